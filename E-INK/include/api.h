@@ -1,27 +1,131 @@
 #pragma once
 #include <Arduino.h>
 
-// ---------------- MTA (storage lives in main.cpp) ----------------
-extern char northTrain[5];
-extern int  northMin[5];
-extern char southTrain[5];
-extern int  southMin[5];
-
-// ---------------- Weather (storage lives in main.cpp) -------------
+static const int MAX_ARR = 5;        // arrivals shown per direction
 static const int WEATHER_MAX = 72;   // ~3 days hourly
 
-extern int weatherStartIndex;
-extern int weatherCount;           // how many hourly items we got (<=72)
+// ---------------- Snapshots ----------------
+// The fetch task fills these and publishes them whole. The render side keeps
+// its own copy and refreshes it with mtaLatest()/weatherLatest(), so it never
+// sees a half-written update and never waits on the network.
+struct MtaSnapshot {
+  uint32_t seq;              // 0 = nothing fetched yet
+  uint32_t fetchedAt;        // unix time of the fetch, 0 if the clock was not set yet
+  bool     restored;         // loaded from flash at boot, not fetched this session
+  char northTrain[MAX_ARR];
+  int  northMin[MAX_ARR];    // minutes as of the fetch
+  char southTrain[MAX_ARR];
+  int  southMin[MAX_ARR];
+  uint32_t northAt[MAX_ARR]; // unix time of arrival, 0 = only the minutes are known
+  uint32_t southAt[MAX_ARR];
+};
+
+// Hourly forecast stored as a structure of arrays, ~4 bytes per hour instead
+// of 16. Read and write it through the accessors; the raw fields are the
+// same encoding the binary wire format uses.
+struct WeatherSeries {
+  static const uint8_t NO_CODE = 0xFF;
+
+  int8_t   temp[WEATHER_MAX];                  // rounded F
+  uint16_t prec[WEATHER_MAX];                  // hundredths of an inch
+  uint8_t  code[WEATHER_MAX];                  // weather_code, NO_CODE = no data
+  uint8_t  dayBits[(WEATHER_MAX + 7) / 8];     // bit i = is_day of hour i
+
+  int   tempF(int i) const       { return temp[i]; }
+  float precIn(int i) const      { return prec[i] / 100.0f; }
+  int   weatherCode(int i) const { return code[i] == NO_CODE ? -1 : code[i]; }
+  int   isDay(int i) const       { return (dayBits[i >> 3] >> (i & 7)) & 1; }
 
-extern int wTemp[WEATHER_MAX];     // rounded F
-extern float wPrec[WEATHER_MAX];     // inches
-extern int wCode[WEATHER_MAX];     // weather_code
-extern int wDay[WEATHER_MAX];      // 0/1 is_day
+  void set(int i, int tempF, float precIn, int weatherCode, int day) {
+    long hundredths = lroundf(precIn * 100.0f);
+    temp[i] = (int8_t)(tempF < -128 ? -128 : tempF > 127 ? 127 : tempF);
+    prec[i] = (uint16_t)(hundredths < 0 ? 0 : hundredths > 65535 ? 65535 : hundredths);
+    code[i] = (weatherCode < 0 || weatherCode >= NO_CODE) ? NO_CODE : (uint8_t)weatherCode;
+    if (day) dayBits[i >> 3] |= (uint8_t)(1 << (i & 7));
+    else     dayBits[i >> 3] &= (uint8_t)~(1 << (i & 7));
+  }
+
+  // Every hour back to "no data"
+  void clear() {
+    memset(temp, 0, sizeof(temp));
+    memset(prec, 0, sizeof(prec));
+    memset(code, NO_CODE, sizeof(code));
+    memset(dayBits, 0, sizeof(dayBits));
+  }
+};
+
+struct WeatherSnapshot {
+  uint32_t seq;              // 0 = nothing fetched yet
+  uint32_t fetchedAt;        // unix time of the fetch, 0 if the clock was not set yet
+  bool     restored;         // loaded from flash at boot, not fetched this session
+  int   startIndex;
+  int   count;               // how many hourly items we got (<=WEATHER_MAX)
+  WeatherSeries hours;
+};
 
 // ---------------- URLs live in main.cpp ----------------
 extern const char* MTA_URL;
 extern const char* WEATHER_URL;
+extern const char* BUNDLE_URL;       // both feeds in one request when both are due
+extern const char* MTA_STREAM_URL;   // "" = poll MTA_URL only (see "Push stream" in api.cpp)
+
+// ---------------- Fetch task ----------------
+enum : uint8_t {
+  FEED_MTA     = 1 << 0,
+  FEED_WEATHER = 1 << 1
+};
+
+bool snapshotsRestore();            // publish the last saved snapshots; safe before Wi-Fi
+void fetchTaskStart();              // once Wi-Fi is up; runs on core 0
+void fetchRequest(uint8_t feeds);   // FEED_* bits, returns immediately; fresh feeds are skipped
+
+// Per-feed cache counters (TTLs: MTA_TTL_MS, WEATHER_TTL_MS in api.cpp)
+struct CacheStats {
+  uint32_t hits;     // requests answered by a snapshot still inside its TTL
+  uint32_t misses;   // requests that found it stale and asked for a refresh
+};
+CacheStats cacheStats(uint8_t feed);  // FEED_MTA or FEED_WEATHER
+
+enum FetchResult : uint8_t {
+  FETCH_FAILED,        // nothing published (offline, HTTP error, bad body)
+  FETCH_UPDATED,       // new snapshot published
+  FETCH_NOT_MODIFIED   // 304: last snapshot still current, nothing to redraw
+};
+
+// Copy the latest published snapshot into `dst` if it is newer than dst.seq.
+// Returns true when `dst` changed (i.e. the screen needs a redraw).
+bool mtaLatest(MtaSnapshot& dst);
+bool weatherLatest(WeatherSnapshot& dst);
+
+uint32_t fetchBytesSaved();   // body bytes skipped thanks to 304 responses
+
+// Both feeds share one kept-alive connection per host (see api.cpp)
+struct ConnStats {
+  uint32_t opened;             // requests that needed a new TCP + TLS handshake
+  uint32_t reused;             // requests sent on an already open connection
+  uint32_t dnsCached;          // new connections that skipped DNS (RTC/NVS address cache)
+  uint32_t handshakeUsTotal;   // sum of TCP + TLS connect time over `opened`
+  uint32_t lastHandshakeUs;
+};
+ConnStats connStats();
+
+// ---------------- Flight recorder ----------------
+// One record per fetch, kept in a fixed ring in api.cpp (serial command 'F')
+struct FetchRecord {
+  uint32_t atMs;         // millis() when the fetch started
+  uint8_t  feed;         // FEED_MTA, FEED_WEATHER, or both for a bundle
+  uint8_t  result;       // FetchResult
+  bool     reused;       // sent on an already open connection
+  int16_t  status;       // HTTP status, or negative HTTPClient error
+  uint32_t dnsUs;        // 0 when reused or the cached address was used
+  uint32_t connectUs;    // TCP + TLS (one call in WiFiClientSecure)
+  uint32_t ttfbUs;       // request sent until headers parsed
+  uint32_t downloadUs;   // time spent waiting in body reads
+  uint32_t parseUs;      // decode time minus download time
+  uint32_t bytes;        // body bytes handed to the decoder
+  uint32_t heapBefore;
+  uint32_t heapAfter;
+};
 
-// ---------------- API functions ----------------
-bool mtaFetch();
-bool weatherFetch();
\ No newline at end of file
+size_t fetchRecords(FetchRecord* out, size_t max);  // oldest first, returns count
+void fetchRecorderDump(Print& out);
@@ -0,0 +1,203 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <GxEPD2_EPD.h>
+#include "packed_bitmap.h"
+
+#ifndef EPD_RENDER_AHEAD
+#define EPD_RENDER_AHEAD 1   // -D EPD_RENDER_AHEAD=0 drops the back buffer (48 KB)
+#endif
+
+#ifndef EPD_PAGE_ROWS
+#define EPD_PAGE_ROWS 0      // -D EPD_PAGE_ROWS=60 (or 120) keeps only that many rows in RAM
+#endif
+
+// Ghosting budget, see cleanupDue()
+#ifndef EPD_GHOST_PARTIALS
+#define EPD_GHOST_PARTIALS 20   // partial refreshes one region takes between full ones
+#endif
+#ifndef EPD_GHOST_MINUTES
+#define EPD_GHOST_MINUTES 30    // age of the last full refresh once partials followed it
+#endif
+
+// Whole-screen frame in RAM plus a shadow of what the panel currently shows.
+// Screens draw their full picture with the usual Adafruit GFX calls and then
+// call update(): the frame is diffed against the shadow, only the changed
+// byte-aligned rectangles go over SPI, and nothing is refreshed at all when
+// the picture did not change. Bit layout is the controller's (MSB = left
+// pixel, 1 = white), so rows are written straight from the frame.
+//
+// Paged (pageRows < panel height, see EPD_PAGE_ROWS): the frame holds one
+// band of rows and every picture is drawn once per band through drawPaged()
+// or firstPage()/nextPage(). Drawing is clipped to the current band, which
+// starts white; each band is diffed against the shadow and sent before the
+// next one is drawn. The whole-frame buffer (48 KB) and the render-ahead
+// buffer go; the shadow stays, so unchanged pictures are still skipped and
+// partial refreshes still send only what changed.
+class EpdFrame : public GFXcanvas1 {
+ public:
+  struct Rect {
+    int16_t x, y, w, h;   // x and w are multiples of 8
+  };
+
+  struct Stats {
+    uint32_t full;        // full refreshes
+    uint32_t partial;     // partial refreshes
+    uint32_t skipped;     // update() calls that found nothing to send
+    uint32_t rects;       // rectangles written by partial refreshes
+    uint32_t bytes;       // frame bytes sent to the controller
+    uint32_t ahead;       // pictures drawn ahead during a refresh
+    uint32_t aheadUsed;   // ... and later swapped in by takeAhead()
+    uint32_t cleanups;    // full refreshes made while cleanupDue()
+  };
+
+  static const int MAX_RECTS = 8;   // per update; more are merged (see epd_frame.cpp)
+
+  // Regions the ghosting budget is kept for, 100x120 px on the 800x480 panel
+  static const int GHOST_COLS = 8;
+  static const int GHOST_ROWS = 4;
+
+  // pageRows 0 (or the panel height) keeps the whole frame in RAM
+  explicit EpdFrame(GxEPD2_EPD& panel, uint16_t pageRows = EPD_PAGE_ROWS);
+  ~EpdFrame();
+
+  // Bytes of `rows` frame rows on a panel `w` pixels wide: the frame takes
+  // bandBytes(w, pageRows), the shadow bandBytes(w, panel height)
+  static constexpr size_t bandBytes(int16_t w, int16_t rows) { return (size_t)(w + 7) / 8 * rows; }
+
+  // Caller-owned storage for the frame and the shadow, sized as above; call
+  // before begin(). Static arrays turn a shortage of RAM into a link error
+  // instead of a blank screen.
+  void setBuffers(uint8_t* frame, uint8_t* shadow);
+
+  // Init the panel and allocate whatever setBuffers() did not provide: the
+  // frame and its shadow (2 x 48 KB on the 800x480 panel, or one band +
+  // 48 KB paged) and the render-ahead buffer. The first update after this
+  // is always a full refresh.
+  bool begin(uint32_t serialDiagBitrate = 0);
+
+  // Draw a picture and send it, the same way paged or not:
+  //   f.firstPage(full); do { draw(f); } while (f.nextPage());
+  // or f.drawPaged(fn, arg, full). The draw must cover the whole picture
+  // (it runs once per band), and nextPage() refreshes after the last band:
+  // full = full waveform, otherwise partial, skipped when nothing changed.
+  // A frame that is not paged runs the draw once over the frame as it is.
+  typedef void (*RenderFn)(EpdFrame& f, int arg);
+  void firstPage(bool full = false);
+  bool nextPage();
+  void drawPaged(RenderFn fn, int arg, bool full = false);
+  bool paged() const { return pageRows < HEIGHT; }
+
+  // Whole frame only (nothing is sent when paged): send what changed since
+  // the last refresh with the partial waveform. Returns the number of
+  // rectangles written, 0 if the refresh was skipped.
+  int update();
+
+  // Send the whole frame with the full waveform (slower, clears ghosting)
+  void updateFull();
+
+  // Changed rectangles of the current band (the whole frame when not paged)
+  // without sending anything, at most MAX_RECTS
+  int diff(Rect* out);
+
+  const Stats& stats() const { return counters; }
+  // Stats, then the partial refreshes each region took since the last full one
+  void printStats(Print& out) const;
+
+  // Ghosting policy: every partial refresh counts once against each region
+  // its rectangles touch, and a full refresh clears the counts. The panel is
+  // due a full refresh once a region has taken EPD_GHOST_PARTIALS, or once
+  // the last full refresh is EPD_GHOST_MINUTES old and partials followed it.
+  // Callers pick the moment (see showScreen() in main.cpp); nothing here
+  // turns a partial refresh into a full one.
+  bool cleanupDue() const;
+  uint16_t ghostCount(int col, int row) const { return ghost[row * GHOST_COLS + col]; }
+  uint32_t idleMs() const { return millis() - lastRefreshMs; }   // since the last refresh
+
+  // Render-ahead: renderAhead() queues a draw into the back buffer that runs
+  // from the panel's busy callback during the next refresh, while the CPU
+  // would otherwise spin in delay(1). takeAhead() with the same fn and arg
+  // then swaps that picture in as the frame instead of drawing it again.
+  // Without a back buffer (or paged) nothing is queued and takeAhead()
+  // returns false.
+  void renderAhead(RenderFn fn, int arg);
+  // true = the frame now holds what fn(arg) drew; the back buffer is spent
+  // either way
+  bool takeAhead(RenderFn fn, int arg);
+
+  // 1bpp bitmaps are copied a byte per 8 pixels (shifted when x is not a
+  // multiple of 8) instead of one drawPixel per pixel. Other rotations go
+  // through Adafruit_GFX as before.
+  using Adafruit_GFX::drawBitmap;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                  uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg);
+
+  // Run-length packed bitmaps (packed_bitmap.h) are decoded a row at a time
+  // straight into the frame. Without bg they are drawn transparently and
+  // rows with no ink are skipped without touching the frame.
+  void drawPacked(int16_t x, int16_t y, const PackedBitmap& bmp, uint16_t color);
+  void drawPacked(int16_t x, int16_t y, const PackedBitmap& bmp, uint16_t color, uint16_t bg);
+
+  // Rectangles fill row spans: masked edge bytes and a memset in between
+  // (Adafruit_GFX fills them column by column). Horizontal lines are
+  // one-row rectangles; vertical lines and fillScreen are GFXcanvas1's.
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+
+  // GFXcanvas1's own, clipped to the band when paged (getPixel() is not
+  // virtual and only reads the current band)
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+
+  // GFXfont text goes a glyph row at a time through the same blit, scaled
+  // rows included (setTextSize). The built-in 5x7 font and rotated frames
+  // use Adafruit_GFX.
+  using Print::write;
+  size_t write(uint8_t c) override;
+
+ private:
+  int rowBytes() const { return (WIDTH + 7) / 8; }
+  size_t frameBytes() const { return (size_t)rowBytes() * HEIGHT; }
+  // Frame row y (panel coordinates, inside the current band)
+  uint8_t* row(int y) const { return buffer + (size_t)(y - pageTop) * rowBytes(); }
+  void setPage(int16_t top);
+  void sendPage();
+  uint32_t regionsOf(const Rect& r) const;   // bit per GHOST_COLS x GHOST_ROWS region
+  void countPartial(uint32_t regions);
+  void countFull();
+  // stride = bytes per source row; 0 repeats the first row h times
+  bool blit(int16_t x, int16_t y, const uint8_t* src, int stride, int16_t w, int16_t h,
+            uint16_t color, uint16_t bg, bool opaque);
+  void drawGlyph(int16_t x, int16_t y, uint8_t c, uint16_t color, uint8_t sx, uint8_t sy);
+  void unpack(int16_t x, int16_t y, const PackedBitmap& bmp, uint16_t color, uint16_t bg,
+              bool opaque);
+  static void onBusy(const void* self);
+
+  GxEPD2_EPD& panel;
+  const int16_t pageRows;     // rows held in `buffer`
+  int16_t pageTop = 0;        // current band: rows pageTop .. pageEnd - 1
+  int16_t pageEnd;
+  bool pageFull = false;      // firstPage(full) in progress
+  bool pageAgain = false;     // second pass (the controller's writeImage*Again)
+  int16_t sentX0 = 0, sentY0 = 0, sentX1 = 0, sentY1 = 0;   // what the bands sent
+  int pageRects = 0;
+  uint32_t pageRegions = 0;   // regions the bands' rectangles touched
+  uint16_t ghost[GHOST_COLS * GHOST_ROWS] = {};
+  uint32_t lastFullMs = 0;
+  uint32_t lastRefreshMs = 0;
+  uint8_t* shadow = nullptr;
+  bool shadowValid = false;   // false until the first full refresh
+  uint8_t* back = nullptr;    // render-ahead buffer
+  RenderFn aheadFn = nullptr; // queued or drawn into `back`
+  int aheadArg = 0;
+  bool aheadDrawn = false;
+  Stats counters = {};
+  // What begin() took from the heap. Render-ahead swaps `buffer` and `back`,
+  // so these, not the working pointers, are what the destructor frees.
+  uint8_t* frameAlloc = nullptr;
+  uint8_t* shadowAlloc = nullptr;
+  uint8_t* backAlloc = nullptr;
+};
@@ -0,0 +1,32 @@
+// Generated by scripts/pack_icons.py from assets/icons.json. Do not edit.
+#pragma once
+#include "packed_bitmap.h"
+
+// Weather icon sizes, square
+enum IconSize : uint8_t {
+  ICON_SIZE_200,
+  ICON_SIZE_160,
+  ICON_SIZE_48,
+  ICON_SIZES
+};
+
+// Weather categories; WMO codes no category lists are WX_UNKNOWN
+enum IconCategory : uint8_t {
+  WX_UNKNOWN,
+  WX_CLEAR,
+  WX_CLOUDY,
+  WX_FOG,
+  WX_RAIN,
+  WX_SNOW,
+  WX_THUNDER,
+  WX_CATEGORIES
+};
+
+// [size][category][is_day]
+extern const PackedBitmap* const WEATHER_ICONS[ICON_SIZES][WX_CATEGORIES][2];
+
+// WMO weather code -> IconCategory
+extern const uint8_t WMO_CATEGORY[100];
+
+extern const PackedBitmap train_north;   // 160x160
+extern const PackedBitmap train_south;   // 160x160
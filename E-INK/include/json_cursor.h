@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+
+// Pull parser over a Stream for the generated payload decoders
+// (payload_gen.cpp). It reads every byte once and builds no document:
+// containers are walked with nextKey()/nextElement(), scalars are read in
+// place and everything else is skipped.
+class JsonCursor {
+ public:
+  explicit JsonCursor(Stream& src) : src(src) {}
+
+  // Enter a container. Any other value is skipped and false is returned.
+  bool beginObject();
+  bool beginArray();
+
+  // Advance to the next member/element; false once the container closes.
+  // Keys longer than cap - 1 are truncated, len is always the full length.
+  bool nextKey(char* key, size_t cap, size_t& len);
+  bool nextElement();
+
+  // Each reader consumes one value. A null or a value of another type is
+  // skipped and leaves `out` untouched, so defaults survive.
+  void readInt(int& out);
+  void readUint32(uint32_t& out);
+  void readFloat(float& out);
+  void readChar(char& out);   // first character of a string
+  void skipValue();
+
+  bool failed() const { return error; }
+
+ private:
+  int peekByte();
+  int getByte();
+  bool fill();
+  void skipSpace();
+  bool readNumber(char* buf, size_t cap);
+  size_t readString(char* out, size_t cap);  // after the opening quote
+
+  Stream& src;
+  uint8_t buf[64];
+  uint8_t pos = 0;
+  uint8_t end = 0;
+  bool error = false;
+};
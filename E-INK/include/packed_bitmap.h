@@ -0,0 +1,20 @@
+#pragma once
+#include <Arduino.h>
+
+// 1bpp bitmap stored run-length coded. Unpacked it is rows of (w + 7) / 8
+// bytes, MSB = left pixel, 1 = ink (what drawBitmap takes). The rows are
+// packed as one stream, so runs carry on across row ends:
+//
+//   0nnnnnnn               n + 1 literal bytes follow (1..128)
+//   10nnnnnn nnnnnnnn      n + 1 bytes of 0x00, no ink (1..16384)
+//   11nnnnnn v             n + 1 copies of byte v (1..64)
+//
+// Written by scripts/pack_icons.py, drawn by EpdFrame::drawPacked().
+struct PackedBitmap {
+  uint16_t w, h;
+  const uint8_t* data;
+};
+
+static const uint8_t PACK_LITERAL = 0x00;
+static const uint8_t PACK_ZERO    = 0x80;
+static const uint8_t PACK_REPEAT  = 0xC0;
@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+#include "payload_gen.h"
+
+// The same payloads as payload_gen.h, parsed into ArduinoJson documents
+// (payload_dom.cpp). The firmware only uses these when built with
+// -D PAYLOAD_DOM_DECODER; they are the baseline the generated decoders are
+// benchmarked against (test/native/test_payload_bench). Unlike those, they
+// allocate from the heap on every parse.
+bool decodeMtaPayloadDom(Stream& in, MtaPayload& out);
+bool decodeWeatherPayloadDom(Stream& in, WeatherPayload& out);  // set out.hourly first
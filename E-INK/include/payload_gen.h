@@ -0,0 +1,36 @@
+// Generated by scripts/gen_payloads.py from schema/payloads.json. Do not edit.
+#pragma once
+#include "json_cursor.h"
+
+// One upcoming train
+struct MtaArrival {
+  char train;
+  int minutes;
+  uint32_t at;
+};
+
+// GET /api/mta
+struct MtaPayload {
+  MtaArrival north[5];
+  uint8_t northCount;
+  MtaArrival south[5];
+  uint8_t southCount;
+};
+
+// One hourly forecast entry
+struct WeatherHour {
+  int temp;
+  float prec;
+  int code;
+  int day;
+};
+
+// GET /api/weather
+struct WeatherPayload {
+  int startIndex;
+  void (*hourly)(int index, const WeatherHour& item);  // set before decoding; called per element
+  uint8_t hourlyCount;
+};
+
+bool decodeMtaPayload(JsonCursor& in, MtaPayload& out);
+bool decodeWeatherPayload(JsonCursor& in, WeatherPayload& out);
@@ -0,0 +1,172 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "api.h"
+#include "epd_frame.h"
+#include "packed_bitmap.h"
+
+// Retained widgets for the screens in main.cpp. A screen is a fixed list of
+// widgets; each one has the box it draws in and a hash of what it shows.
+// WidgetScreen::render() polls every widget, and only boxes whose hash
+// changed are cleared and drawn again, together with the widgets overlapping
+// them (in list order, so later ones still paint over earlier ones), and
+// EpdFrame::update() finds just those bytes. Widgets must not draw outside
+// their bounds.
+struct Bounds {
+  int16_t x, y, w, h;
+
+  bool intersects(const Bounds& o) const {
+    return x < o.x + o.w && o.x < x + w && y < o.y + o.h && o.y < y + h;
+  }
+};
+
+class Widget {
+ public:
+  explicit Widget(const Bounds& bounds) : bounds(bounds) {}
+  virtual ~Widget() {}
+
+  // Re-read the data behind the widget; returns a hash of what draw() will show
+  virtual uint32_t poll() = 0;
+  virtual void draw(EpdFrame& f) = 0;
+
+  const Bounds bounds;
+  uint32_t shown = 0;   // poll() hash of what the frame holds now
+};
+
+// ---------------- Label ----------------
+// Text at a cursor (baseline, like setCursor). A bound label fills `out` on
+// every poll; it may move the cursor as long as the text stays inside bounds.
+struct LabelText {
+  char text[24];
+  int16_t x, y;   // preset to the label's own cursor
+};
+typedef void (*LabelFn)(LabelText& out, int arg);
+
+class Label : public Widget {
+ public:
+  Label(const Bounds& b, int16_t x, int16_t y, const GFXfont* font, const char* text,
+        uint8_t size = 1);
+  Label(const Bounds& b, int16_t x, int16_t y, const GFXfont* font, LabelFn fn, int arg = 0,
+        uint8_t size = 1);
+
+  uint32_t poll() override;
+  void draw(EpdFrame& f) override;
+
+ private:
+  const int16_t x, y;
+  const GFXfont* font;
+  const char* fixed;
+  LabelFn fn;
+  int arg;
+  uint8_t size;
+  LabelText now;
+};
+
+// ---------------- Icon ----------------
+// Packed bitmap the size of the bounds, black on white, optionally framed.
+// nullptr draws nothing (the frame only). Unframed icons are drawn
+// transparently, skipping their white rows: render() only draws them over
+// a cleared box or over the same icon.
+typedef const PackedBitmap* (*IconFn)(int arg);
+
+class Icon : public Widget {
+ public:
+  Icon(const Bounds& b, const PackedBitmap* bitmap, bool framed = false);
+  Icon(const Bounds& b, IconFn fn, int arg = 0, bool framed = false);
+
+  uint32_t poll() override;
+  void draw(EpdFrame& f) override;
+
+ private:
+  const PackedBitmap* fixed;
+  IconFn fn;
+  int arg;
+  bool framed;
+  const PackedBitmap* now = nullptr;
+};
+
+// ---------------- Rule ----------------
+// Horizontal or vertical line; never changes, redrawn only when something
+// overlapping it is
+class Rule : public Widget {
+ public:
+  Rule(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+  uint32_t poll() override { return 1; }
+  void draw(EpdFrame& f) override;
+};
+
+// ---------------- DotTrack ----------------
+// One direction of the MTA screen: station marker, track and MAX_ARR dots
+// with the train letter above and the minutes below each
+typedef void (*ArrivalsFn)(bool isNorth, char* train, int* minutes);
+
+class DotTrack : public Widget {
+ public:
+  DotTrack(int16_t x, int16_t routeY, const int* dotX, bool isNorth, ArrivalsFn arrivals,
+           const GFXfont* font);
+
+  uint32_t poll() override;
+  void draw(EpdFrame& f) override;
+
+ private:
+  const int16_t x, routeY;
+  const int* dotX;
+  bool isNorth;
+  ArrivalsFn arrivals;
+  const GFXfont* font;
+  char train[MAX_ARR];
+  int minutes[MAX_ARR];
+};
+
+// ---------------- WeatherTile ----------------
+// 120x120 box with the hour label, a 48px icon and "temp F precip in" for
+// hour firstHour() + 4 * slot of `wx`. Out-of-range hours leave it blank.
+typedef int (*HourFn)();
+
+class WeatherTile : public Widget {
+ public:
+  WeatherTile(int16_t x, int16_t y, uint8_t slot, const WeatherSnapshot& wx, HourFn firstHour,
+              const GFXfont* font);
+
+  uint32_t poll() override;
+  void draw(EpdFrame& f) override;
+
+ private:
+  const int16_t x, y;
+  uint8_t slot;
+  const WeatherSnapshot& wx;
+  HourFn firstHour;
+  const GFXfont* font;
+  int hour = -1;   // as of the last poll
+};
+
+// ---------------- WidgetScreen ----------------
+class WidgetScreen {
+ public:
+  static const int MAX_WIDGETS = 32;   // one bit each in render()
+
+  WidgetScreen(Widget* const* widgets, uint8_t count)
+      : widgets(widgets), count(count < MAX_WIDGETS ? count : MAX_WIDGETS) {}
+
+  // full = clear the frame and draw every widget (after another screen was
+  // on it). Otherwise redraw what changed; false when nothing did.
+  bool render(EpdFrame& f, bool full);
+
+  // Redraw what changed and send it with a partial refresh; false when
+  // nothing did. A paged frame gets the whole screen drawn once per band.
+  bool update(EpdFrame& f);
+
+  // The two halves of render(f, true), for pictures drawn once per band:
+  // poll once, then draw the same data into every band
+  void pollAll() { poll(true); }
+  // Clear the frame and draw every widget as last polled
+  void drawAll(EpdFrame& f);
+
+ private:
+  // Re-poll every widget; bit i set = widget i changed (all of them if full)
+  uint32_t poll(bool full);
+
+  Widget* const* widgets;
+  uint8_t count;
+};
@@ -0,0 +1,178 @@
+"""Generate typed payload decoders from schema/payloads.json.
+
+Runs as a PlatformIO pre-script (see platformio.ini) and can also be run
+by hand:  python scripts/gen_payloads.py
+
+Every schema entry becomes a plain struct. Entries with a "decoder" name
+also get a public single-pass decoder on top of JsonCursor. Keys are
+dispatched with a switch on (length, one character), a perfect hash picked
+here per struct, and confirmed with one memcmp.
+
+Field specs:
+  {"type": "int" | "uint32" | "float" | "char", "default": ...}
+  {"array": "<Entry>", "max": N}                  stored inline, plus <name>Count
+  {"array": "<Entry>", "max": N, "stream": true}  handed to a callback per element
+"""
+
+import json
+import os
+import sys
+
+CPP_TYPES = {"int": "int", "uint32": "uint32_t", "float": "float", "char": "char"}
+READERS = {"int": "readInt", "uint32": "readUint32", "float": "readFloat", "char": "readChar"}
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821 (provided by PlatformIO/SCons)
+        return env.subst("$PROJECT_DIR")  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+
+def literal(kind, value):
+    if kind == "char":
+        return "'%s'" % value
+    if kind == "float":
+        return "%sf" % float(value)
+    if kind == "uint32":
+        return "%du" % int(value)
+    return str(int(value))
+
+
+def count_type(n):
+    return "uint8_t" if n < 256 else "uint16_t"
+
+
+def perfect_hash(keys):
+    """Smallest index i such that (len, key[i]) is unique for every key."""
+    shortest = min(len(k) for k in keys)
+    for i in range(shortest):
+        seen = {(len(k), k[i]) for k in keys}
+        if len(seen) == len(keys):
+            return i
+    raise SystemExit("gen_payloads: no (length, char) hash for keys %s" % keys)
+
+
+def emit_struct(name, spec, out):
+    out.append("// %s" % spec.get("doc", name))
+    out.append("struct %s {" % name)
+    for field, f in spec["fields"].items():
+        if "array" in f:
+            if f.get("stream"):
+                out.append("  void (*%s)(int index, const %s& item);  // set before decoding; called per element"
+                           % (field, f["array"]))
+                out.append("  %s %sCount;" % (count_type(f["max"]), field))
+            else:
+                out.append("  %s %s[%d];" % (f["array"], field, f["max"]))
+                out.append("  %s %sCount;" % (count_type(f["max"]), field))
+        else:
+            out.append("  %s %s;" % (CPP_TYPES[f["type"]], field))
+    out.append("};")
+    out.append("")
+
+
+def emit_field(field, f, out):
+    if "array" not in f:
+        out.append("          in.%s(out.%s);" % (READERS[f["type"]], field))
+        return
+
+    item, cap = f["array"], f["max"]
+    out.append("          out.%sCount = 0;" % field)
+    out.append("          if (in.beginArray()) {")
+    if f.get("stream"):
+        out.append("            %s item;" % item)
+        out.append("            while (in.nextElement()) {")
+        out.append("              if (out.%sCount >= %d) { in.skipValue(); continue; }" % (field, cap))
+        out.append("              decode%s(in, item);" % item)
+        out.append("              if (out.%s) out.%s(out.%sCount, item);" % (field, field, field))
+        out.append("              out.%sCount++;" % field)
+        out.append("            }")
+    else:
+        out.append("            while (in.nextElement()) {")
+        out.append("              if (out.%sCount >= %d) { in.skipValue(); continue; }" % (field, cap))
+        out.append("              decode%s(in, out.%s[out.%sCount++]);" % (item, field, field))
+        out.append("            }")
+    out.append("          }")
+
+
+def emit_decoder(name, spec, public, out):
+    fields = spec["fields"]
+    keys = list(fields)
+    probe = perfect_hash(keys)
+    keycap = max(len(k) for k in keys) + 1
+
+    sig = "bool %s(JsonCursor& in, %s& out)" % (spec["decoder"] if public else "decode" + name, name)
+    out.append(sig + " {" if public else "static " + sig + " {")
+    for field, f in fields.items():
+        if "array" in f:
+            out.append("  out.%sCount = 0;" % field)
+        else:
+            out.append("  out.%s = %s;" % (field, literal(f["type"], f["default"])))
+    out.append("  if (!in.beginObject()) return false;")
+    out.append("")
+    out.append("  char key[%d];" % keycap)
+    out.append("  size_t len;")
+    out.append("  while (in.nextKey(key, sizeof(key), len)) {")
+    out.append("    switch (PAYLOAD_KEY(len, key[%d])) {" % probe)
+    for field, f in fields.items():
+        out.append("      case PAYLOAD_KEY(%d, '%s'):" % (len(field), field[probe]))
+        out.append("        if (memcmp(key, \"%s\", %d) == 0) {" % (field, len(field)))
+        emit_field(field, f, out)
+        out.append("          continue;")
+        out.append("        }")
+        out.append("        break;")
+    out.append("    }")
+    out.append("    in.skipValue();  // not in the schema")
+    out.append("  }")
+    out.append("  return !in.failed();")
+    out.append("}")
+    out.append("")
+
+
+def generate(schema):
+    header = [
+        "// Generated by scripts/gen_payloads.py from schema/payloads.json. Do not edit.",
+        "#pragma once",
+        "#include \"json_cursor.h\"",
+        "",
+    ]
+    source = [
+        "// Generated by scripts/gen_payloads.py from schema/payloads.json. Do not edit.",
+        "#include \"payload_gen.h\"",
+        "",
+        "// (key length, probe character) -> case label; unique per struct by construction",
+        "#define PAYLOAD_KEY(len, c) (((uint32_t)(len) << 8) | (uint8_t)(c))",
+        "",
+    ]
+
+    # Element decoders first so the public ones can call them
+    for name, spec in schema.items():
+        emit_struct(name, spec, header)
+        if "decoder" not in spec:
+            emit_decoder(name, spec, False, source)
+    for name, spec in schema.items():
+        if "decoder" in spec:
+            header.append("bool %s(JsonCursor& in, %s& out);" % (spec["decoder"], name))
+            emit_decoder(name, spec, True, source)
+
+    return "\n".join(header) + "\n", "\n".join(source).rstrip("\n") + "\n"
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, "w", newline="\n") as f:
+        f.write(text)
+    print("gen_payloads: wrote %s" % os.path.relpath(path))
+
+
+root = project_dir()
+with open(os.path.join(root, "schema", "payloads.json")) as f:
+    schema = json.load(f)
+
+h, cpp = generate(schema)
+write_if_changed(os.path.join(root, "include", "payload_gen.h"), h)
+write_if_changed(os.path.join(root, "src", "payload_gen.cpp"), cpp)
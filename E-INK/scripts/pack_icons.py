@@ -0,0 +1,296 @@
+"""Build the icons in assets/icons.json into include/icon_gen.h + src/icon_gen.cpp.
+
+Runs as a PlatformIO pre-script (see platformio.ini) and can also be run
+by hand:  python scripts/pack_icons.py
+
+Source images are 1-bit PBM files (P4 or P1) in assets/icons/, named
+<base>_<size>.pbm for weather icons and <name>.pbm for the extras. Any
+editor exports them, e.g.  magick sun.png -monochrome assets/icons/sun_200.pbm
+
+The icons are mostly white, so each one is stored run-length coded in the
+format described in include/packed_bitmap.h: white runs, repeated bytes
+and literal stretches, over all rows as one stream.
+
+Manifest:
+  "sizes":      square weather icon sizes, in px
+  "categories": [{"name", "day", "night", "codes"}], "day"/"night" are file
+                bases; "codes" lists WMO weather codes (numbers or "a-b").
+                The first category takes every code no other one lists.
+  "extra":      other icons, exported by name
+
+Besides the bitmaps it writes WEATHER_ICONS[size][category][is_day] and
+WMO_CATEGORY[code], so picking an icon is two table loads (see icon.h). The
+bitmaps and tables are constexpr: the compiler fills them in, so they sit
+in flash and nothing runs at startup to set them up. icon_gen.h declares
+the tables extern const, and their definitions keep that linkage.
+"""
+
+import json
+import os
+import sys
+
+WMO_CODES = 100
+
+MAX_LITERAL = 128
+MAX_ZERO = 16384
+MAX_REPEAT = 64
+MIN_REPEAT = 3    # shorter repeats stay in the literal stretch
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821 (provided by PlatformIO/SCons)
+        return env.subst("$PROJECT_DIR")  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+
+def fail(msg):
+    raise SystemExit("pack_icons: " + msg)
+
+
+def pbm_tokens(data, i, count):
+    """`count` whitespace separated header fields from offset i; # starts a comment."""
+    out = []
+    while len(out) < count:
+        while i < len(data) and data[i:i + 1].isspace():
+            i += 1
+        if data[i:i + 1] == b"#":
+            while i < len(data) and data[i:i + 1] not in (b"\n", b"\r"):
+                i += 1
+            continue
+        start = i
+        while i < len(data) and not data[i:i + 1].isspace():
+            i += 1
+        if start == i:
+            break
+        out.append(data[start:i])
+    return out, i
+
+
+def read_pbm(path):
+    """(w, h, rows of (w + 7) // 8 bytes, MSB = left pixel, 1 = ink)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, i = pbm_tokens(data, 0, 3)
+    if len(fields) != 3 or fields[0] not in (b"P1", b"P4"):
+        fail("%s is not a 1-bit PBM (P1/P4)" % path)
+    w, h = int(fields[1]), int(fields[2])
+    stride = (w + 7) // 8
+
+    if fields[0] == b"P4":
+        bits = data[i + 1:i + 1 + stride * h]   # one whitespace byte, then the raster
+        if len(bits) != stride * h:
+            fail("%s is short: %d of %d bytes" % (path, len(bits), stride * h))
+        return w, h, bytes(bits)
+
+    pixels = [c for c in data[i:].decode("ascii") if c in "01"]
+    if len(pixels) < w * h:
+        fail("%s is short: %d of %d pixels" % (path, len(pixels), w * h))
+    out = bytearray(stride * h)
+    for y in range(h):
+        for x in range(w):
+            if pixels[y * w + x] == "1":
+                out[y * stride + x // 8] |= 0x80 >> (x % 8)
+    return w, h, bytes(out)
+
+
+def code_list(spec, name):
+    codes = []
+    for c in spec:
+        if isinstance(c, int):
+            codes.append(c)
+        else:
+            lo, _, hi = str(c).partition("-")
+            codes.extend(range(int(lo), int(hi or lo) + 1))
+    for c in codes:
+        if not 0 <= c < WMO_CODES:
+            fail("category %s: code %d is not a WMO code (0..%d)" % (name, c, WMO_CODES - 1))
+    return codes
+
+
+def run_length(data, i, value, cap):
+    n = 0
+    while i + n < len(data) and n < cap and data[i + n] == value:
+        n += 1
+    return n
+
+
+def pack(data):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:MAX_LITERAL]
+
+    i = 0
+    while i < len(data):
+        b = data[i]
+        if b == 0:
+            n = run_length(data, i, 0, MAX_ZERO)
+            # Two zeros cost two bytes either way; inside a literal stretch
+            # they also save restarting it
+            if n >= 3 or (n == 2 and not literal):
+                flush()
+                out.append(0x80 | ((n - 1) >> 8))
+                out.append((n - 1) & 0xFF)
+                i += n
+                continue
+        else:
+            n = run_length(data, i, b, MAX_REPEAT)
+            if n >= MIN_REPEAT:
+                flush()
+                out.append(0xC0 | (n - 1))
+                out.append(b)
+                i += n
+                continue
+        literal.append(b)
+        i += 1
+    flush()
+    return bytes(out)
+
+
+def unpack(packed, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        t = packed[i]
+        if t < 0x80:
+            out.extend(packed[i + 1:i + 2 + t])
+            i += 2 + t
+        elif t < 0xC0:
+            out.extend(bytes((((t & 0x3F) << 8) | packed[i + 1]) + 1))
+            i += 2
+        else:
+            out.extend(bytes([packed[i + 1]]) * ((t & 0x3F) + 1))
+            i += 2
+    return bytes(out)
+
+
+def load(root, manifest):
+    """Icons to pack, in table order: [(name, w, h, data, exported)]."""
+    icons = []
+    seen = set()
+
+    def add(name, size, exported):
+        if name in seen:
+            return
+        seen.add(name)
+        w, h, data = read_pbm(os.path.join(root, "assets", "icons", name + ".pbm"))
+        if size and (w, h) != (size, size):
+            fail("%s.pbm is %dx%d, expected %dx%d" % (name, w, h, size, size))
+        icons.append((name, w, h, data, exported))
+
+    for size in manifest["sizes"]:
+        for cat in manifest["categories"]:
+            add("%s_%d" % (cat["day"], size), size, False)
+            add("%s_%d" % (cat["night"], size), size, False)
+    for name in manifest.get("extra", []):
+        add(name, 0, True)
+
+    # Everything in the folder ships, or it goes
+    for f in sorted(os.listdir(os.path.join(root, "assets", "icons"))):
+        if f.endswith(".pbm") and f[:-4] not in seen:
+            fail("assets/icons/%s is not in icons.json; list it or delete it" % f)
+    return icons
+
+
+def category_table(categories):
+    table = [0] * WMO_CODES
+    owner = {}
+    for k, cat in enumerate(categories):
+        for c in code_list(cat.get("codes", []), cat["name"]):
+            if c in owner:
+                fail("code %d is in both %s and %s" % (c, owner[c], cat["name"]))
+            owner[c] = cat["name"]
+            table[c] = k
+    return table
+
+
+def generate(manifest, icons):
+    sizes = manifest["sizes"]
+    categories = manifest["categories"]
+    wmo = category_table(categories)
+
+    h = ["// Generated by scripts/pack_icons.py from assets/icons.json. Do not edit.",
+         "#pragma once",
+         '#include "packed_bitmap.h"',
+         "",
+         "// Weather icon sizes, square",
+         "enum IconSize : uint8_t {"]
+    h += ["  ICON_SIZE_%d," % s for s in sizes]
+    h += ["  ICON_SIZES", "};", "",
+          "// Weather categories; WMO codes no category lists are WX_%s"
+          % categories[0]["name"].upper(),
+          "enum IconCategory : uint8_t {"]
+    for cat in categories:
+        h.append("  WX_%s," % cat["name"].upper())
+    h += ["  WX_CATEGORIES", "};", "",
+          "// [size][category][is_day]",
+          "extern const PackedBitmap* const WEATHER_ICONS[ICON_SIZES][WX_CATEGORIES][2];",
+          "",
+          "// WMO weather code -> IconCategory",
+          "extern const uint8_t WMO_CATEGORY[%d];" % WMO_CODES,
+          ""]
+    for name, w, ht, _, exported in icons:
+        if exported:
+            h.append("extern const PackedBitmap %s;   // %dx%d" % (name, w, ht))
+
+    src = ["// Generated by scripts/pack_icons.py from assets/icons.json. Do not edit.",
+           '#include "icon_gen.h"', ""]
+    raw_total = packed_total = 0
+    for name, w, ht, data, exported in icons:
+        packed = pack(data)
+        if unpack(packed, len(data)) != data:
+            fail("%s does not round-trip" % name)
+        raw_total += len(data)
+        packed_total += len(packed)
+
+        src.append("// %dx%d, %d -> %d bytes" % (w, ht, len(data), len(packed)))
+        src.append("static const uint8_t %s_rle[] PROGMEM = {" % name)
+        for k in range(0, len(packed), 16):
+            src.append("  " + ", ".join("0x%02x" % b for b in packed[k:k + 16]) + ",")
+        src.append("};")
+        src.append("%s constexpr PackedBitmap %s = {%d, %d, %s_rle};"
+                   % ("extern" if exported else "static", name, w, ht, name))
+        src.append("")
+
+    src.append("extern constexpr const PackedBitmap* WEATHER_ICONS[ICON_SIZES][WX_CATEGORIES][2] = {")
+    for size in sizes:
+        src.append("  {  // %d" % size)
+        for cat in categories:
+            src.append("    {&%s_%d, &%s_%d},   // %s: night, day"
+                       % (cat["night"], size, cat["day"], size, cat["name"]))
+        src.append("  },")
+    src += ["};", "", "extern constexpr uint8_t WMO_CATEGORY[%d] = {" % WMO_CODES]
+    for k in range(0, WMO_CODES, 10):
+        src.append("  " + ", ".join(str(c) for c in wmo[k:k + 10]) + ",   // %d-%d" % (k, k + 9))
+    src += ["};", "",
+            "// %d icons: %d bytes packed from %d (%.1f%%)"
+            % (len(icons), packed_total, raw_total, 100.0 * packed_total / raw_total)]
+    return "\n".join(h) + "\n", "\n".join(src) + "\n", raw_total, packed_total
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, "w", newline="\n") as f:
+        f.write(text)
+    print("pack_icons: wrote %s" % os.path.relpath(path))
+
+
+root = project_dir()
+with open(os.path.join(root, "assets", "icons.json")) as f:
+    manifest = json.load(f)
+
+icons = load(root, manifest)
+h, cpp, raw_total, packed_total = generate(manifest, icons)
+write_if_changed(os.path.join(root, "include", "icon_gen.h"), h)
+write_if_changed(os.path.join(root, "src", "icon_gen.cpp"), cpp)
+print("pack_icons: %d icons, %d bytes packed from %d" % (len(icons), packed_total, raw_total))
@@ -1,126 +1,1170 @@
 #include <Arduino.h>
 #include <WiFi.h>
+#include <WiFiClientSecure.h>
 #include <HTTPClient.h>
-#include <ArduinoJson.h>
+#include <Preferences.h>
+#include <atomic>
+#include <sys/time.h>
 #include "api.h"
 
-// Static JSON documents (allocated once at startup, reused forever)
-// Eliminates heap fragmentation from repeated malloc/free cycles
-static StaticJsonDocument<30000> weatherDoc;
+// JSON bodies (proxies that ignore ?fmt=bin) go through the decoders
+// generated from schema/payloads.json. Build with -D PAYLOAD_DOM_DECODER to
+// parse them into ArduinoJson documents instead (payload_dom.cpp).
+#include "payload_gen.h"
+#ifdef PAYLOAD_DOM_DECODER
+#include "payload_dom.h"
+#endif
 
-// -------------------- MTA --------------------
-bool mtaFetch() {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("MTA Not Connected");
-    return false;
+// -------------------- Staging --------------------
+// Decoders write here; only the fetch task touches these. A snapshot is
+// published (see below) once its decoder has returned true.
+static MtaSnapshot     mtaStage;
+static WeatherSnapshot weatherStage;
+
+// -------------------- Binary wire format --------------------
+// Requested with ?fmt=bin and answered as application/octet-stream. All
+// multi-byte fields are little-endian. Layout (version 1):
+//
+//   MTA      "IM" | ver u8 | nNorth u8 | nSouth u8 | (train u8, minutes u16) x (nNorth + nSouth)
+//   MTA v2   "IM" | 2      | nNorth u8 | nSouth u8 | (train u8, at u32)      x (nNorth + nSouth)
+//   Weather  "IW" | ver u8 | count u8 | startIndex u16 |
+//            temp i8[count] | prec u16[count] (0.01 in) | code u8[count] | day bits[(count + 7) / 8]
+//   Bundle   "IB" | ver u8 | nSections u8 | (kind u8, fetchedAt u32, len u16, body[len]) x nSections
+//            kind 'M' / 'W' = one of the bodies above (see "Bundle" below)
+//
+// Bodies are at most a few hundred bytes, so they are read whole into a
+// static buffer and decoded in one pass before any storage is touched.
+static const uint8_t WIRE_VERSION = 1;
+static const uint8_t MTA_WIRE_VERSION_AT = 2;  // entries carry `at` (u32 unix s) instead of minutes
+static const int WIRE_MTA_MAX     = 5 + 2 * 255 * 5;
+static const int WIRE_WEATHER_MAX = 6 + 255 * 4 + 32;
+
+static uint8_t wireBuf[WIRE_MTA_MAX > WIRE_WEATHER_MAX ? WIRE_MTA_MAX : WIRE_WEATHER_MAX];
+
+static const char* HEADER_KEYS[] = {"Content-Type", "ETag", "Transfer-Encoding", "Date"};
+static const size_t HEADER_KEY_COUNT = sizeof(HEADER_KEYS) / sizeof(HEADER_KEYS[0]);
+
+static bool isBinaryBody(HTTPClient& http) {
+  return http.header("Content-Type").startsWith("application/octet-stream");
+}
+
+static bool readExact(Stream& s, uint8_t* dst, size_t n) {
+  return s.readBytes(dst, n) == n;
+}
+
+static uint16_t rd16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// v1 entries carry minutes, v2 entries the absolute arrival time
+static void mtaDecodeEntries(const uint8_t* e, int n, int entry, char* train, int* minutes, uint32_t* at) {
+  for (int i = 0; i < MAX_ARR; i++) {
+    const uint8_t* p = e + i * entry;
+    train[i] = (i < n && p[0]) ? (char)p[0] : '?';
+    at[i] = (i < n && entry == 5) ? rd32(p + 1) : 0;
+    minutes[i] = (i < n && entry == 3) ? rd16(p + 1) : -1;
   }
+}
 
-  HTTPClient http;
-  http.begin(MTA_URL);
+static bool mtaDecodeBinary(Stream& s) {
+  uint8_t* b = wireBuf;
+  if (!readExact(s, b, 5)) return false;
+  if (b[0] != 'I' || b[1] != 'M') return false;
+  if (b[2] != WIRE_VERSION && b[2] != MTA_WIRE_VERSION_AT) return false;
 
-  int code = http.GET();
-  if (code != 200) {
-    Serial.print("MTA Error: ");
-    Serial.println(code);
-    http.end();
+  int entry = b[2] == MTA_WIRE_VERSION_AT ? 5 : 3;
+  int nNorth = b[3];
+  int nSouth = b[4];
+  if (!readExact(s, b + 5, (nNorth + nSouth) * entry)) return false;
+
+  const uint8_t* e = b + 5;
+  mtaDecodeEntries(e, nNorth, entry, mtaStage.northTrain, mtaStage.northMin, mtaStage.northAt);
+  e += nNorth * entry;
+  mtaDecodeEntries(e, nSouth, entry, mtaStage.southTrain, mtaStage.southMin, mtaStage.southAt);
+  return true;
+}
+
+static bool weatherDecodeBinary(Stream& s) {
+  uint8_t* b = wireBuf;
+  if (!readExact(s, b, 6)) return false;
+  if (b[0] != 'I' || b[1] != 'W' || b[2] != WIRE_VERSION) return false;
+
+  int count = b[3];
+  int start = rd16(b + 4);
+  if (!readExact(s, b + 6, count * 4 + (count + 7) / 8)) return false;
+
+  const int8_t*  temp = (const int8_t*)(b + 6);
+  const uint8_t* prec = b + 6 + count;
+  const uint8_t* code = prec + count * 2;
+  const uint8_t* day  = code + count;
+
+  int n = count > WEATHER_MAX ? WEATHER_MAX : count;
+  weatherStage.startIndex = start;
+  weatherStage.count = n;
+
+  // Same encoding as WeatherSeries, so the fields copy straight across
+  WeatherSeries& h = weatherStage.hours;
+  memset(&h, 0, sizeof(h));  // hours past `count` read as code 0, as before
+  memcpy(h.temp, temp, n);
+  for (int i = 0; i < n; i++) h.prec[i] = rd16(prec + i * 2);
+  memcpy(h.code, code, n);
+  memcpy(h.dayBits, day, (n + 7) / 8);
+  if (n & 7) h.dayBits[n >> 3] &= (uint8_t)((1 << (n & 7)) - 1);
+  return true;
+}
+
+// -------------------- JSON --------------------
+static_assert(sizeof(MtaPayload::north) / sizeof(MtaArrival) == MAX_ARR,
+              "schema/payloads.json: north.max must match MAX_ARR");
+static_assert(sizeof(MtaPayload::south) / sizeof(MtaArrival) == MAX_ARR,
+              "schema/payloads.json: south.max must match MAX_ARR");
+
+static bool decodeMta(Stream& s, MtaPayload& p) {
+#ifdef PAYLOAD_DOM_DECODER
+  return decodeMtaPayloadDom(s, p);
+#else
+  JsonCursor in(s);
+  return decodeMtaPayload(in, p);
+#endif
+}
+
+static bool decodeWeather(Stream& s, WeatherPayload& p) {
+#ifdef PAYLOAD_DOM_DECODER
+  return decodeWeatherPayloadDom(s, p);
+#else
+  JsonCursor in(s);
+  return decodeWeatherPayload(in, p);
+#endif
+}
+
+static bool mtaDecodeJson(Stream& s) {
+  MtaPayload p;
+  if (!decodeMta(s, p)) {
+    Serial.println("MTA JSON parse error");
     return false;
   }
 
-  String payload = http.getString();
-  http.end();
+  for (int i = 0; i < MAX_ARR; i++) {
+    bool north = i < p.northCount;
+    bool south = i < p.southCount;
+    mtaStage.northTrain[i] = north ? p.north[i].train : '?';
+    mtaStage.northMin[i]   = north ? p.north[i].minutes : -1;
+    mtaStage.northAt[i]    = north ? p.north[i].at : 0;
+    mtaStage.southTrain[i] = south ? p.south[i].train : '?';
+    mtaStage.southMin[i]   = south ? p.south[i].minutes : -1;
+    mtaStage.southAt[i]    = south ? p.south[i].at : 0;
+  }
 
-  StaticJsonDocument<4096> doc;
-  DeserializationError err = deserializeJson(doc, payload);
-  if (err) {
-    Serial.print("MTA JSON parse error: ");
-    Serial.println(err.c_str());
+  Serial.println("MTA OK");
+  return true;
+}
+
+// Hourly entries go straight into the staged series, one at a time
+static void weatherHour(int i, const WeatherHour& h) {
+  if (i < WEATHER_MAX) weatherStage.hours.set(i, h.temp, h.prec, h.code, h.day);
+}
+
+static bool weatherDecodeJson(Stream& s) {
+  memset(&weatherStage.hours, 0, sizeof(weatherStage.hours));  // hours past the count read as code 0
+
+  WeatherPayload p;
+  p.hourly = weatherHour;
+  if (!decodeWeather(s, p)) {
+    Serial.println("Weather JSON parse error");
     return false;
   }
 
-  JsonArray north = doc["north"].as<JsonArray>();
-  JsonArray south = doc["south"].as<JsonArray>();
+  weatherStage.startIndex = p.startIndex;
+  weatherStage.count = p.hourlyCount < WEATHER_MAX ? p.hourlyCount : WEATHER_MAX;
+
+  Serial.println("Weather OK");
+  return true;
+}
+
+// -------------------- Chunked bodies --------------------
+// Keep-alive needs HTTP/1.1, so a proxy may answer with chunked framing.
+// This strips the framing on the fly for the decoders. finish() reads up to
+// the terminating chunk so the socket is clean for the next request.
+class ChunkedStream : public Stream {
+ public:
+  explicit ChunkedStream(Stream& src) : src(src) {}
 
-  for (int i = 0; i < 5; i++) {
-    northTrain[i] = '?';
-    northMin[i] = -1;
-    southTrain[i] = '?';
-    southMin[i] = -1;
+  int available() override {
+    if (done) return 0;
+    int n = src.available();
+    return remaining > 0 && n > (int)remaining ? (int)remaining : n;
+  }
 
-    if (i < (int)north.size()) {
-      int minutes = north[i]["minutes"] | -1;
-      const char* trainStr = north[i]["train"] | "?";
-      northMin[i] = minutes;
-      northTrain[i] = (trainStr && trainStr[0]) ? trainStr[0] : '?';
+  int read() override {
+    if (!startChunk()) return -1;
+    int c = nextByte();
+    if (c >= 0 && --remaining == 0) endChunk();
+    return c;
+  }
+
+  int peek() override {
+    if (!startChunk()) return -1;
+    return src.peek();
+  }
+
+  size_t write(uint8_t) override { return 0; }
+
+  void finish() {
+    while (!done && read() >= 0) {}
+  }
+
+ private:
+  int nextByte() {
+    uint8_t c;
+    return src.readBytes(&c, 1) == 1 ? c : -1;
+  }
+
+  // Parse "<hex size>[;ext]\r\n"; a zero size ends the body
+  bool startChunk() {
+    if (done) return false;
+    if (remaining > 0) return true;
+
+    uint32_t size = 0;
+    bool inExt = false;
+    int c;
+    while ((c = nextByte()) >= 0 && c != '\n') {
+      if (c == ';') inExt = true;
+      if (inExt || c == '\r') continue;
+      int v = (c >= '0' && c <= '9') ? c - '0'
+            : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+            : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+      if (v >= 0) size = (size << 4) | v;
     }
+    if (c < 0 || size == 0) {
+      if (c >= 0) endChunk();  // trailing CRLF after the last chunk
+      done = true;
+      return false;
+    }
+    remaining = size;
+    return true;
+  }
+
+  void endChunk() {
+    nextByte();  // \r
+    nextByte();  // \n
+  }
+
+  Stream& src;
+  uint32_t remaining = 0;
+  bool done = false;
+};
+
+// -------------------- Metered bodies --------------------
+// Sits between the body and a decoder and adds up the time spent waiting in
+// reads, so the flight recorder can split download time from parse time.
+class MeteredStream : public Stream {
+ public:
+  explicit MeteredStream(Stream& src) : src(src) {}
 
-    if (i < (int)south.size()) {
-      int minutes = south[i]["minutes"] | -1;
-      const char* trainStr = south[i]["train"] | "?";
-      southMin[i] = minutes;
-      southTrain[i] = (trainStr && trainStr[0]) ? trainStr[0] : '?';
+  int available() override { return src.available(); }
+  int peek() override { return src.peek(); }
+  size_t write(uint8_t) override { return 0; }
+
+  int read() override {
+    uint32_t t0 = micros();
+    int c = src.read();
+    readUs += micros() - t0;
+    if (c >= 0) bytes++;
+    return c;
+  }
+
+  size_t readBytes(char* buf, size_t len) override {
+    uint32_t t0 = micros();
+    size_t n = src.readBytes(buf, len);
+    readUs += micros() - t0;
+    bytes += n;
+    return n;
+  }
+
+  uint32_t readUs = 0;
+  uint32_t bytes = 0;
+
+ private:
+  Stream& src;
+};
+
+// -------------------- Bundle --------------------
+// /api/bundle carries both feeds in one response, each section with the unix
+// time its upstream answered. Sections are decoded in order straight off the
+// socket into the two stages; a section the proxy could not fill is simply
+// absent and that feed is fetched on its own. Binary only: the firmware
+// always asks for ?fmt=bin and every proxy that has the route speaks it.
+static uint8_t bundleGot = 0;           // FEED_* bits staged by the last decode
+static uint32_t bundleMtaAt = 0;
+static uint32_t bundleWeatherAt = 0;
+
+static bool skipExact(Stream& s, size_t n) {
+  uint8_t scrap[32];
+  while (n > 0) {
+    size_t k = n < sizeof(scrap) ? n : sizeof(scrap);
+    if (!readExact(s, scrap, k)) return false;
+    n -= k;
+  }
+  return true;
+}
+
+static bool bundleDecodeBinary(Stream& s) {
+  bundleGot = 0;
+  uint8_t h[7];
+  if (!readExact(s, h, 4)) return false;
+  if (h[0] != 'I' || h[1] != 'B' || h[2] != WIRE_VERSION) return false;
+
+  int sections = h[3];
+  for (int i = 0; i < sections; i++) {
+    if (!readExact(s, h, 7)) return false;
+    uint8_t kind = h[0];
+    uint32_t at = rd32(h + 1);
+    uint16_t len = rd16(h + 5);
+
+    MeteredStream section(s);
+    if (kind == 'M') {
+      if (!mtaDecodeBinary(section)) return false;
+      bundleGot |= FEED_MTA;
+      bundleMtaAt = at;
+    } else if (kind == 'W') {
+      if (!weatherDecodeBinary(section)) return false;
+      bundleGot |= FEED_WEATHER;
+      bundleWeatherAt = at;
     }
+    // Unknown kinds, and anything a newer proxy appends to a body, are skipped
+    if (section.bytes > len || !skipExact(s, len - section.bytes)) return false;
   }
+  return true;
+}
 
-  Serial.println("MTA OK");
+static bool bundleDecodeJson(Stream&) {
+  Serial.println("Bundle JSON not supported (ask for ?fmt=bin)");
+  return false;
+}
+
+// -------------------- Connection manager --------------------
+// One client per host, kept open between fetches so back-to-back requests to
+// the proxy pay for a single DNS + TCP + TLS handshake. HTTPClient stops its
+// client when destroyed, so the HTTPClient lives here too instead of on the
+// stack of each fetch.
+struct HostConn {
+  char host[64];
+  bool secure;
+  WiFiClientSecure tls;
+  WiFiClient plain;
+  HTTPClient http;
+  uint32_t lastUsedMs;
+
+  WiFiClient& client() { return secure ? (WiFiClient&)tls : plain; }
+};
+
+static const int MAX_HOSTS = 2;
+static HostConn conns[MAX_HOSTS];
+static ConnStats connCounters = {0, 0, 0, 0, 0};
+
+// "https://host:443/path" -> host, secure, port
+static void parseHost(const char* url, char* host, size_t cap, bool& secure, uint16_t& port) {
+  secure = strncmp(url, "https://", 8) == 0;
+  const char* p = strstr(url, "://");
+  p = p ? p + 3 : url;
+  size_t n = strcspn(p, ":/?");
+  port = (p[n] == ':') ? (uint16_t)atoi(p + n + 1) : (secure ? 443 : 80);
+  if (n >= cap) n = cap - 1;
+  memcpy(host, p, n);
+  host[n] = '\0';
+}
+
+static HostConn& connFor(const char* url, uint16_t& port) {
+  char host[sizeof(conns[0].host)];
+  bool secure;
+  parseHost(url, host, sizeof(host), secure, port);
+
+  HostConn* slot = &conns[0];
+  for (int i = 0; i < MAX_HOSTS; i++) {
+    HostConn& c = conns[i];
+    if (c.secure == secure && strcmp(c.host, host) == 0) {
+      slot = &c;
+      break;
+    }
+    if (c.lastUsedMs < slot->lastUsedMs) slot = &c;  // least recently used
+  }
+
+  if (slot->secure != secure || strcmp(slot->host, host) != 0) {
+    slot->client().stop();
+    strcpy(slot->host, host);
+    slot->secure = secure;
+    slot->tls.setInsecure();  // matches the old HTTPClient::begin(url) behaviour
+    slot->http.setReuse(true);
+  }
+  slot->lastUsedMs = millis();
+  return *slot;
+}
+
+// -------------------- Host address cache --------------------
+// WiFiClientSecure runs the whole mbedTLS handshake inside connect() and has
+// no hook to save or offer a TLS session, so session resumption is out of
+// reach with this core. What does survive a reboot or deep sleep is the DNS
+// answer for the proxy: it lives in RTC memory (kept across ESP.restart()
+// and deep sleep), is backed by NVS for cold boots, and lets a reconnect go
+// straight to TCP + TLS. A failed connect drops the entry and re-resolves.
+struct HostAddr {
+  uint32_t magic;
+  char host[64];
+  uint32_t ip;
+};
+
+static const uint32_t HOST_ADDR_MAGIC = 0x484F5354;  // "HOST"
+RTC_NOINIT_ATTR static HostAddr rtcHostAddr;
+
+static bool hostAddrLookup(const char* host, IPAddress& ip) {
+  if (rtcHostAddr.magic != HOST_ADDR_MAGIC) {
+    // Cold boot: RTC memory holds garbage, try the NVS copy
+    Preferences nvs;
+    nvs.begin("net", true);
+    bool found = nvs.getBytesLength("host") == sizeof(HostAddr) &&
+                 nvs.getBytes("host", &rtcHostAddr, sizeof(HostAddr)) == sizeof(HostAddr);
+    nvs.end();
+    if (!found || rtcHostAddr.magic != HOST_ADDR_MAGIC) {
+      rtcHostAddr.magic = 0;
+      return false;
+    }
+  }
+  if (strncmp(rtcHostAddr.host, host, sizeof(rtcHostAddr.host)) != 0) return false;
+  ip = IPAddress(rtcHostAddr.ip);
   return true;
 }
 
+static void hostAddrStore(const char* host, IPAddress ip) {
+  // A name that does not fit could never match on lookup, and would rewrite
+  // NVS on every connect; leave it uncached
+  size_t len = strlen(host);
+  if (len >= sizeof(rtcHostAddr.host)) return;
 
-// -------------------- Weather --------------------
-bool weatherFetch() {
+  bool same = rtcHostAddr.magic == HOST_ADDR_MAGIC && rtcHostAddr.ip == (uint32_t)ip &&
+              strncmp(rtcHostAddr.host, host, sizeof(rtcHostAddr.host)) == 0;
+  if (same) return;  // NVS only sees a write when the answer actually changes
+
+  memset(&rtcHostAddr, 0, sizeof(rtcHostAddr));
+  rtcHostAddr.magic = HOST_ADDR_MAGIC;
+  memcpy(rtcHostAddr.host, host, len + 1);
+  rtcHostAddr.ip = (uint32_t)ip;
+
+  Preferences nvs;
+  nvs.begin("net", false);
+  nvs.putBytes("host", &rtcHostAddr, sizeof(HostAddr));
+  nvs.end();
+}
+
+static void hostAddrForget() {
+  rtcHostAddr.magic = 0;
+}
+
+// Open a cold connection ourselves (instead of letting HTTPClient resolve
+// and connect) so the DNS answer can be cached and both steps timed.
+static bool openConn(HostConn& c, uint16_t port, uint32_t& dnsUs, uint32_t& handshakeUs) {
+  dnsUs = 0;
+  handshakeUs = 0;
+
+  IPAddress ip;
+  bool cached = hostAddrLookup(c.host, ip);
+  for (int attempt = 0; attempt < 2; attempt++) {
+    if (!cached) {
+      uint32_t t0 = micros();
+      if (!WiFi.hostByName(c.host, ip)) return false;
+      dnsUs = micros() - t0;
+    }
+
+    uint32_t t1 = micros();
+    bool ok = c.secure ? c.tls.connect(ip, port, c.host, nullptr, nullptr, nullptr)
+                       : c.plain.connect(ip, port);
+    handshakeUs = micros() - t1;
+
+    if (ok) {
+      if (cached) connCounters.dnsCached++;
+      else hostAddrStore(c.host, ip);
+      return true;
+    }
+    if (!cached) return false;
+
+    // The cached address went stale; resolve again and retry once
+    hostAddrForget();
+    cached = false;
+  }
+  return false;
+}
+
+ConnStats connStats() {
+  return connCounters;
+}
+
+// -------------------- Clock fallback --------------------
+// Arrival countdowns need the wall clock. Until NTP answers, the proxy's
+// Date header ("Tue, 15 Nov 1994 08:12:31 GMT") is close enough.
+static void clockFromDate(const String& date) {
+  static const char MONTHS[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  char mon[4];
+  int d, y, hh, mm, ss;
+  if (sscanf(date.c_str(), "%*3s, %d %3s %d %d:%d:%d", &d, mon, &y, &hh, &mm, &ss) != 6) return;
+  const char* m = strstr(MONTHS, mon);
+  if (!m || (m - MONTHS) % 3) return;
+  int month = (m - MONTHS) / 3 + 1;
+
+  // Days since 1970-01-01 for a proleptic Gregorian date
+  y -= month <= 2;
+  long era = y / 400;
+  long yoe = y - era * 400;
+  long doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  long days = era * 146097 + doe - 719468;
+
+  struct timeval tv = {(time_t)(days * 86400 + hh * 3600 + mm * 60 + ss), 0};
+  settimeofday(&tv, nullptr);
+  Serial.println("Clock set from HTTP Date");
+}
+
+// -------------------- Fetch --------------------
+// Per-feed HTTP state. The ETag of the last good body is sent back as
+// If-None-Match; a 304 leaves the stored data (and the screen) untouched.
+struct Feed {
+  const char* name;
+  uint8_t bit;                     // FEED_*
+  const char* const* url;          // points at MTA_URL / WEATHER_URL in main.cpp
+  bool (*decodeBinary)(Stream&);
+  bool (*decodeJson)(Stream&);
+  char etag[48];
+  int lastBytes;                   // body size of the last 200, counted as saved on 304
+  uint32_t bytesSaved;
+  int lastStatus;                  // HTTP status of the last request, or HTTPClient error
+};
+
+static Feed mtaFeed     = {"MTA",     FEED_MTA,     &MTA_URL,     mtaDecodeBinary,     mtaDecodeJson,     "", 0, 0, 0};
+static Feed weatherFeed = {"Weather", FEED_WEATHER, &WEATHER_URL, weatherDecodeBinary, weatherDecodeJson, "", 0, 0, 0};
+static Feed bundleFeed  = {"Bundle",  FEED_MTA | FEED_WEATHER, &BUNDLE_URL, bundleDecodeBinary, bundleDecodeJson, "", 0, 0, 0};
+
+static int sendGet(HostConn& c, Feed& feed) {
+  c.http.begin(c.client(), *feed.url);
+  c.http.collectHeaders(HEADER_KEYS, HEADER_KEY_COUNT);
+  if (feed.etag[0]) c.http.addHeader("If-None-Match", feed.etag);
+  return c.http.GET();
+}
+
+static FetchResult fetchFeed(Feed& feed, FetchRecord& rec) {
   if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("Weather Not Connected");
-    return false;
+    Serial.print(feed.name);
+    Serial.println(" Not Connected");
+    return FETCH_FAILED;
   }
 
-  HTTPClient http;
-  http.begin(WEATHER_URL);
+  uint16_t port;
+  HostConn& c = connFor(*feed.url, port);
+  HTTPClient& http = c.http;
+
+  uint32_t dnsUs = 0, handshakeUs = 0;
+  bool warm = c.client().connected();
+  if (!warm) openConn(c, port, dnsUs, handshakeUs);  // on failure HTTPClient retries the plain way
 
-  int code = http.GET();
+  uint32_t t0 = micros();
+  int code = sendGet(c, feed);
+  if (code < 0 && warm) {
+    // The server closed the idle socket under us; retry once on a fresh one
+    http.end();
+    c.client().stop();
+    warm = false;
+    openConn(c, port, dnsUs, handshakeUs);
+    t0 = micros();
+    code = sendGet(c, feed);
+  }
+  rec.ttfbUs = micros() - t0;  // request out, status line and headers back
+  if (code > 0 && time(nullptr) < 1700000000) clockFromDate(http.header("Date"));
+  rec.status = (int16_t)code;
+  feed.lastStatus = code;
+  rec.reused = warm;
+  rec.dnsUs = dnsUs;
+  rec.connectUs = handshakeUs;
+  if (code > 0) {
+    if (warm) {
+      connCounters.reused++;
+    } else {
+      connCounters.opened++;
+      connCounters.handshakeUsTotal += handshakeUs;
+      connCounters.lastHandshakeUs = handshakeUs;
+    }
+  }
+
+  Serial.print(feed.name);
+  if (warm) {
+    Serial.println(" conn: reused");
+  } else {
+    Serial.print(" conn: new, dns ");
+    Serial.print(dnsUs / 1000);
+    Serial.print(dnsUs ? " ms" : " ms (cached)");
+    Serial.print(", tcp+tls ");
+    Serial.print(handshakeUs / 1000);
+    Serial.println(" ms");
+  }
+
+  if (code == 304) {
+    http.end();
+    feed.bytesSaved += feed.lastBytes;
+    Serial.print(feed.name);
+    Serial.print(" Not Modified (saved ");
+    Serial.print(feed.lastBytes);
+    Serial.println(" B)");
+    return FETCH_NOT_MODIFIED;
+  }
   if (code != 200) {
-    Serial.print("Weather Error: ");
+    Serial.print(feed.name);
+    Serial.print(" Error: ");
     Serial.println(code);
     http.end();
-    return false;
+    if (code < 0) c.client().stop();
+    return FETCH_FAILED;
   }
 
-  String payload = http.getString();
-  http.end();
+  bool chunked = http.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+  ChunkedStream dechunked(c.client());
+  MeteredStream body(chunked ? (Stream&)dechunked : (Stream&)c.client());
 
-  // Clear previous data and reuse static document (no heap fragmentation)
-  weatherDoc.clear();
+  // Older proxies ignore ?fmt=bin and still answer with JSON
+  bool ok;
+  uint32_t t1 = micros();
+  if (isBinaryBody(http)) {
+    ok = feed.decodeBinary(body);
+    Serial.print(feed.name);
+    Serial.println(ok ? " OK (bin)" : " binary decode error");
+  } else {
+    ok = feed.decodeJson(body);
+  }
+  uint32_t decodeUs = micros() - t1;
+  rec.downloadUs = body.readUs;
+  rec.parseUs = decodeUs > body.readUs ? decodeUs - body.readUs : 0;
+  rec.bytes = body.bytes;
+  if (chunked) dechunked.finish();
 
-  DeserializationError err = deserializeJson(weatherDoc, payload);
-  if (err) {
-    Serial.print("Weather JSON parse error: ");
-    Serial.println(err.c_str());
-    return false;
+  // Only remember the validator once the body it names has been applied
+  String etag = http.header("ETag");
+  if (ok && etag.length() < sizeof(feed.etag)) {
+    strcpy(feed.etag, etag.c_str());
+    int size = http.getSize();
+    feed.lastBytes = size > 0 ? size : 0;
+  } else {
+    feed.etag[0] = '\0';
   }
 
-  // startIndex
-  weatherStartIndex = weatherDoc["startIndex"] | 0;
+  http.end();                   // keeps the socket open unless the server said close
+  if (!ok) c.client().stop();   // unknown amount of body left unread
+  return ok ? FETCH_UPDATED : FETCH_FAILED;
+}
+
+// -------------------- Flight recorder --------------------
+// The last RECORDER_SIZE fetches with their timing split, newest overwriting
+// oldest. Written by the fetch task; readers copy out under a spinlock.
+static const int RECORDER_SIZE = 32;
+static FetchRecord records[RECORDER_SIZE];
+static uint32_t recordsWritten = 0;
+static portMUX_TYPE recorderMux = portMUX_INITIALIZER_UNLOCKED;
+
+static FetchResult fetchRecorded(Feed& feed) {
+  FetchRecord rec = {};
+  rec.atMs = millis();
+  rec.feed = feed.bit;
+  rec.heapBefore = ESP.getFreeHeap();
 
-  JsonArray hourly = weatherDoc["hourly"].as<JsonArray>();
-  int n = (int)hourly.size();
-  if (n > WEATHER_MAX) n = WEATHER_MAX;
-  weatherCount = n;
+  FetchResult r = fetchFeed(feed, rec);
+
+  rec.result = r;
+  rec.heapAfter = ESP.getFreeHeap();
+  portENTER_CRITICAL(&recorderMux);
+  records[recordsWritten % RECORDER_SIZE] = rec;
+  recordsWritten++;
+  portEXIT_CRITICAL(&recorderMux);
+  return r;
+}
 
-  for (int i = 0; i < WEATHER_MAX; i++) {
-    wTemp[i] = 0;
-    wPrec[i] = 0.0f;
-    wCode[i] = 0;
-    wDay[i]  = 0;
+size_t fetchRecords(FetchRecord* out, size_t max) {
+  portENTER_CRITICAL(&recorderMux);
+  size_t n = recordsWritten < RECORDER_SIZE ? recordsWritten : RECORDER_SIZE;
+  if (n > max) n = max;
+  for (size_t i = 0; i < n; i++) {
+    out[i] = records[(recordsWritten - n + i) % RECORDER_SIZE];
   }
+  portEXIT_CRITICAL(&recorderMux);
+  return n;
+}
 
-  for (int i = 0; i < n; i++) {
-    JsonObject h = hourly[i].as<JsonObject>();
+void fetchRecorderDump(Print& out) {
+  static const char* RESULT[] = {"fail", "new", "304"};
+  static FetchRecord copy[RECORDER_SIZE];  // too big for the caller's stack
+  size_t n = fetchRecords(copy, RECORDER_SIZE);
 
-    wTemp[i] = h["temp"] | 0;
-    wPrec[i] = h["prec"] | 0.0f;
-    wDay[i]  = h["day"]  | 0;
-    wCode[i] = h["code"] | 0;
+  out.printf("[FLIGHT] %u fetches (times in ms)\n", (unsigned)n);
+  out.println("      at feed      st  res  sock   dns  conn  ttfb    dl parse  bytes  heap before/after");
+  for (size_t i = 0; i < n; i++) {
+    const FetchRecord& r = copy[i];
+    out.printf("%8lu %-7s %4d %4s %5s %5lu %5lu %5lu %5lu %5lu %6lu  %lu/%lu\n",
+               (unsigned long)r.atMs,
+               r.feed == FEED_MTA ? "MTA" : r.feed == FEED_WEATHER ? "Weather" : "Bundle", r.status,
+               RESULT[r.result], r.reused ? "warm" : "new",
+               (unsigned long)(r.dnsUs / 1000), (unsigned long)(r.connectUs / 1000),
+               (unsigned long)(r.ttfbUs / 1000), (unsigned long)(r.downloadUs / 1000),
+               (unsigned long)(r.parseUs / 1000), (unsigned long)r.bytes,
+               (unsigned long)r.heapBefore, (unsigned long)r.heapAfter);
   }
 
-  Serial.println("Weather OK");
+  ConnStats cs = connStats();
+  CacheStats mc = cacheStats(FEED_MTA);
+  CacheStats wc = cacheStats(FEED_WEATHER);
+  out.printf("[FLIGHT] conns opened %lu reused %lu | cache MTA %lu/%lu weather %lu/%lu (hit/miss) | 304 saved %lu B\n",
+             (unsigned long)cs.opened, (unsigned long)cs.reused,
+             (unsigned long)mc.hits, (unsigned long)mc.misses,
+             (unsigned long)wc.hits, (unsigned long)wc.misses,
+             (unsigned long)fetchBytesSaved());
+}
+
+// -------------------- Publishing --------------------
+// Seqlock: the writer makes seq odd, copies, then makes it even again. A
+// reader copies out and retries if seq was odd or moved under it. The writer
+// never waits and a reader only spins for the length of one memcpy.
+template <typename T>
+class Published {
+public:
+  void publish(T& v) {
+    uint32_t s = seq_.load(std::memory_order_relaxed);
+    v.seq = s + 2;
+    seq_.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&value_, &v, sizeof(T));
+    seq_.store(s + 2, std::memory_order_release);
+  }
+
+  bool latest(T& dst) const {
+    for (;;) {
+      uint32_t s = seq_.load(std::memory_order_acquire);
+      if (s == dst.seq) return false;
+      if (s & 1) continue;  // write in progress on the other core
+      T tmp;
+      memcpy(&tmp, &value_, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) != s) continue;
+      memcpy(&dst, &tmp, sizeof(T));
+      return true;
+    }
+  }
+
+private:
+  std::atomic<uint32_t> seq_{0};
+  T value_;
+};
+
+static Published<MtaSnapshot>     mtaPublished;
+static Published<WeatherSnapshot> weatherPublished;
+
+bool mtaLatest(MtaSnapshot& dst) {
+  return mtaPublished.latest(dst);
+}
+
+bool weatherLatest(WeatherSnapshot& dst) {
+  return weatherPublished.latest(dst);
+}
+
+// -------------------- Persistence --------------------
+// The last good snapshots live in NVS so a reboot can draw real data before
+// Wi-Fi is up. A record is only rewritten when its payload (everything after
+// seq/fetchedAt/restored) changed, and MTA writes are spaced out on top of
+// that because arrivals change on almost every fetch.
+static const uint16_t SAVE_VERSION = 1;
+static const uint32_t MTA_SAVE_EVERY_MS = 10 * 60000UL;
+static const uint32_t WEATHER_SAVE_EVERY_MS = 0;  // changes hourly at most
+
+template <typename T>
+struct SavedRecord {
+  uint16_t version;
+  uint16_t size;    // sizeof(T); a layout change invalidates old records
+  T snap;
+};
+
+struct SaveSlot {
+  const char* key;
+  size_t payloadOffset;
+  uint32_t minGapMs;
+  bool known;       // hash below matches what is in flash
+  uint32_t hash;
+  bool wrote;       // written during this boot, wroteMs is valid
+  uint32_t wroteMs;
+};
+
+static SaveSlot mtaSave     = {"mta", offsetof(MtaSnapshot, northTrain),
+                               MTA_SAVE_EVERY_MS, false, 0, false, 0};
+static SaveSlot weatherSave = {"weather", offsetof(WeatherSnapshot, startIndex),
+                               WEATHER_SAVE_EVERY_MS, false, 0, false, 0};
+
+static uint32_t payloadHash(const SaveSlot& slot, const void* snap, size_t size) {
+  const uint8_t* p = (const uint8_t*)snap + slot.payloadOffset;
+  uint32_t h = 2166136261u;  // FNV-1a
+  for (size_t i = slot.payloadOffset; i < size; i++) h = (h ^ *p++) * 16777619u;
+  return h;
+}
+
+template <typename T>
+static void snapshotSave(SaveSlot& slot, const T& snap) {
+  uint32_t h = payloadHash(slot, &snap, sizeof(T));
+  if (slot.known && h == slot.hash) return;
+  if (slot.wrote && millis() - slot.wroteMs < slot.minGapMs) return;
+
+  SavedRecord<T> rec = {SAVE_VERSION, (uint16_t)sizeof(T), snap};
+  Preferences nvs;
+  nvs.begin("snap", false);
+  bool ok = nvs.putBytes(slot.key, &rec, sizeof(rec)) == sizeof(rec);
+  nvs.end();
+
+  slot.known = ok;
+  slot.hash = h;
+  slot.wrote = true;
+  slot.wroteMs = millis();
+}
+
+template <typename T>
+static bool snapshotLoad(Preferences& nvs, SaveSlot& slot, T& out) {
+  SavedRecord<T> rec;
+  if (nvs.getBytesLength(slot.key) != sizeof(rec)) return false;
+  if (nvs.getBytes(slot.key, &rec, sizeof(rec)) != sizeof(rec)) return false;
+  if (rec.version != SAVE_VERSION || rec.size != sizeof(T)) return false;
+
+  out = rec.snap;
+  out.restored = true;
+  slot.known = true;
+  slot.hash = payloadHash(slot, &out, sizeof(T));
   return true;
-}
\ No newline at end of file
+}
+
+bool snapshotsRestore() {
+  Preferences nvs;
+  if (!nvs.begin("snap", true)) return false;  // nothing saved yet
+  bool mta = snapshotLoad(nvs, mtaSave, mtaStage);
+  bool weather = snapshotLoad(nvs, weatherSave, weatherStage);
+  nvs.end();
+
+  if (mta) mtaPublished.publish(mtaStage);
+  if (weather) weatherPublished.publish(weatherStage);
+  return mta || weather;
+}
+
+// Only trust the clock once NTP (or clockFromDate() below) has set it
+static uint32_t fetchTime() {
+  time_t now = time(nullptr);
+  return now > 1700000000 ? (uint32_t)now : 0;
+}
+
+// v2 bodies only carry arrival times; derive the minutes as of the fetch too
+static void mtaMinutesFromAt(int* minutes, const uint32_t* at, uint32_t now) {
+  for (int i = 0; i < MAX_ARR; i++) {
+    if (!at[i] || !now || minutes[i] >= 0) continue;
+    minutes[i] = at[i] > now ? (int)((at[i] - now + 30) / 60) : 0;
+  }
+}
+
+// -------------------- MTA --------------------
+// mtaStage holds a freshly decoded body (from a fetch, a bundle or a push event)
+static void mtaPublishStage(uint32_t fetchedAt) {
+  mtaStage.fetchedAt = fetchedAt;
+  mtaMinutesFromAt(mtaStage.northMin, mtaStage.northAt, mtaStage.fetchedAt);
+  mtaMinutesFromAt(mtaStage.southMin, mtaStage.southAt, mtaStage.fetchedAt);
+  mtaStage.restored = false;
+  mtaPublished.publish(mtaStage);
+  snapshotSave(mtaSave, mtaStage);
+}
+
+static FetchResult mtaFetch() {
+  FetchResult r = fetchRecorded(mtaFeed);
+  if (r == FETCH_UPDATED) mtaPublishStage(fetchTime());
+  return r;
+}
+
+// -------------------- Weather --------------------
+static void weatherPublishStage(uint32_t fetchedAt) {
+  weatherStage.fetchedAt = fetchedAt;
+  weatherStage.restored = false;
+  weatherPublished.publish(weatherStage);
+  snapshotSave(weatherSave, weatherStage);
+}
+
+static FetchResult weatherFetch() {
+  FetchResult r = fetchRecorded(weatherFeed);
+  if (r == FETCH_UPDATED) weatherPublishStage(fetchTime());
+  return r;
+}
+
+// -------------------- Cache --------------------
+// A snapshot younger than its TTL counts as fresh: a request for it is a hit
+// and never reaches the network. A stale snapshot keeps being drawn while the
+// fetch task revalidates it (stale-while-revalidate); both a 200 and a 304
+// restart the clock, a failure does not. TTLs can be overridden with
+// build_flags, e.g. -D MTA_TTL_MS=20000.
+#ifndef MTA_TTL_MS
+#define MTA_TTL_MS 60000UL            // minutes are counted down on the device between fetches
+#endif
+#ifndef WEATHER_TTL_MS
+#define WEATHER_TTL_MS (15 * 60000UL) // forecast changes hourly
+#endif
+
+// Written by the fetch task, read by fetchRequest() on the render core
+struct FeedCache {
+  uint8_t bit;
+  uint32_t ttlMs;
+  std::atomic<bool> valid;
+  std::atomic<uint32_t> validatedMs;
+  std::atomic<uint32_t> hits;
+  std::atomic<uint32_t> misses;
+};
+
+static FeedCache mtaCache     = {FEED_MTA,     MTA_TTL_MS,     {false}, {0}, {0}, {0}};
+static FeedCache weatherCache = {FEED_WEATHER, WEATHER_TTL_MS, {false}, {0}, {0}, {0}};
+
+// Feeds with a fetch queued or running; a second request for one is dropped
+static std::atomic<uint8_t> inFlight{0};
+
+static bool cacheFresh(const FeedCache& c) {
+  return c.valid.load() && millis() - c.validatedMs.load() < c.ttlMs;
+}
+
+static void cacheValidated(FeedCache& c, FetchResult r) {
+  if (r == FETCH_FAILED) return;
+  c.validatedMs.store(millis());
+  c.valid.store(true);
+}
+
+// Hit: drop the bit. Miss: keep it unless that feed is already on its way.
+static uint8_t cacheFilter(FeedCache& c, uint8_t feeds) {
+  if (!(feeds & c.bit)) return feeds;
+  if (cacheFresh(c)) {
+    c.hits++;
+    return feeds & ~c.bit;
+  }
+  c.misses++;
+  if (inFlight.fetch_or(c.bit) & c.bit) return feeds & ~c.bit;
+  return feeds;
+}
+
+CacheStats cacheStats(uint8_t feed) {
+  const FeedCache& c = (feed == FEED_WEATHER) ? weatherCache : mtaCache;
+  return {c.hits.load(), c.misses.load()};
+}
+
+// -------------------- Push stream --------------------
+// With MTA_STREAM_URL set (local_server's /mta/stream), the fetch task also
+// keeps a server-sent-events connection open and applies each "mta" event as
+// it arrives: one JSON body on one data line, decoded straight off the
+// socket. Every event and heartbeat counts as a validation for the MTA cache,
+// so while the stream is up fetchRequest() answers MTA from the cache and
+// never polls. When it goes quiet or drops, the TTL runs out and polling
+// MTA_URL takes over again until a reconnect succeeds.
+static const uint32_t STREAM_SERVICE_MS = 100;   // fetch task wake-up while streaming
+static const uint32_t STREAM_RETRY_MS = 15000;
+static const uint32_t STREAM_IDLE_MS = 50000;    // the server pings every 20 s
+
+// One SSE line as a Stream: ends after the newline, so a decoder that reads
+// ahead can never run into the next line
+class LineStream : public Stream {
+ public:
+  explicit LineStream(Stream& src) : src(src) {}
+
+  int available() override { return done ? 0 : src.available(); }
+  int peek() override { return done ? -1 : src.peek(); }
+  size_t write(uint8_t) override { return 0; }
+
+  int read() override {
+    if (done) return -1;
+    uint8_t c;
+    if (src.readBytes(&c, 1) != 1) {
+      done = true;
+      return -1;
+    }
+    if (c == '\n') done = true;
+    return c;
+  }
+
+  size_t readBytes(char* buf, size_t len) override {
+    size_t n = 0;
+    int c;
+    while (n < len && (c = read()) >= 0) buf[n++] = (char)c;
+    return n;
+  }
+
+  void finish() {
+    while (read() >= 0) {}
+  }
+
+ private:
+  Stream& src;
+  bool done = false;
+};
+
+static WiFiClient streamClient;
+static HTTPClient streamHttp;
+static bool streamOpen = false;
+static uint32_t streamTriedMs = 0;
+static uint32_t streamHeardMs = 0;
+
+static bool streamEnabled() {
+  return MTA_STREAM_URL && MTA_STREAM_URL[0];
+}
+
+static void mtaStreamClose(const char* why) {
+  streamHttp.end();
+  streamClient.stop();
+  streamOpen = false;
+  Serial.print("MTA stream closed: ");
+  Serial.println(why);
+}
+
+static void mtaStreamConnect() {
+  streamTriedMs = millis();
+  streamHttp.begin(streamClient, MTA_STREAM_URL);
+  streamHttp.setConnectTimeout(2000);  // a missing LAN server must not stall the polls for long
+  streamHttp.useHTTP10(true);          // close-delimited body, no chunk framing in the way
+  streamHttp.setReuse(false);
+  streamHttp.addHeader("Accept", "text/event-stream");
+  int code = streamHttp.GET();
+  if (code != 200) {
+    Serial.print("MTA stream Error: ");
+    Serial.println(code);
+    streamHttp.end();
+    streamClient.stop();
+    return;
+  }
+  streamOpen = true;
+  streamHeardMs = millis();
+  Serial.println("MTA stream open");
+}
+
+// Handle whatever lines have arrived; called from the fetch task only, so
+// mtaStage has a single writer
+static void mtaStreamService() {
+  if (!streamEnabled()) return;
+  if (!streamOpen) {
+    bool due = streamTriedMs == 0 || millis() - streamTriedMs >= STREAM_RETRY_MS;
+    if (due && WiFi.status() == WL_CONNECTED) mtaStreamConnect();
+    return;
+  }
+  if (!streamClient.connected()) {
+    mtaStreamClose("server hung up");
+    return;
+  }
+  if (millis() - streamHeardMs >= STREAM_IDLE_MS) {
+    mtaStreamClose("idle");
+    return;
+  }
+
+  // Each line is written in one go by the server, so once its first byte is
+  // here the rest follows within the socket timeout
+  while (streamClient.available() > 0) {
+    streamHeardMs = millis();
+    LineStream line(streamClient);
+
+    char field[8];
+    size_t n = 0;
+    int c;
+    while ((c = line.read()) >= 0 && c != ':' && c != '\n') {
+      if (n + 1 < sizeof(field)) field[n++] = (char)c;
+    }
+    field[n] = '\0';
+    if (c != ':') continue;  // blank line (event end) or a field without a value
+
+    if (strcmp(field, "data") == 0) {
+      if (line.peek() == ' ') line.read();
+      if (mtaDecodeJson(line)) {
+        mtaFeed.etag[0] = '\0';  // the last polled body is no longer what is shown
+        mtaPublishStage(fetchTime());
+        Serial.println("MTA push applied");
+      }
+    }
+    cacheValidated(mtaCache, FETCH_NOT_MODIFIED);  // any line, pings included, proves the feed is live
+    line.finish();
+  }
+}
+
+// -------------------- Bundled fetch --------------------
+// When both feeds are due (boot, and rotations after both TTLs ran out) one
+// request to BUNDLE_URL replaces two. Returns the FEED_* bits it answered;
+// the caller fetches the rest separately. A proxy without the route (404)
+// is not asked again this boot.
+static bool bundleMissing = false;
+
+static uint8_t bundleFetch() {
+  if (bundleMissing || !BUNDLE_URL || !BUNDLE_URL[0]) return 0;
+
+  FetchResult r = fetchRecorded(bundleFeed);
+  if (r == FETCH_FAILED) {
+    if (bundleFeed.lastStatus == 404) bundleMissing = true;
+    return 0;
+  }
+
+  uint8_t served = FEED_MTA | FEED_WEATHER;  // a 304 only ever answers a complete bundle
+  if (r == FETCH_UPDATED) {
+    served = bundleGot;
+    uint32_t now = fetchTime();
+    if (served & FEED_MTA) {
+      mtaFeed.etag[0] = '\0';      // what is shown no longer matches the last /mta body
+      mtaPublishStage(bundleMtaAt ? bundleMtaAt : now);
+    }
+    if (served & FEED_WEATHER) {
+      weatherFeed.etag[0] = '\0';
+      weatherPublishStage(bundleWeatherAt ? bundleWeatherAt : now);
+    }
+    if (served != (FEED_MTA | FEED_WEATHER)) bundleFeed.etag[0] = '\0';
+  }
+
+  if (served & FEED_MTA) cacheValidated(mtaCache, r);
+  if (served & FEED_WEATHER) cacheValidated(weatherCache, r);
+  return served;
+}
+
+// -------------------- Fetch task --------------------
+// All network I/O runs here, pinned to core 0 next to the Wi-Fi stack, so
+// loop() on core 1 keeps reading the encoder and drawing while a request is
+// in flight. Requests arrive as FEED_* notification bits that have already
+// been through the cache above.
+static const uint32_t FETCH_TASK_STACK = 8192;  // same as Arduino's loopTask, which ran these before
+static TaskHandle_t fetchTask = nullptr;
+
+static void fetchTaskLoop(void*) {
+  for (;;) {
+    uint32_t feeds = 0;
+    TickType_t wait = streamEnabled() ? pdMS_TO_TICKS(STREAM_SERVICE_MS) : portMAX_DELAY;
+    xTaskNotifyWait(0, UINT32_MAX, &feeds, wait);
+    mtaStreamService();
+    if ((feeds & FEED_MTA) && (feeds & FEED_WEATHER)) {
+      uint8_t served = bundleFetch();
+      inFlight.fetch_and((uint8_t)~served);
+      feeds &= ~served;
+    }
+    if (feeds & FEED_MTA) {
+      cacheValidated(mtaCache, mtaFetch());
+      inFlight.fetch_and((uint8_t)~FEED_MTA);
+    }
+    if (feeds & FEED_WEATHER) {
+      cacheValidated(weatherCache, weatherFetch());
+      inFlight.fetch_and((uint8_t)~FEED_WEATHER);
+    }
+  }
+}
+
+void fetchTaskStart() {
+  if (fetchTask) return;
+  xTaskCreatePinnedToCore(fetchTaskLoop, "fetch", FETCH_TASK_STACK, nullptr, 1, &fetchTask, 0);
+}
+
+void fetchRequest(uint8_t feeds) {
+  if (!fetchTask) return;
+  feeds = cacheFilter(mtaCache, feeds);
+  feeds = cacheFilter(weatherCache, feeds);
+  if (feeds) xTaskNotify(fetchTask, feeds, eSetBits);
+}
+
+uint32_t fetchBytesSaved() {
+  return mtaFeed.bytesSaved + weatherFeed.bytesSaved + bundleFeed.bytesSaved;
+}
@@ -0,0 +1,806 @@
+#include "epd_frame.h"
+
+#include <algorithm>
+
+// ---------------- Diff tuning ----------------
+// A changed span stays one span across up to GAP_BYTES unchanged bytes, and
+// a rectangle keeps growing downwards across up to ROW_GAP unchanged rows.
+// Every rectangle costs a window setup and two delay(1) in the driver, worth
+// roughly RECT_COST_BYTES of pixel data, so two rectangles are merged when
+// their bounding box wastes less than that.
+static const int GAP_BYTES = 4;
+static const int ROW_GAP = 8;
+static const int TRACKED = 32;            // rectangles held while scanning
+static const int32_t RECT_COST_BYTES = 256;
+
+namespace {
+
+struct Box {
+  int16_t x0, x1;   // bytes, inclusive
+  int16_t y0, y1;   // rows, inclusive
+};
+
+int32_t area(const Box& b) {
+  return (int32_t)(b.x1 - b.x0 + 1) * (b.y1 - b.y0 + 1);
+}
+
+Box unite(const Box& a, const Box& b) {
+  return {std::min(a.x0, b.x0), std::max(a.x1, b.x1), std::min(a.y0, b.y0), std::max(a.y1, b.y1)};
+}
+
+// Bytes the union of a and b sends that neither of them needed (negative
+// when they overlap)
+int32_t waste(const Box& a, const Box& b) {
+  return area(unite(a, b)) - area(a) - area(b);
+}
+
+// Merge the pair that wastes the least; returns that waste
+int32_t mergeCheapest(Box* boxes, int& n) {
+  int bi = 0, bj = 1;
+  int32_t best = INT32_MAX;
+  for (int i = 0; i < n; i++) {
+    for (int j = i + 1; j < n; j++) {
+      int32_t w = waste(boxes[i], boxes[j]);
+      if (w < best) {
+        best = w;
+        bi = i;
+        bj = j;
+      }
+    }
+  }
+  boxes[bi] = unite(boxes[bi], boxes[bj]);
+  boxes[bj] = boxes[--n];
+  return best;
+}
+
+// Cheapest merge without applying it
+int32_t cheapestWaste(const Box* boxes, int n) {
+  int32_t best = INT32_MAX;
+  for (int i = 0; i < n; i++)
+    for (int j = i + 1; j < n; j++) best = std::min(best, waste(boxes[i], boxes[j]));
+  return best;
+}
+
+// Attach a changed span of row y to the rectangle right above it, or start
+// a new one. A span touching several rectangles joins them into one.
+void addSpan(Box* boxes, int& n, int16_t x0, int16_t x1, int16_t y) {
+  int hit = -1;
+  for (int i = 0; i < n; i++) {
+    Box& b = boxes[i];
+    if (y - b.y1 > ROW_GAP) continue;
+    if (x0 > b.x1 + GAP_BYTES || x1 + GAP_BYTES < b.x0) continue;
+    if (hit < 0) {
+      hit = i;
+      b = unite(b, {x0, x1, y, y});
+    } else {
+      boxes[hit] = unite(boxes[hit], b);
+      boxes[i--] = boxes[--n];
+    }
+  }
+  if (hit >= 0) return;
+
+  if (n == TRACKED) mergeCheapest(boxes, n);
+  boxes[n++] = {x0, x1, y, y};
+}
+
+// ---------------- Bitmap rows ----------------
+// The 8 bitmap bits that land in one frame byte, for a bitmap whose left
+// edge sits s pixels into its first byte. k is the bitmap byte under that
+// frame byte when s is 0.
+inline uint8_t shiftedByte(const uint8_t* row, int stride, int k, int s) {
+  uint8_t cur = k < stride ? row[k] : 0;
+  if (s == 0) return cur;
+  uint8_t prev = k > 0 ? row[k - 1] : 0;
+  return (uint8_t)((prev << (8 - s)) | (cur >> s));
+}
+
+// Set bits take fg, clear bits take bg (or stay as they are when not opaque)
+inline void blendByte(uint8_t& dst, uint8_t bits, uint8_t mask, uint8_t fg, uint8_t bg, bool opaque) {
+  if (!opaque) mask &= bits;
+  uint8_t out = (uint8_t)((bits & fg) | (~bits & bg));
+  dst = (uint8_t)((dst & ~mask) | (out & mask));
+}
+
+// Horizontal clip and shift of a w px wide source at x, worked out once and
+// shared by all of its rows
+struct Columns {
+  int first, last;           // frame bytes touched
+  uint8_t headMask, tailMask;
+  int s;                     // source left edge, pixels into its first frame byte
+  int q;                     // that frame byte (may be negative)
+  int width;                 // source bytes per row
+};
+
+bool clipColumns(int x, int w, int frameW, Columns& c) {
+  const int x0 = std::max(x, 0), x1 = std::min(x + w, frameW);
+  if (x0 >= x1) return false;
+  c.s = x & 7;               // also right for negative x
+  c.q = (x - c.s) / 8;
+  c.first = x0 >> 3;
+  c.last = (x1 - 1) >> 3;
+  c.headMask = (uint8_t)(0xFF >> (x0 & 7));
+  c.tailMask = (uint8_t)(0xFF << (7 - ((x1 - 1) & 7)));
+  if (c.first == c.last) c.headMask &= c.tailMask;
+  c.width = (w + 7) / 8;
+  return true;
+}
+
+void blendRow(uint8_t* dst, const uint8_t* from, const Columns& c, uint8_t fg, uint8_t bg, bool opaque) {
+  blendByte(dst[c.first], shiftedByte(from, c.width, c.first - c.q, c.s), c.headMask, fg, bg, opaque);
+  if (c.first == c.last) return;
+
+  if (c.s == 0 && opaque) {
+    // Aligned: a plain copy, inverted for black-on-white
+    const uint8_t* in = from + (c.first + 1 - c.q);
+    uint8_t* to = dst + c.first + 1;
+    int n = c.last - c.first - 1;
+    if (fg == 0xFF && bg == 0x00) {
+      memcpy(to, in, n);
+    } else {
+      for (int i = 0; i < n; i++) to[i] = (uint8_t)((in[i] & fg) | (~in[i] & bg));
+    }
+  } else {
+    for (int b = c.first + 1; b < c.last; b++) {
+      blendByte(dst[b], shiftedByte(from, c.width, b - c.q, c.s), 0xFF, fg, bg, opaque);
+    }
+  }
+
+  blendByte(dst[c.last], shiftedByte(from, c.width, c.last - c.q, c.s), c.tailMask, fg, bg, opaque);
+}
+
+// Masked edge bytes and a memset in between
+void fillSpan(uint8_t* dst, const Columns& c, uint8_t fill) {
+  dst[c.first] = (uint8_t)((dst[c.first] & ~c.headMask) | (fill & c.headMask));
+  if (c.first == c.last) return;
+  memset(dst + c.first + 1, fill, c.last - c.first - 1);
+  dst[c.last] = (uint8_t)((dst[c.last] & ~c.tailMask) | (fill & c.tailMask));
+}
+
+// ---------------- Packed bitmaps ----------------
+// Widest packed row drawn (the whole 800 px frame)
+static const int PACKED_ROW_BYTES = 100;
+
+// Walks the token stream of packed_bitmap.h
+struct RunReader {
+  const uint8_t* p;
+  int left = 0;      // bytes left in the current token
+  uint8_t kind = PACK_LITERAL;
+  uint8_t value = 0;
+
+  explicit RunReader(const uint8_t* data) : p(data) {}
+
+  // Up to n bytes of the current token (the next one if it is used up);
+  // for literals `src` points at them
+  int take(int n, const uint8_t*& src) {
+    if (left == 0) next();
+    int k = std::min(left, n);
+    left -= k;
+    src = p;
+    if (kind == PACK_LITERAL) p += k;
+    return k;
+  }
+
+  void next() {
+    uint8_t t = *p++;
+    if (t < PACK_ZERO) {
+      kind = PACK_LITERAL;
+      left = t + 1;
+    } else if (t < PACK_REPEAT) {
+      kind = PACK_ZERO;
+      left = (((t & 0x3F) << 8) | *p++) + 1;
+    } else {
+      kind = PACK_REPEAT;
+      left = (t & 0x3F) + 1;
+      value = *p++;
+    }
+  }
+};
+
+// Ink bits into frame byte j of a row, clipped to the columns
+inline void inkBits(uint8_t* dst, const Columns& c, int j, uint8_t bits, uint8_t fg) {
+  if (j < c.first || j > c.last) return;
+  if (j == c.first) bits &= c.headMask;
+  if (j == c.last) bits &= c.tailMask;
+  dst[j] = fg ? (uint8_t)(dst[j] | bits) : (uint8_t)(dst[j] & ~bits);
+}
+
+// Source byte k of a row, shifted into place
+inline void inkByte(uint8_t* dst, const Columns& c, int k, uint8_t b, uint8_t fg) {
+  inkBits(dst, c, c.q + k, (uint8_t)(b >> c.s), fg);
+  if (c.s) inkBits(dst, c, c.q + k + 1, (uint8_t)(b << (8 - c.s)), fg);
+}
+
+// ---------------- Glyph rows ----------------
+// Widest scaled glyph row handled here (FreeMonoBold24pt at 2x is 56 px)
+static const int GLYPH_ROW_BYTES = 16;
+
+// Each bit of a nibble doubled, for setTextSize(2)
+static const uint8_t DOUBLED_NIBBLE[16] = {
+  0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+  0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+
+// GFXfont glyphs are one bit stream with no row padding: row yy of a w px
+// wide glyph starts yy * w bits in. Pulls it out MSB-first, 16 bits at a time.
+void glyphRow(const uint8_t* bits, int bytes, int w, int yy, uint8_t* out) {
+  int pos = yy * w;
+  int k = pos >> 3, sh = pos & 7;
+  int n = (w + 7) / 8;
+  for (int i = 0; i < n; i++, k++) {
+    uint16_t window = (uint16_t)((bits[k] << 8) | (k + 1 < bytes ? bits[k + 1] : 0));
+    out[i] = (uint8_t)(window >> (8 - sh));
+  }
+  if (w & 7) out[n - 1] &= (uint8_t)(0xFF << (8 - (w & 7)));
+}
+
+// Row of w px widened by sx > 1
+void scaleRow(const uint8_t* in, int w, int sx, uint8_t* out) {
+  int n = (w + 7) / 8;
+  if (sx == 2) {
+    for (int i = 0; i < n; i++) {
+      out[2 * i] = DOUBLED_NIBBLE[in[i] >> 4];
+      out[2 * i + 1] = DOUBLED_NIBBLE[in[i] & 0x0F];
+    }
+  } else {
+    memset(out, 0, (w * sx + 7) / 8);
+    for (int b = 0; b < w; b++) {
+      if (!(in[b >> 3] & (0x80 >> (b & 7)))) continue;
+      for (int o = b * sx; o < (b + 1) * sx; o++) out[o >> 3] |= (uint8_t)(0x80 >> (o & 7));
+    }
+  }
+}
+
+}  // namespace
+
+EpdFrame::EpdFrame(GxEPD2_EPD& panel, uint16_t pageRows)
+    : GFXcanvas1(panel.WIDTH, panel.HEIGHT, false),
+      panel(panel),
+      pageRows(pageRows > 0 && pageRows < panel.HEIGHT ? pageRows : panel.HEIGHT),
+      pageEnd(this->pageRows) {}
+
+EpdFrame::~EpdFrame() {
+  free(frameAlloc);
+  free(shadowAlloc);
+  free(backAlloc);
+  buffer = nullptr;  // not GFXcanvas1's to free (buffer_owned stays false)
+}
+
+void EpdFrame::setBuffers(uint8_t* frame, uint8_t* shadow) {
+  buffer = frame;
+  this->shadow = shadow;
+}
+
+bool EpdFrame::begin(uint32_t serialDiagBitrate) {
+  panel.init(serialDiagBitrate);
+
+  if (!buffer) buffer = frameAlloc = (uint8_t*)malloc(bandBytes(WIDTH, pageRows));
+  if (!shadow) shadow = shadowAlloc = (uint8_t*)malloc(frameBytes());
+  if (!buffer || !shadow) {
+    Serial.println("[EPD] Not enough memory for the frame buffers");
+    return false;
+  }
+
+  // Optional; without it every screen is drawn when it is shown. A band
+  // can't hold the next screen.
+  if (EPD_RENDER_AHEAD && !paged() && !back) {
+    back = backAlloc = (uint8_t*)malloc(frameBytes());
+    if (!back) Serial.println("[EPD] No memory for render-ahead, screens are drawn when shown");
+  }
+  if (back) panel.setBusyCallback(onBusy, this);
+
+  fillScreen(GxEPD_WHITE);
+  shadowValid = false;
+  return true;
+}
+
+int EpdFrame::diff(Rect* out) {
+  if (!buffer || !shadow) return 0;
+
+  const int rowLen = rowBytes();
+  Box boxes[TRACKED];
+  int n = 0;
+
+  for (int16_t y = pageTop; y < pageEnd; y++) {
+    const uint8_t* now = row(y);
+    const uint8_t* shown = shadow + (size_t)y * rowLen;
+    if (memcmp(now, shown, rowLen) == 0) continue;
+
+    int x = 0;
+    while (x < rowLen) {
+      while (x < rowLen && now[x] == shown[x]) x++;
+      if (x == rowLen) break;
+      int x0 = x, x1 = x;
+      while (++x < rowLen && x - x1 <= GAP_BYTES) {
+        if (now[x] != shown[x]) x1 = x;
+      }
+      addSpan(boxes, n, x0, x1, y);
+    }
+  }
+
+  // Overlaps and near neighbours first, then whatever keeps us under the cap
+  while (n > 1 && (n > MAX_RECTS || cheapestWaste(boxes, n) < RECT_COST_BYTES)) {
+    mergeCheapest(boxes, n);
+  }
+
+  for (int i = 0; i < n; i++) {
+    out[i] = {(int16_t)(boxes[i].x0 * 8), boxes[i].y0,
+              (int16_t)((boxes[i].x1 - boxes[i].x0 + 1) * 8),
+              (int16_t)(boxes[i].y1 - boxes[i].y0 + 1)};
+  }
+  return n;
+}
+
+int EpdFrame::update() {
+  if (!buffer || !shadow || paged()) return 0;
+  if (!shadowValid) {
+    updateFull();
+    return 1;
+  }
+
+  Rect rects[MAX_RECTS];
+  int n = diff(rects);
+  if (n == 0) {
+    counters.skipped++;
+    return 0;
+  }
+
+  int16_t x0 = WIDTH, y0 = HEIGHT, x1 = 0, y1 = 0;
+  uint32_t regions = 0;
+  for (int i = 0; i < n; i++) {
+    const Rect& r = rects[i];
+    panel.writeImagePart(buffer, r.x, r.y, WIDTH, HEIGHT, r.x, r.y, r.w, r.h);
+    counters.bytes += (uint32_t)(r.w / 8) * r.h;
+    regions |= regionsOf(r);
+    x0 = std::min(x0, r.x);
+    y0 = std::min(y0, r.y);
+    x1 = std::max(x1, (int16_t)(r.x + r.w));
+    y1 = std::max(y1, (int16_t)(r.y + r.h));
+  }
+
+  // One refresh for all of them: with its partial window disabled the
+  // GDEY075T7 drives the whole glass on every partial refresh, so one per
+  // rectangle would only repeat the same ~0.5 s wait
+  panel.refresh(x0, y0, x1 - x0, y1 - y0);
+  if (panel.hasFastPartialUpdate) {
+    // Same second write GxEPD2_BW does for controllers that need it
+    for (int i = 0; i < n; i++) {
+      const Rect& r = rects[i];
+      panel.writeImagePartAgain(buffer, r.x, r.y, WIDTH, HEIGHT, r.x, r.y, r.w, r.h);
+    }
+  }
+
+  memcpy(shadow, buffer, frameBytes());
+  countPartial(regions);
+  counters.partial++;
+  counters.rects += n;
+  return n;
+}
+
+void EpdFrame::updateFull() {
+  if (!buffer || !shadow || paged()) return;
+
+  panel.writeImageForFullRefresh(buffer, 0, 0, WIDTH, HEIGHT);
+  panel.refresh(false);
+  if (panel.hasFastPartialUpdate) panel.writeImageAgain(buffer, 0, 0, WIDTH, HEIGHT);
+  panel.powerOff();
+
+  memcpy(shadow, buffer, frameBytes());
+  shadowValid = true;
+  countFull();
+  counters.full++;
+  counters.bytes += frameBytes();
+}
+
+// ---------------- Pages ----------------
+void EpdFrame::setPage(int16_t top) {
+  pageTop = top;
+  pageEnd = std::min<int16_t>(top + pageRows, HEIGHT);
+  if (paged()) fillScreen(GxEPD_WHITE);
+}
+
+void EpdFrame::firstPage(bool full) {
+  pageFull = full || !shadowValid;
+  pageAgain = false;
+  sentX0 = WIDTH;
+  sentY0 = HEIGHT;
+  sentX1 = sentY1 = 0;
+  pageRects = 0;
+  pageRegions = 0;
+  setPage(0);
+}
+
+// Bands are sent as they are drawn; the refresh waits for the last one.
+// Controllers that want the picture written again after a refresh
+// (hasFastPartialUpdate) get a second pass over all bands, as GxEPD2_BW
+// does, and the shadow follows in that pass: until then the bands still
+// diff the same against it.
+bool EpdFrame::nextPage() {
+  if (!paged()) {
+    if (pageFull) updateFull();
+    else update();
+    return false;
+  }
+  if (!buffer || !shadow) return false;
+
+  sendPage();
+  if (pageEnd < HEIGHT) {
+    setPage(pageEnd);
+    return true;
+  }
+
+  if (!pageAgain) {
+    if (pageFull) {
+      panel.refresh(false);
+    } else if (pageRects == 0) {
+      counters.skipped++;
+      setPage(0);
+      return false;
+    } else {
+      // One refresh for all bands, see update()
+      panel.refresh(sentX0, sentY0, sentX1 - sentX0, sentY1 - sentY0);
+    }
+    if (panel.hasFastPartialUpdate) {
+      pageAgain = true;
+      setPage(0);
+      return true;
+    }
+  }
+
+  if (pageFull) {
+    panel.powerOff();
+    shadowValid = true;
+    countFull();
+    counters.full++;
+  } else {
+    countPartial(pageRegions);
+    counters.partial++;
+    counters.rects += pageRects;
+  }
+  setPage(0);
+  return false;
+}
+
+void EpdFrame::sendPage() {
+  const int16_t rows = pageEnd - pageTop;
+  if (pageFull) {
+    if (!pageAgain) {
+      panel.writeImageForFullRefresh(buffer, 0, pageTop, WIDTH, rows);
+      counters.bytes += (uint32_t)rowBytes() * rows;
+    } else {
+      panel.writeImageAgain(buffer, 0, pageTop, WIDTH, rows);
+    }
+  } else {
+    Rect rects[MAX_RECTS];
+    int n = diff(rects);
+    for (int i = 0; i < n; i++) {
+      const Rect& r = rects[i];
+      if (pageAgain) {
+        panel.writeImagePartAgain(buffer, r.x, r.y - pageTop, WIDTH, rows, r.x, r.y, r.w, r.h);
+        continue;
+      }
+      panel.writeImagePart(buffer, r.x, r.y - pageTop, WIDTH, rows, r.x, r.y, r.w, r.h);
+      counters.bytes += (uint32_t)(r.w / 8) * r.h;
+      sentX0 = std::min(sentX0, r.x);
+      sentY0 = std::min(sentY0, r.y);
+      sentX1 = std::max(sentX1, (int16_t)(r.x + r.w));
+      sentY1 = std::max(sentY1, (int16_t)(r.y + r.h));
+      pageRegions |= regionsOf(r);
+    }
+    if (!pageAgain) pageRects += n;
+  }
+
+  if (pageAgain || !panel.hasFastPartialUpdate) {
+    memcpy(shadow + (size_t)pageTop * rowBytes(), buffer, (size_t)rowBytes() * rows);
+  }
+}
+
+void EpdFrame::drawPaged(RenderFn fn, int arg, bool full) {
+  firstPage(full);
+  do {
+    fn(*this, arg);
+  } while (nextPage());
+}
+
+// ---------------- Ghosting ----------------
+uint32_t EpdFrame::regionsOf(const Rect& r) const {
+  const int c0 = r.x * GHOST_COLS / WIDTH, c1 = (r.x + r.w - 1) * GHOST_COLS / WIDTH;
+  const int r0 = r.y * GHOST_ROWS / HEIGHT, r1 = (r.y + r.h - 1) * GHOST_ROWS / HEIGHT;
+  uint32_t bits = 0;
+  for (int row = r0; row <= r1; row++)
+    for (int col = c0; col <= c1; col++) bits |= 1UL << (row * GHOST_COLS + col);
+  return bits;
+}
+
+void EpdFrame::countPartial(uint32_t regions) {
+  for (int i = 0; i < GHOST_COLS * GHOST_ROWS; i++) {
+    if ((regions & (1UL << i)) && ghost[i] < UINT16_MAX) ghost[i]++;
+  }
+  lastRefreshMs = millis();
+}
+
+void EpdFrame::countFull() {
+  if (cleanupDue()) counters.cleanups++;
+  memset(ghost, 0, sizeof(ghost));
+  lastFullMs = lastRefreshMs = millis();
+}
+
+bool EpdFrame::cleanupDue() const {
+  bool any = false;
+  for (int i = 0; i < GHOST_COLS * GHOST_ROWS; i++) {
+    if (ghost[i] >= EPD_GHOST_PARTIALS) return true;
+    any |= ghost[i] > 0;
+  }
+  return any && millis() - lastFullMs >= EPD_GHOST_MINUTES * 60000UL;
+}
+
+void EpdFrame::renderAhead(RenderFn fn, int arg) {
+  if (!back) return;
+  aheadFn = fn;
+  aheadArg = arg;
+  aheadDrawn = false;
+}
+
+bool EpdFrame::takeAhead(RenderFn fn, int arg) {
+  bool hit = aheadDrawn && fn == aheadFn && arg == aheadArg;
+  if (hit) {
+    std::swap(buffer, back);
+    counters.aheadUsed++;
+  }
+  aheadFn = nullptr;
+  aheadDrawn = false;
+  return hit;
+}
+
+// Called by the driver in place of delay(1) while the panel is busy. The
+// frame itself is left alone; it may still be on its way to the controller.
+void EpdFrame::onBusy(const void* self) {
+  EpdFrame* f = (EpdFrame*)self;
+  if (!f->aheadFn || f->aheadDrawn) {
+    delay(1);
+    return;
+  }
+
+  std::swap(f->buffer, f->back);
+  f->aheadFn(*f, f->aheadArg);
+  std::swap(f->buffer, f->back);
+  f->aheadDrawn = true;
+  f->counters.ahead++;
+}
+
+void EpdFrame::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                          uint16_t color) {
+  if (!blit(x, y, bitmap, (w + 7) / 8, w, h, color, color, false))
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+}
+
+void EpdFrame::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                          uint16_t color, uint16_t bg) {
+  if (!blit(x, y, bitmap, (w + 7) / 8, w, h, color, bg, true))
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+}
+
+void EpdFrame::drawPacked(int16_t x, int16_t y, const PackedBitmap& bmp, uint16_t color) {
+  unpack(x, y, bmp, color, color, false);
+}
+
+void EpdFrame::drawPacked(int16_t x, int16_t y, const PackedBitmap& bmp, uint16_t color,
+                          uint16_t bg) {
+  unpack(x, y, bmp, color, bg, true);
+}
+
+// Only ink is written: opaque rows are first filled with bg as a span, then
+// every non-zero byte is shifted into place. White runs cost nothing, however
+// many rows they cover. A rotated frame gets whole decoded rows through
+// Adafruit_GFX instead.
+void EpdFrame::unpack(int16_t x, int16_t y, const PackedBitmap& bmp, uint16_t color, uint16_t bg,
+                      bool opaque) {
+  const int stride = (bmp.w + 7) / 8;
+  if (!buffer || stride > PACKED_ROW_BYTES) return;
+
+  const bool direct = getRotation() == 0;
+  Columns cols;
+  if (direct && !clipColumns(x, bmp.w, WIDTH, cols)) return;
+
+  const uint8_t fg = color ? 0xFF : 0x00;
+  const int yEnd = direct ? std::min<int>(y + bmp.h, pageEnd) : y + bmp.h;
+
+  RunReader in(bmp.data);
+  uint8_t line[PACKED_ROW_BYTES];
+  for (int fy = y; fy < yEnd; fy++) {
+    uint8_t* dst = direct && fy >= pageTop ? row(fy) : nullptr;
+    if (dst && opaque) fillSpan(dst, cols, bg ? 0xFF : 0x00);
+
+    for (int k = 0; k < stride;) {
+      const uint8_t* src;
+      int n = in.take(stride - k, src);
+      if (!direct) {
+        if (in.kind == PACK_LITERAL) memcpy(line + k, src, n);
+        else memset(line + k, in.kind == PACK_ZERO ? 0 : in.value, n);
+      } else if (dst && in.kind == PACK_REPEAT) {
+        for (int i = 0; i < n; i++) inkByte(dst, cols, k + i, in.value, fg);
+      } else if (dst && in.kind == PACK_LITERAL) {
+        for (int i = 0; i < n; i++) {
+          if (src[i]) inkByte(dst, cols, k + i, src[i], fg);
+        }
+      }
+      k += n;
+    }
+
+    if (direct) continue;
+    if (opaque) Adafruit_GFX::drawBitmap(x, fy, line, bmp.w, 1, color, bg);
+    else Adafruit_GFX::drawBitmap(x, fy, line, bmp.w, 1, color);
+  }
+}
+
+// Flash is memory-mapped on the ESP32, so PROGMEM bitmaps are read directly.
+// Returns false when the pixel path has to do it (rotated frame).
+bool EpdFrame::blit(int16_t x, int16_t y, const uint8_t* src, int stride, int16_t w, int16_t h,
+                    uint16_t color, uint16_t bg, bool opaque) {
+  if (!buffer || getRotation() != 0) return false;
+
+  Columns cols;
+  const int y0 = std::max<int>(y, pageTop), y1 = std::min<int>(y + h, pageEnd);
+  if (y0 >= y1 || !clipColumns(x, w, WIDTH, cols)) return true;
+
+  const uint8_t fg = color ? 0xFF : 0x00;
+  const uint8_t bgBits = opaque ? (bg ? 0xFF : 0x00) : fg;
+  for (int fy = y0; fy < y1; fy++) {
+    blendRow(row(fy), src + (size_t)(fy - y) * stride, cols, fg, bgBits, opaque);
+  }
+  return true;
+}
+
+void EpdFrame::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (!buffer || getRotation() != 0) {
+    GFXcanvas1::fillRect(x, y, w, h, color);
+    return;
+  }
+  // Negative sizes grow left/up, as GFXcanvas1's lines do
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+
+  Columns c;
+  const int y0 = std::max<int>(y, pageTop), y1 = std::min<int>(y + h, pageEnd);
+  if (y0 >= y1 || !clipColumns(x, w, WIDTH, c)) return;
+
+  const uint8_t fill = color ? 0xFF : 0x00;
+  const int rowLen = rowBytes();
+  uint8_t* dst = row(y0);
+  for (int yy = y0; yy < y1; yy++, dst += rowLen) fillSpan(dst, c, fill);
+}
+
+void EpdFrame::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (buffer && getRotation() == 0) fillRect(x, y, w, 1, color);
+  else if (paged()) Adafruit_GFX::drawFastHLine(x, y, w, color);
+  else GFXcanvas1::drawFastHLine(x, y, w, color);
+}
+
+// Paged, rotated lines go pixel by pixel through drawPixel(), the only
+// place that clips them to the band
+void EpdFrame::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (!paged()) GFXcanvas1::drawFastVLine(x, y, h, color);
+  else if (buffer && getRotation() == 0) fillRect(x, y, 1, h, color);
+  else Adafruit_GFX::drawFastVLine(x, y, h, color);
+}
+
+void EpdFrame::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!paged()) {
+    GFXcanvas1::drawPixel(x, y, color);
+    return;
+  }
+  if (!buffer) return;
+
+  // GFXcanvas1's rotation, then the band
+  int16_t t;
+  switch (getRotation()) {
+    case 1:
+      t = x;
+      x = WIDTH - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - 1 - t;
+      break;
+  }
+  if (x < 0 || x >= WIDTH || y < pageTop || y >= pageEnd) return;
+
+  uint8_t* p = row(y) + x / 8;
+  if (color) *p |= (uint8_t)(0x80 >> (x & 7));
+  else *p &= (uint8_t)~(0x80 >> (x & 7));
+}
+
+void EpdFrame::fillScreen(uint16_t color) {
+  if (buffer) memset(buffer, color ? 0xFF : 0x00, (size_t)rowBytes() * pageRows);
+}
+
+// Same cursor handling as Adafruit_GFX::write for custom fonts
+size_t EpdFrame::write(uint8_t c) {
+  if (!gfxFont || !buffer || getRotation() != 0) return Adafruit_GFX::write(c);
+
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+    return 1;
+  }
+  if (c == '\r' || c < gfxFont->first || c > gfxFont->last) return 1;
+
+  const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+  if (glyph->width > 0 && glyph->height > 0) {
+    if (wrap && cursor_x + textsize_x * (glyph->xOffset + glyph->width) > _width) {
+      cursor_x = 0;
+      cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+    }
+    drawGlyph(cursor_x, cursor_y, c, textcolor, textsize_x, textsize_y);
+  }
+  cursor_x += (int16_t)textsize_x * glyph->xAdvance;
+  return 1;
+}
+
+// Clipped once per glyph: rows above or below the frame are never unpacked,
+// columns share one Columns. Each row is unpacked, widened and blended into
+// sy frame rows.
+void EpdFrame::drawGlyph(int16_t x, int16_t y, uint8_t c, uint16_t color, uint8_t sx, uint8_t sy) {
+  const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+  const int w = glyph->width, h = glyph->height;
+  const int gx = x + glyph->xOffset * sx;
+  const int gy = y + glyph->yOffset * sy;
+  const int outW = w * sx;
+
+  if (gy >= pageEnd || gy + h * sy <= pageTop) return;
+  if ((outW + 7) / 8 > GLYPH_ROW_BYTES) {
+    Adafruit_GFX::drawChar(x, y, c, color, color, sx, sy);
+    return;
+  }
+  Columns cols;
+  if (!clipColumns(gx, outW, WIDTH, cols)) return;
+
+  const uint8_t* bits = gfxFont->bitmap + glyph->bitmapOffset;
+  const int bytes = (w * h + 7) / 8;
+  const int rowFirst = gy < pageTop ? (pageTop - gy) / sy : 0;
+  const int rowEnd = std::min(h, (pageEnd - gy + sy - 1) / sy);
+  const uint8_t fg = color ? 0xFF : 0x00;
+
+  uint8_t line[GLYPH_ROW_BYTES];
+  uint8_t scaled[GLYPH_ROW_BYTES];
+  for (int yy = rowFirst; yy < rowEnd; yy++) {
+    glyphRow(bits, bytes, w, yy, line);
+    const uint8_t* out = line;
+    if (sx > 1) {
+      scaleRow(line, w, sx, scaled);
+      out = scaled;
+    }
+    const int top = std::max<int>(gy + yy * sy, pageTop);
+    const int bottom = std::min<int>(gy + (yy + 1) * sy, pageEnd);
+    for (int fy = top; fy < bottom; fy++) blendRow(row(fy), out, cols, fg, fg, false);
+  }
+}
+
+void EpdFrame::printStats(Print& out) const {
+  out.printf("[EPD] full %lu (%lu cleanups) | partial %lu (%lu rects) | skipped %lu | sent %lu B"
+             " | ahead %lu (%lu used)\n",
+             (unsigned long)counters.full, (unsigned long)counters.cleanups,
+             (unsigned long)counters.partial, (unsigned long)counters.rects,
+             (unsigned long)counters.skipped, (unsigned long)counters.bytes,
+             (unsigned long)counters.ahead, (unsigned long)counters.aheadUsed);
+
+  out.printf("[EPD] partials per region since the last full (%lu s ago, budget %d / %d min)%s\n",
+             (unsigned long)((millis() - lastFullMs) / 1000), EPD_GHOST_PARTIALS, EPD_GHOST_MINUTES,
+             cleanupDue() ? ", cleanup due" : "");
+  for (int row = 0; row < GHOST_ROWS; row++) {
+    out.print("[EPD]  ");
+    for (int col = 0; col < GHOST_COLS; col++) out.printf(" %4u", (unsigned)ghostCount(col, row));
+    out.println();
+  }
+}
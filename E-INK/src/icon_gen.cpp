@@ -0,0 +1,3039 @@
+// Generated by scripts/pack_icons.py from assets/icons.json. Do not edit.
+#include "icon_gen.h"
+
+// 200x200, 5000 -> 1333 bytes
+static const uint8_t unknown_200_rle[] PROGMEM = {
+  0x83, 0xf2, 0x03, 0x07, 0xff, 0xff, 0xe0, 0x80, 0x14, 0xc3, 0xff, 0x80, 0x13, 0x00, 0x0f, 0xc3,
+  0xff, 0x00, 0xe0, 0x80, 0x12, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xfe, 0x80, 0x11, 0x00, 0x03, 0xc5,
+  0xff, 0x00, 0x80, 0x80, 0x10, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0xf0, 0x80, 0x10, 0x00, 0x3f, 0xc5,
+  0xff, 0x00, 0xfc, 0x80, 0x10, 0x04, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xc2, 0xff, 0x80, 0x0f, 0x09,
+  0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x0e, 0x02, 0x0f, 0xff, 0xfc,
+  0x80, 0x03, 0x02, 0x7f, 0xff, 0xe0, 0x80, 0x0e, 0x02, 0x1f, 0xff, 0xe0, 0x80, 0x03, 0x02, 0x0f,
+  0xff, 0xf8, 0x80, 0x0e, 0x02, 0x7f, 0xff, 0x80, 0x80, 0x03, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x0e,
+  0x01, 0xff, 0xfc, 0x80, 0x05, 0x01, 0x7f, 0xff, 0x80, 0x0d, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x05,
+  0x02, 0x1f, 0xff, 0x80, 0x80, 0x0c, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x05, 0x02, 0x07, 0xff, 0xc0,
+  0x80, 0x0c, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x05, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x0c, 0x01, 0x1f,
+  0xfe, 0x80, 0x07, 0x01, 0xff, 0xf8, 0x80, 0x0c, 0x01, 0x3f, 0xfc, 0x80, 0x07, 0x01, 0x3f, 0xfc,
+  0x80, 0x0c, 0x01, 0x7f, 0xf0, 0x80, 0x07, 0x01, 0x1f, 0xfe, 0x80, 0x0c, 0x01, 0xff, 0xe0, 0x80,
+  0x07, 0x01, 0x0f, 0xff, 0x80, 0x0b, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x02, 0x03, 0xff, 0x80,
+  0x80, 0x0a, 0x02, 0x03, 0xff, 0x80, 0x80, 0x07, 0x02, 0x01, 0xff, 0x80, 0x80, 0x0a, 0x01, 0x07,
+  0xff, 0x80, 0x09, 0x01, 0xff, 0xc0, 0x80, 0x0a, 0x01, 0x0f, 0xfe, 0x80, 0x09, 0x01, 0x7f, 0xe0,
+  0x80, 0x0a, 0x01, 0x0f, 0xfc, 0x80, 0x09, 0x01, 0x3f, 0xf0, 0x80, 0x0a, 0x01, 0x1f, 0xf8, 0x80,
+  0x09, 0x01, 0x1f, 0xf8, 0x80, 0x0a, 0x01, 0x3f, 0xf0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x0a,
+  0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xfc, 0x80, 0x0a, 0x01, 0x7f, 0xc0, 0x80, 0x09, 0x01,
+  0x07, 0xfe, 0x80, 0x0a, 0x01, 0xff, 0xc0, 0x80, 0x09, 0x01, 0x03, 0xfe, 0x80, 0x08, 0x03, 0x0f,
+  0xff, 0xff, 0x80, 0x80, 0x09, 0x01, 0x01, 0xff, 0x80, 0x08, 0xc2, 0xff, 0x80, 0x0a, 0x01, 0x01,
+  0xff, 0x80, 0x07, 0x00, 0x07, 0xc2, 0xff, 0x80, 0x0b, 0x01, 0xff, 0x80, 0x80, 0x06, 0x03, 0x3f,
+  0xff, 0xff, 0xfe, 0x80, 0x0b, 0x01, 0xff, 0x80, 0x80, 0x06, 0xc2, 0xff, 0x00, 0xfe, 0x80, 0x0b,
+  0x01, 0x7f, 0xc0, 0x80, 0x05, 0x00, 0x03, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xc0,
+  0x80, 0x05, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0b, 0x01, 0x3f, 0xe0, 0x80, 0x05, 0x02,
+  0x3f, 0xff, 0xfc, 0x80, 0x0d, 0x01, 0x3f, 0xe0, 0x80, 0x05, 0x02, 0x7f, 0xff, 0xc0, 0x80, 0x0d,
+  0x01, 0x1f, 0xe0, 0x80, 0x05, 0x01, 0xff, 0xfe, 0x80, 0x0e, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x02,
+  0x03, 0xff, 0xf0, 0x80, 0x0e, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x0e,
+  0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x0f, 0xff, 0x80, 0x0f, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x01,
+  0x1f, 0xfe, 0x80, 0x0f, 0x01, 0x07, 0xff, 0x80, 0x04, 0x01, 0x3f, 0xf8, 0x80, 0x0f, 0x02, 0x07,
+  0xff, 0xf8, 0x80, 0x03, 0x01, 0x7f, 0xf0, 0x80, 0x0f, 0x02, 0x07, 0xff, 0xff, 0x80, 0x03, 0x01,
+  0xff, 0xe0, 0x80, 0x0f, 0x03, 0x07, 0xff, 0xff, 0xe0, 0x80, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x0f,
+  0x08, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xff, 0x80, 0x80, 0x0f, 0x07, 0x03, 0xff, 0xff,
+  0xfe, 0x00, 0x00, 0x03, 0xff, 0x80, 0x10, 0x00, 0x03, 0xc2, 0xff, 0x03, 0x80, 0x00, 0x07, 0xfe,
+  0x80, 0x11, 0x06, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xfc, 0x80, 0x12, 0x05, 0x1f, 0xff, 0xe0,
+  0x00, 0x0f, 0xf8, 0x80, 0x12, 0x05, 0x03, 0xff, 0xf8, 0x00, 0x0f, 0xf8, 0x80, 0x13, 0x04, 0x7f,
+  0xfc, 0x00, 0x1f, 0xf0, 0x80, 0x13, 0x04, 0x3f, 0xfe, 0x00, 0x1f, 0xf0, 0x80, 0x13, 0x04, 0x0f,
+  0xff, 0x00, 0x3f, 0xe0, 0x80, 0x13, 0x04, 0x03, 0xff, 0x80, 0x3f, 0xe0, 0x80, 0x13, 0x04, 0x01,
+  0xff, 0x80, 0x3f, 0xc0, 0x80, 0x14, 0x03, 0xff, 0xc0, 0x7f, 0xc0, 0x80, 0x14, 0x03, 0x7f, 0xe0,
+  0x7f, 0x80, 0x80, 0x14, 0x03, 0x3f, 0xf0, 0x7f, 0x80, 0x80, 0x14, 0x03, 0x1f, 0xf0, 0x7f, 0x80,
+  0x80, 0x14, 0x03, 0x0f, 0xf8, 0xff, 0x80, 0x80, 0x14, 0x02, 0x0f, 0xf8, 0xff, 0x80, 0x15, 0x02,
+  0x07, 0xfc, 0xff, 0x80, 0x0a, 0x00, 0x06, 0x80, 0x09, 0x02, 0x07, 0xfc, 0xff, 0x80, 0x0a, 0x00,
+  0x0f, 0x80, 0x09, 0x02, 0x03, 0xfc, 0xff, 0x80, 0x0a, 0x01, 0x1f, 0x80, 0x80, 0x08, 0x02, 0x03,
+  0xfe, 0xff, 0x80, 0x0a, 0x01, 0x3f, 0xc0, 0x80, 0x08, 0x02, 0x01, 0xfe, 0xff, 0x80, 0x0a, 0x01,
+  0xff, 0xe0, 0x80, 0x08, 0x02, 0x01, 0xfe, 0xff, 0x80, 0x09, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x08,
+  0x02, 0x01, 0xff, 0xff, 0x80, 0x09, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x09, 0x01, 0xff, 0xff, 0x80,
+  0x09, 0x02, 0x07, 0xff, 0xfe, 0x80, 0x09, 0x01, 0xff, 0xff, 0x80, 0x09, 0x02, 0x0f, 0xff, 0xff,
+  0x80, 0x09, 0x01, 0xff, 0xff, 0x80, 0x09, 0x03, 0x1f, 0xff, 0xff, 0x80, 0x80, 0x08, 0x01, 0xff,
+  0xff, 0x80, 0x09, 0x03, 0x3f, 0xff, 0xff, 0xc0, 0x80, 0x08, 0x02, 0xff, 0xff, 0x80, 0x80, 0x08,
+  0x03, 0x7f, 0xff, 0xff, 0xe0, 0x80, 0x08, 0x02, 0xff, 0x7f, 0x80, 0x80, 0x07, 0x00, 0x01, 0xc2,
+  0xff, 0x00, 0xf0, 0x80, 0x08, 0x02, 0xff, 0x7f, 0x80, 0x80, 0x07, 0x00, 0x03, 0xc2, 0xff, 0x00,
+  0xfc, 0x80, 0x08, 0x02, 0xff, 0x7f, 0x80, 0x80, 0x07, 0x04, 0x07, 0xff, 0xbf, 0xdf, 0xfe, 0x80,
+  0x08, 0x02, 0xff, 0x7f, 0xc0, 0x80, 0x07, 0x04, 0x0f, 0xfe, 0x3f, 0xcf, 0xff, 0x80, 0x08, 0x02,
+  0xff, 0x3f, 0xc0, 0x80, 0x07, 0x05, 0x1f, 0xfc, 0x3f, 0xc7, 0xff, 0x80, 0x80, 0x07, 0x02, 0xff,
+  0x3f, 0xe0, 0x80, 0x07, 0x05, 0x3f, 0xf8, 0x3f, 0xc1, 0xff, 0xc0, 0x80, 0x06, 0x03, 0x01, 0xff,
+  0x3f, 0xe0, 0x80, 0x07, 0x05, 0x7f, 0xf0, 0x3f, 0xc0, 0xff, 0xe0, 0x80, 0x06, 0x03, 0x01, 0xfe,
+  0x1f, 0xf0, 0x80, 0x07, 0x05, 0xff, 0xe0, 0x3f, 0xc0, 0x7f, 0xf0, 0x80, 0x06, 0x03, 0x01, 0xfe,
+  0x1f, 0xf0, 0x80, 0x06, 0x06, 0x03, 0xff, 0xc0, 0x3f, 0xc0, 0x3f, 0xf8, 0x80, 0x06, 0x03, 0x03,
+  0xfe, 0x0f, 0xf8, 0x80, 0x06, 0x06, 0x07, 0xff, 0x80, 0x3f, 0xc0, 0x1f, 0xfe, 0x80, 0x06, 0x03,
+  0x03, 0xfe, 0x0f, 0xfc, 0x80, 0x06, 0x06, 0x07, 0xff, 0x00, 0x3f, 0xc0, 0x0f, 0xfe, 0x80, 0x06,
+  0x03, 0x03, 0xfc, 0x07, 0xfc, 0x80, 0x06, 0x06, 0x03, 0xfc, 0x00, 0x3f, 0xc0, 0x07, 0xfc, 0x80,
+  0x06, 0x03, 0x07, 0xfc, 0x07, 0xfe, 0x80, 0x06, 0x06, 0x01, 0xf8, 0x00, 0x3f, 0xc0, 0x01, 0xf8,
+  0x80, 0x06, 0x03, 0x0f, 0xf8, 0x03, 0xff, 0x80, 0x07, 0x05, 0xf0, 0x00, 0x3f, 0xc0, 0x00, 0xf0,
+  0x80, 0x06, 0x04, 0x0f, 0xf8, 0x01, 0xff, 0x80, 0x80, 0x06, 0x05, 0x60, 0x00, 0x3f, 0xc0, 0x00,
+  0x60, 0x80, 0x06, 0x04, 0x1f, 0xf0, 0x00, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x08,
+  0x04, 0x3f, 0xf0, 0x00, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x08, 0x04, 0x7f, 0xe0,
+  0x00, 0x7f, 0xf0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x08, 0x04, 0xff, 0xc0, 0x00, 0x3f, 0xf8,
+  0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x07, 0x05, 0x01, 0xff, 0xc0, 0x00, 0x1f, 0xfe, 0x80, 0x08,
+  0x01, 0x3f, 0xc0, 0x80, 0x07, 0x05, 0x03, 0xff, 0x80, 0x00, 0x0f, 0xff, 0x80, 0x08, 0x01, 0x3f,
+  0xc0, 0x80, 0x07, 0x06, 0x07, 0xff, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x3f, 0xc0,
+  0x80, 0x07, 0x06, 0x1f, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80,
+  0x07, 0x01, 0x7f, 0xfc, 0x80, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x06,
+  0x02, 0x01, 0xff, 0xf8, 0x80, 0x02, 0x02, 0x7f, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x3f, 0xc0, 0x80,
+  0x06, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x02, 0x02, 0x3f, 0xff, 0xfe, 0x80, 0x06, 0x01, 0x3f, 0xc0,
+  0x80, 0x06, 0x02, 0xff, 0xff, 0xe0, 0x80, 0x02, 0x00, 0x0f, 0xc6, 0xff, 0x05, 0xe0, 0x00, 0x3f,
+  0xc0, 0x00, 0x7f, 0xc6, 0xff, 0x00, 0x80, 0x80, 0x02, 0x00, 0x03, 0xc6, 0xff, 0x04, 0xe0, 0x00,
+  0x3f, 0xc0, 0x00, 0xc7, 0xff, 0x80, 0x04, 0xc6, 0xff, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x00, 0xc6,
+  0xff, 0x00, 0xfc, 0x80, 0x04, 0x00, 0x3f, 0xc5, 0xff, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x00, 0xc6,
+  0xff, 0x00, 0xf0, 0x80, 0x04, 0x00, 0x07, 0xc5, 0xff, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x00, 0xc6,
+  0xff, 0x00, 0x80, 0x80, 0x05, 0xc5, 0xff, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x00, 0xc5, 0xff, 0x00,
+  0xfc, 0x80, 0x06, 0x00, 0x0f, 0xc4, 0xff, 0x04, 0xe0, 0x00, 0x3f, 0xc0, 0x00, 0xc5, 0xff, 0x00,
+  0xc0, 0x80, 0x0e, 0x01, 0x3f, 0xc0, 0x80, 0x16, 0x01, 0x3f, 0xc0, 0x80, 0x16, 0x01, 0x3f, 0xc0,
+  0x80, 0x16, 0x01, 0x3f, 0xc0, 0x80, 0x16, 0x01, 0x3f, 0xc0, 0x80, 0x16, 0x01, 0x3f, 0xc0, 0x80,
+  0x16, 0x01, 0x3f, 0xc0, 0x80, 0x16, 0x01, 0x3f, 0xc0, 0x80, 0x16, 0x01, 0x3f, 0xc0, 0x80, 0x16,
+  0x01, 0x3f, 0xc0, 0x83, 0xf2,
+};
+static constexpr PackedBitmap unknown_200 = {200, 200, unknown_200_rle};
+
+// 200x200, 5000 -> 1719 bytes
+static const uint8_t sun_200_rle[] PROGMEM = {
+  0x81, 0x50, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff,
+  0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff,
+  0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff,
+  0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff,
+  0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff,
+  0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x0e, 0x01, 0x01,
+  0x80, 0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0x01, 0x80, 0x80, 0x05, 0x01, 0x03, 0xc0, 0x80,
+  0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0x03, 0xc0, 0x80, 0x05, 0x01, 0x07, 0xe0, 0x80, 0x06, 0x00,
+  0xff, 0x80, 0x06, 0x01, 0x07, 0xe0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x06, 0x00, 0xff, 0x80,
+  0x06, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x1f, 0xf8, 0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01,
+  0x1f, 0xf8, 0x80, 0x05, 0x01, 0x1f, 0xfe, 0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0x7f, 0xf8,
+  0x80, 0x05, 0x01, 0x0f, 0xff, 0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0xff, 0xf0, 0x80, 0x05,
+  0x02, 0x07, 0xff, 0x80, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x05,
+  0x02, 0x03, 0xff, 0xc0, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x06,
+  0x01, 0xff, 0xe0, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x01, 0x07, 0xff, 0x80, 0x07, 0x01, 0x7f,
+  0xf0, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x01, 0x0f, 0xfe, 0x80, 0x07, 0x01, 0x3f, 0xf8, 0x80,
+  0x0c, 0x01, 0x1f, 0xfc, 0x80, 0x07, 0x01, 0x1f, 0xfe, 0x80, 0x0c, 0x01, 0x7f, 0xf8, 0x80, 0x07,
+  0x01, 0x0f, 0xff, 0x80, 0x0c, 0x01, 0xff, 0xf0, 0x80, 0x07, 0x02, 0x07, 0xff, 0x80, 0x80, 0x0a,
+  0x02, 0x01, 0xff, 0xe0, 0x80, 0x07, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x0a, 0x02, 0x03, 0xff, 0xc0,
+  0x80, 0x08, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x01, 0x07, 0xff, 0x80, 0x09, 0x01, 0x7f, 0xf0, 0x80,
+  0x0a, 0x01, 0x0f, 0xfe, 0x80, 0x09, 0x01, 0x3f, 0xfc, 0x80, 0x0a, 0x01, 0x3f, 0xfc, 0x80, 0x09,
+  0x01, 0x1f, 0xfe, 0x80, 0x0a, 0x01, 0x7f, 0xf8, 0x80, 0x09, 0x01, 0x0f, 0xff, 0x80, 0x03, 0x02,
+  0x03, 0xff, 0xc0, 0x80, 0x03, 0x01, 0xff, 0xf0, 0x80, 0x09, 0x02, 0x07, 0xff, 0x80, 0x80, 0x02,
+  0xc2, 0xff, 0x80, 0x02, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x09, 0x05, 0x03, 0xff, 0xc0, 0x00, 0x00,
+  0x0f, 0xc2, 0xff, 0x05, 0xf0, 0x00, 0x00, 0x03, 0xff, 0x80, 0x80, 0x0a, 0x04, 0xff, 0xe0, 0x00,
+  0x00, 0x7f, 0xc2, 0xff, 0x04, 0xfe, 0x00, 0x00, 0x07, 0xff, 0x80, 0x0b, 0x03, 0x7f, 0xf0, 0x00,
+  0x03, 0xc4, 0xff, 0x03, 0xc0, 0x00, 0x0f, 0xfe, 0x80, 0x0b, 0x03, 0x3f, 0xf0, 0x00, 0x0f, 0xc4,
+  0xff, 0x03, 0xf0, 0x00, 0x0f, 0xfc, 0x80, 0x0b, 0x03, 0x1f, 0xe0, 0x00, 0x3f, 0xc4, 0xff, 0x03,
+  0xfc, 0x00, 0x07, 0xf8, 0x80, 0x0b, 0x02, 0x0f, 0x80, 0x00, 0xc2, 0xff, 0x00, 0xc3, 0xc2, 0xff,
+  0x02, 0x00, 0x01, 0xf0, 0x80, 0x0b, 0x0c, 0x07, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff,
+  0xff, 0x80, 0x00, 0xe0, 0x80, 0x0d, 0x02, 0x07, 0xff, 0xfc, 0x80, 0x02, 0x02, 0x3f, 0xff, 0xe0,
+  0x80, 0x0f, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x02, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x0f, 0x02, 0x3f,
+  0xff, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x0f, 0x01, 0x7f, 0xfe, 0x80, 0x04, 0x01,
+  0x7f, 0xfe, 0x80, 0x0f, 0x01, 0xff, 0xf8, 0x80, 0x04, 0x01, 0x1f, 0xff, 0x80, 0x0e, 0x02, 0x01,
+  0xff, 0xe0, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x0d, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x04,
+  0x02, 0x03, 0xff, 0xc0, 0x80, 0x0d, 0x01, 0x07, 0xff, 0x80, 0x06, 0x01, 0xff, 0xe0, 0x80, 0x0d,
+  0x01, 0x0f, 0xfe, 0x80, 0x06, 0x01, 0x7f, 0xf0, 0x80, 0x0d, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x01,
+  0x3f, 0xf8, 0x80, 0x0d, 0x01, 0x3f, 0xf8, 0x80, 0x06, 0x01, 0x1f, 0xfc, 0x80, 0x0d, 0x01, 0x3f,
+  0xf0, 0x80, 0x06, 0x01, 0x0f, 0xfc, 0x80, 0x0d, 0x01, 0x7f, 0xe0, 0x80, 0x06, 0x01, 0x07, 0xfe,
+  0x80, 0x0d, 0x01, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x0d, 0x01, 0xff, 0x80, 0x80,
+  0x06, 0x01, 0x01, 0xff, 0x80, 0x0c, 0x01, 0x01, 0xff, 0x80, 0x08, 0x01, 0xff, 0x80, 0x80, 0x0b,
+  0x01, 0x03, 0xff, 0x80, 0x08, 0x01, 0xff, 0xc0, 0x80, 0x0b, 0x01, 0x03, 0xfe, 0x80, 0x08, 0x01,
+  0x7f, 0xc0, 0x80, 0x0b, 0x01, 0x07, 0xfc, 0x80, 0x08, 0x01, 0x3f, 0xe0, 0x80, 0x0b, 0x01, 0x07,
+  0xfc, 0x80, 0x08, 0x01, 0x3f, 0xe0, 0x80, 0x0b, 0x01, 0x07, 0xf8, 0x80, 0x08, 0x01, 0x1f, 0xe0,
+  0x80, 0x0b, 0x01, 0x0f, 0xf8, 0x80, 0x08, 0x01, 0x1f, 0xf0, 0x80, 0x0b, 0x01, 0x0f, 0xf0, 0x80,
+  0x08, 0x01, 0x0f, 0xf0, 0x80, 0x0b, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x0f, 0xf0, 0x80, 0x0b,
+  0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x0f, 0xf8, 0x80, 0x0b, 0x01, 0x1f, 0xe0, 0x80, 0x08, 0x01,
+  0x07, 0xf8, 0x80, 0x0b, 0x01, 0x1f, 0xe0, 0x80, 0x08, 0x01, 0x07, 0xf8, 0x80, 0x0b, 0x01, 0x3f,
+  0xe0, 0x80, 0x08, 0x01, 0x07, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xe0, 0x80, 0x08, 0x01, 0x07, 0xfc,
+  0x80, 0x0b, 0x01, 0x3f, 0xc0, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xc0, 0x80,
+  0x08, 0x01, 0x03, 0xfc, 0x80, 0x05, 0xc3, 0xff, 0x03, 0xfc, 0x00, 0x3f, 0xc0, 0x80, 0x08, 0x03,
+  0x03, 0xfc, 0x00, 0x7f, 0xc7, 0xff, 0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x80, 0x08, 0x03, 0x03, 0xfc,
+  0x00, 0x7f, 0xc7, 0xff, 0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x80, 0x08, 0x03, 0x03, 0xfc, 0x00, 0x7f,
+  0xc7, 0xff, 0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x80, 0x08, 0x03, 0x03, 0xfc, 0x00, 0x7f, 0xc7, 0xff,
+  0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x80, 0x08, 0x03, 0x03, 0xfc, 0x00, 0x7f, 0xc7, 0xff, 0x03, 0xfe,
+  0x00, 0x3f, 0xc0, 0x80, 0x08, 0x03, 0x03, 0xfc, 0x00, 0x7f, 0xc7, 0xff, 0x03, 0xfe, 0x00, 0x3f,
+  0xc0, 0x80, 0x08, 0x03, 0x03, 0xfc, 0x00, 0x7f, 0xc3, 0xff, 0x80, 0x05, 0x01, 0x3f, 0xc0, 0x80,
+  0x08, 0x01, 0x03, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xc0, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x0b,
+  0x01, 0x3f, 0xe0, 0x80, 0x08, 0x01, 0x07, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xe0, 0x80, 0x08, 0x01,
+  0x07, 0xfc, 0x80, 0x0b, 0x01, 0x1f, 0xe0, 0x80, 0x08, 0x01, 0x07, 0xf8, 0x80, 0x0b, 0x01, 0x1f,
+  0xe0, 0x80, 0x08, 0x01, 0x07, 0xf8, 0x80, 0x0b, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x0f, 0xf8,
+  0x80, 0x0b, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x0f, 0xf8, 0x80, 0x0b, 0x01, 0x0f, 0xf0, 0x80,
+  0x08, 0x01, 0x0f, 0xf0, 0x80, 0x0b, 0x01, 0x0f, 0xf8, 0x80, 0x08, 0x01, 0x1f, 0xf0, 0x80, 0x0b,
+  0x01, 0x0f, 0xf8, 0x80, 0x08, 0x01, 0x1f, 0xf0, 0x80, 0x0b, 0x01, 0x07, 0xfc, 0x80, 0x08, 0x01,
+  0x3f, 0xe0, 0x80, 0x0b, 0x01, 0x07, 0xfc, 0x80, 0x08, 0x01, 0x3f, 0xe0, 0x80, 0x0b, 0x01, 0x03,
+  0xfe, 0x80, 0x08, 0x01, 0x7f, 0xc0, 0x80, 0x0b, 0x01, 0x03, 0xfe, 0x80, 0x08, 0x01, 0x7f, 0xc0,
+  0x80, 0x0b, 0x01, 0x01, 0xff, 0x80, 0x08, 0x01, 0xff, 0x80, 0x80, 0x0b, 0x02, 0x01, 0xff, 0x80,
+  0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x0c, 0x01, 0xff, 0x80, 0x80, 0x06, 0x01, 0x01, 0xff,
+  0x80, 0x0d, 0x01, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x0d, 0x01, 0x7f, 0xe0, 0x80,
+  0x06, 0x01, 0x07, 0xfe, 0x80, 0x0d, 0x01, 0x3f, 0xf0, 0x80, 0x06, 0x01, 0x0f, 0xfc, 0x80, 0x0d,
+  0x01, 0x1f, 0xf8, 0x80, 0x06, 0x01, 0x1f, 0xf8, 0x80, 0x0d, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x01,
+  0x3f, 0xf8, 0x80, 0x0d, 0x01, 0x0f, 0xfe, 0x80, 0x06, 0x01, 0x7f, 0xf0, 0x80, 0x0d, 0x02, 0x07,
+  0xff, 0x80, 0x80, 0x04, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x0d, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x04,
+  0x02, 0x03, 0xff, 0xc0, 0x80, 0x0d, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x04, 0x02, 0x0f, 0xff, 0x80,
+  0x80, 0x0e, 0x01, 0xff, 0xf8, 0x80, 0x04, 0x01, 0x1f, 0xff, 0x80, 0x0f, 0x01, 0x3f, 0xfe, 0x80,
+  0x04, 0x01, 0x7f, 0xfe, 0x80, 0x0f, 0x02, 0x1f, 0xff, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0xf8,
+  0x80, 0x0f, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x0d, 0x04, 0x02,
+  0x00, 0x03, 0xff, 0xfe, 0x80, 0x02, 0x04, 0x7f, 0xff, 0xc0, 0x00, 0xc0, 0x80, 0x0b, 0x0c, 0x07,
+  0x80, 0x01, 0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0x80, 0x01, 0xe0, 0x80, 0x0b, 0x03, 0x0f,
+  0xc0, 0x00, 0x7f, 0xc4, 0xff, 0x03, 0xfe, 0x00, 0x03, 0xf0, 0x80, 0x0b, 0x03, 0x1f, 0xe0, 0x00,
+  0x1f, 0xc4, 0xff, 0x03, 0xf8, 0x00, 0x07, 0xf8, 0x80, 0x0b, 0x03, 0x3f, 0xf0, 0x00, 0x07, 0xc4,
+  0xff, 0x03, 0xe0, 0x00, 0x0f, 0xfc, 0x80, 0x0b, 0x03, 0xff, 0xf0, 0x00, 0x01, 0xc4, 0xff, 0x03,
+  0x80, 0x00, 0x0f, 0xfe, 0x80, 0x0a, 0x05, 0x01, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xc2, 0xff, 0x05,
+  0xfc, 0x00, 0x00, 0x07, 0xff, 0x80, 0x80, 0x09, 0x05, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xc2,
+  0xff, 0x05, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x80, 0x09, 0x02, 0x07, 0xff, 0x80, 0x80, 0x02,
+  0x02, 0x7f, 0xff, 0xfe, 0x80, 0x02, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xfe, 0x80,
+  0x0a, 0x01, 0xff, 0xf0, 0x80, 0x09, 0x01, 0x1f, 0xfc, 0x80, 0x0a, 0x01, 0x3f, 0xf8, 0x80, 0x09,
+  0x01, 0x3f, 0xf8, 0x80, 0x0a, 0x01, 0x1f, 0xfc, 0x80, 0x09, 0x01, 0xff, 0xf0, 0x80, 0x0a, 0x01,
+  0x0f, 0xff, 0x80, 0x08, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x07, 0xff, 0x80, 0x80, 0x07,
+  0x02, 0x03, 0xff, 0xc0, 0x80, 0x0a, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x07, 0x02, 0x07, 0xff, 0x80,
+  0x80, 0x0a, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x07, 0x01, 0x0f, 0xfe, 0x80, 0x0c, 0x01, 0x7f, 0xf0,
+  0x80, 0x07, 0x01, 0x1f, 0xfc, 0x80, 0x0c, 0x01, 0x3f, 0xf8, 0x80, 0x07, 0x01, 0x7f, 0xf8, 0x80,
+  0x0c, 0x01, 0x1f, 0xfc, 0x80, 0x07, 0x01, 0xff, 0xf0, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x01,
+  0x0f, 0xff, 0x80, 0x06, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x02, 0x07,
+  0xff, 0x80, 0x80, 0x05, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x02, 0x03,
+  0xff, 0xc0, 0x80, 0x05, 0x01, 0x07, 0xff, 0x80, 0x06, 0x00, 0xff, 0x80, 0x05, 0x02, 0x01, 0xff,
+  0xe0, 0x80, 0x05, 0x01, 0x0f, 0xfe, 0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0x7f, 0xf0, 0x80,
+  0x05, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0x3f, 0xf8, 0x80, 0x05, 0x01,
+  0x1f, 0xf8, 0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0x1f, 0xf8, 0x80, 0x05, 0x01, 0x0f, 0xf0,
+  0x80, 0x06, 0x00, 0xff, 0x80, 0x06, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xe0, 0x80, 0x06,
+  0x00, 0xff, 0x80, 0x06, 0x01, 0x07, 0xe0, 0x80, 0x05, 0x01, 0x03, 0xc0, 0x80, 0x06, 0x00, 0xff,
+  0x80, 0x06, 0x01, 0x03, 0xc0, 0x80, 0x0e, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00,
+  0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00,
+  0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00,
+  0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00,
+  0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00,
+  0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00, 0xff, 0x80, 0x17, 0x00,
+  0xff, 0x80, 0x17, 0x00, 0xff, 0x81, 0x50,
+};
+static constexpr PackedBitmap sun_200 = {200, 200, sun_200_rle};
+
+// 200x200, 5000 -> 2090 bytes
+static const uint8_t moon_200_rle[] PROGMEM = {
+  0x80, 0xa0, 0x03, 0x03, 0xff, 0xff, 0x80, 0x80, 0x14, 0x03, 0x01, 0xff, 0xff, 0xfe, 0x80, 0x15,
+  0xc2, 0xff, 0x00, 0xe0, 0x80, 0x14, 0x03, 0x7f, 0xff, 0xff, 0xfe, 0x80, 0x14, 0x00, 0x3f, 0xc2,
+  0xff, 0x00, 0xc0, 0x80, 0x13, 0x00, 0x3f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x13, 0x00, 0x1f, 0xc3,
+  0xff, 0x80, 0x13, 0x00, 0x0f, 0xc3, 0xff, 0x00, 0xc0, 0x80, 0x12, 0x00, 0x0f, 0xc3, 0xff, 0x00,
+  0xf0, 0x80, 0x12, 0x00, 0x07, 0xc3, 0xff, 0x00, 0xfc, 0x80, 0x12, 0x00, 0x03, 0xc4, 0xff, 0x80,
+  0x12, 0x00, 0x03, 0xc4, 0xff, 0x00, 0xc0, 0x80, 0x11, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xf0, 0x80,
+  0x11, 0x02, 0x01, 0xff, 0xf0, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x12, 0x05, 0xff, 0xf0, 0x0f, 0xff,
+  0xff, 0xfe, 0x80, 0x12, 0x02, 0xff, 0xf8, 0x01, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x11, 0x06, 0x7f,
+  0xf8, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x80, 0x11, 0x06, 0x7f, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xe0,
+  0x80, 0x11, 0x06, 0x3f, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x80, 0x11, 0x06, 0x3f, 0xfc, 0x00,
+  0x00, 0x7f, 0xff, 0xfc, 0x80, 0x11, 0x06, 0x3f, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x80, 0x11,
+  0x07, 0x1f, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x80, 0x10, 0x07, 0x1f, 0xfe, 0x00, 0x00,
+  0x03, 0xff, 0xff, 0xc0, 0x80, 0x10, 0x01, 0x0f, 0xfe, 0x80, 0x02, 0x02, 0xff, 0xff, 0xe0, 0x80,
+  0x10, 0x01, 0x0f, 0xff, 0x80, 0x02, 0x02, 0x7f, 0xff, 0xf0, 0x80, 0x10, 0x01, 0x0f, 0xff, 0x80,
+  0x02, 0x02, 0x1f, 0xff, 0xf8, 0x80, 0x10, 0x01, 0x0f, 0xff, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xfc,
+  0x80, 0x10, 0x01, 0x07, 0xff, 0x80, 0x02, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x10, 0x07, 0x07, 0xff,
+  0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x10, 0x02, 0x07, 0xff, 0x80, 0x80, 0x02, 0x02, 0xff,
+  0xff, 0x80, 0x80, 0x0f, 0x02, 0x07, 0xff, 0x80, 0x80, 0x02, 0x02, 0x3f, 0xff, 0xc0, 0x80, 0x0f,
+  0x02, 0x03, 0xff, 0x80, 0x80, 0x02, 0x02, 0x1f, 0xff, 0xe0, 0x80, 0x0f, 0x02, 0x03, 0xff, 0x80,
+  0x80, 0x02, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x0f, 0x02, 0x03, 0xff, 0x80, 0x80, 0x02, 0x02, 0x07,
+  0xff, 0xf8, 0x80, 0x0f, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x02, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x0f,
+  0x02, 0x03, 0xff, 0xc0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x0f, 0x02, 0x03, 0xff, 0xc0,
+  0x80, 0x03, 0x01, 0xff, 0xfe, 0x80, 0x0f, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x03, 0x01, 0x7f, 0xff,
+  0x80, 0x0f, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x3f, 0xff, 0x80, 0x80, 0x0e, 0x02, 0x01,
+  0xff, 0xc0, 0x80, 0x03, 0x02, 0x1f, 0xff, 0xc0, 0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03,
+  0x02, 0x0f, 0xff, 0xc0, 0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xe0,
+  0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x0e, 0x02, 0x01,
+  0xff, 0xc0, 0x80, 0x03, 0x02, 0x03, 0xff, 0xf0, 0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03,
+  0x02, 0x01, 0xff, 0xf8, 0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x01, 0xff, 0xfc, 0x80,
+  0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x01, 0xff, 0xfc, 0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0,
+  0x80, 0x04, 0x01, 0x7f, 0xfe, 0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x3f, 0xfe,
+  0x80, 0x0e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x3f, 0xff, 0x80, 0x0e, 0x02, 0x01, 0xff,
+  0xc0, 0x80, 0x04, 0x01, 0x1f, 0xff, 0x80, 0x0e, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x04, 0x02, 0x0f,
+  0xff, 0x80, 0x80, 0x0d, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x04, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x0d,
+  0x02, 0x03, 0xff, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x0d, 0x02, 0x03, 0xff, 0xc0,
+  0x80, 0x04, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x0d, 0x02, 0x03, 0xff, 0x80, 0x80, 0x04, 0x02, 0x03,
+  0xff, 0xe0, 0x80, 0x0d, 0x02, 0x03, 0xff, 0x80, 0x80, 0x04, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x0d,
+  0x02, 0x03, 0xff, 0x80, 0x80, 0x04, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x0d, 0x02, 0x07, 0xff, 0x80,
+  0x80, 0x05, 0x01, 0xff, 0xf0, 0x80, 0x0d, 0x02, 0x07, 0xff, 0x80, 0x80, 0x05, 0x01, 0xff, 0xf0,
+  0x80, 0x0d, 0x02, 0x07, 0xff, 0x80, 0x80, 0x05, 0x01, 0xff, 0xf8, 0x80, 0x0d, 0x01, 0x07, 0xff,
+  0x80, 0x06, 0x01, 0x7f, 0xf8, 0x80, 0x0d, 0x01, 0x0f, 0xff, 0x80, 0x06, 0x01, 0x7f, 0xfc, 0x80,
+  0x0d, 0x01, 0x0f, 0xff, 0x80, 0x06, 0x01, 0x3f, 0xfc, 0x80, 0x0d, 0x01, 0x0f, 0xff, 0x80, 0x06,
+  0x01, 0x3f, 0xfc, 0x80, 0x0d, 0x01, 0x0f, 0xfe, 0x80, 0x06, 0x01, 0x1f, 0xfe, 0x80, 0x0d, 0x01,
+  0x1f, 0xfe, 0x80, 0x06, 0x01, 0x1f, 0xfe, 0x80, 0x0d, 0x01, 0x1f, 0xfe, 0x80, 0x06, 0x01, 0x1f,
+  0xfe, 0x80, 0x0d, 0x01, 0x3f, 0xfc, 0x80, 0x06, 0x01, 0x0f, 0xff, 0x80, 0x0d, 0x01, 0x3f, 0xfc,
+  0x80, 0x06, 0x01, 0x0f, 0xff, 0x80, 0x0d, 0x01, 0x3f, 0xfc, 0x80, 0x06, 0x01, 0x0f, 0xff, 0x80,
+  0x0d, 0x01, 0x7f, 0xfc, 0x80, 0x06, 0x01, 0x07, 0xff, 0x80, 0x0d, 0x01, 0x7f, 0xf8, 0x80, 0x06,
+  0x02, 0x07, 0xff, 0x80, 0x80, 0x0c, 0x01, 0xff, 0xf8, 0x80, 0x06, 0x02, 0x07, 0xff, 0x80, 0x80,
+  0x0c, 0x01, 0xff, 0xf0, 0x80, 0x06, 0x02, 0x07, 0xff, 0x80, 0x80, 0x0b, 0x02, 0x01, 0xff, 0xf0,
+  0x80, 0x06, 0x02, 0x03, 0xff, 0x80, 0x80, 0x0b, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x06, 0x02, 0x03,
+  0xff, 0xc0, 0x80, 0x0b, 0x02, 0x03, 0xff, 0xe0, 0x80, 0x06, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x0b,
+  0x02, 0x03, 0xff, 0xe0, 0x80, 0x06, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x0b, 0x02, 0x07, 0xff, 0xc0,
+  0x80, 0x06, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x0b, 0x02, 0x0f, 0xff, 0xc0, 0x80, 0x06, 0x02, 0x01,
+  0xff, 0xc0, 0x80, 0x0b, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x06, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x0b,
+  0x01, 0x1f, 0xff, 0x80, 0x07, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0x3f, 0xff, 0x80, 0x07,
+  0x02, 0x01, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0x3f, 0xfe, 0x80, 0x07, 0x02, 0x01, 0xff, 0xe0, 0x80,
+  0x0b, 0x01, 0x7f, 0xfe, 0x80, 0x07, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0xff, 0xfc, 0x80,
+  0x08, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x08, 0x01, 0xff, 0xe0, 0x80,
+  0x0a, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x08, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x03, 0xff, 0xf0,
+  0x80, 0x08, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x07, 0xff, 0xe0, 0x80, 0x08, 0x01, 0xff, 0xe0,
+  0x80, 0x0a, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x08, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x1f, 0xff,
+  0xc0, 0x80, 0x08, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x3f, 0xff, 0x80, 0x80, 0x08, 0x01, 0xff,
+  0xe0, 0x80, 0x0a, 0x01, 0x7f, 0xff, 0x80, 0x09, 0x01, 0xff, 0xe0, 0x80, 0x0a, 0x01, 0xff, 0xff,
+  0x80, 0x09, 0x01, 0xff, 0xe0, 0x80, 0x09, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x09, 0x01, 0xff, 0xe0,
+  0x80, 0x09, 0x02, 0x07, 0xff, 0xfc, 0x80, 0x09, 0x01, 0xff, 0xe0, 0x80, 0x09, 0x02, 0x0f, 0xff,
+  0xf8, 0x80, 0x09, 0x01, 0xff, 0xe0, 0x80, 0x09, 0x02, 0x1f, 0xff, 0xf0, 0x80, 0x09, 0x02, 0xff,
+  0xe0, 0x0c, 0x80, 0x08, 0x02, 0x7f, 0xff, 0xe0, 0x80, 0x09, 0x02, 0xff, 0xe0, 0x0e, 0x80, 0x08,
+  0x02, 0xff, 0xff, 0xc0, 0x80, 0x09, 0x03, 0xff, 0xe0, 0x0f, 0x80, 0x80, 0x06, 0x03, 0x03, 0xff,
+  0xff, 0x80, 0x80, 0x09, 0x03, 0xff, 0xe0, 0x0f, 0xc0, 0x80, 0x06, 0x02, 0x0f, 0xff, 0xff, 0x80,
+  0x0a, 0x03, 0xff, 0xe0, 0x0f, 0xf0, 0x80, 0x06, 0x02, 0x3f, 0xff, 0xfe, 0x80, 0x0a, 0x03, 0xff,
+  0xe0, 0x0f, 0xfc, 0x80, 0x06, 0x02, 0x7f, 0xff, 0xfc, 0x80, 0x09, 0x04, 0x01, 0xff, 0xe0, 0x07,
+  0xff, 0x80, 0x05, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x09, 0x05, 0x01, 0xff, 0xe0, 0x07, 0xff,
+  0xe0, 0x80, 0x04, 0x03, 0x0f, 0xff, 0xff, 0xe0, 0x80, 0x09, 0x05, 0x01, 0xff, 0xe0, 0x07, 0xff,
+  0xf8, 0x80, 0x04, 0x03, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x09, 0x06, 0x01, 0xff, 0xe0, 0x07, 0xff,
+  0xff, 0x80, 0x80, 0x02, 0x00, 0x03, 0xc2, 0xff, 0x80, 0x0a, 0x06, 0x01, 0xff, 0xc0, 0x07, 0xff,
+  0xff, 0xf8, 0x80, 0x02, 0x03, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x0a, 0x03, 0x01, 0xff, 0xc0, 0x07,
+  0xc2, 0xff, 0x02, 0xe0, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0a, 0x03, 0x01, 0xff, 0xc0,
+  0x07, 0xc8, 0xff, 0x00, 0xe0, 0x80, 0x0a, 0x03, 0x03, 0xff, 0xc0, 0x07, 0xc8, 0xff, 0x00, 0xc0,
+  0x80, 0x0a, 0x03, 0x03, 0xff, 0xc0, 0x03, 0xc8, 0xff, 0x80, 0x0b, 0x03, 0x03, 0xff, 0xc0, 0x03,
+  0xc7, 0xff, 0x00, 0xfc, 0x80, 0x0b, 0x03, 0x03, 0xff, 0x80, 0x03, 0xc7, 0xff, 0x00, 0xf0, 0x80,
+  0x0b, 0x03, 0x07, 0xff, 0x80, 0x03, 0xc7, 0xff, 0x00, 0xc0, 0x80, 0x0b, 0x03, 0x07, 0xff, 0x80,
+  0x01, 0xc6, 0xff, 0x00, 0xfe, 0x80, 0x0c, 0x03, 0x07, 0xff, 0x80, 0x01, 0xc6, 0xff, 0x00, 0xf0,
+  0x80, 0x0c, 0x05, 0x07, 0xff, 0x00, 0x01, 0xff, 0xe7, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x0c, 0x06,
+  0x0f, 0xff, 0x00, 0x01, 0xff, 0xe0, 0x3f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0d, 0x06, 0x0f, 0xff,
+  0x00, 0x00, 0xff, 0xf0, 0x03, 0xc2, 0xff, 0x80, 0x0e, 0x05, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xf0,
+  0x80, 0x12, 0x05, 0x1f, 0xfe, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x12, 0x05, 0x1f, 0xfe, 0x00, 0x00,
+  0x7f, 0xf8, 0x80, 0x12, 0x05, 0x1f, 0xfe, 0x00, 0x00, 0x7f, 0xf8, 0x80, 0x12, 0x05, 0x3f, 0xfc,
+  0x00, 0x00, 0x7f, 0xfc, 0x80, 0x12, 0x05, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x80, 0x12, 0x05,
+  0x7f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x80, 0x12, 0x05, 0x7f, 0xf8, 0x00, 0x00, 0x1f, 0xfe, 0x80,
+  0x12, 0x05, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xfe, 0x80, 0x12, 0x05, 0xff, 0xf0, 0x00, 0x00, 0x1f,
+  0xff, 0x80, 0x12, 0x05, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x11, 0x07, 0x01, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0x80, 0x80, 0x10, 0x07, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0x80,
+  0x80, 0x10, 0x07, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x80, 0x10, 0x07, 0x07, 0xff,
+  0xc0, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x80, 0x10, 0x07, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff,
+  0xe0, 0x80, 0x10, 0x07, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x80, 0x10, 0x07, 0x0f,
+  0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x80, 0x10, 0x01, 0x1f, 0xff, 0x80, 0x03, 0x01, 0xff,
+  0xf8, 0x80, 0x10, 0x01, 0x3f, 0xff, 0x80, 0x03, 0x01, 0xff, 0xf8, 0x80, 0x10, 0x01, 0x3f, 0xfe,
+  0x80, 0x03, 0x01, 0x7f, 0xfc, 0x80, 0x10, 0x01, 0x7f, 0xfe, 0x80, 0x03, 0x01, 0x7f, 0xfe, 0x80,
+  0x10, 0x01, 0xff, 0xfc, 0x80, 0x03, 0x01, 0x3f, 0xff, 0x80, 0x10, 0x01, 0xff, 0xf8, 0x80, 0x03,
+  0x01, 0x1f, 0xff, 0x80, 0x0f, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x03, 0x02, 0x1f, 0xff, 0x80, 0x80,
+  0x0e, 0x02, 0x03, 0xff, 0xf0, 0x80, 0x03, 0x02, 0x0f, 0xff, 0xc0, 0x80, 0x0e, 0x02, 0x07, 0xff,
+  0xf0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xe0, 0x80, 0x0e, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x03, 0x02,
+  0x07, 0xff, 0xf0, 0x80, 0x0e, 0x02, 0x0f, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x03, 0xff, 0xf0, 0x80,
+  0x0e, 0x02, 0x1f, 0xff, 0x80, 0x80, 0x03, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x0e, 0x02, 0x3f, 0xff,
+  0x80, 0x80, 0x03, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x0e, 0x01, 0x7f, 0xff, 0x80, 0x05, 0x01, 0xff,
+  0xfe, 0x80, 0x0e, 0x01, 0xff, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0xff, 0x80, 0x0d, 0x02, 0x01, 0xff,
+  0xfc, 0x80, 0x05, 0x02, 0x3f, 0xff, 0x80, 0x80, 0x0c, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x05, 0x02,
+  0x1f, 0xff, 0xc0, 0x80, 0x0c, 0x02, 0x07, 0xff, 0xf8, 0x80, 0x05, 0x02, 0x0f, 0xff, 0xe0, 0x80,
+  0x0c, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x05, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x0c, 0x02, 0x1f, 0xff,
+  0xe0, 0x80, 0x05, 0x02, 0x07, 0xff, 0xfc, 0x80, 0x0c, 0x02, 0x7f, 0xff, 0xc0, 0x80, 0x05, 0x02,
+  0x03, 0xff, 0xfe, 0x80, 0x0c, 0x02, 0xff, 0xff, 0x80, 0x80, 0x05, 0x02, 0x01, 0xff, 0xff, 0x80,
+  0x0b, 0x02, 0x01, 0xff, 0xff, 0x80, 0x07, 0x02, 0xff, 0xff, 0xc0, 0x80, 0x0a, 0x02, 0x03, 0xff,
+  0xfe, 0x80, 0x07, 0x02, 0x7f, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x0f, 0xff, 0xfc, 0x80, 0x07, 0x02,
+  0x3f, 0xff, 0xf0, 0x80, 0x0a, 0x02, 0x1f, 0xff, 0xf8, 0x80, 0x07, 0x02, 0x1f, 0xff, 0xfc, 0x80,
+  0x0a, 0x02, 0x7f, 0xff, 0xf0, 0x80, 0x07, 0x02, 0x0f, 0xff, 0xfe, 0x80, 0x0a, 0x02, 0xff, 0xff,
+  0xe0, 0x80, 0x07, 0x03, 0x03, 0xff, 0xff, 0x80, 0x80, 0x08, 0x03, 0x03, 0xff, 0xff, 0xc0, 0x80,
+  0x07, 0x03, 0x01, 0xff, 0xff, 0xe0, 0x80, 0x08, 0x03, 0x0f, 0xff, 0xff, 0x80, 0x80, 0x08, 0x02,
+  0xff, 0xff, 0xf8, 0x80, 0x08, 0x02, 0x3f, 0xff, 0xfe, 0x80, 0x09, 0x02, 0x7f, 0xff, 0xfe, 0x80,
+  0x08, 0x02, 0xff, 0xff, 0xfc, 0x80, 0x09, 0x03, 0x1f, 0xff, 0xff, 0x80, 0x80, 0x06, 0x03, 0x03,
+  0xff, 0xff, 0xf8, 0x80, 0x09, 0x03, 0x0f, 0xff, 0xff, 0xe0, 0x80, 0x06, 0x03, 0x0f, 0xff, 0xff,
+  0xe0, 0x80, 0x09, 0x03, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x06, 0x03, 0x7f, 0xff, 0xff, 0xc0, 0x80,
+  0x09, 0x00, 0x01, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x04, 0x00, 0x01, 0xc2, 0xff, 0x80, 0x0b, 0xc2,
+  0xff, 0x00, 0xf0, 0x80, 0x04, 0x03, 0x1f, 0xff, 0xff, 0xfe, 0x80, 0x0b, 0x00, 0x3f, 0xc2, 0xff,
+  0x80, 0x03, 0x00, 0x01, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0b, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xf0,
+  0x80, 0x02, 0x00, 0x1f, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x0b, 0x00, 0x07, 0xc3, 0xff, 0x02, 0xf0,
+  0x00, 0x0f, 0xc3, 0xff, 0x00, 0xc0, 0x80, 0x0b, 0x00, 0x01, 0xca, 0xff, 0x80, 0x0d, 0x00, 0x7f,
+  0xc8, 0xff, 0x00, 0xfc, 0x80, 0x0d, 0x00, 0x1f, 0xc8, 0xff, 0x00, 0xf0, 0x80, 0x0d, 0x00, 0x03,
+  0xc8, 0xff, 0x00, 0xc0, 0x80, 0x0e, 0xc7, 0xff, 0x00, 0xfe, 0x80, 0x0f, 0x00, 0x1f, 0xc6, 0xff,
+  0x00, 0xf8, 0x80, 0x0f, 0x00, 0x03, 0xc6, 0xff, 0x00, 0xc0, 0x80, 0x10, 0x00, 0x7f, 0xc4, 0xff,
+  0x00, 0xfc, 0x80, 0x11, 0x00, 0x0f, 0xc4, 0xff, 0x00, 0xe0, 0x80, 0x12, 0x00, 0x7f, 0xc2, 0xff,
+  0x00, 0xfc, 0x80, 0x13, 0x00, 0x01, 0xc2, 0xff, 0x80, 0x55,
+};
+static constexpr PackedBitmap moon_200 = {200, 200, moon_200_rle};
+
+// 200x200, 5000 -> 1632 bytes
+static const uint8_t cloud_sun_200_rle[] PROGMEM = {
+  0x82, 0x91, 0x00, 0x7f, 0x80, 0x17, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16,
+  0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01,
+  0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f,
+  0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80,
+  0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80,
+  0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x10, 0x00, 0x03, 0x80, 0x04, 0x01,
+  0x7f, 0x80, 0x80, 0x03, 0x00, 0x30, 0x80, 0x0b, 0x01, 0x07, 0x80, 0x80, 0x03, 0x01, 0x7f, 0x80,
+  0x80, 0x03, 0x00, 0x78, 0x80, 0x0b, 0x01, 0x0f, 0xc0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x03,
+  0x00, 0xfc, 0x80, 0x0b, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x01,
+  0xfe, 0x80, 0x0b, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xff,
+  0x80, 0x0b, 0x01, 0x3f, 0xf8, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x07, 0xfe, 0x80,
+  0x0b, 0x01, 0x1f, 0xfc, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x0f, 0xfc, 0x80, 0x0b,
+  0x01, 0x0f, 0xfe, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x1f, 0xf8, 0x80, 0x0b, 0x01,
+  0x07, 0xff, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xf0, 0x80, 0x0b, 0x02, 0x01,
+  0xff, 0x80, 0x80, 0x07, 0x01, 0x7f, 0xe0, 0x80, 0x0c, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x01, 0xff,
+  0xc0, 0x80, 0x0c, 0x01, 0x7f, 0xe0, 0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x0c, 0x01, 0x3f,
+  0xf0, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x0d, 0x01, 0x1f, 0xf8, 0x80, 0x06, 0x01, 0x07, 0xfe,
+  0x80, 0x0d, 0x01, 0x0f, 0xfc, 0x80, 0x06, 0x01, 0x0f, 0xfc, 0x80, 0x0d, 0x01, 0x07, 0xfe, 0x80,
+  0x06, 0x01, 0x1f, 0xf8, 0x80, 0x0d, 0x0a, 0x03, 0xff, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00,
+  0x7f, 0xf0, 0x80, 0x0d, 0x0a, 0x01, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x00, 0xff, 0xe0,
+  0x80, 0x0e, 0x02, 0xff, 0xc0, 0x01, 0xc2, 0xff, 0x03, 0xe0, 0x01, 0xff, 0xc0, 0x80, 0x0e, 0x02,
+  0x7f, 0xc0, 0x07, 0xc2, 0xff, 0x03, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x0e, 0x02, 0x3f, 0x80, 0x1f,
+  0xc2, 0xff, 0x02, 0xfe, 0x00, 0x7f, 0x80, 0x0f, 0x02, 0x1f, 0x00, 0x7f, 0xc3, 0xff, 0x01, 0x00,
+  0x3e, 0x80, 0x0f, 0x01, 0x0e, 0x00, 0xc4, 0xff, 0x01, 0xc0, 0x1c, 0x80, 0x0f, 0x08, 0x04, 0x01,
+  0xff, 0xfe, 0x00, 0x3f, 0xff, 0xe0, 0x08, 0x80, 0x10, 0x06, 0x07, 0xff, 0xe0, 0x00, 0x03, 0xff,
+  0xf0, 0x80, 0x11, 0x06, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x7f, 0xf8, 0x80, 0x11, 0x01, 0x1f, 0xfe,
+  0x80, 0x02, 0x01, 0x3f, 0xfc, 0x80, 0x11, 0x01, 0x3f, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xfe, 0x80,
+  0x11, 0x01, 0x3f, 0xf0, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x11, 0x01, 0x7f, 0xe0, 0x80, 0x02,
+  0x05, 0x01, 0xff, 0x80, 0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x05, 0xff,
+  0x80, 0x07, 0xff, 0xff, 0xf0, 0x80, 0x0b, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x02, 0x7f, 0xc0,
+  0x7f, 0xc2, 0xff, 0x80, 0x0b, 0x01, 0x01, 0xff, 0x80, 0x04, 0x01, 0x3f, 0xe3, 0xc3, 0xff, 0x00,
+  0xe0, 0x80, 0x0a, 0x01, 0x03, 0xfe, 0x80, 0x04, 0x00, 0x1f, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x0a,
+  0x01, 0x03, 0xfc, 0x80, 0x04, 0x00, 0x1f, 0xc4, 0xff, 0x00, 0xfe, 0x80, 0x0a, 0x01, 0x07, 0xfc,
+  0x80, 0x04, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x09, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x00,
+  0x07, 0xc5, 0xff, 0x00, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07, 0x0f, 0xff, 0xfe,
+  0x00, 0x00, 0x3f, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07, 0x1f, 0xff, 0xe0,
+  0x00, 0x00, 0x03, 0xff, 0xfc, 0x80, 0x09, 0x01, 0x0f, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xff, 0x80,
+  0x03, 0x01, 0x7f, 0xff, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01, 0xff, 0xfc, 0x80, 0x03,
+  0x02, 0x1f, 0xff, 0x80, 0x80, 0x08, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x02, 0x01, 0xff, 0xf0, 0x80,
+  0x03, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x02, 0x03, 0xff, 0xc0,
+  0x80, 0x03, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x01, 0x0f, 0xff,
+  0x80, 0x05, 0x01, 0x7f, 0xf0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01, 0x1f, 0xfe, 0x80,
+  0x05, 0x01, 0x3f, 0xf8, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01, 0x3f, 0xf8, 0x80, 0x05,
+  0x01, 0x1f, 0xfc, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x03, 0x01, 0x3f, 0xf0,
+  0x80, 0x05, 0x01, 0x07, 0xfe, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x03, 0x01,
+  0x7f, 0xe0, 0x80, 0x05, 0x01, 0x03, 0xff, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80,
+  0x03, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0,
+  0x3f, 0xc0, 0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x06, 0x01, 0xff, 0xc0, 0x80, 0x03, 0xc2,
+  0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x07, 0x01, 0x7f, 0xe0, 0x80,
+  0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x03, 0xfe, 0x80, 0x07, 0x01, 0x3f,
+  0xe0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x07, 0xfc, 0x80, 0x07,
+  0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xf8, 0x80, 0x07, 0x01,
+  0x0f, 0xf8, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xf0, 0x80, 0x07, 0x01, 0x0f,
+  0xf8, 0x80, 0x07, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x07, 0xfc,
+  0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x00, 0x01, 0xbf, 0xe0, 0x80, 0x07, 0x01, 0x03, 0xfc, 0x80,
+  0x07, 0x06, 0x1f, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x01, 0xfe, 0x80, 0x07,
+  0x06, 0x1f, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x01, 0xfe, 0x80, 0x07, 0x06,
+  0x0f, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x08, 0x00, 0xff, 0x80, 0x07, 0x02, 0x0f, 0xf0,
+  0x01, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x08, 0x00, 0xff, 0x80, 0x07, 0x02, 0x0f, 0xf8, 0x07, 0xc2,
+  0xff, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x02, 0x07, 0xf8, 0x1f, 0xc2, 0xff, 0x80, 0x09,
+  0x01, 0x7f, 0x80, 0x80, 0x06, 0x05, 0x07, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x09, 0x01, 0x3f,
+  0x80, 0x80, 0x06, 0x04, 0x03, 0xfe, 0x7f, 0xff, 0x80, 0x80, 0x0a, 0x01, 0x3f, 0xc0, 0x80, 0x06,
+  0x03, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xc0, 0x80, 0x06, 0x03, 0x01, 0xff, 0xff,
+  0xe0, 0x80, 0x0b, 0x01, 0x1f, 0xc0, 0x80, 0x07, 0x02, 0xff, 0xff, 0x80, 0x80, 0x0b, 0x01, 0x1f,
+  0xe0, 0x80, 0x07, 0x01, 0xff, 0xfe, 0x80, 0x0c, 0x01, 0x1f, 0xe0, 0x80, 0x07, 0x01, 0x7f, 0xfc,
+  0x80, 0x0c, 0x01, 0x0f, 0xff, 0x80, 0x07, 0x01, 0x3f, 0xf8, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xf0,
+  0x80, 0x06, 0x01, 0x3f, 0xf0, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xfc, 0x80, 0x06, 0x01, 0x7f, 0xc0,
+  0x80, 0x0c, 0x02, 0x0f, 0xff, 0xff, 0x80, 0x06, 0x01, 0xff, 0x80, 0x80, 0x0c, 0x03, 0x0f, 0xff,
+  0xff, 0xc0, 0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x0c, 0x03, 0x07, 0xff, 0xff, 0xe0, 0x80, 0x04,
+  0x01, 0x01, 0xff, 0x80, 0x0d, 0x03, 0x07, 0xff, 0xff, 0xf8, 0x80, 0x04, 0x01, 0x03, 0xfe, 0x80,
+  0x0e, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x04, 0x01, 0x03, 0xfc, 0x80, 0x0f, 0x01, 0x3f, 0xfe, 0x80,
+  0x04, 0x01, 0x07, 0xfc, 0x80, 0x0f, 0x01, 0x0f, 0xff, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x0f,
+  0x02, 0x03, 0xff, 0x80, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x0f, 0x02, 0x01, 0xff, 0xc0, 0x80,
+  0x03, 0x01, 0x0f, 0xf0, 0x80, 0x10, 0x01, 0x7f, 0xc0, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x10,
+  0x01, 0x3f, 0xe0, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x10, 0x01, 0x1f, 0xf0, 0x80, 0x03, 0x01,
+  0x1f, 0xe0, 0x80, 0x10, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10, 0x01, 0x0f,
+  0xf8, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xc0,
+  0x80, 0x10, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10, 0x01, 0x03, 0xfc, 0x80,
+  0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x10,
+  0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x3f,
+  0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03,
+  0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0x7f,
+  0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x11,
+  0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xe0,
+  0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01,
+  0x1f, 0xe0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x00, 0x7f, 0x80,
+  0x03, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x00,
+  0xff, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80,
+  0x11, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x07, 0xfc, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01,
+  0x03, 0xfc, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xfe, 0x80, 0x10, 0x01, 0x03,
+  0xfc, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80, 0x10, 0x01, 0x03, 0xfc, 0x80, 0x04, 0x01, 0xff, 0x80,
+  0x80, 0x0f, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80, 0x0f, 0x01, 0x0f, 0xf8, 0x80,
+  0x04, 0x01, 0x7f, 0xc0, 0x80, 0x0f, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x0f,
+  0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xf8, 0x80, 0x0f, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01,
+  0x1f, 0xfc, 0x80, 0x0f, 0x01, 0x7f, 0xe0, 0x80, 0x04, 0x01, 0x0f, 0xfe, 0x80, 0x0e, 0x02, 0x01,
+  0xff, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x0d, 0x02, 0x03, 0xff, 0x80, 0x80, 0x04,
+  0x02, 0x03, 0xff, 0xe0, 0x80, 0x0d, 0x01, 0x0f, 0xff, 0x80, 0x05, 0x02, 0x01, 0xff, 0xfc, 0x80,
+  0x0d, 0x01, 0x3f, 0xfe, 0x80, 0x06, 0x02, 0x7f, 0xff, 0x80, 0x80, 0x0b, 0x02, 0x01, 0xff, 0xfc,
+  0x80, 0x06, 0x00, 0x3f, 0xcf, 0xff, 0x00, 0xf8, 0x80, 0x06, 0x00, 0x1f, 0xcf, 0xff, 0x00, 0xf0,
+  0x80, 0x06, 0x00, 0x07, 0xcf, 0xff, 0x00, 0xc0, 0x80, 0x06, 0x00, 0x01, 0xcf, 0xff, 0x80, 0x08,
+  0x00, 0x7f, 0xcd, 0xff, 0x00, 0xfc, 0x80, 0x08, 0x00, 0x0f, 0xcd, 0xff, 0x00, 0xf0, 0x80, 0x08,
+  0x00, 0x01, 0xcd, 0xff, 0x00, 0x80, 0x80, 0x09, 0x00, 0x01, 0xcb, 0xff, 0x00, 0xc0, 0x82, 0x8c,
+};
+static constexpr PackedBitmap cloud_sun_200 = {200, 200, cloud_sun_200_rle};
+
+// 200x200, 5000 -> 1359 bytes
+static const uint8_t cloud_moon_200_rle[] PROGMEM = {
+  0x83, 0x88, 0x01, 0xff, 0x80, 0x80, 0x15, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x16, 0x02, 0xff, 0xff,
+  0xe0, 0x80, 0x15, 0x02, 0x7f, 0xff, 0xfc, 0x80, 0x15, 0x02, 0x7f, 0xff, 0xff, 0x80, 0x15, 0x03,
+  0x3f, 0xff, 0xff, 0xe0, 0x80, 0x14, 0x03, 0x3f, 0xff, 0xff, 0xf0, 0x80, 0x14, 0x03, 0x1f, 0xff,
+  0xff, 0xfc, 0x80, 0x14, 0x03, 0x1f, 0xf7, 0xff, 0xff, 0x80, 0x14, 0x04, 0x1f, 0xf0, 0x7f, 0xff,
+  0x80, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x0f, 0xff, 0xc0, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x03, 0xff,
+  0xf0, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0xff, 0xf8, 0x80, 0x13, 0x04, 0x0f, 0xf0, 0x00, 0x3f,
+  0xfc, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0x1f, 0xfe, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0x0f,
+  0xff, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x13, 0x05, 0x1f, 0xf0, 0x00, 0x01,
+  0xff, 0x80, 0x80, 0x12, 0x05, 0x1f, 0xf0, 0x00, 0x00, 0xff, 0xc0, 0x80, 0x12, 0x05, 0x1f, 0xe0,
+  0x00, 0x00, 0x7f, 0xe0, 0x80, 0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x12, 0x05,
+  0x3f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x12, 0x05, 0x7f, 0xe0, 0x00, 0x00, 0x1f, 0xf0, 0x80,
+  0x12, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x12, 0x05, 0xff, 0xc0, 0x00, 0x00, 0x0f,
+  0xf8, 0x80, 0x12, 0x05, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x11, 0x06, 0x01, 0xff, 0x80,
+  0x00, 0x00, 0x07, 0xfc, 0x80, 0x11, 0x01, 0x03, 0xff, 0x80, 0x02, 0x05, 0x03, 0xfe, 0x00, 0x07,
+  0xff, 0xc0, 0x80, 0x0d, 0x01, 0x07, 0xfe, 0x80, 0x02, 0x02, 0x03, 0xfe, 0x03, 0xc2, 0xff, 0x00,
+  0x80, 0x80, 0x0c, 0x01, 0x0f, 0xfe, 0x80, 0x02, 0x02, 0x03, 0xfe, 0x3f, 0xc2, 0xff, 0x00, 0xf8,
+  0x80, 0x0c, 0x01, 0x1f, 0xfc, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x0b, 0x01,
+  0x3f, 0xf8, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xf0, 0x80, 0x0b, 0x01, 0xff, 0xf0, 0x80,
+  0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xfc, 0x80, 0x07, 0x05, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xe0,
+  0x80, 0x02, 0x00, 0x01, 0xc6, 0xff, 0x00, 0x80, 0x80, 0x06, 0x05, 0xf0, 0x00, 0x00, 0x0f, 0xff,
+  0xc0, 0x80, 0x02, 0x00, 0x07, 0xc2, 0xff, 0x00, 0x87, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x06, 0x05,
+  0xfe, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x80, 0x02, 0x08, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x01, 0xff,
+  0xff, 0xf8, 0x80, 0x06, 0x04, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0x80, 0x03, 0x02, 0x7f, 0xff, 0xf0,
+  0x80, 0x02, 0x02, 0x1f, 0xff, 0xfc, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xfc, 0x80, 0x02, 0x03, 0x01,
+  0xff, 0xff, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0xff, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xf8, 0x80,
+  0x02, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x04, 0x02, 0x7f, 0xff, 0x80, 0x80, 0x05, 0xc3, 0xff, 0x00,
+  0xe0, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x04, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x05, 0xc3,
+  0xff, 0x00, 0x80, 0x80, 0x02, 0x02, 0x1f, 0xff, 0x80, 0x80, 0x04, 0x02, 0x03, 0xff, 0xf0, 0x80,
+  0x05, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x03, 0x01, 0x3f, 0xfe, 0x80, 0x06, 0x01, 0xff, 0xfc, 0x80,
+  0x05, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0xfc, 0x80, 0x06, 0x01, 0x3f, 0xfe, 0x80,
+  0x05, 0x02, 0xff, 0xff, 0xfe, 0x80, 0x03, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x1f, 0xff,
+  0x80, 0x05, 0x01, 0x7f, 0x80, 0x80, 0x04, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x06, 0x02, 0x07, 0xff,
+  0x80, 0x80, 0x04, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x06, 0x02, 0x03,
+  0xff, 0xc0, 0x80, 0x04, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xff, 0x80, 0x07, 0x02, 0x01,
+  0xff, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xfe, 0x80, 0x08, 0x01, 0x7f,
+  0xf0, 0x80, 0x04, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xf8, 0x80, 0x08, 0x01, 0x3f, 0xf8,
+  0x80, 0x04, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x08, 0x01, 0x1f, 0xf8, 0x80,
+  0x04, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0x7f, 0xe0, 0x80, 0x08, 0x01, 0x0f, 0xfc, 0x80, 0x04,
+  0x01, 0x1f, 0xf8, 0x80, 0x04, 0x01, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x01,
+  0x0f, 0xf8, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x04, 0x01, 0x0f,
+  0xfc, 0x80, 0x03, 0x02, 0x01, 0xff, 0x80, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x04, 0x01, 0x07,
+  0xfe, 0x80, 0x03, 0x01, 0xff, 0xff, 0x80, 0x09, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x03,
+  0xff, 0x80, 0x02, 0x02, 0x7f, 0xff, 0xfe, 0x80, 0x0a, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x07, 0x03,
+  0xff, 0x80, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x80, 0x0a, 0x01, 0x7f, 0xc0, 0x80, 0x03, 0x07, 0x01,
+  0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x80, 0x0a, 0x01, 0x7f, 0xe0, 0x80, 0x04, 0x02, 0xff,
+  0xe0, 0x01, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0a, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x02, 0x7f, 0xf0,
+  0x07, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0a, 0x01, 0x3f, 0xf0, 0x80, 0x04, 0x02, 0x3f, 0xfc, 0x1f,
+  0xc2, 0xff, 0x00, 0xf0, 0x80, 0x0a, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x02, 0x1f, 0xfe, 0x3f, 0xc2,
+  0xff, 0x00, 0xf0, 0x80, 0x0a, 0x01, 0x1f, 0xf8, 0x80, 0x04, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xe0,
+  0x80, 0x0c, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x03, 0x07, 0xff, 0xff, 0xfe, 0x80, 0x0d, 0x01, 0x0f,
+  0xf8, 0x80, 0x04, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x0d, 0x01, 0x07, 0xfc, 0x80, 0x05, 0x02,
+  0xff, 0xff, 0xc0, 0x80, 0x0d, 0x01, 0x07, 0xfc, 0x80, 0x05, 0x01, 0x7f, 0xff, 0x80, 0x0e, 0x01,
+  0x07, 0xfc, 0x80, 0x05, 0x01, 0x3f, 0xfc, 0x80, 0x0e, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x04, 0x01,
+  0x7f, 0xf8, 0x80, 0x0e, 0x03, 0x03, 0xff, 0xff, 0x80, 0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x0e,
+  0x03, 0x03, 0xff, 0xff, 0xe0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x0e, 0x03, 0x01, 0xff,
+  0xff, 0xfc, 0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x0e, 0x00, 0x01, 0xc2, 0xff, 0x80, 0x02,
+  0x01, 0x03, 0xff, 0x80, 0x0f, 0x00, 0x01, 0xc2, 0xff, 0x04, 0x80, 0x00, 0x00, 0x07, 0xfe, 0x80,
+  0x10, 0xc2, 0xff, 0x04, 0xe0, 0x00, 0x00, 0x0f, 0xfc, 0x80, 0x11, 0x06, 0x1f, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xfc, 0x80, 0x11, 0x06, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xf8, 0x80, 0x12, 0x05,
+  0x7f, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x12, 0x05, 0x1f, 0xff, 0x00, 0x00, 0x3f, 0xf0, 0x80,
+  0x12, 0x05, 0x07, 0xff, 0x80, 0x00, 0x3f, 0xe0, 0x80, 0x12, 0x05, 0x03, 0xff, 0xc0, 0x00, 0x3f,
+  0xe0, 0x80, 0x12, 0x05, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0x7f, 0xe0, 0x00,
+  0x7f, 0xc0, 0x80, 0x13, 0x04, 0x3f, 0xf0, 0x00, 0x7f, 0x80, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00,
+  0xff, 0x80, 0x80, 0x13, 0x04, 0x1f, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x13, 0x04, 0x0f, 0xfc, 0x00,
+  0xff, 0x80, 0x80, 0x13, 0x04, 0x07, 0xfc, 0x00, 0xff, 0x80, 0x80, 0x13, 0x03, 0x07, 0xfc, 0x00,
+  0xff, 0x80, 0x14, 0x03, 0x03, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x03, 0xfe, 0x00, 0xff, 0x80,
+  0x14, 0x03, 0x01, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x01, 0xff, 0x00, 0xff, 0x80, 0x14, 0x03,
+  0x01, 0xff, 0x00, 0xff, 0x80, 0x14, 0x04, 0x01, 0xff, 0x00, 0xff, 0x80, 0x80, 0x14, 0x03, 0xff,
+  0x00, 0xff, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0xff,
+  0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x14, 0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80,
+  0x14, 0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xe0, 0x80, 0x13,
+  0x04, 0x01, 0xff, 0x00, 0x3f, 0xe0, 0x80, 0x13, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xf0, 0x80, 0x13,
+  0x04, 0x01, 0xfe, 0x00, 0x1f, 0xf0, 0x80, 0x13, 0x04, 0x03, 0xfe, 0x00, 0x1f, 0xf8, 0x80, 0x13,
+  0x04, 0x03, 0xfe, 0x00, 0x0f, 0xfc, 0x80, 0x13, 0x04, 0x07, 0xfc, 0x00, 0x07, 0xfc, 0x80, 0x13,
+  0x04, 0x07, 0xfc, 0x00, 0x07, 0xfe, 0x80, 0x13, 0x04, 0x0f, 0xfc, 0x00, 0x03, 0xff, 0x80, 0x13,
+  0x05, 0x1f, 0xf8, 0x00, 0x01, 0xff, 0x80, 0x80, 0x12, 0x05, 0x1f, 0xf0, 0x00, 0x01, 0xff, 0xc0,
+  0x80, 0x12, 0x05, 0x3f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x12, 0x05, 0x7f, 0xe0, 0x00, 0x00,
+  0x7f, 0xf8, 0x80, 0x11, 0x06, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xfe, 0x80, 0x11, 0x06, 0x03,
+  0xff, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x11, 0x07, 0x07, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff,
+  0xc0, 0x80, 0x10, 0x01, 0x1f, 0xff, 0x80, 0x02, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x10, 0x01, 0x7f,
+  0xfe, 0x80, 0x02, 0x02, 0x01, 0xff, 0xff, 0x80, 0x0f, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x03, 0x02,
+  0xff, 0xff, 0xf0, 0x80, 0x0e, 0x02, 0x1f, 0xff, 0xf0, 0x80, 0x03, 0x00, 0x3f, 0xd2, 0xff, 0x00,
+  0xe0, 0x80, 0x03, 0x00, 0x0f, 0xd2, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0x03, 0xd2, 0xff, 0x80,
+  0x05, 0xd1, 0xff, 0x00, 0xfc, 0x80, 0x05, 0x00, 0x3f, 0xd0, 0xff, 0x00, 0xe0, 0x80, 0x05, 0x00,
+  0x07, 0xd0, 0xff, 0x00, 0x80, 0x80, 0x06, 0x00, 0x3f, 0xce, 0xff, 0x00, 0xf8, 0x83, 0x9f,
+};
+static constexpr PackedBitmap cloud_moon_200 = {200, 200, cloud_moon_200_rle};
+
+// 200x200, 5000 -> 1238 bytes
+static const uint8_t fog_sun_200_rle[] PROGMEM = {
+  0x82, 0x14, 0x00, 0x7e, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe,
+  0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe,
+  0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe,
+  0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe,
+  0x80, 0x17, 0x00, 0xfe, 0x80, 0x17, 0x00, 0xfe, 0x80, 0x11, 0x00, 0x06, 0x80, 0x04, 0x00, 0xfe,
+  0x80, 0x04, 0x00, 0xc0, 0x80, 0x0b, 0x00, 0x0f, 0x80, 0x04, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x01,
+  0xe0, 0x80, 0x0b, 0x01, 0x1f, 0x80, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xf0, 0x80,
+  0x0b, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x0b, 0x01,
+  0x7f, 0xe0, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x0f, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xf0,
+  0x80, 0x03, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x1f, 0xf8, 0x80, 0x0b, 0x01, 0x1f, 0xf8, 0x80, 0x03,
+  0x00, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xf0, 0x80, 0x0b, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x00, 0xfe,
+  0x80, 0x03, 0x01, 0x7f, 0xe0, 0x80, 0x0b, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x03,
+  0x01, 0xff, 0xc0, 0x80, 0x0b, 0x01, 0x03, 0xff, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x02, 0x02, 0x01,
+  0xff, 0x80, 0x80, 0x0b, 0x02, 0x01, 0xff, 0x80, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x0d, 0x01,
+  0xff, 0xc0, 0x80, 0x06, 0x01, 0x07, 0xfe, 0x80, 0x0d, 0x01, 0x7f, 0xe0, 0x80, 0x06, 0x01, 0x0f,
+  0xfc, 0x80, 0x0d, 0x01, 0x3f, 0xf8, 0x80, 0x06, 0x01, 0x1f, 0xf8, 0x80, 0x0d, 0x01, 0x1f, 0xfc,
+  0x80, 0x06, 0x01, 0x3f, 0xf0, 0x80, 0x0d, 0x01, 0x0f, 0xfe, 0x80, 0x02, 0x00, 0x18, 0x80, 0x02,
+  0x01, 0x7f, 0xe0, 0x80, 0x0d, 0x0a, 0x07, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xc0, 0x80, 0x0d, 0x0a, 0x03, 0xff, 0x80, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x80, 0x80,
+  0x0d, 0x03, 0x01, 0xff, 0x80, 0x07, 0xc2, 0xff, 0x02, 0xc0, 0x03, 0xff, 0x80, 0x0f, 0x02, 0xff,
+  0x80, 0x1f, 0xc2, 0xff, 0x02, 0xf0, 0x03, 0xfe, 0x80, 0x0f, 0x02, 0x7f, 0x00, 0x3f, 0xc2, 0xff,
+  0x02, 0xf8, 0x01, 0xfc, 0x80, 0x0f, 0x01, 0x3e, 0x00, 0xc3, 0xff, 0x02, 0xfe, 0x00, 0xf8, 0x80,
+  0x0f, 0x01, 0x1c, 0x01, 0xc4, 0xff, 0x01, 0x00, 0x70, 0x80, 0x10, 0x06, 0x07, 0xff, 0xf8, 0x00,
+  0x3f, 0xff, 0xc0, 0x80, 0x11, 0x06, 0x0f, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xe0, 0x80, 0x11, 0x06,
+  0x1f, 0xfe, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x80, 0x11, 0x01, 0x3f, 0xfc, 0x80, 0x02, 0x01, 0x7f,
+  0xf8, 0x80, 0x11, 0x01, 0x7f, 0xf0, 0x80, 0x02, 0x01, 0x1f, 0xfc, 0x80, 0x11, 0x01, 0x7f, 0xe0,
+  0x80, 0x02, 0x01, 0x0f, 0xfc, 0x80, 0x11, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x05, 0x07, 0xfe, 0x00,
+  0x00, 0xff, 0xf8, 0x80, 0x0c, 0x01, 0x01, 0xff, 0x80, 0x03, 0x06, 0x03, 0xff, 0x00, 0x3f, 0xff,
+  0xff, 0xc0, 0x80, 0x0b, 0x01, 0x03, 0xfe, 0x80, 0x03, 0x02, 0x01, 0xff, 0x81, 0xc2, 0xff, 0x00,
+  0xfc, 0x80, 0x0b, 0x01, 0x03, 0xfe, 0x80, 0x04, 0x01, 0xff, 0x8f, 0xc3, 0xff, 0x00, 0x80, 0x80,
+  0x0a, 0x01, 0x07, 0xfc, 0x80, 0x04, 0x00, 0x7f, 0xc4, 0xff, 0x00, 0xe0, 0x80, 0x0a, 0x01, 0x07,
+  0xf8, 0x80, 0x04, 0x00, 0x3f, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x0a, 0x01, 0x0f, 0xf0, 0x80, 0x04,
+  0x00, 0x3f, 0xc4, 0xff, 0x00, 0xfe, 0x80, 0x0a, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07, 0x1f, 0xff,
+  0xff, 0xc0, 0x3f, 0xff, 0xff, 0x80, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x07, 0x3f, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x07, 0x7f, 0xff,
+  0x80, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x02, 0x01, 0xff,
+  0xfc, 0x80, 0x02, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x02, 0x03,
+  0xff, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0xfe, 0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x02, 0x07,
+  0xff, 0x80, 0x80, 0x03, 0x01, 0x1f, 0xff, 0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01, 0x0f,
+  0xff, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x08, 0x01, 0x3f, 0x80, 0x80, 0x03, 0x01, 0x1f,
+  0xfc, 0x80, 0x04, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x3f, 0x80, 0x80, 0x03, 0x01, 0x3f,
+  0xf8, 0x80, 0x05, 0x01, 0xff, 0xe0, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xe0, 0x3f, 0x80, 0x80, 0x03,
+  0x01, 0x7f, 0xe0, 0x80, 0x05, 0x01, 0x7f, 0xf0, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xe0, 0x7f, 0x80,
+  0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x3f, 0xf8, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xe0,
+  0x7f, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x05, 0x01, 0x0f, 0xfc, 0x80, 0x04, 0xc2,
+  0xff, 0x02, 0xe0, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x06, 0x01, 0x07, 0xfc, 0x80,
+  0x04, 0xc2, 0xff, 0x02, 0xe0, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x07, 0xfe, 0x80, 0x06, 0x01, 0x03,
+  0xfe, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xe0, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x07, 0xfc, 0x80, 0x06,
+  0x01, 0x01, 0xff, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xe0, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x0f, 0xf8,
+  0x80, 0x07, 0x01, 0xff, 0x80, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xe0, 0x3f, 0x80, 0x80, 0x02, 0x01,
+  0x1f, 0xf0, 0x80, 0x07, 0x01, 0xff, 0x80, 0x80, 0x07, 0x01, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x1f,
+  0xe0, 0x80, 0x07, 0x01, 0x7f, 0xc0, 0x80, 0x07, 0x01, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xe0,
+  0x80, 0x07, 0x01, 0x3f, 0xe0, 0x80, 0x07, 0x01, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xc0, 0x80,
+  0x07, 0x01, 0x1f, 0xe0, 0x80, 0x07, 0x06, 0x3f, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x80, 0x07,
+  0x01, 0x1f, 0xf0, 0x80, 0x07, 0x06, 0x3f, 0xc0, 0x00, 0x07, 0xff, 0xff, 0x80, 0x80, 0x07, 0x01,
+  0x0f, 0xf0, 0x80, 0x07, 0x05, 0x1f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x08, 0x01, 0x0f, 0xf8,
+  0x80, 0x07, 0x02, 0x1f, 0xe0, 0x00, 0xc2, 0xff, 0x80, 0x08, 0x01, 0x07, 0xf8, 0x80, 0x07, 0x05,
+  0x1f, 0xe0, 0x03, 0xff, 0xff, 0xfe, 0x80, 0x08, 0x01, 0x07, 0xfc, 0x80, 0x07, 0x05, 0x0f, 0xf0,
+  0x0f, 0xff, 0xff, 0xfe, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x07, 0x05, 0x0f, 0xf0, 0x3f, 0xff,
+  0xff, 0xfc, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x07, 0x05, 0x07, 0xf8, 0x7f, 0xff, 0xfd, 0xfc,
+  0x80, 0x08, 0x01, 0x01, 0xfe, 0x80, 0x07, 0x03, 0x07, 0xfd, 0xff, 0xfe, 0x80, 0x0a, 0x01, 0x01,
+  0xfe, 0x80, 0x07, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x0b, 0x00, 0xfe, 0x80, 0x07, 0x03, 0x03,
+  0xff, 0xff, 0xc0, 0x80, 0x0b, 0x00, 0xff, 0x80, 0x07, 0x02, 0x01, 0xff, 0xff, 0x80, 0x0c, 0x00,
+  0xff, 0x80, 0x08, 0x01, 0xff, 0xfc, 0x80, 0x0c, 0x00, 0xff, 0x80, 0x9d, 0x00, 0x07, 0xd2, 0xff,
+  0x00, 0x80, 0x80, 0x03, 0x00, 0x07, 0xd2, 0xff, 0x00, 0xc0, 0x80, 0x03, 0x00, 0x07, 0xd2, 0xff,
+  0x00, 0xc0, 0x80, 0x03, 0x00, 0x07, 0xd2, 0xff, 0x00, 0xc0, 0x80, 0x03, 0x00, 0x07, 0xd2, 0xff,
+  0x00, 0xc0, 0x80, 0x03, 0x00, 0x07, 0xd2, 0xff, 0x00, 0xc0, 0x80, 0x03, 0x00, 0x07, 0xd2, 0xff,
+  0x00, 0xc0, 0x80, 0x03, 0x00, 0x07, 0xd2, 0xff, 0x00, 0x80, 0x81, 0x2e, 0x00, 0x01, 0xd4, 0xff,
+  0x80, 0x02, 0x00, 0x03, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x03, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x03,
+  0xd4, 0xff, 0x80, 0x02, 0x00, 0x03, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x03, 0xd4, 0xff, 0x80, 0x02,
+  0x00, 0x03, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x01, 0xd4, 0xff, 0x81, 0x30, 0x00, 0x0f, 0xd1, 0xff,
+  0x00, 0x80, 0x80, 0x04, 0x00, 0x0f, 0xd1, 0xff, 0x00, 0xc0, 0x80, 0x04, 0x00, 0x0f, 0xd1, 0xff,
+  0x00, 0xc0, 0x80, 0x04, 0x00, 0x0f, 0xd1, 0xff, 0x00, 0xc0, 0x80, 0x04, 0x00, 0x0f, 0xd1, 0xff,
+  0x00, 0xc0, 0x80, 0x04, 0x00, 0x0f, 0xd1, 0xff, 0x00, 0xc0, 0x80, 0x04, 0x00, 0x0f, 0xd1, 0xff,
+  0x00, 0xc0, 0x80, 0x04, 0x00, 0x0f, 0xd1, 0xff, 0x00, 0x80, 0x80, 0xe8, 0xcb, 0xff, 0x00, 0xfc,
+  0x80, 0x0b, 0xcb, 0xff, 0x00, 0xfc, 0x80, 0x0b, 0xcb, 0xff, 0x00, 0xfc, 0x80, 0x0b, 0xcb, 0xff,
+  0x00, 0xfc, 0x80, 0x0b, 0xcb, 0xff, 0x00, 0xfc, 0x80, 0x0b, 0xcb, 0xff, 0x00, 0xfc, 0x80, 0x0b,
+  0xcb, 0xff, 0x00, 0xfc, 0x82, 0x29,
+};
+static constexpr PackedBitmap fog_sun_200 = {200, 200, fog_sun_200_rle};
+
+// 200x200, 5000 -> 1002 bytes
+static const uint8_t fog_moon_200_rle[] PROGMEM = {
+  0x83, 0x0a, 0x01, 0x01, 0xff, 0x80, 0x16, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x15, 0x03, 0x01, 0xff,
+  0xff, 0xc0, 0x80, 0x15, 0x02, 0xff, 0xff, 0xf8, 0x80, 0x15, 0x02, 0xff, 0xff, 0xfe, 0x80, 0x15,
+  0x03, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x14, 0x03, 0x7f, 0xff, 0xff, 0xe0, 0x80, 0x14, 0x03, 0x3f,
+  0xff, 0xff, 0xf8, 0x80, 0x14, 0x03, 0x3f, 0xef, 0xff, 0xfc, 0x80, 0x14, 0x03, 0x3f, 0xe0, 0xff,
+  0xff, 0x80, 0x14, 0x04, 0x3f, 0xe0, 0x1f, 0xff, 0x80, 0x80, 0x13, 0x04, 0x1f, 0xe0, 0x07, 0xff,
+  0xc0, 0x80, 0x13, 0x04, 0x1f, 0xe0, 0x01, 0xff, 0xe0, 0x80, 0x13, 0x04, 0x1f, 0xe0, 0x00, 0xff,
+  0xf0, 0x80, 0x13, 0x04, 0x1f, 0xe0, 0x00, 0x3f, 0xf8, 0x80, 0x13, 0x04, 0x1f, 0xe0, 0x00, 0x1f,
+  0xfc, 0x80, 0x13, 0x04, 0x3f, 0xe0, 0x00, 0x0f, 0xfe, 0x80, 0x13, 0x04, 0x3f, 0xe0, 0x00, 0x07,
+  0xff, 0x80, 0x13, 0x04, 0x3f, 0xe0, 0x00, 0x03, 0xff, 0x80, 0x13, 0x05, 0x3f, 0xc0, 0x00, 0x01,
+  0xff, 0x80, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0xff, 0xc0, 0x80, 0x12, 0x05, 0x7f, 0xc0,
+  0x00, 0x00, 0x7f, 0xc0, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x12, 0x05,
+  0xff, 0x80, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x12, 0x05, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x80,
+  0x11, 0x01, 0x01, 0xff, 0x80, 0x02, 0x01, 0x1f, 0xf0, 0x80, 0x11, 0x01, 0x03, 0xff, 0x80, 0x02,
+  0x01, 0x0f, 0xf8, 0x80, 0x11, 0x01, 0x07, 0xfe, 0x80, 0x02, 0x04, 0x0f, 0xf8, 0x00, 0x1f, 0xff,
+  0x80, 0x0e, 0x01, 0x0f, 0xfc, 0x80, 0x02, 0x05, 0x07, 0xf8, 0x0f, 0xff, 0xff, 0xfe, 0x80, 0x0d,
+  0x01, 0x1f, 0xfc, 0x80, 0x02, 0x01, 0x07, 0xf8, 0xc3, 0xff, 0x00, 0xe0, 0x80, 0x0c, 0x01, 0x3f,
+  0xf8, 0x80, 0x02, 0x00, 0x07, 0xc4, 0xff, 0x00, 0xfc, 0x80, 0x0c, 0x01, 0x7f, 0xf0, 0x80, 0x02,
+  0x00, 0x07, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x0a, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x02, 0x00, 0x03,
+  0xc5, 0xff, 0x00, 0xf0, 0x80, 0x07, 0x05, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x80, 0x02, 0x00,
+  0x07, 0xc5, 0xff, 0x00, 0xfc, 0x80, 0x07, 0x05, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x80, 0x02,
+  0x04, 0x1f, 0xff, 0xff, 0xfe, 0x1f, 0xc2, 0xff, 0x80, 0x07, 0x04, 0xfe, 0x00, 0x00, 0xff, 0xff,
+  0x80, 0x03, 0x08, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x80, 0x06, 0x04, 0xff,
+  0xe0, 0x0f, 0xff, 0xfe, 0x80, 0x03, 0x02, 0xff, 0xff, 0xc0, 0x80, 0x02, 0x02, 0x7f, 0xff, 0xf0,
+  0x80, 0x06, 0xc3, 0xff, 0x00, 0xf8, 0x80, 0x02, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x03, 0x02, 0x0f,
+  0xff, 0xf8, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xf0, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x03,
+  0x02, 0x01, 0xff, 0xfe, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x1f, 0xff, 0xc0,
+  0x80, 0x04, 0x01, 0x7f, 0xff, 0x80, 0x06, 0xc3, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xff, 0x80, 0x05,
+  0x02, 0x1f, 0xff, 0x80, 0x80, 0x05, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x03, 0x01, 0x7f, 0xfc, 0x80,
+  0x05, 0x02, 0x07, 0xff, 0xe0, 0x80, 0x05, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x02, 0x02, 0x01, 0xff,
+  0xf0, 0x80, 0x05, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x05, 0x02, 0xff, 0xff, 0xfc, 0x80, 0x03, 0x02,
+  0x03, 0xff, 0xc0, 0x80, 0x06, 0x01, 0xff, 0xf8, 0x80, 0x05, 0x01, 0x7f, 0x80, 0x80, 0x04, 0x02,
+  0x07, 0xff, 0x80, 0x80, 0x06, 0x01, 0x3f, 0xfc, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01,
+  0x0f, 0xff, 0x80, 0x07, 0x01, 0x1f, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x1f,
+  0xfc, 0x80, 0x07, 0x01, 0x0f, 0xff, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x3f, 0xf8,
+  0x80, 0x07, 0x02, 0x03, 0xff, 0x80, 0x80, 0x04, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xf0,
+  0x80, 0x07, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xe0,
+  0x80, 0x08, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80,
+  0x08, 0x01, 0x7f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xf0, 0x80, 0x03, 0x02, 0x01, 0xff, 0x80, 0x80,
+  0x08, 0x01, 0x3f, 0xf0, 0x80, 0x04, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80, 0x09,
+  0x01, 0x1f, 0xf8, 0x80, 0x04, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x01, 0x03, 0xff, 0x80, 0x09, 0x01,
+  0x1f, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x01, 0xff, 0xfe, 0x80, 0x09, 0x01, 0x0f,
+  0xfc, 0x80, 0x04, 0x01, 0x03, 0xff, 0x80, 0x02, 0x02, 0xff, 0xff, 0xfc, 0x80, 0x09, 0x01, 0x07,
+  0xfc, 0x80, 0x04, 0x07, 0x03, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x03,
+  0xfe, 0x80, 0x04, 0x07, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x03,
+  0xfe, 0x80, 0x05, 0x02, 0xff, 0xe0, 0x01, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x09, 0x01, 0x01, 0xff,
+  0x80, 0x05, 0x02, 0x7f, 0xf0, 0x07, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x09, 0x01, 0x01, 0xff, 0x80,
+  0x05, 0x02, 0x3f, 0xf8, 0x1f, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x0a, 0x01, 0xff, 0x80, 0x80, 0x04,
+  0x02, 0x3f, 0xfe, 0x7f, 0xc2, 0xff, 0x00, 0xc0, 0x80, 0x0a, 0x01, 0xff, 0x80, 0x80, 0x04, 0x00,
+  0x0f, 0xc2, 0xff, 0x00, 0xc0, 0x80, 0x0c, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x03, 0x07, 0xff, 0xff,
+  0xfc, 0x80, 0x0d, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x0d, 0x01,
+  0x3f, 0xc0, 0x80, 0x04, 0x03, 0x01, 0xff, 0xff, 0x80, 0x80, 0x0d, 0x01, 0x3f, 0xe0, 0x80, 0x05,
+  0x01, 0x7f, 0xfe, 0x80, 0x0e, 0x01, 0x3f, 0xe0, 0x80, 0xb3, 0x00, 0x1f, 0xd5, 0xff, 0x80, 0x01,
+  0x00, 0x1f, 0xd5, 0xff, 0x80, 0x01, 0x00, 0x1f, 0xd5, 0xff, 0x80, 0x01, 0x00, 0x1f, 0xd5, 0xff,
+  0x80, 0x01, 0x00, 0x1f, 0xd5, 0xff, 0x80, 0x01, 0x00, 0x1f, 0xd5, 0xff, 0x80, 0x01, 0x00, 0x0f,
+  0xd5, 0xff, 0x81, 0x45, 0x00, 0x0f, 0xd7, 0xff, 0x00, 0x0f, 0xd7, 0xff, 0x00, 0x0f, 0xd7, 0xff,
+  0x00, 0x0f, 0xd7, 0xff, 0x00, 0x0f, 0xd7, 0xff, 0x00, 0x0f, 0xd7, 0xff, 0x00, 0x0f, 0xd7, 0xff,
+  0x81, 0x46, 0x00, 0x1f, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x1f, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x1f,
+  0xd4, 0xff, 0x80, 0x02, 0x00, 0x1f, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x1f, 0xd4, 0xff, 0x80, 0x02,
+  0x00, 0x1f, 0xd4, 0xff, 0x80, 0x02, 0x00, 0x0f, 0xd4, 0xff, 0x80, 0xe6, 0x00, 0x1f, 0xcd, 0xff,
+  0x00, 0x80, 0x80, 0x08, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0x80, 0x80, 0x08, 0x00, 0x1f, 0xcd, 0xff,
+  0x00, 0x80, 0x80, 0x08, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0x80, 0x80, 0x08, 0x00, 0x1f, 0xcd, 0xff,
+  0x00, 0x80, 0x80, 0x08, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0x80, 0x80, 0x08, 0x00, 0x1f, 0xcd, 0xff,
+  0x00, 0x80, 0x80, 0x08, 0x00, 0x0f, 0xcd, 0xff, 0x83, 0x0b,
+};
+static constexpr PackedBitmap fog_moon_200 = {200, 200, fog_moon_200_rle};
+
+// 200x200, 5000 -> 2462 bytes
+static const uint8_t rain_sun_200_rle[] PROGMEM = {
+  0x80, 0x20, 0x00, 0x3f, 0x80, 0x17, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16,
+  0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01,
+  0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f,
+  0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80,
+  0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80,
+  0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x10, 0x00, 0x07, 0x80, 0x04, 0x01,
+  0x7f, 0x80, 0x80, 0x03, 0x00, 0x30, 0x80, 0x0b, 0x01, 0x0f, 0x80, 0x80, 0x03, 0x01, 0x7f, 0x80,
+  0x80, 0x03, 0x00, 0x78, 0x80, 0x0b, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x03,
+  0x00, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x01,
+  0xfe, 0x80, 0x0b, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x07, 0xff,
+  0x80, 0x0b, 0x01, 0x1f, 0xf8, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x0f, 0xfe, 0x80,
+  0x0b, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x1f, 0xfc, 0x80, 0x0b,
+  0x01, 0x07, 0xfe, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xf8, 0x80, 0x0b, 0x01,
+  0x03, 0xff, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x7f, 0xf0, 0x80, 0x0b, 0x02, 0x01,
+  0xff, 0x80, 0x80, 0x07, 0x01, 0xff, 0xe0, 0x80, 0x0c, 0x01, 0xff, 0xc0, 0x80, 0x06, 0x02, 0x01,
+  0xff, 0xc0, 0x80, 0x0c, 0x01, 0x7f, 0xe0, 0x80, 0x06, 0x02, 0x03, 0xff, 0x80, 0x80, 0x0c, 0x01,
+  0x3f, 0xf0, 0x80, 0x06, 0x01, 0x07, 0xff, 0x80, 0x0d, 0x01, 0x1f, 0xf8, 0x80, 0x06, 0x01, 0x0f,
+  0xfe, 0x80, 0x0d, 0x01, 0x0f, 0xfc, 0x80, 0x06, 0x01, 0x1f, 0xfc, 0x80, 0x0d, 0x01, 0x07, 0xfe,
+  0x80, 0x02, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x3f, 0xf8, 0x80, 0x0d, 0x0a, 0x03, 0xff, 0x00, 0x00,
+  0x0f, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xf0, 0x80, 0x0d, 0x0a, 0x01, 0xff, 0x80, 0x00, 0x7f, 0xff,
+  0xff, 0x80, 0x00, 0xff, 0xe0, 0x80, 0x0e, 0x02, 0xff, 0xc0, 0x03, 0xc2, 0xff, 0x03, 0xe0, 0x01,
+  0xff, 0x80, 0x80, 0x0e, 0x02, 0x7f, 0x80, 0x0f, 0xc2, 0xff, 0x02, 0xf8, 0x00, 0xff, 0x80, 0x0f,
+  0x02, 0x3f, 0x00, 0x3f, 0xc2, 0xff, 0x02, 0xfe, 0x00, 0x7e, 0x80, 0x0f, 0x02, 0x1e, 0x00, 0x7f,
+  0xc3, 0xff, 0x01, 0x80, 0x3c, 0x80, 0x0f, 0x01, 0x0c, 0x01, 0xc4, 0xff, 0x01, 0xc0, 0x18, 0x80,
+  0x10, 0x06, 0x03, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xe0, 0x80, 0x11, 0x06, 0x07, 0xff, 0xe0, 0x00,
+  0x01, 0xff, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xff, 0x80, 0x02, 0x01, 0x7f, 0xf8, 0x80, 0x11, 0x01,
+  0x1f, 0xfc, 0x80, 0x02, 0x01, 0x1f, 0xfc, 0x80, 0x11, 0x01, 0x3f, 0xf8, 0x80, 0x02, 0x01, 0x0f,
+  0xfe, 0x80, 0x11, 0x01, 0x7f, 0xe0, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x11, 0x01, 0xff, 0xc0,
+  0x80, 0x02, 0x05, 0x01, 0xff, 0x80, 0x00, 0x7f, 0xfe, 0x80, 0x0d, 0x01, 0xff, 0x80, 0x80, 0x03,
+  0x05, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xf8, 0x80, 0x0b, 0x01, 0x01, 0xff, 0x80, 0x04, 0x01, 0x7f,
+  0xc0, 0xc3, 0xff, 0x80, 0x0b, 0x01, 0x03, 0xfe, 0x80, 0x04, 0x01, 0x3f, 0xe3, 0xc3, 0xff, 0x00,
+  0xe0, 0x80, 0x0a, 0x01, 0x03, 0xfe, 0x80, 0x04, 0x00, 0x1f, 0xc4, 0xff, 0x00, 0xfc, 0x80, 0x0a,
+  0x01, 0x07, 0xfc, 0x80, 0x04, 0x00, 0x1f, 0xc5, 0xff, 0x80, 0x0a, 0x01, 0x07, 0xf8, 0x80, 0x04,
+  0x00, 0x0f, 0xc5, 0xff, 0x00, 0xc0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x07, 0x07, 0xff,
+  0xff, 0xf0, 0x07, 0xff, 0xff, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07, 0x0f, 0xff,
+  0xfc, 0x00, 0x00, 0x1f, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07, 0x3f, 0xff,
+  0xc0, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xfe,
+  0x80, 0x03, 0x01, 0x7f, 0xff, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x02, 0x01, 0xff, 0xf8,
+  0x80, 0x03, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x08, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x02, 0x03, 0xff,
+  0xe0, 0x80, 0x03, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x02, 0x07,
+  0xff, 0x80, 0x80, 0x03, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01,
+  0x0f, 0xff, 0x80, 0x05, 0x01, 0x7f, 0xf8, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01, 0x1f,
+  0xfc, 0x80, 0x05, 0x01, 0x3f, 0xfc, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xe0, 0x3f, 0xc0, 0x80, 0x03,
+  0x01, 0x3f, 0xf8, 0x80, 0x05, 0x01, 0x0f, 0xfe, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80,
+  0x80, 0x03, 0x01, 0x7f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xff, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0,
+  0x3f, 0x80, 0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x03, 0xff, 0x80, 0x04, 0xc2, 0xff,
+  0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x05, 0x02, 0x01, 0xff, 0x80,
+  0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x01, 0xff, 0x80, 0x07, 0x01,
+  0xff, 0xc0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xfe, 0x80,
+  0x07, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x07,
+  0xfc, 0x80, 0x07, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xe0, 0x3f, 0xc0, 0x80, 0x02,
+  0x01, 0x07, 0xfc, 0x80, 0x07, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01,
+  0x0f, 0xf8, 0x80, 0x07, 0x01, 0x0f, 0xf8, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x1f,
+  0xf0, 0x80, 0x07, 0x01, 0x07, 0xf8, 0x80, 0x07, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xe0,
+  0x80, 0x07, 0x01, 0x07, 0xfc, 0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x80,
+  0x07, 0x01, 0x03, 0xfe, 0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x07,
+  0x01, 0x01, 0xfe, 0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xc0, 0x80, 0x07, 0x01,
+  0x01, 0xfe, 0x80, 0x07, 0x02, 0x0f, 0xf0, 0x00, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x08, 0x00, 0xff,
+  0x80, 0x07, 0x02, 0x0f, 0xf0, 0x03, 0xc2, 0xff, 0x80, 0x09, 0x00, 0xff, 0x80, 0x07, 0x02, 0x0f,
+  0xf8, 0x0f, 0xc2, 0xff, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x05, 0x07, 0xf8, 0x1f, 0xff,
+  0xff, 0xfe, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x05, 0x07, 0xfc, 0x7f, 0xff, 0xfc, 0x3e,
+  0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x06, 0x03, 0x03, 0xfe, 0xff, 0xff, 0x80, 0x0b, 0x01, 0x3f,
+  0xc0, 0x80, 0x06, 0x03, 0x03, 0xff, 0xff, 0xf8, 0x80, 0x0b, 0x01, 0x3f, 0xc0, 0x80, 0x06, 0x03,
+  0x01, 0xff, 0xff, 0xc0, 0x80, 0x0b, 0x01, 0x1f, 0xc0, 0x80, 0x07, 0x02, 0xff, 0xff, 0x80, 0x80,
+  0x0b, 0x01, 0x1f, 0xe0, 0x80, 0x07, 0x01, 0xff, 0xfe, 0x80, 0x0c, 0x01, 0x1f, 0xf0, 0x80, 0x07,
+  0x01, 0x7f, 0xf8, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x06, 0x01, 0x3f, 0xf0, 0x80, 0x0c,
+  0x02, 0x0f, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x7f, 0xe0, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xfe, 0x80,
+  0x06, 0x01, 0x7f, 0xc0, 0x80, 0x0c, 0x03, 0x0f, 0xff, 0xff, 0x80, 0x80, 0x05, 0x01, 0xff, 0x80,
+  0x80, 0x0c, 0x03, 0x0f, 0xff, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x01, 0xff, 0x80, 0x0d, 0x03, 0x07,
+  0xff, 0xff, 0xf0, 0x80, 0x04, 0x01, 0x01, 0xfe, 0x80, 0x0e, 0x02, 0x7f, 0xff, 0xf8, 0x80, 0x04,
+  0x01, 0x03, 0xfe, 0x80, 0x0f, 0x01, 0xff, 0xfc, 0x80, 0x04, 0x01, 0x03, 0xfc, 0x80, 0x0f, 0x01,
+  0x3f, 0xfe, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x0f, 0x01, 0x07, 0xff, 0x80, 0x04, 0x01, 0x07,
+  0xf8, 0x80, 0x0f, 0x02, 0x03, 0xff, 0x80, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x10, 0x01, 0xff,
+  0xc0, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x10, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01, 0x0f, 0xf0,
+  0x80, 0x10, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10, 0x01, 0x1f, 0xf0, 0x80,
+  0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10,
+  0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10, 0x01, 0x07, 0xfc, 0x80, 0x03, 0x01,
+  0x1f, 0xc0, 0x80, 0x10, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x10, 0x01, 0x03,
+  0xfc, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0,
+  0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xfe, 0x80, 0x03,
+  0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xff,
+  0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11,
+  0x00, 0x7f, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xc0,
+  0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01,
+  0x1f, 0xe0, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x00, 0x7f,
+  0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80,
+  0x04, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01,
+  0x07, 0xf8, 0x80, 0x04, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x01, 0x03, 0xf8,
+  0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x00, 0xff, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x03,
+  0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x00, 0xff, 0x80, 0x03, 0x01, 0x0f,
+  0xf0, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x00, 0xff, 0x80,
+  0x03, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x04,
+  0x00, 0xfe, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07,
+  0xf8, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x07, 0xfc, 0x80, 0x03, 0x01, 0x03, 0xf8,
+  0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xfc, 0x80,
+  0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x03,
+  0x01, 0x03, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01,
+  0x03, 0xfc, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x07,
+  0xf8, 0x80, 0x03, 0x01, 0x03, 0xfc, 0x80, 0x04, 0x01, 0xff, 0x80, 0x80, 0x02, 0x01, 0x03, 0xf8,
+  0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80,
+  0x02, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x0f, 0xf8,
+  0x80, 0x04, 0x01, 0x7f, 0xe0, 0x80, 0x02, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07,
+  0xf8, 0x80, 0x03, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x02, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0x1f,
+  0xf8, 0x80, 0x02, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x03, 0x01,
+  0x7f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xfc, 0x80, 0x02, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xff, 0x80, 0x02, 0x08,
+  0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x02, 0x02, 0x01, 0xff, 0xc0, 0x80,
+  0x04, 0x0d, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8,
+  0x80, 0x02, 0x02, 0x03, 0xff, 0x80, 0x80, 0x04, 0x0d, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xff, 0x80, 0x06, 0x0c, 0xff,
+  0xfc, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x02, 0x01, 0x7f,
+  0xfe, 0x80, 0x06, 0x11, 0x7f, 0xff, 0xc0, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07,
+  0xf8, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x80, 0x06, 0x0d, 0x3f, 0xff, 0xff, 0xf0, 0x03, 0xf8, 0x00,
+  0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x03, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x06, 0x0d, 0x0f, 0xff,
+  0xff, 0xf0, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x03, 0xc2, 0xff, 0x00, 0xe0,
+  0x80, 0x06, 0x0d, 0x07, 0xff, 0xff, 0xf0, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8,
+  0x03, 0xc2, 0xff, 0x00, 0xc0, 0x80, 0x06, 0x0d, 0x01, 0xff, 0xff, 0xf0, 0x03, 0xf8, 0x00, 0x00,
+  0x3f, 0x80, 0x00, 0x07, 0xf8, 0x03, 0xc2, 0xff, 0x80, 0x08, 0x0f, 0x3f, 0xff, 0xf0, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x08, 0x0f, 0x0f, 0xff,
+  0xf0, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x03, 0xff, 0xff, 0xe0, 0x80, 0x09,
+  0x0d, 0xff, 0xf0, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x03, 0xff, 0xff, 0x80,
+  0x0c, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8,
+  0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x07, 0xf8, 0x80, 0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80,
+  0x0f, 0x08, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x80, 0x13, 0x01, 0x3f, 0x80,
+  0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80,
+  0x16, 0x01, 0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x16,
+  0x01, 0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x16, 0x01,
+  0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x16, 0x01, 0x3f, 0x80, 0x80, 0x3a,
+};
+static constexpr PackedBitmap rain_sun_200 = {200, 200, rain_sun_200_rle};
+
+// 200x200, 5000 -> 2270 bytes
+static const uint8_t rain_moon_200_rle[] PROGMEM = {
+  0x81, 0x16, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x15, 0x02, 0x01, 0xff, 0xff, 0x80, 0x16, 0x02, 0xff,
+  0xff, 0xe0, 0x80, 0x15, 0x02, 0x7f, 0xff, 0xfc, 0x80, 0x15, 0x03, 0x7f, 0xff, 0xff, 0x80, 0x80,
+  0x14, 0x03, 0x3f, 0xff, 0xff, 0xe0, 0x80, 0x14, 0x03, 0x3f, 0xff, 0xff, 0xf8, 0x80, 0x14, 0x03,
+  0x1f, 0xff, 0xff, 0xfc, 0x80, 0x14, 0x03, 0x1f, 0xf3, 0xff, 0xff, 0x80, 0x14, 0x04, 0x1f, 0xf0,
+  0x7f, 0xff, 0x80, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x0f, 0xff, 0xe0, 0x80, 0x13, 0x04, 0x1f, 0xf0,
+  0x03, 0xff, 0xf0, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0xff, 0xf8, 0x80, 0x13, 0x04, 0x0f, 0xf0,
+  0x00, 0x3f, 0xfc, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0x1f, 0xfe, 0x80, 0x13, 0x04, 0x1f, 0xf0,
+  0x00, 0x0f, 0xff, 0x80, 0x13, 0x05, 0x1f, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x80, 0x12, 0x05, 0x1f,
+  0xf0, 0x00, 0x01, 0xff, 0x80, 0x80, 0x12, 0x05, 0x1f, 0xf0, 0x00, 0x00, 0xff, 0xc0, 0x80, 0x12,
+  0x05, 0x1f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x3f, 0xe0,
+  0x80, 0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00, 0x00,
+  0x1f, 0xf0, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x12, 0x05, 0xff, 0xc0,
+  0x00, 0x00, 0x0f, 0xf8, 0x80, 0x12, 0x05, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x11, 0x06,
+  0x01, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x11, 0x01, 0x03, 0xff, 0x80, 0x02, 0x05, 0x03,
+  0xfe, 0x00, 0x07, 0xff, 0xe0, 0x80, 0x0d, 0x01, 0x07, 0xfe, 0x80, 0x02, 0x02, 0x03, 0xfe, 0x03,
+  0xc2, 0xff, 0x00, 0x80, 0x80, 0x0c, 0x01, 0x0f, 0xfe, 0x80, 0x02, 0x02, 0x03, 0xfe, 0x3f, 0xc2,
+  0xff, 0x00, 0xfc, 0x80, 0x0c, 0x01, 0x1f, 0xfc, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0x80,
+  0x80, 0x0b, 0x01, 0x7f, 0xf8, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xf0, 0x80, 0x0b, 0x01,
+  0xff, 0xf0, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xfe, 0x80, 0x07, 0x05, 0xc0, 0x00, 0x00,
+  0x03, 0xff, 0xe0, 0x80, 0x02, 0x00, 0x03, 0xc6, 0xff, 0x00, 0x80, 0x80, 0x06, 0x05, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xc0, 0x80, 0x02, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0x01, 0xc2, 0xff, 0x00, 0xe0,
+  0x80, 0x06, 0x05, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x80, 0x02, 0x08, 0x1f, 0xff, 0xff, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0xf8, 0x80, 0x06, 0x04, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x80, 0x03, 0x02,
+  0x7f, 0xff, 0xf0, 0x80, 0x02, 0x02, 0x1f, 0xff, 0xfc, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xfc, 0x80,
+  0x02, 0x02, 0x01, 0xff, 0xff, 0x80, 0x03, 0x02, 0x01, 0xff, 0xff, 0x80, 0x06, 0xc3, 0xff, 0x00,
+  0xf0, 0x80, 0x02, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x04, 0x02, 0x3f, 0xff, 0xc0, 0x80, 0x05, 0xc3,
+  0xff, 0x00, 0xe0, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x04, 0x02, 0x0f, 0xff, 0xe0, 0x80,
+  0x05, 0xc3, 0xff, 0x00, 0x80, 0x80, 0x02, 0x02, 0x1f, 0xff, 0x80, 0x80, 0x04, 0x02, 0x03, 0xff,
+  0xf0, 0x80, 0x05, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x03, 0x01, 0x3f, 0xfe, 0x80, 0x06, 0x01, 0xff,
+  0xfc, 0x80, 0x05, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0xf8, 0x80, 0x06, 0x01, 0x3f,
+  0xfe, 0x80, 0x05, 0x02, 0xff, 0xbf, 0xfc, 0x80, 0x03, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x06, 0x01,
+  0x1f, 0xff, 0x80, 0x05, 0x01, 0x7f, 0x80, 0x80, 0x04, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x06, 0x02,
+  0x07, 0xff, 0x80, 0x80, 0x04, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x06,
+  0x02, 0x03, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xff, 0x80, 0x07,
+  0x02, 0x01, 0xff, 0xe0, 0x80, 0x04, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xfe, 0x80, 0x08,
+  0x01, 0x7f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xf8, 0x80, 0x08, 0x01,
+  0x3f, 0xf8, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x08, 0x01, 0x1f,
+  0xf8, 0x80, 0x04, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0x7f, 0xe0, 0x80, 0x08, 0x01, 0x0f, 0xfc,
+  0x80, 0x04, 0x01, 0x1f, 0xf8, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x07, 0xfe, 0x80,
+  0x04, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x04,
+  0x01, 0x0f, 0xfc, 0x80, 0x03, 0x02, 0x01, 0xff, 0x80, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x04,
+  0x01, 0x07, 0xfe, 0x80, 0x02, 0x02, 0x01, 0xff, 0xff, 0x80, 0x09, 0x02, 0x01, 0xff, 0x80, 0x80,
+  0x03, 0x01, 0x03, 0xff, 0x80, 0x02, 0x02, 0xff, 0xff, 0xfe, 0x80, 0x0a, 0x01, 0xff, 0xc0, 0x80,
+  0x03, 0x07, 0x03, 0xff, 0x80, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x80, 0x0a, 0x01, 0x7f, 0xc0, 0x80,
+  0x03, 0x07, 0x01, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x80, 0x0a, 0x01, 0x7f, 0xe0, 0x80,
+  0x04, 0x02, 0xff, 0xe0, 0x01, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0a, 0x01, 0x3f, 0xe0, 0x80, 0x04,
+  0x02, 0x7f, 0xf8, 0x07, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0a, 0x01, 0x3f, 0xf0, 0x80, 0x04, 0x02,
+  0x3f, 0xfc, 0x1f, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x0a, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x02, 0x1f,
+  0xff, 0x3f, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x0a, 0x01, 0x1f, 0xf8, 0x80, 0x04, 0x00, 0x0f, 0xc2,
+  0xff, 0x00, 0xe0, 0x80, 0x0c, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x03, 0x07, 0xff, 0xff, 0xfe, 0x80,
+  0x0d, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x0d, 0x01, 0x07, 0xfc,
+  0x80, 0x05, 0x02, 0xff, 0xff, 0xc0, 0x80, 0x0d, 0x01, 0x07, 0xfc, 0x80, 0x05, 0x01, 0x7f, 0xff,
+  0x80, 0x0e, 0x01, 0x07, 0xfc, 0x80, 0x05, 0x01, 0x3f, 0xfc, 0x80, 0x0e, 0x02, 0x03, 0xff, 0xf8,
+  0x80, 0x04, 0x01, 0x7f, 0xf8, 0x80, 0x0e, 0x03, 0x03, 0xff, 0xff, 0x80, 0x80, 0x03, 0x01, 0xff,
+  0xe0, 0x80, 0x0e, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x0e,
+  0x03, 0x01, 0xff, 0xff, 0xfc, 0x80, 0x02, 0x02, 0x03, 0xff, 0x80, 0x80, 0x0e, 0x00, 0x01, 0xc2,
+  0xff, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x0f, 0x00, 0x01, 0xc2, 0xff, 0x04, 0xc0, 0x00, 0x00,
+  0x07, 0xfe, 0x80, 0x10, 0x07, 0x7f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xfc, 0x80, 0x11, 0x06,
+  0x1f, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfc, 0x80, 0x11, 0x06, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x1f,
+  0xf8, 0x80, 0x12, 0x05, 0x7f, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x12, 0x05, 0x1f, 0xff, 0x00,
+  0x00, 0x3f, 0xf0, 0x80, 0x12, 0x05, 0x07, 0xff, 0x80, 0x00, 0x3f, 0xe0, 0x80, 0x12, 0x05, 0x03,
+  0xff, 0xc0, 0x00, 0x3f, 0xe0, 0x80, 0x13, 0x04, 0xff, 0xc0, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04,
+  0x7f, 0xe0, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0x3f, 0xf0, 0x00, 0x7f, 0x80, 0x80, 0x13, 0x04,
+  0x1f, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x13, 0x04, 0x1f, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x13, 0x04,
+  0x0f, 0xfc, 0x00, 0xff, 0x80, 0x80, 0x13, 0x04, 0x07, 0xfc, 0x00, 0xff, 0x80, 0x80, 0x13, 0x03,
+  0x07, 0xfc, 0x00, 0xff, 0x80, 0x14, 0x03, 0x03, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x03, 0xfe,
+  0x00, 0xff, 0x80, 0x14, 0x03, 0x01, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x01, 0xff, 0x00, 0xff,
+  0x80, 0x14, 0x03, 0x01, 0xff, 0x00, 0xff, 0x80, 0x14, 0x04, 0x01, 0xff, 0x00, 0xff, 0x80, 0x80,
+  0x14, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x14, 0x03,
+  0xff, 0x00, 0xff, 0x80, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x05,
+  0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80,
+  0x05, 0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0,
+  0x80, 0x05, 0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f,
+  0xf0, 0x80, 0x04, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05,
+  0x01, 0x0f, 0xf0, 0x80, 0x04, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x0f, 0xf0,
+  0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xf0, 0x80, 0x04, 0x01,
+  0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x04, 0x01, 0xfe, 0x00, 0x1f, 0xf0, 0x80,
+  0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x04, 0x03, 0xfe, 0x00, 0x1f,
+  0xf8, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x04, 0x03, 0xfe,
+  0x00, 0x0f, 0xfc, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x04,
+  0x07, 0xfc, 0x00, 0x07, 0xfe, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80,
+  0x04, 0x04, 0x07, 0xfc, 0x00, 0x07, 0xfe, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f,
+  0xf0, 0x80, 0x04, 0x04, 0x0f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x05,
+  0x01, 0x0f, 0xf0, 0x80, 0x04, 0x05, 0x1f, 0xf8, 0x00, 0x01, 0xff, 0x80, 0x80, 0x03, 0x09, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x04, 0x05, 0x3f, 0xf0, 0x00, 0x01,
+  0xff, 0xc0, 0x80, 0x03, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80,
+  0x04, 0x05, 0x3f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x03, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x04, 0x05, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xf8, 0x80, 0x03,
+  0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x03, 0x06, 0x01, 0xff,
+  0xc0, 0x00, 0x00, 0x3f, 0xfe, 0x80, 0x03, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x80, 0x03, 0x06, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x03, 0x09, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x03, 0x07, 0x07, 0xff, 0x80, 0x00,
+  0x00, 0x0f, 0xff, 0xc0, 0x80, 0x02, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x80, 0x03, 0x01, 0x1f, 0xff, 0x80, 0x02, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x02, 0x09, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x03, 0x01, 0x7f, 0xfe, 0x80, 0x02,
+  0x02, 0x01, 0xff, 0xff, 0x80, 0x02, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x80, 0x02, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x03, 0x0e, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x02, 0x02, 0x3f, 0xff, 0xf0, 0x80,
+  0x03, 0x00, 0x3f, 0xc2, 0xff, 0x0b, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0xc3, 0xff, 0x00, 0xe0, 0x80, 0x03, 0x00, 0x0f, 0xc2, 0xff, 0x0b, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xc3, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00,
+  0x03, 0xc2, 0xff, 0x0b, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0xc3, 0xff, 0x80, 0x05, 0xc2, 0xff, 0x0b, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x05, 0x0e, 0x3f, 0xff, 0xff, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x05, 0x0e,
+  0x03, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xc2,
+  0xff, 0x80, 0x07, 0x10, 0x3f, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0xff, 0xff, 0xf0, 0x80, 0x0a, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80,
+  0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e,
+  0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80,
+  0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e,
+  0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80,
+  0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0e, 0x09, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x12, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0,
+  0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80,
+  0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16,
+  0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01,
+  0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf0, 0x81, 0x1d,
+};
+static constexpr PackedBitmap rain_moon_200 = {200, 200, rain_moon_200_rle};
+
+// 200x200, 5000 -> 2003 bytes
+static const uint8_t snow_sun_200_rle[] PROGMEM = {
+  0x81, 0x7e, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80,
+  0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16,
+  0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01,
+  0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f,
+  0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80,
+  0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x10, 0x00, 0x02, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03,
+  0x00, 0x30, 0x80, 0x0b, 0x00, 0x07, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x00, 0x78, 0x80,
+  0x0b, 0x01, 0x0f, 0x80, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x00, 0xfc, 0x80, 0x0b, 0x01,
+  0x1f, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x01, 0xfe, 0x80, 0x0b, 0x01, 0x3f,
+  0xf0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x0b, 0x01, 0x3f, 0xf8,
+  0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x07, 0xfe, 0x80, 0x0b, 0x01, 0x1f, 0xfc, 0x80,
+  0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x0f, 0xfc, 0x80, 0x0b, 0x01, 0x0f, 0xfe, 0x80, 0x03,
+  0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x1f, 0xf8, 0x80, 0x0b, 0x01, 0x07, 0xff, 0x80, 0x03, 0x01,
+  0x7f, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xf0, 0x80, 0x0b, 0x02, 0x03, 0xff, 0x80, 0x80, 0x02, 0x01,
+  0x7f, 0x80, 0x80, 0x02, 0x01, 0x7f, 0xe0, 0x80, 0x0b, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x01,
+  0xff, 0xc0, 0x80, 0x0c, 0x01, 0xff, 0xe0, 0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x0c, 0x01,
+  0x7f, 0xf0, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x0d, 0x01, 0x3f, 0xf8, 0x80, 0x06, 0x01, 0x07,
+  0xfe, 0x80, 0x0d, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x01, 0x0f, 0xfc, 0x80, 0x0d, 0x01, 0x0f, 0xfe,
+  0x80, 0x06, 0x01, 0x1f, 0xf8, 0x80, 0x0d, 0x0a, 0x03, 0xff, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00,
+  0x00, 0x7f, 0xf0, 0x80, 0x0d, 0x0a, 0x01, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xe0, 0x80, 0x0e, 0x02, 0xff, 0xc0, 0x01, 0xc2, 0xff, 0x03, 0xc0, 0x01, 0xff, 0xc0, 0x80, 0x0e,
+  0x02, 0x7f, 0xc0, 0x07, 0xc2, 0xff, 0x03, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x0e, 0x02, 0x3f, 0x80,
+  0x1f, 0xc2, 0xff, 0x02, 0xfc, 0x00, 0x7f, 0x80, 0x0f, 0x02, 0x1f, 0x00, 0x7f, 0xc3, 0xff, 0x01,
+  0x00, 0x3e, 0x80, 0x0f, 0x01, 0x0e, 0x00, 0xc4, 0xff, 0x01, 0x80, 0x1c, 0x80, 0x0f, 0x08, 0x04,
+  0x01, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xe0, 0x08, 0x80, 0x10, 0x06, 0x07, 0xff, 0xf0, 0x00, 0x03,
+  0xff, 0xf0, 0x80, 0x11, 0x06, 0x0f, 0xff, 0x80, 0x00, 0x00, 0xff, 0xf8, 0x80, 0x11, 0x01, 0x1f,
+  0xfe, 0x80, 0x02, 0x01, 0x3f, 0xfc, 0x80, 0x11, 0x01, 0x3f, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xfe,
+  0x80, 0x11, 0x01, 0x7f, 0xf0, 0x80, 0x02, 0x01, 0x07, 0xff, 0x80, 0x11, 0x01, 0x7f, 0xe0, 0x80,
+  0x02, 0x05, 0x01, 0xff, 0x80, 0x00, 0x07, 0xf0, 0x80, 0x0d, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x05,
+  0xff, 0x80, 0x07, 0xff, 0xff, 0xe0, 0x80, 0x0b, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x05, 0x7f,
+  0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x0b, 0x01, 0x01, 0xff, 0x80, 0x04, 0x01, 0x3f, 0xe3, 0xc3,
+  0xff, 0x00, 0xc0, 0x80, 0x0a, 0x01, 0x03, 0xfe, 0x80, 0x04, 0x01, 0x3f, 0xef, 0xc3, 0xff, 0x00,
+  0xf8, 0x80, 0x0a, 0x01, 0x03, 0xfc, 0x80, 0x04, 0x00, 0x1f, 0xc4, 0xff, 0x00, 0xfe, 0x80, 0x0a,
+  0x01, 0x07, 0xf8, 0x80, 0x04, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x09, 0x01, 0x07, 0xf8,
+  0x80, 0x04, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07,
+  0x0f, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07,
+  0x1f, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01,
+  0x7f, 0xff, 0x80, 0x03, 0x01, 0xff, 0xfe, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01, 0xff,
+  0xfc, 0x80, 0x03, 0x02, 0x1f, 0xff, 0x80, 0x80, 0x08, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x02, 0x01,
+  0xff, 0xf0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x02,
+  0x03, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03,
+  0x01, 0x0f, 0xff, 0x80, 0x05, 0x01, 0xff, 0xf0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01,
+  0x1f, 0xfe, 0x80, 0x05, 0x01, 0x3f, 0xf8, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01, 0x3f,
+  0xf8, 0x80, 0x05, 0x01, 0x1f, 0xfc, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x03,
+  0x01, 0x7f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xfe, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80,
+  0x80, 0x03, 0x01, 0x7f, 0xe0, 0x80, 0x05, 0x01, 0x03, 0xff, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0,
+  0x3f, 0x80, 0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0xc2,
+  0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x06, 0x01, 0xff, 0xc0,
+  0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x07, 0x01,
+  0x7f, 0xe0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x07, 0xfe, 0x80,
+  0x07, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x07,
+  0xfc, 0x80, 0x07, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xf8,
+  0x80, 0x07, 0x01, 0x0f, 0xf8, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xf0, 0x80,
+  0x07, 0x01, 0x0f, 0xf8, 0x80, 0x07, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xf0, 0x80, 0x07,
+  0x01, 0x07, 0xfc, 0x80, 0x07, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x3f, 0xe0, 0x80, 0x07, 0x01,
+  0x03, 0xfc, 0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x03,
+  0xfe, 0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x01, 0xfe,
+  0x80, 0x07, 0x06, 0x0f, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x08, 0x00, 0xff, 0x80, 0x07,
+  0x02, 0x0f, 0xf0, 0x01, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x08, 0x00, 0xff, 0x80, 0x07, 0x02, 0x0f,
+  0xf0, 0x07, 0xc2, 0xff, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x02, 0x07, 0xf8, 0x1f, 0xc2,
+  0xff, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x05, 0x07, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x80,
+  0x09, 0x01, 0x3f, 0x80, 0x80, 0x06, 0x04, 0x03, 0xfc, 0x7f, 0xff, 0x80, 0x80, 0x0a, 0x01, 0x3f,
+  0xc0, 0x80, 0x06, 0x03, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xc0, 0x80, 0x06, 0x03,
+  0x01, 0xff, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0x1f, 0xc0, 0x80, 0x07, 0x02, 0xff, 0xff, 0x80, 0x80,
+  0x0b, 0x01, 0x1f, 0xe0, 0x80, 0x07, 0x01, 0xff, 0xfe, 0x80, 0x0c, 0x01, 0x1f, 0xe0, 0x80, 0x07,
+  0x01, 0x7f, 0xfc, 0x80, 0x0c, 0x01, 0x1f, 0xff, 0x80, 0x07, 0x01, 0x3f, 0xf8, 0x80, 0x0c, 0x02,
+  0x0f, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x3f, 0xe0, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xfc, 0x80, 0x06,
+  0x01, 0x7f, 0xc0, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xff, 0x80, 0x06, 0x01, 0xff, 0x80, 0x80, 0x0c,
+  0x03, 0x0f, 0xff, 0xff, 0xc0, 0x80, 0x05, 0x00, 0xff, 0x80, 0x0d, 0x03, 0x07, 0xff, 0xff, 0xe0,
+  0x80, 0x04, 0x01, 0x01, 0xff, 0x80, 0x0d, 0x03, 0x07, 0xff, 0xff, 0xf8, 0x80, 0x04, 0x01, 0x03,
+  0xfe, 0x80, 0x0e, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x04, 0x01, 0x03, 0xfc, 0x80, 0x0f, 0x01, 0x3f,
+  0xfe, 0x80, 0x04, 0x01, 0x07, 0xfc, 0x80, 0x0f, 0x01, 0x0f, 0xff, 0x80, 0x04, 0x01, 0x07, 0xf8,
+  0x80, 0x0f, 0x02, 0x03, 0xff, 0x80, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x0f, 0x02, 0x01, 0xff,
+  0xc0, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x10, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x01, 0x0f, 0xf0,
+  0x80, 0x10, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x10, 0x01, 0x1f, 0xf0, 0x80,
+  0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10, 0x01, 0x1f, 0xf0, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10,
+  0x01, 0x0f, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01,
+  0x1f, 0xc0, 0x80, 0x10, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10, 0x01, 0x03,
+  0xfc, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0,
+  0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80,
+  0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00,
+  0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80,
+  0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f,
+  0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03,
+  0x01, 0x1f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x11, 0x00, 0x7f,
+  0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x03,
+  0x07, 0x01, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x7f, 0x80, 0x03, 0x01,
+  0x0f, 0xf0, 0x80, 0x03, 0x08, 0x07, 0xe0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x0f, 0xc0, 0x80, 0x04,
+  0x00, 0xff, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x08, 0x0f, 0xf0, 0x00, 0x01, 0xff, 0x00,
+  0x00, 0x1f, 0xe0, 0x80, 0x04, 0x00, 0xff, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x08, 0x1f,
+  0xf8, 0x00, 0x01, 0xff, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x04, 0x00, 0xff, 0x80, 0x03, 0x01, 0x07,
+  0xf8, 0x80, 0x03, 0x08, 0x1f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x04, 0x00,
+  0xfe, 0x80, 0x03, 0x01, 0x07, 0xfc, 0x80, 0x03, 0x08, 0x3f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x00,
+  0x3f, 0xf0, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x08, 0x1f,
+  0xf8, 0x00, 0x03, 0xff, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01,
+  0x03, 0xfe, 0x80, 0x03, 0x08, 0x1f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x03,
+  0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80, 0x03, 0x08, 0x1f, 0xf0, 0x00, 0x01, 0xff,
+  0x00, 0x00, 0x1f, 0xf0, 0x80, 0x03, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80, 0x03,
+  0x08, 0x0f, 0xf0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x1f, 0xe0, 0x80, 0x03, 0x01, 0x07, 0xfc, 0x80,
+  0x04, 0x01, 0xff, 0x80, 0x80, 0x02, 0x08, 0x03, 0xc0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x07, 0x80,
+  0x80, 0x03, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0xc0, 0x80, 0x0f, 0x01, 0x0f, 0xf8, 0x80,
+  0x04, 0x01, 0x7f, 0xe0, 0x80, 0x0f, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x0f,
+  0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xfc, 0x80, 0x0f, 0x01, 0x7f, 0xe0, 0x80, 0x04, 0x01,
+  0x0f, 0xfe, 0x80, 0x0f, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x0d, 0x02,
+  0x03, 0xff, 0x80, 0x80, 0x04, 0x02, 0x03, 0xff, 0xe0, 0x80, 0x0d, 0x01, 0x0f, 0xff, 0x80, 0x05,
+  0x02, 0x01, 0xff, 0xf8, 0x80, 0x0d, 0x01, 0x3f, 0xfe, 0x80, 0x06, 0x02, 0xff, 0xff, 0x80, 0x80,
+  0x0b, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x06, 0x06, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x04, 0x80,
+  0x02, 0x03, 0xc0, 0x00, 0x00, 0x1f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x06, 0x0d, 0x1f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x1f, 0xc2, 0xff, 0x00, 0xf0, 0x80,
+  0x06, 0x0d, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x1f,
+  0xc2, 0xff, 0x00, 0xc0, 0x80, 0x06, 0x0d, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xe0, 0x00,
+  0x0f, 0xfc, 0x00, 0x00, 0x1f, 0xc2, 0xff, 0x80, 0x08, 0x0f, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xe0, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x80, 0x08, 0x0f, 0x1f, 0xff, 0xf0,
+  0x00, 0x00, 0xff, 0xe0, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x80, 0x08, 0x0f,
+  0x01, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x80,
+  0x80, 0x09, 0x0d, 0x03, 0xf0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x1f, 0xff,
+  0xe0, 0x80, 0x0e, 0x04, 0x7f, 0xc0, 0x00, 0x07, 0xfc, 0x80, 0x13, 0x04, 0x3f, 0x80, 0x00, 0x03,
+  0xf8, 0x80, 0x13, 0x04, 0x0f, 0x00, 0x00, 0x01, 0xe0, 0x81, 0x0b, 0x08, 0x07, 0xe0, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x0f, 0xc0, 0x80, 0x0f, 0x08, 0x0f, 0xf0, 0x00, 0x01, 0xff, 0x00, 0x00, 0x1f,
+  0xe0, 0x80, 0x0f, 0x08, 0x1f, 0xf8, 0x00, 0x01, 0xff, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x0f, 0x08,
+  0x1f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x0f, 0x08, 0x3f, 0xf8, 0x00, 0x03,
+  0xff, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x0f, 0x08, 0x1f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x00, 0x3f,
+  0xf0, 0x80, 0x0f, 0x08, 0x1f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x0f, 0x08,
+  0x1f, 0xf8, 0x00, 0x01, 0xff, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x0f, 0x08, 0x0f, 0xf0, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x1f, 0xe0, 0x80, 0x0f, 0x08, 0x03, 0xc0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x07,
+  0x80, 0x81, 0x7c,
+};
+static constexpr PackedBitmap snow_sun_200 = {200, 200, snow_sun_200_rle};
+
+// 200x200, 5000 -> 1737 bytes
+static const uint8_t snow_moon_200_rle[] PROGMEM = {
+  0x82, 0x74, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x16, 0x02, 0xff, 0xff, 0xc0, 0x80, 0x15, 0x02, 0xff,
+  0xff, 0xf8, 0x80, 0x15, 0x02, 0x7f, 0xff, 0xff, 0x80, 0x15, 0x03, 0x3f, 0xff, 0xff, 0xc0, 0x80,
+  0x14, 0x03, 0x3f, 0xff, 0xff, 0xf0, 0x80, 0x14, 0x03, 0x3f, 0xff, 0xff, 0xfc, 0x80, 0x14, 0x03,
+  0x1f, 0xff, 0xff, 0xfe, 0x80, 0x14, 0x04, 0x1f, 0xf0, 0xff, 0xff, 0x80, 0x80, 0x13, 0x04, 0x1f,
+  0xf0, 0x1f, 0xff, 0xc0, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x07, 0xff, 0xe0, 0x80, 0x13, 0x04, 0x1f,
+  0xf0, 0x01, 0xff, 0xf0, 0x80, 0x13, 0x04, 0x0f, 0xf0, 0x00, 0x7f, 0xfc, 0x80, 0x13, 0x04, 0x0f,
+  0xf0, 0x00, 0x1f, 0xfe, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0x0f, 0xfe, 0x80, 0x13, 0x04, 0x1f,
+  0xf0, 0x00, 0x07, 0xff, 0x80, 0x13, 0x05, 0x1f, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x80, 0x12, 0x05,
+  0x1f, 0xf0, 0x00, 0x01, 0xff, 0xc0, 0x80, 0x12, 0x05, 0x1f, 0xe0, 0x00, 0x00, 0xff, 0xe0, 0x80,
+  0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x3f,
+  0xf0, 0x80, 0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00,
+  0x00, 0x1f, 0xf8, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x12, 0x05, 0xff,
+  0x80, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x11, 0x06, 0x01, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x80,
+  0x11, 0x01, 0x03, 0xff, 0x80, 0x02, 0x04, 0x03, 0xfc, 0x00, 0x00, 0x10, 0x80, 0x0e, 0x01, 0x07,
+  0xff, 0x80, 0x02, 0x02, 0x03, 0xfe, 0x00, 0xc2, 0xff, 0x80, 0x0d, 0x01, 0x0f, 0xfe, 0x80, 0x02,
+  0x02, 0x03, 0xfe, 0x1f, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x0c, 0x01, 0x1f, 0xfc, 0x80, 0x02, 0x00,
+  0x01, 0xc5, 0xff, 0x80, 0x0c, 0x01, 0x3f, 0xf8, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xe0,
+  0x80, 0x0b, 0x01, 0xff, 0xf0, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xfc, 0x80, 0x07, 0x05,
+  0x80, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x80, 0x02, 0x00, 0x01, 0xc6, 0xff, 0x80, 0x07, 0x05, 0xe0,
+  0x00, 0x00, 0x07, 0xff, 0xc0, 0x80, 0x02, 0x00, 0x07, 0xc6, 0xff, 0x00, 0xc0, 0x80, 0x06, 0x05,
+  0xfc, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x80, 0x02, 0x08, 0x1f, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xff,
+  0xff, 0xf0, 0x80, 0x06, 0x04, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x80, 0x03, 0x02, 0x7f, 0xff, 0xf8,
+  0x80, 0x02, 0x02, 0x3f, 0xff, 0xfc, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x02, 0xff,
+  0xff, 0x80, 0x80, 0x02, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xf8, 0x80, 0x02,
+  0x02, 0x03, 0xff, 0xfc, 0x80, 0x04, 0x02, 0x7f, 0xff, 0x80, 0x80, 0x05, 0xc3, 0xff, 0x00, 0xe0,
+  0x80, 0x02, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x04, 0x02, 0x1f, 0xff, 0xe0, 0x80, 0x05, 0xc3, 0xff,
+  0x00, 0x80, 0x80, 0x02, 0x02, 0x1f, 0xff, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x05,
+  0xc2, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xff, 0x80, 0x05, 0x02, 0x01, 0xff, 0xf8, 0x80,
+  0x05, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x03, 0x01, 0x7f, 0xfc, 0x80, 0x06, 0x01, 0x7f, 0xfc, 0x80,
+  0x05, 0xc2, 0xff, 0x80, 0x04, 0x01, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x1f, 0xfe, 0x80, 0x05, 0x01,
+  0x7f, 0x80, 0x80, 0x04, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x06, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x04,
+  0x01, 0x7f, 0xc0, 0x80, 0x04, 0x02, 0x03, 0xff, 0x80, 0x80, 0x06, 0x02, 0x03, 0xff, 0xc0, 0x80,
+  0x04, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x07, 0xff, 0x80, 0x07, 0x02, 0x01, 0xff, 0xe0, 0x80,
+  0x04, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xfe, 0x80, 0x08, 0x01, 0xff, 0xf0, 0x80, 0x04,
+  0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xfc, 0x80, 0x08, 0x01, 0x7f, 0xf0, 0x80, 0x04, 0x01,
+  0x3f, 0xe0, 0x80, 0x04, 0x01, 0x3f, 0xf8, 0x80, 0x08, 0x01, 0x3f, 0xf8, 0x80, 0x04, 0x01, 0x1f,
+  0xf0, 0x80, 0x04, 0x01, 0x7f, 0xf0, 0x80, 0x08, 0x01, 0x1f, 0xfc, 0x80, 0x04, 0x01, 0x1f, 0xf0,
+  0x80, 0x04, 0x01, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x0f, 0xfe, 0x80, 0x04, 0x01, 0x0f, 0xf8, 0x80,
+  0x04, 0x01, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x01, 0x0f, 0xfc, 0x80, 0x03,
+  0x02, 0x01, 0xff, 0x80, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x04, 0x01, 0x07, 0xfe, 0x80, 0x03,
+  0x01, 0x03, 0xff, 0x80, 0x09, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x07, 0xff, 0x80, 0x02,
+  0x02, 0x3f, 0xff, 0xff, 0x80, 0x0a, 0x01, 0xff, 0x80, 0x80, 0x03, 0x07, 0x03, 0xff, 0x80, 0x00,
+  0x03, 0xff, 0xff, 0xfe, 0x80, 0x0a, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x07, 0x01, 0xff, 0xc0, 0x00,
+  0x1f, 0xff, 0xff, 0xfc, 0x80, 0x0a, 0x01, 0x7f, 0xe0, 0x80, 0x04, 0x02, 0xff, 0xe0, 0x00, 0xc2,
+  0xff, 0x00, 0xfc, 0x80, 0x0a, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x02, 0x7f, 0xf0, 0x03, 0xc2, 0xff,
+  0x00, 0xf8, 0x80, 0x0a, 0x01, 0x3f, 0xf0, 0x80, 0x04, 0x02, 0x3f, 0xf8, 0x0f, 0xc2, 0xff, 0x00,
+  0xf0, 0x80, 0x0a, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x02, 0x3f, 0xfe, 0x3f, 0xc2, 0xff, 0x00, 0xf0,
+  0x80, 0x0a, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x0c, 0x01,
+  0x0f, 0xf8, 0x80, 0x04, 0x00, 0x07, 0xc2, 0xff, 0x80, 0x0d, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x03,
+  0x03, 0xff, 0xff, 0xf8, 0x80, 0x0d, 0x01, 0x07, 0xfc, 0x80, 0x04, 0x03, 0x01, 0xff, 0xff, 0xe0,
+  0x80, 0x0d, 0x01, 0x07, 0xfc, 0x80, 0x05, 0x02, 0x7f, 0xff, 0x80, 0x80, 0x0d, 0x01, 0x07, 0xfc,
+  0x80, 0x05, 0x01, 0x3f, 0xfe, 0x80, 0x0e, 0x02, 0x03, 0xff, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xf8,
+  0x80, 0x0e, 0x02, 0x03, 0xff, 0xff, 0x80, 0x04, 0x01, 0xff, 0xf0, 0x80, 0x0e, 0x03, 0x03, 0xff,
+  0xff, 0xe0, 0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x0e, 0x03, 0x03, 0xff, 0xff, 0xf8, 0x80, 0x02,
+  0x02, 0x01, 0xff, 0x80, 0x80, 0x0e, 0x03, 0x01, 0xff, 0xff, 0xfe, 0x80, 0x02, 0x01, 0x03, 0xff,
+  0x80, 0x0f, 0x00, 0x01, 0xc2, 0xff, 0x04, 0x80, 0x00, 0x00, 0x07, 0xfe, 0x80, 0x0f, 0x00, 0x01,
+  0xc2, 0xff, 0x04, 0xe0, 0x00, 0x00, 0x07, 0xfe, 0x80, 0x11, 0x06, 0x7f, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xfc, 0x80, 0x11, 0x06, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xf8, 0x80, 0x12, 0x05, 0xff,
+  0xfc, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x12, 0x05, 0x1f, 0xfe, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x12,
+  0x05, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x12, 0x05, 0x03, 0xff, 0x80, 0x00, 0x3f, 0xe0,
+  0x80, 0x12, 0x05, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0xff, 0xe0, 0x00, 0x7f,
+  0xc0, 0x80, 0x13, 0x04, 0x7f, 0xf0, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0x3f, 0xf0, 0x00, 0xff,
+  0x80, 0x80, 0x13, 0x04, 0x1f, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x13, 0x04, 0x0f, 0xf8, 0x00, 0xff,
+  0x80, 0x80, 0x13, 0x04, 0x07, 0xfc, 0x00, 0xff, 0x80, 0x80, 0x13, 0x03, 0x07, 0xfc, 0x00, 0xff,
+  0x80, 0x14, 0x03, 0x03, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x03, 0xfe, 0x00, 0xff, 0x80, 0x14,
+  0x03, 0x01, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x01, 0xff, 0x00, 0xff, 0x80, 0x14, 0x03, 0x01,
+  0xff, 0x00, 0xff, 0x80, 0x14, 0x04, 0x01, 0xff, 0x00, 0xff, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00,
+  0xff, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0xff, 0x80,
+  0x80, 0x14, 0x03, 0xff, 0x00, 0x7f, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x14,
+  0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xe0, 0x80, 0x04, 0x09,
+  0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x80, 0x04, 0x04, 0x01, 0xff, 0x00,
+  0x3f, 0xe0, 0x80, 0x04, 0x09, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80,
+  0x04, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xf0, 0x80, 0x04, 0x09, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x00, 0x00, 0xff, 0xf0, 0x80, 0x04, 0x04, 0x01, 0xfe, 0x00, 0x1f, 0xf0, 0x80, 0x04, 0x09, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x04, 0x04, 0x03, 0xfe, 0x00, 0x1f,
+  0xf8, 0x80, 0x04, 0x09, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x04,
+  0x04, 0x03, 0xfe, 0x00, 0x0f, 0xf8, 0x80, 0x04, 0x09, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0x80, 0x04, 0x04, 0x07, 0xfe, 0x00, 0x0f, 0xfc, 0x80, 0x04, 0x09, 0xff, 0xf0,
+  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x04, 0x04, 0x07, 0xfc, 0x00, 0x07, 0xfe,
+  0x80, 0x04, 0x09, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x04, 0x04,
+  0x0f, 0xfc, 0x00, 0x03, 0xff, 0x80, 0x04, 0x09, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00,
+  0x3f, 0xc0, 0x80, 0x04, 0x05, 0x0f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x80, 0x03, 0x09, 0x1f, 0x80,
+  0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x1f, 0x80, 0x80, 0x04, 0x05, 0x1f, 0xf8, 0x00, 0x01, 0xff,
+  0xc0, 0x80, 0x12, 0x05, 0x3f, 0xf0, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x12, 0x05, 0x7f, 0xe0, 0x00,
+  0x00, 0x7f, 0xf8, 0x80, 0x12, 0x05, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xfc, 0x80, 0x11, 0x06, 0x01,
+  0xff, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x11, 0x07, 0x07, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff,
+  0xc0, 0x80, 0x10, 0x01, 0x1f, 0xff, 0x80, 0x02, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x10, 0x01, 0x3f,
+  0xfe, 0x80, 0x02, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x0f, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x03, 0x02,
+  0xff, 0xff, 0xe0, 0x80, 0x0e, 0x02, 0x0f, 0xff, 0xf8, 0x80, 0x03, 0x03, 0x7f, 0xff, 0xff, 0xe0,
+  0x80, 0x0c, 0x03, 0x0f, 0xff, 0xff, 0xe0, 0x80, 0x03, 0x00, 0x1f, 0xc2, 0xff, 0x80, 0x02, 0x08,
+  0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x0f, 0xc3, 0xff, 0x00, 0xc0, 0x80, 0x03, 0x00,
+  0x07, 0xc2, 0xff, 0x80, 0x02, 0x08, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x0f, 0xc3,
+  0xff, 0x80, 0x04, 0x00, 0x01, 0xc2, 0xff, 0x80, 0x02, 0x08, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x05, 0x02, 0x3f, 0xff, 0xff, 0x80, 0x02, 0x08,
+  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x05, 0x02,
+  0x07, 0xff, 0xff, 0x80, 0x02, 0x08, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xc2,
+  0xff, 0x00, 0x80, 0x80, 0x06, 0x01, 0xff, 0xff, 0x80, 0x02, 0x0b, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x80, 0x07, 0x01, 0x01, 0xff, 0x80, 0x02, 0x0a, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x0d, 0x05, 0x7f, 0xe0, 0x00,
+  0x00, 0x7f, 0xe0, 0x80, 0x12, 0x05, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x80, 0x12, 0x05, 0x1f,
+  0x80, 0x00, 0x00, 0x1f, 0x80, 0x81, 0x0a, 0x09, 0x1f, 0x80, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00,
+  0x1f, 0x80, 0x80, 0x0e, 0x09, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80,
+  0x0e, 0x09, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x0e, 0x09, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x0e, 0x09, 0xff, 0xf0, 0x00, 0x00,
+  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x80, 0x0e, 0x09, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0x80, 0x0e, 0x09, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x80, 0x0e, 0x09, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x0e, 0x09,
+  0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x0e, 0x09, 0x1f, 0x80, 0x00,
+  0x00, 0x1f, 0x80, 0x00, 0x00, 0x1f, 0x80, 0x82, 0x77,
+};
+static constexpr PackedBitmap snow_moon_200 = {200, 200, snow_moon_200_rle};
+
+// 200x200, 5000 -> 2002 bytes
+static const uint8_t lightning_sun_200_rle[] PROGMEM = {
+  0x81, 0x01, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80,
+  0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16,
+  0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01,
+  0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f,
+  0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x16, 0x01, 0x7f, 0x80,
+  0x80, 0x16, 0x01, 0x7f, 0x80, 0x80, 0x10, 0x00, 0x02, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03,
+  0x00, 0x30, 0x80, 0x0b, 0x00, 0x07, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x00, 0x78, 0x80,
+  0x0b, 0x01, 0x0f, 0x80, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x00, 0xfc, 0x80, 0x0b, 0x01,
+  0x1f, 0xc0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x01, 0xfe, 0x80, 0x0b, 0x01, 0x3f,
+  0xf0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x0b, 0x01, 0x3f, 0xf8,
+  0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x07, 0xfe, 0x80, 0x0b, 0x01, 0x1f, 0xfc, 0x80,
+  0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x0f, 0xfc, 0x80, 0x0b, 0x01, 0x0f, 0xfe, 0x80, 0x03,
+  0x01, 0x7f, 0x80, 0x80, 0x02, 0x01, 0x1f, 0xf8, 0x80, 0x0b, 0x01, 0x07, 0xff, 0x80, 0x03, 0x01,
+  0x7f, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xf0, 0x80, 0x0b, 0x02, 0x03, 0xff, 0x80, 0x80, 0x02, 0x01,
+  0x7f, 0x80, 0x80, 0x02, 0x01, 0x7f, 0xe0, 0x80, 0x0b, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x01,
+  0xff, 0xc0, 0x80, 0x0c, 0x01, 0xff, 0xe0, 0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x0c, 0x01,
+  0x7f, 0xf0, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x0d, 0x01, 0x3f, 0xf8, 0x80, 0x06, 0x01, 0x07,
+  0xfe, 0x80, 0x0d, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x01, 0x0f, 0xfc, 0x80, 0x0d, 0x01, 0x0f, 0xfe,
+  0x80, 0x06, 0x01, 0x1f, 0xf8, 0x80, 0x0d, 0x0a, 0x07, 0xff, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00,
+  0x00, 0x3f, 0xf0, 0x80, 0x0d, 0x0a, 0x01, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xe0, 0x80, 0x0e, 0x02, 0xff, 0xc0, 0x01, 0xc2, 0xff, 0x03, 0xc0, 0x01, 0xff, 0xc0, 0x80, 0x0e,
+  0x02, 0x7f, 0xc0, 0x07, 0xc2, 0xff, 0x03, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x0e, 0x02, 0x3f, 0x80,
+  0x1f, 0xc2, 0xff, 0x02, 0xfc, 0x00, 0x7f, 0x80, 0x0f, 0x02, 0x1f, 0x00, 0x7f, 0xc3, 0xff, 0x01,
+  0x00, 0x3e, 0x80, 0x0f, 0x01, 0x0e, 0x00, 0xc4, 0xff, 0x01, 0x80, 0x1c, 0x80, 0x0f, 0x08, 0x04,
+  0x01, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xe0, 0x08, 0x80, 0x10, 0x06, 0x07, 0xff, 0xf0, 0x00, 0x03,
+  0xff, 0xf0, 0x80, 0x11, 0x06, 0x0f, 0xff, 0x80, 0x00, 0x00, 0xff, 0xf8, 0x80, 0x11, 0x01, 0x1f,
+  0xfe, 0x80, 0x02, 0x01, 0x3f, 0xfc, 0x80, 0x11, 0x01, 0x3f, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xfe,
+  0x80, 0x11, 0x01, 0x3f, 0xf0, 0x80, 0x02, 0x01, 0x07, 0xff, 0x80, 0x11, 0x01, 0x7f, 0xe0, 0x80,
+  0x02, 0x05, 0x01, 0xff, 0x80, 0x00, 0x03, 0xe0, 0x80, 0x0d, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x05,
+  0xff, 0x80, 0x03, 0xff, 0xff, 0xe0, 0x80, 0x0b, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x05, 0x7f,
+  0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x0b, 0x01, 0x01, 0xff, 0x80, 0x04, 0x01, 0x3f, 0xe1, 0xc3,
+  0xff, 0x00, 0xc0, 0x80, 0x0a, 0x01, 0x03, 0xfe, 0x80, 0x04, 0x01, 0x3f, 0xef, 0xc3, 0xff, 0x00,
+  0xf8, 0x80, 0x0a, 0x01, 0x03, 0xfc, 0x80, 0x04, 0x00, 0x1f, 0xc4, 0xff, 0x00, 0xfe, 0x80, 0x0a,
+  0x01, 0x07, 0xf8, 0x80, 0x04, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x09, 0x01, 0x07, 0xf8,
+  0x80, 0x04, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07,
+  0x0f, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x07,
+  0x1f, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01,
+  0x7f, 0xff, 0x80, 0x03, 0x01, 0xff, 0xfe, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01, 0xff,
+  0xfc, 0x80, 0x03, 0x02, 0x1f, 0xff, 0x80, 0x80, 0x08, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x02, 0x01,
+  0xff, 0xf0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x02,
+  0x03, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03,
+  0x01, 0x0f, 0xff, 0x80, 0x05, 0x01, 0xff, 0xf0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01,
+  0x1f, 0xfe, 0x80, 0x05, 0x01, 0x3f, 0xf8, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x01, 0x3f,
+  0xf8, 0x80, 0x05, 0x01, 0x1f, 0xfc, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x03,
+  0x01, 0x3f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xfe, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80,
+  0x80, 0x03, 0x01, 0x7f, 0xe0, 0x80, 0x05, 0x01, 0x03, 0xff, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xf0,
+  0x3f, 0x80, 0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0xc2,
+  0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x06, 0x01, 0xff, 0xc0,
+  0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x07, 0x01,
+  0x7f, 0xe0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0x80, 0x80, 0x02, 0x01, 0x03, 0xfe, 0x80,
+  0x07, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0xc2, 0xff, 0x02, 0xf0, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x07,
+  0xfc, 0x80, 0x07, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xf8,
+  0x80, 0x07, 0x01, 0x0f, 0xf8, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xf0, 0x80,
+  0x07, 0x01, 0x0f, 0xf8, 0x80, 0x07, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xf0, 0x80, 0x07,
+  0x01, 0x07, 0xfc, 0x80, 0x07, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x3f, 0xe0, 0x80, 0x07, 0x01,
+  0x03, 0xfc, 0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x03,
+  0xfe, 0x80, 0x07, 0x06, 0x1f, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x01, 0xfe,
+  0x80, 0x07, 0x06, 0x0f, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x08, 0x00, 0xff, 0x80, 0x07,
+  0x02, 0x0f, 0xf0, 0x01, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x08, 0x00, 0xff, 0x80, 0x07, 0x02, 0x0f,
+  0xf0, 0x07, 0xc2, 0xff, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x02, 0x07, 0xf8, 0x1f, 0xc2,
+  0xff, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x05, 0x07, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x80,
+  0x09, 0x01, 0x7f, 0x80, 0x80, 0x06, 0x04, 0x03, 0xfc, 0x7f, 0xff, 0x80, 0x80, 0x0a, 0x01, 0x3f,
+  0xc0, 0x80, 0x06, 0x03, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x0b, 0x01, 0x3f, 0xc0, 0x80, 0x06, 0x03,
+  0x01, 0xff, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0x1f, 0xc0, 0x80, 0x06, 0x03, 0x01, 0xff, 0xff, 0x80,
+  0x80, 0x0b, 0x01, 0x1f, 0xe0, 0x80, 0x07, 0x01, 0xff, 0xfe, 0x80, 0x0c, 0x01, 0x1f, 0xe0, 0x80,
+  0x07, 0x01, 0x7f, 0xfc, 0x80, 0x0c, 0x01, 0x1f, 0xff, 0x80, 0x07, 0x01, 0x3f, 0xf8, 0x80, 0x0c,
+  0x02, 0x0f, 0xff, 0xe0, 0x80, 0x06, 0x01, 0x3f, 0xe0, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xfc, 0x80,
+  0x06, 0x01, 0x7f, 0xc0, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xff, 0x80, 0x06, 0x01, 0xff, 0x80, 0x80,
+  0x0c, 0x03, 0x0f, 0xff, 0xff, 0xc0, 0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x0c, 0x03, 0x07, 0xff,
+  0xff, 0xe0, 0x80, 0x04, 0x01, 0x01, 0xff, 0x80, 0x0d, 0x03, 0x07, 0xff, 0xff, 0xf8, 0x80, 0x04,
+  0x01, 0x03, 0xfe, 0x80, 0x0e, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x04, 0x01, 0x03, 0xfc, 0x80, 0x0f,
+  0x01, 0x7f, 0xfe, 0x80, 0x04, 0x01, 0x07, 0xfc, 0x80, 0x0f, 0x01, 0x0f, 0xff, 0x80, 0x04, 0x01,
+  0x07, 0xf8, 0x80, 0x0f, 0x02, 0x03, 0xff, 0x80, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x0f, 0x02,
+  0x01, 0xff, 0xc0, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x10, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x01,
+  0x0f, 0xf0, 0x80, 0x10, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x10, 0x01, 0x1f,
+  0xf0, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80, 0x10, 0x01, 0x1f, 0xf0, 0x80, 0x03, 0x01, 0x1f, 0xe0,
+  0x80, 0x10, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10, 0x01, 0x07, 0xf8, 0x80,
+  0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x10,
+  0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01,
+  0x3f, 0xc0, 0x80, 0x10, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x10, 0x01, 0x01,
+  0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80,
+  0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f,
+  0xc0, 0x80, 0x11, 0x00, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03,
+  0x01, 0x3f, 0xc0, 0x80, 0x11, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x11, 0x00, 0x7f,
+  0x80, 0x03, 0x01, 0x1f, 0xc0, 0x80, 0x06, 0x00, 0x0c, 0x80, 0x09, 0x00, 0x7f, 0x80, 0x03, 0x01,
+  0x1f, 0xe0, 0x80, 0x06, 0x00, 0x3e, 0x80, 0x09, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x1f, 0xe0, 0x80,
+  0x06, 0x00, 0x7e, 0x80, 0x09, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x05, 0x01, 0x01,
+  0xff, 0x80, 0x09, 0x00, 0x7f, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x06, 0x01, 0xff, 0x80, 0x80,
+  0x08, 0x00, 0xff, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x06, 0x01, 0x7f, 0xc0, 0x80, 0x08, 0x00,
+  0xff, 0x80, 0x03, 0x01, 0x0f, 0xf8, 0x80, 0x06, 0x01, 0x7f, 0xc0, 0x80, 0x08, 0x00, 0xff, 0x80,
+  0x03, 0x01, 0x07, 0xf8, 0x80, 0x06, 0x01, 0x3f, 0xe0, 0x80, 0x08, 0x00, 0xfe, 0x80, 0x03, 0x01,
+  0x07, 0xfc, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x03,
+  0xfc, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xfe,
+  0x80, 0x06, 0x01, 0x0f, 0xf8, 0x80, 0x07, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80,
+  0x06, 0x01, 0x07, 0xfc, 0x80, 0x07, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80, 0x06,
+  0x01, 0x03, 0xfe, 0x80, 0x07, 0x01, 0x07, 0xfc, 0x80, 0x04, 0x01, 0xff, 0x80, 0x80, 0x05, 0x01,
+  0x03, 0xfe, 0x80, 0x07, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0xc0, 0x80, 0x05, 0x01, 0x01,
+  0xff, 0x80, 0x07, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0xe0, 0x80, 0x06, 0x01, 0xff, 0x80,
+  0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x06, 0x01, 0xff, 0x80, 0x80,
+  0x06, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x01, 0x7f, 0xc0, 0x80, 0x06,
+  0x01, 0x7f, 0xe0, 0x80, 0x04, 0x01, 0x0f, 0xfe, 0x80, 0x06, 0x01, 0x3f, 0xe0, 0x80, 0x06, 0x01,
+  0xff, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x05, 0x01, 0x1f, 0xf0, 0x80, 0x05, 0x02,
+  0x03, 0xff, 0x80, 0x80, 0x04, 0x02, 0x03, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x1f, 0xf0, 0x80, 0x05,
+  0x01, 0x0f, 0xff, 0x80, 0x05, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x05, 0x01, 0x0f, 0xf8, 0x80, 0x05,
+  0x01, 0x3f, 0xfe, 0x80, 0x06, 0x02, 0xff, 0xff, 0x80, 0x80, 0x04, 0x01, 0x07, 0xfc, 0x80, 0x04,
+  0x02, 0x01, 0xff, 0xfc, 0x80, 0x06, 0x00, 0x3f, 0xc2, 0xff, 0x08, 0xfc, 0x00, 0x00, 0xff, 0xff,
+  0xfe, 0x00, 0x00, 0x07, 0xc3, 0xff, 0x00, 0xf8, 0x80, 0x06, 0x00, 0x1f, 0xc2, 0xff, 0x08, 0xfc,
+  0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xc3, 0xff, 0x00, 0xf0, 0x80, 0x06, 0x00, 0x07,
+  0xc2, 0xff, 0x02, 0xfc, 0x00, 0x00, 0xc2, 0xff, 0x80, 0x01, 0x00, 0x0f, 0xc3, 0xff, 0x00, 0xc0,
+  0x80, 0x06, 0x00, 0x01, 0xc2, 0xff, 0x08, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x0f,
+  0xc3, 0xff, 0x00, 0x80, 0x80, 0x07, 0x0b, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff,
+  0x80, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xfe, 0x80, 0x08, 0x0b, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00,
+  0x1f, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x08, 0x0b, 0x01, 0xff, 0xff,
+  0xfc, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x09, 0x0d,
+  0x07, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x80, 0x0f,
+  0x01, 0x07, 0xfc, 0x80, 0x16, 0x01, 0x03, 0xfe, 0x80, 0x16, 0x01, 0x03, 0xfe, 0x80, 0x16, 0x01,
+  0x01, 0xff, 0x80, 0x17, 0x01, 0xff, 0x80, 0x80, 0x16, 0x01, 0xff, 0x80, 0x80, 0x16, 0x01, 0x7f,
+  0xc0, 0x80, 0x16, 0x01, 0x3f, 0xe0, 0x80, 0x16, 0x01, 0x1f, 0xf0, 0x80, 0x16, 0x01, 0x1f, 0xf0,
+  0x80, 0x16, 0x01, 0x0f, 0xf8, 0x80, 0x16, 0x01, 0x07, 0xfc, 0x80, 0x16, 0x01, 0x07, 0xfc, 0x80,
+  0x16, 0x01, 0x03, 0xfe, 0x80, 0x16, 0x01, 0x01, 0xff, 0x80, 0x17, 0x01, 0xff, 0x80, 0x80, 0x16,
+  0x01, 0xff, 0x80, 0x80, 0x16, 0x01, 0x7f, 0xc0, 0x80, 0x16, 0x01, 0x3f, 0xe0, 0x80, 0x16, 0x01,
+  0x3f, 0xe0, 0x80, 0x16, 0x01, 0x1f, 0xf0, 0x80, 0x16, 0x01, 0x0f, 0xf8, 0x80, 0x16, 0x01, 0x07,
+  0xfc, 0x80, 0x16, 0x01, 0x07, 0xfc, 0x80, 0x16, 0x01, 0x03, 0xfe, 0x80, 0x16, 0x01, 0x01, 0xff,
+  0x80, 0x16, 0x01, 0x01, 0xff, 0x80, 0x17, 0x01, 0xff, 0x80, 0x80, 0x16, 0x01, 0x7f, 0xc0, 0x80,
+  0x16, 0x01, 0x3f, 0xc0, 0x80, 0x16, 0x00, 0x3f, 0x80, 0x17, 0x00, 0x1e, 0x80, 0x17, 0x00, 0x08,
+  0x81, 0x01,
+};
+static constexpr PackedBitmap lightning_sun_200 = {200, 200, lightning_sun_200_rle};
+
+// 200x200, 5000 -> 1733 bytes
+static const uint8_t lightning_moon_200_rle[] PROGMEM = {
+  0x81, 0xf7, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x16, 0x02, 0xff, 0xff, 0xc0, 0x80, 0x15, 0x02, 0xff,
+  0xff, 0xf8, 0x80, 0x15, 0x02, 0x7f, 0xff, 0xff, 0x80, 0x15, 0x03, 0x3f, 0xff, 0xff, 0xc0, 0x80,
+  0x14, 0x03, 0x3f, 0xff, 0xff, 0xf0, 0x80, 0x14, 0x03, 0x3f, 0xff, 0xff, 0xfc, 0x80, 0x14, 0x03,
+  0x1f, 0xff, 0xff, 0xfe, 0x80, 0x14, 0x04, 0x1f, 0xf0, 0xff, 0xff, 0x80, 0x80, 0x13, 0x04, 0x1f,
+  0xf0, 0x1f, 0xff, 0xc0, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x07, 0xff, 0xe0, 0x80, 0x13, 0x04, 0x1f,
+  0xf0, 0x01, 0xff, 0xf0, 0x80, 0x13, 0x04, 0x0f, 0xf0, 0x00, 0x7f, 0xf8, 0x80, 0x13, 0x04, 0x0f,
+  0xf0, 0x00, 0x1f, 0xfc, 0x80, 0x13, 0x04, 0x1f, 0xf0, 0x00, 0x0f, 0xfe, 0x80, 0x13, 0x04, 0x1f,
+  0xf0, 0x00, 0x07, 0xff, 0x80, 0x13, 0x05, 0x1f, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x80, 0x12, 0x05,
+  0x1f, 0xf0, 0x00, 0x01, 0xff, 0xc0, 0x80, 0x12, 0x05, 0x1f, 0xe0, 0x00, 0x00, 0xff, 0xc0, 0x80,
+  0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x3f,
+  0xf0, 0x80, 0x12, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00,
+  0x00, 0x1f, 0xf8, 0x80, 0x12, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x12, 0x05, 0xff,
+  0x80, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x11, 0x06, 0x01, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x80,
+  0x11, 0x01, 0x03, 0xff, 0x80, 0x02, 0x01, 0x03, 0xfc, 0x80, 0x11, 0x01, 0x07, 0xff, 0x80, 0x02,
+  0x05, 0x03, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0x80, 0x0d, 0x01, 0x0f, 0xfe, 0x80, 0x02, 0x02, 0x03,
+  0xfe, 0x1f, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x0c, 0x01, 0x1f, 0xfc, 0x80, 0x02, 0x00, 0x01, 0xc5,
+  0xff, 0x80, 0x0c, 0x01, 0x3f, 0xf8, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xe0, 0x80, 0x0b,
+  0x01, 0xff, 0xf0, 0x80, 0x02, 0x00, 0x01, 0xc5, 0xff, 0x00, 0xfc, 0x80, 0x07, 0x05, 0x80, 0x00,
+  0x00, 0x01, 0xff, 0xf0, 0x80, 0x02, 0x00, 0x01, 0xc6, 0xff, 0x80, 0x07, 0x05, 0xe0, 0x00, 0x00,
+  0x07, 0xff, 0xc0, 0x80, 0x02, 0x00, 0x07, 0xc6, 0xff, 0x00, 0xc0, 0x80, 0x06, 0x05, 0xfc, 0x00,
+  0x00, 0x3f, 0xff, 0x80, 0x80, 0x02, 0x08, 0x1f, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xf0,
+  0x80, 0x06, 0x04, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x80, 0x03, 0x02, 0x7f, 0xff, 0xf8, 0x80, 0x02,
+  0x02, 0x3f, 0xff, 0xfc, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x02, 0xff, 0xff, 0x80,
+  0x80, 0x02, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x06, 0xc3, 0xff, 0x00, 0xf8, 0x80, 0x02, 0x02, 0x03,
+  0xff, 0xfc, 0x80, 0x04, 0x02, 0x7f, 0xff, 0x80, 0x80, 0x05, 0xc3, 0xff, 0x00, 0xe0, 0x80, 0x02,
+  0x02, 0x07, 0xff, 0xf0, 0x80, 0x04, 0x02, 0x1f, 0xff, 0xc0, 0x80, 0x05, 0xc3, 0xff, 0x00, 0x80,
+  0x80, 0x02, 0x02, 0x1f, 0xff, 0xc0, 0x80, 0x04, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x05, 0xc2, 0xff,
+  0x00, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xff, 0x80, 0x05, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x05, 0xc2,
+  0xff, 0x00, 0xf0, 0x80, 0x03, 0x01, 0x7f, 0xfc, 0x80, 0x06, 0x01, 0x7f, 0xfc, 0x80, 0x05, 0xc2,
+  0xff, 0x80, 0x04, 0x01, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x1f, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0x80,
+  0x80, 0x04, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x06, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x04, 0x01, 0x7f,
+  0xc0, 0x80, 0x04, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x06, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x04, 0x01,
+  0x7f, 0xc0, 0x80, 0x04, 0x01, 0x07, 0xff, 0x80, 0x07, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x04, 0x01,
+  0x7f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xfe, 0x80, 0x08, 0x01, 0xff, 0xf0, 0x80, 0x04, 0x01, 0x3f,
+  0xe0, 0x80, 0x04, 0x01, 0x1f, 0xfc, 0x80, 0x08, 0x01, 0x7f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xe0,
+  0x80, 0x04, 0x01, 0x3f, 0xf8, 0x80, 0x08, 0x01, 0x3f, 0xf8, 0x80, 0x04, 0x01, 0x1f, 0xf0, 0x80,
+  0x04, 0x01, 0x7f, 0xf0, 0x80, 0x08, 0x01, 0x1f, 0xfc, 0x80, 0x04, 0x01, 0x1f, 0xf0, 0x80, 0x04,
+  0x01, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x0f, 0xfe, 0x80, 0x04, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x01,
+  0xff, 0xc0, 0x80, 0x08, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x02, 0x01,
+  0xff, 0x80, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x04, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x01, 0x03,
+  0xff, 0x80, 0x09, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x07, 0xff, 0x80, 0x02, 0x02, 0x1f,
+  0xff, 0xff, 0x80, 0x0a, 0x01, 0xff, 0x80, 0x80, 0x03, 0x07, 0x03, 0xff, 0x80, 0x00, 0x03, 0xff,
+  0xff, 0xfe, 0x80, 0x0a, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x07, 0x01, 0xff, 0xc0, 0x00, 0x1f, 0xff,
+  0xff, 0xfc, 0x80, 0x0a, 0x01, 0x7f, 0xe0, 0x80, 0x04, 0x02, 0xff, 0xe0, 0x00, 0xc2, 0xff, 0x00,
+  0xfc, 0x80, 0x0a, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x02, 0x7f, 0xf0, 0x03, 0xc2, 0xff, 0x00, 0xf8,
+  0x80, 0x0a, 0x01, 0x3f, 0xf0, 0x80, 0x04, 0x02, 0x7f, 0xf8, 0x0f, 0xc2, 0xff, 0x00, 0xf0, 0x80,
+  0x0a, 0x01, 0x1f, 0xf0, 0x80, 0x04, 0x02, 0x3f, 0xfe, 0x3f, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x0a,
+  0x01, 0x1f, 0xf0, 0x80, 0x04, 0x00, 0x1f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0c, 0x01, 0x0f, 0xf8,
+  0x80, 0x04, 0x00, 0x07, 0xc2, 0xff, 0x80, 0x0d, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x03, 0x03, 0xff,
+  0xff, 0xf8, 0x80, 0x0d, 0x01, 0x07, 0xf8, 0x80, 0x04, 0x03, 0x01, 0xff, 0xff, 0xe0, 0x80, 0x0d,
+  0x01, 0x07, 0xfc, 0x80, 0x05, 0x02, 0x7f, 0xff, 0x80, 0x80, 0x0d, 0x01, 0x07, 0xfc, 0x80, 0x05,
+  0x01, 0x3f, 0xfe, 0x80, 0x0e, 0x02, 0x03, 0xff, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xf8, 0x80, 0x0e,
+  0x02, 0x03, 0xff, 0xff, 0x80, 0x04, 0x01, 0xff, 0xf0, 0x80, 0x0e, 0x03, 0x03, 0xff, 0xff, 0xe0,
+  0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x0e, 0x03, 0x03, 0xff, 0xff, 0xf8, 0x80, 0x02, 0x02, 0x01,
+  0xff, 0x80, 0x80, 0x0e, 0x03, 0x01, 0xff, 0xff, 0xfe, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x0f,
+  0x00, 0x01, 0xc2, 0xff, 0x04, 0x80, 0x00, 0x00, 0x07, 0xfe, 0x80, 0x0f, 0x00, 0x01, 0xc2, 0xff,
+  0x04, 0xc0, 0x00, 0x00, 0x07, 0xfe, 0x80, 0x11, 0x06, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfc,
+  0x80, 0x11, 0x06, 0x07, 0xff, 0xf8, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x12, 0x05, 0xff, 0xfc, 0x00,
+  0x00, 0x1f, 0xf0, 0x80, 0x12, 0x05, 0x3f, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x12, 0x05, 0x0f,
+  0xff, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x12, 0x05, 0x03, 0xff, 0x80, 0x00, 0x3f, 0xe0, 0x80, 0x12,
+  0x05, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0xff, 0xe0, 0x00, 0x7f, 0xc0, 0x80,
+  0x13, 0x04, 0x7f, 0xf0, 0x00, 0x7f, 0xc0, 0x80, 0x13, 0x04, 0x3f, 0xf0, 0x00, 0xff, 0x80, 0x80,
+  0x13, 0x04, 0x1f, 0xf8, 0x00, 0xff, 0x80, 0x80, 0x13, 0x04, 0x0f, 0xf8, 0x00, 0xff, 0x80, 0x80,
+  0x13, 0x04, 0x07, 0xfc, 0x00, 0xff, 0x80, 0x80, 0x13, 0x03, 0x07, 0xfc, 0x00, 0xff, 0x80, 0x14,
+  0x03, 0x03, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x03, 0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x03,
+  0xfe, 0x00, 0xff, 0x80, 0x14, 0x03, 0x01, 0xff, 0x00, 0xff, 0x80, 0x14, 0x03, 0x01, 0xff, 0x00,
+  0xff, 0x80, 0x14, 0x04, 0x01, 0xff, 0x00, 0xff, 0x80, 0x80, 0x13, 0x04, 0x01, 0xff, 0x00, 0xff,
+  0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x14, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80,
+  0x07, 0x00, 0x06, 0x80, 0x0b, 0x03, 0xff, 0x00, 0x7f, 0x80, 0x80, 0x07, 0x00, 0x1f, 0x80, 0x0b,
+  0x03, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x07, 0x01, 0x3f, 0x80, 0x80, 0x0a, 0x03, 0xff, 0x00, 0x7f,
+  0xc0, 0x80, 0x07, 0x01, 0xff, 0xc0, 0x80, 0x09, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xe0, 0x80, 0x07,
+  0x01, 0xff, 0xe0, 0x80, 0x09, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xe0, 0x80, 0x07, 0x01, 0x7f, 0xf0,
+  0x80, 0x09, 0x04, 0x01, 0xff, 0x00, 0x3f, 0xf0, 0x80, 0x07, 0x01, 0x3f, 0xf0, 0x80, 0x09, 0x04,
+  0x01, 0xfe, 0x00, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x1f, 0xf8, 0x80, 0x09, 0x04, 0x03, 0xfe, 0x00,
+  0x1f, 0xf8, 0x80, 0x07, 0x01, 0x0f, 0xfc, 0x80, 0x09, 0x04, 0x03, 0xfe, 0x00, 0x0f, 0xf8, 0x80,
+  0x07, 0x01, 0x0f, 0xfe, 0x80, 0x09, 0x04, 0x07, 0xfe, 0x00, 0x0f, 0xfc, 0x80, 0x07, 0x01, 0x07,
+  0xff, 0x80, 0x09, 0x04, 0x07, 0xfc, 0x00, 0x07, 0xfe, 0x80, 0x07, 0x02, 0x03, 0xff, 0x80, 0x80,
+  0x08, 0x04, 0x0f, 0xfc, 0x00, 0x03, 0xff, 0x80, 0x07, 0x02, 0x01, 0xff, 0x80, 0x80, 0x08, 0x05,
+  0x0f, 0xf8, 0x00, 0x03, 0xff, 0x80, 0x80, 0x07, 0x01, 0xff, 0xc0, 0x80, 0x08, 0x05, 0x1f, 0xf8,
+  0x00, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x7f, 0xe0, 0x80, 0x08, 0x05, 0x3f, 0xf0, 0x00, 0x00,
+  0xff, 0xe0, 0x80, 0x07, 0x01, 0x3f, 0xf0, 0x80, 0x08, 0x05, 0x7f, 0xe0, 0x00, 0x00, 0x7f, 0xf8,
+  0x80, 0x07, 0x01, 0x3f, 0xf8, 0x80, 0x08, 0x05, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xfc, 0x80, 0x07,
+  0x01, 0x1f, 0xfc, 0x80, 0x07, 0x06, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x07, 0x01,
+  0x0f, 0xfc, 0x80, 0x07, 0x07, 0x07, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x80, 0x06, 0x01,
+  0x07, 0xfe, 0x80, 0x07, 0x01, 0x0f, 0xff, 0x80, 0x02, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x06, 0x01,
+  0x03, 0xff, 0x80, 0x07, 0x01, 0x3f, 0xfe, 0x80, 0x02, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x06, 0x02,
+  0x01, 0xff, 0x80, 0x80, 0x05, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x03, 0x02, 0xff, 0xff, 0xc0, 0x80,
+  0x05, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x02, 0x0f, 0xff, 0xf8, 0x80, 0x03, 0x03, 0x7f, 0xff,
+  0xff, 0xc0, 0x80, 0x05, 0x01, 0xff, 0xe0, 0x80, 0x04, 0x03, 0x07, 0xff, 0xff, 0xe0, 0x80, 0x03,
+  0x00, 0x1f, 0xc3, 0xff, 0x02, 0xf0, 0x00, 0x00, 0xc2, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x0f, 0xc4,
+  0xff, 0x00, 0xc0, 0x80, 0x03, 0x00, 0x07, 0xc3, 0xff, 0x09, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xc4, 0xff, 0x80, 0x04, 0x00, 0x01, 0xc3, 0xff, 0x09, 0xf0, 0x00, 0x00,
+  0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x0f, 0xc3, 0xff, 0x00, 0xfc, 0x80, 0x05, 0x00, 0x7f, 0xc2,
+  0xff, 0x09, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xc3, 0xff, 0x00, 0xf0,
+  0x80, 0x05, 0x00, 0x0f, 0xc2, 0xff, 0x09, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00,
+  0x0f, 0xc3, 0xff, 0x00, 0xc0, 0x80, 0x06, 0xc2, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc2, 0xff,
+  0x80, 0x01, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x07, 0x06, 0x03, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x07, 0xc2, 0xff, 0x80, 0x01, 0x00, 0x0f, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x0d, 0x01, 0x03,
+  0xff, 0x80, 0x16, 0x02, 0x01, 0xff, 0x80, 0x80, 0x16, 0x01, 0xff, 0xc0, 0x80, 0x16, 0x01, 0x7f,
+  0xe0, 0x80, 0x16, 0x01, 0x7f, 0xf0, 0x80, 0x16, 0x01, 0x3f, 0xf8, 0x80, 0x16, 0x01, 0x1f, 0xfc,
+  0x80, 0x16, 0x01, 0x0f, 0xfc, 0x80, 0x16, 0x01, 0x07, 0xfe, 0x80, 0x16, 0x01, 0x03, 0xff, 0x80,
+  0x16, 0x02, 0x03, 0xff, 0x80, 0x80, 0x15, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x16, 0x01, 0xff, 0xe0,
+  0x80, 0x16, 0x01, 0x7f, 0xe0, 0x80, 0x16, 0x01, 0x3f, 0xf0, 0x80, 0x16, 0x01, 0x1f, 0xf8, 0x80,
+  0x16, 0x01, 0x1f, 0xfc, 0x80, 0x16, 0x01, 0x0f, 0xfe, 0x80, 0x16, 0x01, 0x07, 0xff, 0x80, 0x16,
+  0x01, 0x03, 0xff, 0x80, 0x16, 0x02, 0x01, 0xff, 0x80, 0x80, 0x16, 0x01, 0xff, 0xc0, 0x80, 0x16,
+  0x01, 0xff, 0xe0, 0x80, 0x16, 0x01, 0x7f, 0xf0, 0x80, 0x16, 0x01, 0x3f, 0xf8, 0x80, 0x16, 0x01,
+  0x1f, 0xf8, 0x80, 0x16, 0x01, 0x0f, 0xfc, 0x80, 0x16, 0x01, 0x07, 0xfe, 0x80, 0x16, 0x01, 0x07,
+  0xff, 0x80, 0x16, 0x01, 0x03, 0xff, 0x80, 0x16, 0x01, 0x01, 0xfc, 0x80, 0x17, 0x00, 0xf0, 0x80,
+  0x17, 0x00, 0x60, 0x81, 0xfc,
+};
+static constexpr PackedBitmap lightning_moon_200 = {200, 200, lightning_moon_200_rle};
+
+// 160x160, 3200 -> 1008 bytes
+static const uint8_t unknown_160_rle[] PROGMEM = {
+  0x82, 0x75, 0x00, 0x30, 0x80, 0x11, 0x02, 0xff, 0xff, 0xfc, 0x80, 0x0f, 0x00, 0x0f, 0xc2, 0xff,
+  0x00, 0xc0, 0x80, 0x0e, 0x00, 0x7f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0d, 0x00, 0x03, 0xc4, 0xff,
+  0x80, 0x0d, 0x00, 0x0f, 0xc4, 0xff, 0x00, 0xc0, 0x80, 0x0c, 0x00, 0x3f, 0xc4, 0xff, 0x00, 0xf0,
+  0x80, 0x0c, 0x06, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff, 0xfc, 0x80, 0x0b, 0x02, 0x03, 0xff, 0xfc,
+  0x80, 0x02, 0x01, 0xff, 0xff, 0x80, 0x0b, 0x02, 0x07, 0xff, 0xe0, 0x80, 0x02, 0x02, 0x1f, 0xff,
+  0x80, 0x80, 0x0a, 0x01, 0x1f, 0xff, 0x80, 0x03, 0x02, 0x07, 0xff, 0xe0, 0x80, 0x0a, 0x01, 0x3f,
+  0xfc, 0x80, 0x04, 0x01, 0xff, 0xf0, 0x80, 0x0a, 0x01, 0x7f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xf8,
+  0x80, 0x09, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xfe, 0x80, 0x09, 0x02, 0x03, 0xff,
+  0x80, 0x80, 0x04, 0x01, 0x07, 0xff, 0x80, 0x09, 0x01, 0x07, 0xff, 0x80, 0x05, 0x02, 0x03, 0xff,
+  0x80, 0x80, 0x08, 0x01, 0x0f, 0xfc, 0x80, 0x06, 0x01, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x1f, 0xf8,
+  0x80, 0x06, 0x01, 0x7f, 0xe0, 0x80, 0x08, 0x01, 0x1f, 0xf0, 0x80, 0x06, 0x01, 0x3f, 0xf0, 0x80,
+  0x08, 0x01, 0x3f, 0xe0, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x7f, 0xc0, 0x80, 0x06,
+  0x01, 0x0f, 0xf8, 0x80, 0x08, 0x01, 0xff, 0x80, 0x80, 0x06, 0x01, 0x07, 0xfc, 0x80, 0x08, 0x00,
+  0xff, 0x80, 0x07, 0x01, 0x03, 0xfc, 0x80, 0x07, 0x01, 0x01, 0xfe, 0x80, 0x07, 0x01, 0x01, 0xfe,
+  0x80, 0x07, 0x01, 0x03, 0xfe, 0x80, 0x07, 0x01, 0x01, 0xff, 0x80, 0x06, 0x02, 0x1f, 0xff, 0xfc,
+  0x80, 0x08, 0x00, 0xff, 0x80, 0x05, 0x03, 0x01, 0xff, 0xff, 0xf8, 0x80, 0x08, 0x01, 0x7f, 0x80,
+  0x80, 0x04, 0x03, 0x07, 0xff, 0xff, 0xf8, 0x80, 0x08, 0x01, 0x7f, 0x80, 0x80, 0x04, 0x03, 0x3f,
+  0xff, 0xff, 0xf0, 0x80, 0x08, 0x01, 0x3f, 0xc0, 0x80, 0x04, 0x03, 0x7f, 0xff, 0xff, 0xe0, 0x80,
+  0x08, 0x01, 0x3f, 0xc0, 0x80, 0x03, 0x00, 0x01, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x08, 0x01, 0x1f,
+  0xe0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xf8, 0x80, 0x0a, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x02, 0x0f,
+  0xff, 0xc0, 0x80, 0x0a, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x01, 0x1f, 0xfe, 0x80, 0x0b, 0x01, 0x0f,
+  0xf0, 0x80, 0x03, 0x01, 0x3f, 0xf8, 0x80, 0x0b, 0x01, 0x07, 0xf0, 0x80, 0x03, 0x01, 0x7f, 0xe0,
+  0x80, 0x0b, 0x01, 0x07, 0xfc, 0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x0b, 0x07, 0x07, 0xff, 0xe0,
+  0x00, 0x00, 0x01, 0xff, 0x80, 0x80, 0x0b, 0x06, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfe, 0x80,
+  0x0c, 0x06, 0x03, 0xff, 0xff, 0x80, 0x00, 0x07, 0xfc, 0x80, 0x0c, 0x06, 0x03, 0xff, 0xff, 0xc0,
+  0x00, 0x07, 0xf8, 0x80, 0x0c, 0x06, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xf0, 0x80, 0x0d, 0x05,
+  0x1f, 0xff, 0xfc, 0x00, 0x1f, 0xf0, 0x80, 0x0e, 0x04, 0x7f, 0xfe, 0x00, 0x1f, 0xe0, 0x80, 0x0e,
+  0x04, 0x0f, 0xff, 0x00, 0x3f, 0xc0, 0x80, 0x0e, 0x04, 0x03, 0xff, 0x80, 0x3f, 0xc0, 0x80, 0x0f,
+  0x03, 0xff, 0xc0, 0x7f, 0x80, 0x80, 0x0f, 0x03, 0x7f, 0xe0, 0x7f, 0x80, 0x80, 0x0f, 0x02, 0x3f,
+  0xf0, 0x7f, 0x80, 0x10, 0x02, 0x1f, 0xf0, 0xff, 0x80, 0x10, 0x02, 0x0f, 0xf8, 0xff, 0x80, 0x10,
+  0x02, 0x07, 0xf8, 0xfe, 0x80, 0x10, 0x02, 0x03, 0xfc, 0xfe, 0x80, 0x10, 0x02, 0x01, 0xfc, 0xfe,
+  0x80, 0x08, 0x00, 0xe0, 0x80, 0x06, 0x02, 0x01, 0xfe, 0xfe, 0x80, 0x07, 0x01, 0x01, 0xf0, 0x80,
+  0x07, 0x01, 0xfe, 0xfe, 0x80, 0x07, 0x01, 0x03, 0xf8, 0x80, 0x07, 0x01, 0xfe, 0xfe, 0x80, 0x07,
+  0x01, 0x07, 0xfc, 0x80, 0x07, 0x01, 0xff, 0xfe, 0x80, 0x07, 0x01, 0x0f, 0xfe, 0x80, 0x07, 0x01,
+  0x7f, 0xfe, 0x80, 0x07, 0x02, 0x3f, 0xff, 0x80, 0x80, 0x06, 0x01, 0x7f, 0xfe, 0x80, 0x07, 0x02,
+  0x7f, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x7f, 0xfe, 0x80, 0x07, 0x02, 0xff, 0xff, 0xe0, 0x80, 0x06,
+  0x01, 0x7f, 0xfe, 0x80, 0x06, 0x03, 0x01, 0xff, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x7f, 0xfe, 0x80,
+  0x06, 0x03, 0x03, 0xff, 0xff, 0xf8, 0x80, 0x06, 0x01, 0x7f, 0xff, 0x80, 0x06, 0x03, 0x07, 0xff,
+  0xff, 0xfc, 0x80, 0x06, 0x01, 0x7f, 0x7f, 0x80, 0x06, 0x03, 0x0f, 0xff, 0xff, 0xfe, 0x80, 0x06,
+  0x01, 0x7f, 0x7f, 0x80, 0x06, 0x03, 0x1f, 0xfb, 0xfb, 0xff, 0x80, 0x06, 0x02, 0x7f, 0x7f, 0x80,
+  0x80, 0x05, 0x04, 0x7f, 0xf3, 0xf9, 0xff, 0xc0, 0x80, 0x05, 0x02, 0x7f, 0x7f, 0x80, 0x80, 0x05,
+  0x04, 0xff, 0xe3, 0xf8, 0x7f, 0xe0, 0x80, 0x05, 0x02, 0x7f, 0x3f, 0xc0, 0x80, 0x04, 0x05, 0x01,
+  0xff, 0x83, 0xf8, 0x3f, 0xf0, 0x80, 0x05, 0x02, 0xff, 0x3f, 0xc0, 0x80, 0x04, 0x05, 0x03, 0xff,
+  0x03, 0xf8, 0x1f, 0xf8, 0x80, 0x05, 0x02, 0xfe, 0x1f, 0xe0, 0x80, 0x04, 0x05, 0x07, 0xfe, 0x03,
+  0xf8, 0x0f, 0xfc, 0x80, 0x05, 0x02, 0xfe, 0x1f, 0xf0, 0x80, 0x04, 0x05, 0x07, 0xfc, 0x03, 0xf8,
+  0x07, 0xfc, 0x80, 0x04, 0x03, 0x01, 0xfe, 0x0f, 0xf0, 0x80, 0x04, 0x05, 0x03, 0xf8, 0x03, 0xf8,
+  0x03, 0xf8, 0x80, 0x04, 0x03, 0x03, 0xfc, 0x07, 0xf8, 0x80, 0x05, 0x04, 0xf0, 0x03, 0xf8, 0x01,
+  0xe0, 0x80, 0x04, 0x03, 0x03, 0xfc, 0x07, 0xfc, 0x80, 0x05, 0x04, 0x60, 0x03, 0xf8, 0x00, 0xc0,
+  0x80, 0x04, 0x03, 0x07, 0xf8, 0x03, 0xfe, 0x80, 0x06, 0x01, 0x03, 0xf8, 0x80, 0x06, 0x04, 0x0f,
+  0xf8, 0x01, 0xff, 0x80, 0x80, 0x05, 0x01, 0x03, 0xf8, 0x80, 0x06, 0x04, 0x1f, 0xf0, 0x00, 0xff,
+  0xc0, 0x80, 0x05, 0x01, 0x03, 0xf8, 0x80, 0x06, 0x04, 0x3f, 0xe0, 0x00, 0x7f, 0xe0, 0x80, 0x05,
+  0x01, 0x03, 0xf8, 0x80, 0x06, 0x04, 0x7f, 0xe0, 0x00, 0x3f, 0xf8, 0x80, 0x05, 0x01, 0x03, 0xf8,
+  0x80, 0x05, 0x05, 0x01, 0xff, 0xc0, 0x00, 0x1f, 0xfe, 0x80, 0x05, 0x01, 0x03, 0xf8, 0x80, 0x05,
+  0x06, 0x07, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xc0, 0x80, 0x04, 0x01, 0x03, 0xf8, 0x80, 0x05, 0x06,
+  0x1f, 0xff, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x80, 0x04, 0x01, 0x03, 0xf8, 0x80, 0x05, 0x04, 0xff,
+  0xfc, 0x00, 0x00, 0x01, 0xc5, 0xff, 0x03, 0xe0, 0x03, 0xf8, 0x00, 0xc5, 0xff, 0x00, 0xf8, 0x80,
+  0x02, 0x00, 0x7f, 0xc4, 0xff, 0x03, 0xe0, 0x03, 0xf8, 0x00, 0xc5, 0xff, 0x00, 0xf0, 0x80, 0x02,
+  0x00, 0x3f, 0xc4, 0xff, 0x03, 0xe0, 0x03, 0xf8, 0x00, 0xc5, 0xff, 0x00, 0xc0, 0x80, 0x02, 0x00,
+  0x07, 0xc4, 0xff, 0x03, 0xe0, 0x03, 0xf8, 0x00, 0xc5, 0xff, 0x80, 0x04, 0xc4, 0xff, 0x03, 0xe0,
+  0x03, 0xf8, 0x00, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x04, 0x00, 0x1f, 0xc3, 0xff, 0x03, 0xe0, 0x03,
+  0xf8, 0x00, 0xc4, 0xff, 0x00, 0xc0, 0x80, 0x0a, 0x01, 0x03, 0xf8, 0x80, 0x11, 0x01, 0x03, 0xf8,
+  0x80, 0x11, 0x01, 0x03, 0xf8, 0x80, 0x11, 0x01, 0x03, 0xf8, 0x80, 0x11, 0x01, 0x03, 0xf8, 0x80,
+  0x11, 0x01, 0x03, 0xf8, 0x80, 0x11, 0x01, 0x03, 0xf8, 0x80, 0x11, 0x01, 0x03, 0xf8, 0x82, 0x88,
+};
+static constexpr PackedBitmap unknown_160 = {160, 160, unknown_160_rle};
+
+// 160x160, 3200 -> 1367 bytes
+static const uint8_t sun_160_rle[] PROGMEM = {
+  0x80, 0xd0, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80,
+  0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11,
+  0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01,
+  0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f,
+  0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0,
+  0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80,
+  0x0b, 0x00, 0xe0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x00, 0x07, 0x80, 0x04, 0x01, 0x01,
+  0xf0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x0f, 0x80, 0x80, 0x03, 0x01, 0x03, 0xf8,
+  0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80,
+  0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01, 0x07, 0xff, 0x80, 0x04,
+  0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0xff, 0xe0, 0x80, 0x03, 0x02, 0x03, 0xff, 0x80, 0x80, 0x03,
+  0x01, 0x0f, 0xf0, 0x80, 0x03, 0x02, 0x01, 0xff, 0x80, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80, 0x03,
+  0x01, 0x0f, 0xf0, 0x80, 0x03, 0x01, 0x03, 0xff, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01,
+  0x0f, 0xf0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80, 0x05, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x07,
+  0xe0, 0x80, 0x03, 0x01, 0x0f, 0xfc, 0x80, 0x05, 0x01, 0x1f, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0xf8,
+  0x80, 0x05, 0x01, 0x0f, 0xfe, 0x80, 0x09, 0x01, 0x7f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xff, 0x80,
+  0x09, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x02, 0x01, 0xff, 0x80, 0x80, 0x07, 0x02, 0x01, 0xff, 0x80,
+  0x80, 0x06, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x01, 0x03, 0xff, 0x80, 0x07, 0x01, 0x7f, 0xe0, 0x80,
+  0x07, 0x01, 0x07, 0xfe, 0x80, 0x07, 0x01, 0x3f, 0xf0, 0x80, 0x07, 0x01, 0x0f, 0xfc, 0x80, 0x07,
+  0x0b, 0x1f, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xf8, 0x80, 0x07, 0x0b,
+  0x0f, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xf0, 0x80, 0x07, 0x03, 0x07,
+  0xff, 0x00, 0x00, 0xc3, 0xff, 0x80, 0x01, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x03, 0x01, 0xff, 0x80,
+  0x03, 0xc3, 0xff, 0x03, 0xc0, 0x01, 0xff, 0x80, 0x80, 0x08, 0x02, 0xff, 0x00, 0x1f, 0xc3, 0xff,
+  0x02, 0xf0, 0x00, 0xff, 0x80, 0x09, 0x02, 0x7e, 0x00, 0x3f, 0xc3, 0xff, 0x02, 0xfc, 0x00, 0x7e,
+  0x80, 0x09, 0x09, 0x3c, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x3c, 0x80, 0x09, 0x09,
+  0x18, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x18, 0x80, 0x0a, 0x07, 0x07, 0xff, 0xe0,
+  0x00, 0x00, 0x07, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0x0f, 0xff, 0x80, 0x03, 0x01, 0xff, 0xf0, 0x80,
+  0x0b, 0x01, 0x1f, 0xfc, 0x80, 0x03, 0x01, 0x3f, 0xf8, 0x80, 0x0b, 0x01, 0x3f, 0xf8, 0x80, 0x03,
+  0x01, 0x1f, 0xfc, 0x80, 0x0b, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80, 0x0b, 0x01,
+  0xff, 0xc0, 0x80, 0x03, 0x01, 0x03, 0xff, 0x80, 0x0a, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x02,
+  0x01, 0xff, 0x80, 0x80, 0x09, 0x01, 0x03, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x09, 0x01,
+  0x07, 0xfc, 0x80, 0x05, 0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x07, 0xfc, 0x80, 0x05, 0x01, 0x3f,
+  0xe0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x05, 0x01, 0x1f, 0xf0, 0x80, 0x09, 0x01, 0x0f, 0xf0,
+  0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x05, 0x01, 0x07, 0xf8, 0x80,
+  0x09, 0x01, 0x1f, 0xe0, 0x80, 0x05, 0x01, 0x07, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x05,
+  0x01, 0x03, 0xfc, 0x80, 0x09, 0x01, 0x3f, 0x80, 0x80, 0x05, 0x01, 0x01, 0xfc, 0x80, 0x09, 0x01,
+  0x7f, 0x80, 0x80, 0x05, 0x01, 0x01, 0xfe, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x05, 0x01, 0x01,
+  0xfe, 0x80, 0x09, 0x00, 0x7f, 0x80, 0x07, 0x00, 0xfe, 0x80, 0x09, 0x00, 0xff, 0x80, 0x07, 0x00,
+  0xff, 0x80, 0x09, 0x00, 0xff, 0x80, 0x07, 0x00, 0xff, 0x80, 0x09, 0x00, 0xfe, 0x80, 0x07, 0x00,
+  0x7f, 0x80, 0x09, 0x00, 0xfe, 0x80, 0x07, 0x00, 0x7f, 0x80, 0x09, 0x00, 0xfe, 0x80, 0x07, 0x00,
+  0x7f, 0x80, 0x04, 0xc2, 0xff, 0x02, 0xfe, 0x00, 0xfe, 0x80, 0x07, 0x02, 0x7f, 0x00, 0x7f, 0xc5,
+  0xff, 0x02, 0xfe, 0x00, 0xfe, 0x80, 0x07, 0x02, 0x7f, 0x00, 0x7f, 0xc5, 0xff, 0x02, 0xfe, 0x00,
+  0xfe, 0x80, 0x07, 0x02, 0x7f, 0x00, 0x7f, 0xc5, 0xff, 0x02, 0xfe, 0x00, 0xfe, 0x80, 0x07, 0x02,
+  0x7f, 0x00, 0x7f, 0xc5, 0xff, 0x02, 0xfe, 0x00, 0xfe, 0x80, 0x07, 0x02, 0x7f, 0x00, 0x7f, 0xc5,
+  0xff, 0x02, 0xfe, 0x00, 0xfe, 0x80, 0x07, 0x02, 0x7f, 0x00, 0x7f, 0xc2, 0xff, 0x80, 0x04, 0x00,
+  0xfe, 0x80, 0x07, 0x00, 0x7f, 0x80, 0x09, 0x00, 0xfe, 0x80, 0x07, 0x00, 0x7f, 0x80, 0x09, 0x00,
+  0xfe, 0x80, 0x07, 0x00, 0x7f, 0x80, 0x09, 0x00, 0xff, 0x80, 0x07, 0x00, 0xff, 0x80, 0x09, 0x00,
+  0xff, 0x80, 0x07, 0x00, 0xff, 0x80, 0x09, 0x00, 0x7f, 0x80, 0x07, 0x00, 0xfe, 0x80, 0x09, 0x01,
+  0x7f, 0x80, 0x80, 0x05, 0x01, 0x01, 0xfe, 0x80, 0x09, 0x01, 0x7f, 0x80, 0x80, 0x05, 0x01, 0x01,
+  0xfe, 0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x05, 0x01, 0x03, 0xfc, 0x80, 0x09, 0x01, 0x3f, 0xc0,
+  0x80, 0x05, 0x01, 0x03, 0xfc, 0x80, 0x09, 0x01, 0x1f, 0xe0, 0x80, 0x05, 0x01, 0x07, 0xf8, 0x80,
+  0x09, 0x01, 0x1f, 0xe0, 0x80, 0x05, 0x01, 0x07, 0xf8, 0x80, 0x09, 0x01, 0x0f, 0xf0, 0x80, 0x05,
+  0x01, 0x0f, 0xf0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x05, 0x01, 0x1f, 0xf0, 0x80, 0x09, 0x01,
+  0x07, 0xfc, 0x80, 0x05, 0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x03, 0xfe, 0x80, 0x05, 0x01, 0x7f,
+  0xc0, 0x80, 0x09, 0x01, 0x03, 0xff, 0x80, 0x05, 0x01, 0xff, 0xc0, 0x80, 0x09, 0x02, 0x01, 0xff,
+  0x80, 0x80, 0x03, 0x02, 0x01, 0xff, 0x80, 0x80, 0x0a, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x01, 0x03,
+  0xff, 0x80, 0x0b, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80, 0x0b, 0x01, 0x3f, 0xf8,
+  0x80, 0x03, 0x01, 0x1f, 0xfc, 0x80, 0x0b, 0x01, 0x1f, 0xfe, 0x80, 0x03, 0x01, 0x7f, 0xf8, 0x80,
+  0x0b, 0x07, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x80, 0x0b, 0x07, 0x07, 0xff, 0xe0,
+  0x00, 0x00, 0x07, 0xff, 0xe0, 0x80, 0x0a, 0x09, 0x18, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff,
+  0x80, 0x18, 0x80, 0x09, 0x09, 0x3c, 0x00, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x00, 0x3c, 0x80,
+  0x09, 0x02, 0x7e, 0x00, 0x3f, 0xc3, 0xff, 0x02, 0xfc, 0x00, 0x7e, 0x80, 0x08, 0x03, 0x01, 0xff,
+  0x00, 0x0f, 0xc3, 0xff, 0x02, 0xf0, 0x00, 0xff, 0x80, 0x08, 0x03, 0x03, 0xff, 0x80, 0x03, 0xc3,
+  0xff, 0x03, 0xc0, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x0b, 0x07, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff,
+  0xfe, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x07, 0x0b, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x3f, 0xf0, 0x80, 0x07, 0x01, 0x1f, 0xf8, 0x80, 0x02, 0x01, 0x7f, 0xfe, 0x80, 0x02,
+  0x01, 0x1f, 0xf8, 0x80, 0x07, 0x01, 0x3f, 0xf0, 0x80, 0x07, 0x01, 0x0f, 0xfc, 0x80, 0x07, 0x01,
+  0x7f, 0xe0, 0x80, 0x07, 0x01, 0x07, 0xfe, 0x80, 0x06, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x07, 0x02,
+  0x03, 0xff, 0x80, 0x80, 0x05, 0x02, 0x03, 0xff, 0x80, 0x80, 0x07, 0x02, 0x01, 0xff, 0xc0, 0x80,
+  0x05, 0x01, 0x07, 0xff, 0x80, 0x09, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x0f, 0xfc, 0x80, 0x09,
+  0x01, 0x3f, 0xf0, 0x80, 0x05, 0x01, 0x1f, 0xf8, 0x80, 0x09, 0x01, 0x1f, 0xf8, 0x80, 0x05, 0x01,
+  0x3f, 0xf0, 0x80, 0x03, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x01, 0x0f, 0xfc, 0x80, 0x05, 0x01, 0x7f,
+  0xe0, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x02, 0x01, 0xff,
+  0xc0, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x02, 0x03, 0xff, 0x80, 0x80, 0x03, 0x02, 0x03,
+  0xff, 0x80, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x01,
+  0x07, 0xfe, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0xff, 0xe0, 0x80, 0x03, 0x01, 0x07,
+  0xfc, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0x01, 0x03, 0xf8,
+  0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x1f, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xf0, 0x80,
+  0x04, 0x01, 0x0f, 0xf0, 0x80, 0x04, 0x01, 0x0f, 0x80, 0x80, 0x04, 0x00, 0xe0, 0x80, 0x04, 0x01,
+  0x0f, 0xf0, 0x80, 0x04, 0x00, 0x07, 0x80, 0x0b, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0,
+  0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80,
+  0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11,
+  0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01,
+  0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f,
+  0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x0f, 0xf0,
+  0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0xd0,
+};
+static constexpr PackedBitmap sun_160 = {160, 160, sun_160_rle};
+
+// 160x160, 3200 -> 1541 bytes
+static const uint8_t moon_160_rle[] PROGMEM = {
+  0x80, 0x58, 0x01, 0x03, 0x80, 0x80, 0x11, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x10, 0x03, 0x0f, 0xff,
+  0xff, 0x80, 0x80, 0x0f, 0x03, 0x07, 0xff, 0xff, 0xf8, 0x80, 0x0f, 0x00, 0x03, 0xc2, 0xff, 0x80,
+  0x0f, 0x00, 0x01, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x0e, 0x00, 0x01, 0xc2, 0xff, 0x00, 0xf8, 0x80,
+  0x0f, 0xc3, 0xff, 0x80, 0x0f, 0x00, 0x7f, 0xc2, 0xff, 0x00, 0xc0, 0x80, 0x0e, 0x00, 0x7f, 0xc2,
+  0xff, 0x00, 0xf0, 0x80, 0x0e, 0x00, 0x3f, 0xc2, 0xff, 0x00, 0xf8, 0x80, 0x0e, 0x04, 0x3f, 0xf0,
+  0xff, 0xff, 0xfe, 0x80, 0x0e, 0x05, 0x1f, 0xf8, 0x1f, 0xff, 0xff, 0x80, 0x80, 0x0d, 0x05, 0x1f,
+  0xf8, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x0d, 0x05, 0x0f, 0xfc, 0x00, 0x7f, 0xff, 0xf0, 0x80, 0x0d,
+  0x05, 0x0f, 0xfc, 0x00, 0x1f, 0xff, 0xf8, 0x80, 0x0d, 0x05, 0x07, 0xfc, 0x00, 0x07, 0xff, 0xfc,
+  0x80, 0x0d, 0x05, 0x07, 0xfe, 0x00, 0x01, 0xff, 0xff, 0x80, 0x0d, 0x06, 0x07, 0xfe, 0x00, 0x00,
+  0x7f, 0xff, 0x80, 0x80, 0x0c, 0x06, 0x03, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x80, 0x0c, 0x06,
+  0x03, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xe0, 0x80, 0x0c, 0x06, 0x03, 0xff, 0x00, 0x00, 0x03, 0xff,
+  0xf0, 0x80, 0x0c, 0x06, 0x01, 0xff, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x80, 0x0c, 0x01, 0x01, 0xff,
+  0x80, 0x02, 0x01, 0x7f, 0xfc, 0x80, 0x0c, 0x01, 0x01, 0xff, 0x80, 0x02, 0x01, 0x3f, 0xfe, 0x80,
+  0x0c, 0x06, 0x01, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x0c, 0x07, 0x01, 0xff, 0x80, 0x00,
+  0x00, 0x0f, 0xff, 0x80, 0x80, 0x0c, 0x06, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x80, 0x0c,
+  0x06, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xe0, 0x80, 0x0c, 0x06, 0xff, 0x80, 0x00, 0x00, 0x01,
+  0xff, 0xf0, 0x80, 0x0c, 0x01, 0xff, 0x80, 0x80, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x0c, 0x01, 0xff,
+  0x80, 0x80, 0x02, 0x01, 0x7f, 0xf8, 0x80, 0x0c, 0x01, 0xff, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xfc,
+  0x80, 0x0c, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xfe, 0x80, 0x0c, 0x01, 0xff, 0xc0, 0x80,
+  0x02, 0x01, 0x0f, 0xfe, 0x80, 0x0c, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x01, 0x07, 0xff, 0x80, 0x0c,
+  0x01, 0xff, 0xc0, 0x80, 0x02, 0x02, 0x07, 0xff, 0x80, 0x80, 0x0b, 0x01, 0xff, 0xc0, 0x80, 0x02,
+  0x02, 0x03, 0xff, 0x80, 0x80, 0x0b, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xc0, 0x80,
+  0x0b, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x0b, 0x01, 0xff, 0x80, 0x80, 0x03,
+  0x01, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x7f, 0xe0, 0x80, 0x0b, 0x01,
+  0xff, 0x80, 0x80, 0x03, 0x01, 0x7f, 0xf0, 0x80, 0x0b, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x3f,
+  0xf0, 0x80, 0x0b, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x1f, 0xf8, 0x80, 0x0b, 0x01, 0xff, 0x80,
+  0x80, 0x03, 0x01, 0x1f, 0xf8, 0x80, 0x0a, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x0f, 0xfc,
+  0x80, 0x0a, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0x0f, 0xfc, 0x80, 0x0a, 0x01, 0x01, 0xff,
+  0x80, 0x04, 0x01, 0x07, 0xfe, 0x80, 0x0a, 0x01, 0x01, 0xff, 0x80, 0x04, 0x01, 0x07, 0xfe, 0x80,
+  0x0a, 0x01, 0x01, 0xff, 0x80, 0x04, 0x01, 0x03, 0xfe, 0x80, 0x0a, 0x01, 0x03, 0xff, 0x80, 0x04,
+  0x01, 0x03, 0xff, 0x80, 0x0a, 0x01, 0x03, 0xff, 0x80, 0x04, 0x01, 0x03, 0xff, 0x80, 0x0a, 0x01,
+  0x03, 0xfe, 0x80, 0x04, 0x01, 0x01, 0xff, 0x80, 0x0a, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x02, 0x01,
+  0xff, 0x80, 0x80, 0x09, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x02, 0x01, 0xff, 0x80, 0x80, 0x09, 0x01,
+  0x07, 0xfc, 0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x09, 0x01, 0x0f, 0xfc, 0x80, 0x05, 0x01, 0xff,
+  0xc0, 0x80, 0x09, 0x01, 0x0f, 0xfc, 0x80, 0x05, 0x01, 0xff, 0xc0, 0x80, 0x09, 0x01, 0x1f, 0xf8,
+  0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x09, 0x01, 0x1f, 0xf8, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80,
+  0x09, 0x01, 0x3f, 0xf0, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x09, 0x01, 0x3f, 0xf0, 0x80, 0x05,
+  0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x7f, 0xe0, 0x80, 0x05, 0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01,
+  0x7f, 0xe0, 0x80, 0x05, 0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x3f,
+  0xe0, 0x80, 0x08, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x3f, 0xf0, 0x80, 0x08, 0x02, 0x01,
+  0xff, 0x80, 0x80, 0x05, 0x01, 0x3f, 0xf0, 0x80, 0x08, 0x02, 0x03, 0xff, 0x80, 0x80, 0x05, 0x01,
+  0x1f, 0xf0, 0x80, 0x08, 0x01, 0x07, 0xff, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x0f,
+  0xff, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x0f, 0xfe, 0x80, 0x06, 0x01, 0x1f, 0xf0,
+  0x80, 0x08, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x3f, 0xfc, 0x80,
+  0x06, 0x01, 0x1f, 0xf0, 0x80, 0x08, 0x01, 0x7f, 0xf8, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x08,
+  0x01, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x06,
+  0x01, 0x1f, 0xf0, 0x80, 0x07, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x07,
+  0x02, 0x0f, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x02, 0x1f, 0xff, 0x80, 0x80,
+  0x06, 0x01, 0x1f, 0xf0, 0x80, 0x07, 0x01, 0x3f, 0xff, 0x80, 0x07, 0x02, 0x1f, 0xf0, 0x18, 0x80,
+  0x06, 0x01, 0xff, 0xfe, 0x80, 0x07, 0x02, 0x1f, 0xf0, 0x1c, 0x80, 0x05, 0x02, 0x01, 0xff, 0xfc,
+  0x80, 0x07, 0x02, 0x1f, 0xf0, 0x1f, 0x80, 0x05, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x07, 0x03, 0x1f,
+  0xf0, 0x1f, 0xc0, 0x80, 0x04, 0x02, 0x1f, 0xff, 0xe0, 0x80, 0x07, 0x03, 0x1f, 0xf0, 0x1f, 0xf0,
+  0x80, 0x04, 0x02, 0x7f, 0xff, 0xc0, 0x80, 0x07, 0x03, 0x1f, 0xf0, 0x1f, 0xfc, 0x80, 0x03, 0x03,
+  0x01, 0xff, 0xff, 0x80, 0x80, 0x07, 0x04, 0x3f, 0xf0, 0x0f, 0xff, 0x80, 0x80, 0x02, 0x02, 0x0f,
+  0xff, 0xff, 0x80, 0x08, 0x04, 0x3f, 0xf0, 0x0f, 0xff, 0xf0, 0x80, 0x02, 0x02, 0x7f, 0xff, 0xfc,
+  0x80, 0x08, 0x0a, 0x3f, 0xe0, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x80, 0x08,
+  0x02, 0x3f, 0xe0, 0x0f, 0xc6, 0xff, 0x00, 0xe0, 0x80, 0x08, 0x02, 0x3f, 0xe0, 0x0f, 0xc6, 0xff,
+  0x00, 0x80, 0x80, 0x08, 0x02, 0x3f, 0xe0, 0x0f, 0xc6, 0xff, 0x80, 0x09, 0x02, 0x7f, 0xe0, 0x07,
+  0xc5, 0xff, 0x00, 0xfc, 0x80, 0x09, 0x02, 0x7f, 0xc0, 0x07, 0xc5, 0xff, 0x00, 0xe0, 0x80, 0x09,
+  0x02, 0x7f, 0xc0, 0x07, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x09, 0x02, 0x7f, 0xc0, 0x07, 0xc4, 0xff,
+  0x00, 0xfc, 0x80, 0x0a, 0x04, 0xff, 0xc0, 0x03, 0xfe, 0x3f, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x0a,
+  0x07, 0xff, 0x80, 0x03, 0xfe, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x0b, 0x06, 0xff, 0x80, 0x03, 0xff,
+  0x00, 0x03, 0xfe, 0x80, 0x0b, 0x04, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x0e, 0x04, 0x01, 0xff,
+  0x80, 0x01, 0xff, 0x80, 0x0e, 0x05, 0x03, 0xff, 0x00, 0x01, 0xff, 0x80, 0x80, 0x0d, 0x05, 0x03,
+  0xff, 0x00, 0x00, 0xff, 0x80, 0x80, 0x0d, 0x05, 0x03, 0xff, 0x00, 0x00, 0xff, 0xc0, 0x80, 0x0d,
+  0x05, 0x07, 0xfe, 0x00, 0x00, 0xff, 0xc0, 0x80, 0x0d, 0x05, 0x07, 0xfe, 0x00, 0x00, 0x7f, 0xe0,
+  0x80, 0x0d, 0x05, 0x0f, 0xfc, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x0d, 0x05, 0x0f, 0xfc, 0x00, 0x00,
+  0x3f, 0xf0, 0x80, 0x0d, 0x05, 0x1f, 0xf8, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x0d, 0x05, 0x1f, 0xf8,
+  0x00, 0x00, 0x3f, 0xf8, 0x80, 0x0d, 0x05, 0x3f, 0xf8, 0x00, 0x00, 0x1f, 0xf8, 0x80, 0x0d, 0x05,
+  0x3f, 0xf0, 0x00, 0x00, 0x1f, 0xfc, 0x80, 0x0d, 0x05, 0x7f, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0x80,
+  0x0d, 0x05, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xfe, 0x80, 0x0d, 0x05, 0xff, 0xe0, 0x00, 0x00, 0x07,
+  0xff, 0x80, 0x0c, 0x07, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0x80, 0x80, 0x0b, 0x07, 0x03,
+  0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0x80, 0x80, 0x0b, 0x07, 0x03, 0xff, 0x80, 0x00, 0x00, 0x01,
+  0xff, 0xc0, 0x80, 0x0b, 0x01, 0x07, 0xff, 0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0x0f,
+  0xfe, 0x80, 0x03, 0x01, 0xff, 0xf0, 0x80, 0x0b, 0x01, 0x1f, 0xfe, 0x80, 0x03, 0x01, 0x7f, 0xf0,
+  0x80, 0x0b, 0x01, 0x3f, 0xfc, 0x80, 0x03, 0x01, 0x3f, 0xf8, 0x80, 0x0b, 0x01, 0x3f, 0xf8, 0x80,
+  0x03, 0x01, 0x3f, 0xfc, 0x80, 0x0b, 0x01, 0x7f, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xfe, 0x80, 0x0b,
+  0x01, 0xff, 0xf0, 0x80, 0x03, 0x01, 0x0f, 0xff, 0x80, 0x0a, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x03,
+  0x02, 0x07, 0xff, 0x80, 0x80, 0x09, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x03, 0xff, 0xc0,
+  0x80, 0x09, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x03, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x09, 0x02, 0x1f,
+  0xff, 0x80, 0x80, 0x04, 0x01, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0xff, 0x80, 0x05, 0x01, 0xff,
+  0xfc, 0x80, 0x09, 0x01, 0x7f, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0xfe, 0x80, 0x09, 0x01, 0xff, 0xfc,
+  0x80, 0x05, 0x02, 0x3f, 0xff, 0x80, 0x80, 0x07, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x05, 0x02, 0x0f,
+  0xff, 0xc0, 0x80, 0x07, 0x02, 0x07, 0xff, 0xe0, 0x80, 0x05, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x07,
+  0x02, 0x1f, 0xff, 0xc0, 0x80, 0x05, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x07, 0x02, 0x7f, 0xff, 0x80,
+  0x80, 0x05, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x07, 0x01, 0xff, 0xff, 0x80, 0x07, 0x02, 0xff, 0xff,
+  0x80, 0x80, 0x05, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x07, 0x02, 0x7f, 0xff, 0xe0, 0x80, 0x05, 0x02,
+  0x0f, 0xff, 0xfc, 0x80, 0x07, 0x02, 0x1f, 0xff, 0xf8, 0x80, 0x05, 0x02, 0x3f, 0xff, 0xf0, 0x80,
+  0x07, 0x02, 0x0f, 0xff, 0xff, 0x80, 0x04, 0x03, 0x01, 0xff, 0xff, 0xe0, 0x80, 0x07, 0x03, 0x03,
+  0xff, 0xff, 0xe0, 0x80, 0x03, 0x03, 0x0f, 0xff, 0xff, 0x80, 0x80, 0x07, 0x03, 0x01, 0xff, 0xff,
+  0xfc, 0x80, 0x03, 0x02, 0x7f, 0xff, 0xff, 0x80, 0x09, 0x09, 0x7f, 0xff, 0xff, 0xe0, 0x00, 0x00,
+  0x0f, 0xff, 0xff, 0xfc, 0x80, 0x09, 0x00, 0x1f, 0xc2, 0xff, 0x01, 0xe0, 0x0f, 0xc2, 0xff, 0x00,
+  0xf0, 0x80, 0x09, 0x00, 0x07, 0xc7, 0xff, 0x00, 0xc0, 0x80, 0x09, 0x00, 0x01, 0xc7, 0xff, 0x80,
+  0x0b, 0x00, 0x7f, 0xc5, 0xff, 0x00, 0xfc, 0x80, 0x0b, 0x00, 0x1f, 0xc5, 0xff, 0x00, 0xf0, 0x80,
+  0x0b, 0x00, 0x03, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x0c, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xfc, 0x80,
+  0x0d, 0x00, 0x07, 0xc3, 0xff, 0x00, 0xc0, 0x80, 0x0e, 0x03, 0x7f, 0xff, 0xff, 0xfc, 0x80, 0x10,
+  0x01, 0x7f, 0xfc, 0x80, 0x30,
+};
+static constexpr PackedBitmap moon_160 = {160, 160, moon_160_rle};
+
+// 160x160, 3200 -> 1260 bytes
+static const uint8_t cloud_sun_160_rle[] PROGMEM = {
+  0x81, 0x95, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80,
+  0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11,
+  0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01,
+  0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f,
+  0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xe0, 0x80, 0x0d, 0x00, 0x70, 0x80,
+  0x02, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x00, 0x18, 0x80, 0x09, 0x00, 0xf8, 0x80, 0x02, 0x01, 0x0f,
+  0xe0, 0x80, 0x02, 0x00, 0x7e, 0x80, 0x08, 0x01, 0x01, 0xfc, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80,
+  0x02, 0x00, 0xff, 0x80, 0x08, 0x01, 0x03, 0xfe, 0x80, 0x02, 0x05, 0x0f, 0xe0, 0x00, 0x00, 0x01,
+  0xff, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x02, 0x05, 0x0f, 0xe0, 0x00, 0x00, 0x03, 0xff, 0x80,
+  0x08, 0x0a, 0x01, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x07, 0xfe, 0x80, 0x09, 0x09,
+  0xff, 0xc0, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x0f, 0xfc, 0x80, 0x09, 0x09, 0x7f, 0xe0, 0x00,
+  0x00, 0x0f, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0xf0, 0x80, 0x05, 0x01, 0x3f,
+  0xf0, 0x80, 0x09, 0x01, 0x1f, 0xf8, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xfc,
+  0x80, 0x05, 0x01, 0xff, 0xc0, 0x80, 0x09, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x02, 0x01, 0xff, 0x80,
+  0x80, 0x09, 0x08, 0x03, 0xff, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xff, 0x80, 0x0a, 0x08, 0x01,
+  0xff, 0x80, 0x03, 0xff, 0xff, 0x00, 0x07, 0xfe, 0x80, 0x0b, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xff,
+  0xe0, 0x0f, 0xfc, 0x80, 0x0b, 0x07, 0x7f, 0xc0, 0x7f, 0xff, 0xff, 0xf0, 0x0f, 0xf8, 0x80, 0x0b,
+  0x01, 0x3f, 0xc0, 0xc2, 0xff, 0x02, 0xfc, 0x07, 0xf0, 0x80, 0x0b, 0x01, 0x1f, 0x03, 0xc3, 0xff,
+  0x01, 0x03, 0xe0, 0x80, 0x0b, 0x01, 0x0f, 0x07, 0xc3, 0xff, 0x01, 0x81, 0xc0, 0x80, 0x0b, 0x07,
+  0x06, 0x0f, 0xff, 0xe0, 0x1f, 0xff, 0xc0, 0x80, 0x80, 0x0c, 0x05, 0x1f, 0xff, 0x00, 0x03, 0xff,
+  0xe0, 0x80, 0x0d, 0x05, 0x3f, 0xf8, 0x00, 0x00, 0x7f, 0xf0, 0x80, 0x0d, 0x05, 0x7f, 0xe0, 0x00,
+  0x00, 0x1f, 0xf8, 0x80, 0x0d, 0x08, 0xff, 0xc0, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x1f, 0xf8, 0x80,
+  0x0a, 0x09, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfe, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x08, 0x01, 0x01,
+  0xff, 0x80, 0x02, 0x05, 0x01, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x08, 0x01, 0x03, 0xfe, 0x80,
+  0x02, 0x00, 0x01, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01, 0x03, 0xfc, 0x80, 0x03, 0xc4, 0xff,
+  0x00, 0xe0, 0x80, 0x07, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xf8, 0x80,
+  0x07, 0x01, 0x07, 0xf0, 0x80, 0x03, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xfe, 0x80, 0x07, 0x01, 0x0f,
+  0xf0, 0x80, 0x03, 0x06, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0x80, 0x80, 0x06, 0x01, 0x0f, 0xf0,
+  0x80, 0x02, 0x07, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x0f, 0xe0,
+  0x80, 0x02, 0x07, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x80, 0x06, 0x01, 0x0f, 0xe0,
+  0x80, 0x02, 0x01, 0x0f, 0xff, 0x80, 0x03, 0x01, 0xff, 0xf0, 0x80, 0x06, 0x01, 0x1f, 0xe0, 0x80,
+  0x02, 0x01, 0x1f, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xfc, 0x80, 0x06, 0x01, 0x1f, 0xc0, 0x80, 0x02,
+  0x01, 0x3f, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xfe, 0x80, 0x03, 0x04, 0xff, 0xff, 0xfe, 0x1f, 0xc0,
+  0x80, 0x02, 0x01, 0x7f, 0xf0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x04, 0xff, 0xff, 0xfe,
+  0x1f, 0xc0, 0x80, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x01, 0x03, 0xff, 0x80, 0x03, 0x04, 0xff,
+  0xff, 0xfe, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0xff, 0x80, 0x80, 0x04, 0x01, 0xff, 0x80, 0x80, 0x02,
+  0x08, 0xff, 0xff, 0xfe, 0x1f, 0xc0, 0x00, 0x00, 0x01, 0xff, 0x80, 0x05, 0x01, 0xff, 0xc0, 0x80,
+  0x02, 0x08, 0xff, 0xff, 0xfe, 0x1f, 0xc0, 0x00, 0x00, 0x03, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0xe0,
+  0x80, 0x02, 0x08, 0xff, 0xff, 0xfe, 0x1f, 0xc0, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x05, 0x01, 0x1f,
+  0xe0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfe, 0x1f, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x05, 0x01,
+  0x0f, 0xf0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf8,
+  0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xf8, 0x80, 0x05,
+  0x05, 0x0f, 0xe0, 0x00, 0x1f, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x03, 0xfc, 0x80, 0x05, 0x05, 0x0f,
+  0xe0, 0x01, 0xff, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x03, 0xfc, 0x80, 0x05, 0x05, 0x0f, 0xf0, 0x07,
+  0xff, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x01, 0xfe, 0x80, 0x05, 0x05, 0x0f, 0xf0, 0x1f, 0xff, 0xff,
+  0x80, 0x80, 0x06, 0x00, 0xfe, 0x80, 0x05, 0x04, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0x80, 0x07, 0x00,
+  0xff, 0x80, 0x05, 0x01, 0x07, 0xf8, 0xc2, 0xff, 0x80, 0x07, 0x00, 0xff, 0x80, 0x05, 0x00, 0x07,
+  0xc3, 0xff, 0x80, 0x07, 0x00, 0x7f, 0x80, 0x05, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x08, 0x00,
+  0x7f, 0x80, 0x05, 0x02, 0x01, 0xff, 0xff, 0x80, 0x09, 0x01, 0x3f, 0x80, 0x80, 0x04, 0x02, 0x01,
+  0xff, 0xfc, 0x80, 0x09, 0x01, 0x3f, 0x80, 0x80, 0x05, 0x01, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x3f,
+  0xfc, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x09, 0x01, 0x1f, 0xff, 0x80, 0x05, 0x01, 0x7f, 0xc0,
+  0x80, 0x09, 0x02, 0x1f, 0xff, 0xe0, 0x80, 0x04, 0x01, 0xff, 0x80, 0x80, 0x09, 0x02, 0x1f, 0xff,
+  0xf8, 0x80, 0x03, 0x01, 0x01, 0xff, 0x80, 0x0a, 0x02, 0x1f, 0xff, 0xfe, 0x80, 0x03, 0x01, 0x01,
+  0xfe, 0x80, 0x0a, 0x02, 0x0f, 0xff, 0xff, 0x80, 0x03, 0x01, 0x03, 0xfc, 0x80, 0x0b, 0x02, 0x1f,
+  0xff, 0x80, 0x80, 0x02, 0x01, 0x07, 0xfc, 0x80, 0x0b, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x02, 0x01,
+  0x07, 0xf8, 0x80, 0x0c, 0x01, 0xff, 0xe0, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x0c, 0x01, 0x7f,
+  0xf0, 0x80, 0x02, 0x01, 0x0f, 0xf0, 0x80, 0x0c, 0x01, 0x1f, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xf0,
+  0x80, 0x0c, 0x01, 0x0f, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c, 0x01, 0x07, 0xfc, 0x80,
+  0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c, 0x01, 0x03, 0xfc, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c,
+  0x01, 0x01, 0xfe, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x0c, 0x01, 0x01, 0xfe, 0x80, 0x02, 0x01,
+  0x1f, 0xc0, 0x80, 0x0d, 0x00, 0xff, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0xff, 0x80,
+  0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0xff, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00,
+  0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80,
+  0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x1f,
+  0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02,
+  0x01, 0x0f, 0xe0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0d, 0x00, 0x3f,
+  0x80, 0x02, 0x01, 0x0f, 0xf0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x0f, 0xf0, 0x80, 0x0d,
+  0x00, 0x7f, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x07, 0xf8,
+  0x80, 0x0d, 0x00, 0xff, 0x80, 0x02, 0x01, 0x07, 0xfc, 0x80, 0x0d, 0x00, 0xff, 0x80, 0x02, 0x01,
+  0x03, 0xfc, 0x80, 0x0d, 0x00, 0xff, 0x80, 0x02, 0x01, 0x01, 0xfe, 0x80, 0x0c, 0x01, 0x01, 0xfe,
+  0x80, 0x02, 0x01, 0x01, 0xff, 0x80, 0x0c, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x01, 0xff, 0x80, 0x80,
+  0x0b, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0xff, 0xc0, 0x80, 0x0b, 0x01, 0x07, 0xfc, 0x80, 0x03,
+  0x01, 0x7f, 0xe0, 0x80, 0x0b, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x01, 0x3f, 0xf0, 0x80, 0x0b, 0x01,
+  0x1f, 0xf0, 0x80, 0x03, 0x01, 0x1f, 0xfc, 0x80, 0x0b, 0x01, 0x7f, 0xf0, 0x80, 0x03, 0x01, 0x0f,
+  0xff, 0x80, 0x0b, 0x01, 0xff, 0xe0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x09, 0x02, 0x03,
+  0xff, 0xc0, 0x80, 0x03, 0x00, 0x03, 0xcd, 0xff, 0x80, 0x04, 0x00, 0x01, 0xcd, 0xff, 0x80, 0x05,
+  0x00, 0x7f, 0xcb, 0xff, 0x00, 0xfe, 0x80, 0x05, 0x00, 0x3f, 0xcb, 0xff, 0x00, 0xf8, 0x80, 0x05,
+  0x00, 0x07, 0xcb, 0xff, 0x00, 0xe0, 0x80, 0x05, 0x00, 0x01, 0xcb, 0xff, 0x00, 0x80, 0x80, 0x06,
+  0x00, 0x3f, 0xc9, 0xff, 0x00, 0xfc, 0x80, 0x08, 0xc9, 0xff, 0x81, 0x92,
+};
+static constexpr PackedBitmap cloud_sun_160 = {160, 160, cloud_sun_160_rle};
+
+// 160x160, 3200 -> 1020 bytes
+static const uint8_t cloud_moon_160_rle[] PROGMEM = {
+  0x82, 0x32, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x10, 0x02, 0x01, 0xff,
+  0xff, 0x80, 0x11, 0x02, 0xff, 0xff, 0xe0, 0x80, 0x10, 0x02, 0xff, 0xff, 0xf8, 0x80, 0x10, 0x02,
+  0x7f, 0xff, 0xfe, 0x80, 0x10, 0x03, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x0f, 0x03, 0x3f, 0xff, 0xff,
+  0xc0, 0x80, 0x0f, 0x03, 0x3f, 0xdf, 0xff, 0xf0, 0x80, 0x0f, 0x03, 0x3f, 0xc1, 0xff, 0xf8, 0x80,
+  0x0f, 0x03, 0x3f, 0xc0, 0x7f, 0xfc, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0x1f, 0xfe, 0x80, 0x0f, 0x03,
+  0x3f, 0xc0, 0x07, 0xff, 0x80, 0x0f, 0x04, 0x3f, 0xc0, 0x03, 0xff, 0x80, 0x80, 0x0e, 0x04, 0x3f,
+  0xc0, 0x01, 0xff, 0xc0, 0x80, 0x0e, 0x04, 0x3f, 0xc0, 0x00, 0xff, 0xc0, 0x80, 0x0e, 0x04, 0x7f,
+  0xc0, 0x00, 0x7f, 0xe0, 0x80, 0x0e, 0x04, 0x7f, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x0e, 0x04, 0x7f,
+  0x80, 0x00, 0x1f, 0xf0, 0x80, 0x0e, 0x04, 0xff, 0x80, 0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x05, 0x01,
+  0xff, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x05, 0x01, 0xff, 0x00, 0x00, 0x07, 0xf8, 0x80, 0x0d,
+  0x08, 0x03, 0xfe, 0x00, 0x00, 0x07, 0xfc, 0x00, 0xff, 0xf8, 0x80, 0x0a, 0x05, 0x07, 0xfe, 0x00,
+  0x00, 0x03, 0xfc, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x09, 0x04, 0x0f, 0xfc, 0x00, 0x00, 0x03, 0xc3,
+  0xff, 0x00, 0xfe, 0x80, 0x09, 0x04, 0x3f, 0xf8, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xc0, 0x80,
+  0x08, 0x04, 0x7f, 0xf0, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xf0, 0x80, 0x05, 0x07, 0xe0, 0x00,
+  0x01, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xc4, 0xff, 0x00, 0xfe, 0x80, 0x05, 0x07, 0xf8, 0x00, 0x0f,
+  0xff, 0xe0, 0x00, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x04, 0x0e, 0xff, 0xc1, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x04, 0xc3, 0xff, 0x80,
+  0x02, 0x07, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0x80, 0x04, 0xc2, 0xff, 0x05, 0xfe,
+  0x00, 0x00, 0x01, 0xff, 0xfe, 0x80, 0x02, 0x02, 0x07, 0xff, 0xf8, 0x80, 0x04, 0xc2, 0xff, 0x05,
+  0xf8, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x80, 0x03, 0x01, 0xff, 0xfe, 0x80, 0x04, 0xc2, 0xff, 0x05,
+  0xe0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x80, 0x03, 0x01, 0x3f, 0xff, 0x80, 0x04, 0xc2, 0xff, 0x04,
+  0x80, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x04, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x03, 0x02, 0xff, 0xff,
+  0xfc, 0x80, 0x02, 0x01, 0x3f, 0xfc, 0x80, 0x04, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x03, 0x02, 0xff,
+  0xff, 0x80, 0x80, 0x02, 0x01, 0x7f, 0xf8, 0x80, 0x05, 0x01, 0xff, 0xe0, 0x80, 0x03, 0x01, 0xff,
+  0x80, 0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x7f, 0xf0, 0x80, 0x03, 0x01, 0xff, 0x80,
+  0x80, 0x02, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x3f, 0xf8, 0x80, 0x03, 0x01, 0x7f, 0x80,
+  0x80, 0x02, 0x02, 0x03, 0xff, 0x80, 0x80, 0x05, 0x01, 0x1f, 0xfc, 0x80, 0x03, 0x01, 0x7f, 0xc0,
+  0x80, 0x02, 0x01, 0x07, 0xff, 0x80, 0x06, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xe0, 0x80,
+  0x02, 0x01, 0x07, 0xfe, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xe0, 0x80, 0x02,
+  0x01, 0x0f, 0xfc, 0x80, 0x06, 0x01, 0x01, 0xff, 0x80, 0x03, 0x01, 0x1f, 0xf0, 0x80, 0x02, 0x01,
+  0x1f, 0xf8, 0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x02, 0x06, 0x1f, 0xf8, 0x00, 0x00, 0x7f,
+  0xff, 0xf0, 0x80, 0x07, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x06, 0x0f, 0xfc, 0x00, 0x07, 0xff, 0xff,
+  0xe0, 0x80, 0x07, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x06, 0x07, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xe0,
+  0x80, 0x07, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x02, 0x07, 0xff, 0x00, 0xc2, 0xff, 0x00, 0xc0, 0x80,
+  0x07, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x02, 0x03, 0xff, 0xc3, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x07,
+  0x01, 0x1f, 0xf0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xef, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01,
+  0x1f, 0xf0, 0x80, 0x03, 0xc4, 0xff, 0x80, 0x08, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x03, 0x7f, 0xff,
+  0xff, 0xc0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x02, 0x3f, 0xff, 0xfe, 0x80, 0x0a, 0x01,
+  0x07, 0xf8, 0x80, 0x03, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x0a, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x02,
+  0x07, 0xff, 0xc0, 0x80, 0x0a, 0x02, 0x07, 0xff, 0xe0, 0x80, 0x02, 0x01, 0x07, 0xff, 0x80, 0x0b,
+  0x02, 0x03, 0xff, 0xfe, 0x80, 0x02, 0x01, 0x0f, 0xfe, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xc0,
+  0x00, 0x00, 0x1f, 0xfc, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x80,
+  0x0b, 0x07, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x0b, 0x07, 0x01, 0xff, 0xff,
+  0xfc, 0x00, 0x00, 0x7f, 0xe0, 0x80, 0x0c, 0x06, 0x3f, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xc0, 0x80,
+  0x0d, 0x05, 0x1f, 0xff, 0x80, 0x00, 0xff, 0x80, 0x80, 0x0d, 0x04, 0x07, 0xff, 0xc0, 0x00, 0xff,
+  0x80, 0x0e, 0x04, 0x01, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x0f, 0x03, 0x7f, 0xf0, 0x01, 0xfe, 0x80,
+  0x0f, 0x03, 0x3f, 0xf8, 0x01, 0xfe, 0x80, 0x0f, 0x03, 0x1f, 0xf8, 0x03, 0xfe, 0x80, 0x0f, 0x03,
+  0x0f, 0xfc, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x07, 0xfc, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x03, 0xfe,
+  0x03, 0xfc, 0x80, 0x0f, 0x03, 0x01, 0xfe, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x01, 0xff, 0x03, 0xfc,
+  0x80, 0x0f, 0x03, 0x01, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02,
+  0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0x7f, 0x03, 0xfc, 0x80,
+  0x10, 0x02, 0x7f, 0x03, 0xfc, 0x80, 0x10, 0x02, 0x7f, 0x03, 0xfe, 0x80, 0x10, 0x02, 0x7f, 0x01,
+  0xfe, 0x80, 0x10, 0x02, 0xff, 0x01, 0xfe, 0x80, 0x10, 0x02, 0xff, 0x01, 0xff, 0x80, 0x10, 0x02,
+  0xff, 0x00, 0xff, 0x80, 0x10, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x0e, 0x04, 0x01, 0xff, 0x00,
+  0xff, 0xc0, 0x80, 0x0e, 0x04, 0x01, 0xff, 0x00, 0x7f, 0xe0, 0x80, 0x0e, 0x04, 0x03, 0xfe, 0x00,
+  0x3f, 0xe0, 0x80, 0x0e, 0x04, 0x03, 0xfe, 0x00, 0x3f, 0xf0, 0x80, 0x0e, 0x04, 0x07, 0xfc, 0x00,
+  0x1f, 0xfc, 0x80, 0x0e, 0x04, 0x0f, 0xfc, 0x00, 0x0f, 0xfe, 0x80, 0x0e, 0x04, 0x1f, 0xf8, 0x00,
+  0x07, 0xff, 0x80, 0x0e, 0x05, 0x3f, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x80, 0x0d, 0x05, 0xff, 0xf0,
+  0x00, 0x01, 0xff, 0xf0, 0x80, 0x0c, 0x06, 0x01, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xfc, 0x80, 0x0c,
+  0x07, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x80, 0x0b, 0x05, 0x7f, 0xff, 0x80, 0x00,
+  0x00, 0x3f, 0xcf, 0xff, 0x80, 0x02, 0x00, 0x0f, 0xce, 0xff, 0x00, 0xfc, 0x80, 0x02, 0x00, 0x03,
+  0xce, 0xff, 0x00, 0xf8, 0x80, 0x03, 0xce, 0xff, 0x00, 0xe0, 0x80, 0x03, 0x00, 0x3f, 0xcd, 0xff,
+  0x00, 0x80, 0x80, 0x03, 0x00, 0x07, 0xcc, 0xff, 0x00, 0xfc, 0x80, 0x05, 0x00, 0x7f, 0xcb, 0xff,
+  0x00, 0xe0, 0x80, 0x06, 0x00, 0x7f, 0xc9, 0xff, 0x00, 0xe0, 0x82, 0x32,
+};
+static constexpr PackedBitmap cloud_moon_160 = {160, 160, cloud_moon_160_rle};
+
+// 160x160, 3200 -> 986 bytes
+static const uint8_t fog_sun_160_rle[] PROGMEM = {
+  0x81, 0x59, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80,
+  0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11,
+  0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01,
+  0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f,
+  0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x0d, 0x00, 0xe0, 0x80, 0x02, 0x01, 0x1f, 0x80, 0x80,
+  0x02, 0x00, 0x70, 0x80, 0x08, 0x01, 0x01, 0xf0, 0x80, 0x02, 0x01, 0x1f, 0x80, 0x80, 0x02, 0x00,
+  0xf8, 0x80, 0x08, 0x01, 0x03, 0xf8, 0x80, 0x02, 0x05, 0x1f, 0x80, 0x00, 0x00, 0x01, 0xfc, 0x80,
+  0x08, 0x01, 0x03, 0xfc, 0x80, 0x02, 0x05, 0x1f, 0x80, 0x00, 0x00, 0x03, 0xfc, 0x80, 0x08, 0x01,
+  0x03, 0xfe, 0x80, 0x02, 0x05, 0x1f, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x08, 0x01, 0x01, 0xff,
+  0x80, 0x02, 0x05, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x09, 0x09, 0xff, 0x80, 0x00, 0x00,
+  0x1f, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x09, 0x09, 0x7f, 0xc0, 0x00, 0x00, 0x1f, 0x80, 0x00,
+  0x00, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x3f, 0xe0, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x09, 0x01,
+  0x1f, 0xf0, 0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x04, 0x01, 0x01,
+  0xff, 0x80, 0x0a, 0x01, 0x07, 0xfc, 0x80, 0x04, 0x01, 0x03, 0xfe, 0x80, 0x0a, 0x08, 0x03, 0xfe,
+  0x00, 0x00, 0x1f, 0x80, 0x00, 0x07, 0xfc, 0x80, 0x0a, 0x08, 0x01, 0xff, 0x00, 0x03, 0xff, 0xfc,
+  0x00, 0x0f, 0xf8, 0x80, 0x0b, 0x07, 0xff, 0x80, 0x1f, 0xff, 0xff, 0x80, 0x1f, 0xf0, 0x80, 0x0b,
+  0x07, 0x7f, 0x80, 0x7f, 0xff, 0xff, 0xe0, 0x1f, 0xe0, 0x80, 0x0b, 0x01, 0x3f, 0x01, 0xc2, 0xff,
+  0x02, 0xf8, 0x0f, 0xc0, 0x80, 0x0b, 0x01, 0x1e, 0x03, 0xc2, 0xff, 0x02, 0xfc, 0x07, 0x80, 0x80,
+  0x0b, 0x01, 0x0c, 0x0f, 0xc3, 0xff, 0x00, 0x03, 0x80, 0x0d, 0x05, 0x1f, 0xff, 0x00, 0x0f, 0xff,
+  0x80, 0x80, 0x0d, 0x05, 0x3f, 0xf8, 0x00, 0x01, 0xff, 0xc0, 0x80, 0x0d, 0x05, 0x7f, 0xe0, 0x00,
+  0x00, 0x7f, 0xe0, 0x80, 0x0d, 0x05, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x0d, 0x00, 0xff,
+  0x80, 0x02, 0x04, 0x1f, 0xf0, 0x00, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x01, 0xfe, 0x80, 0x02, 0x05,
+  0x07, 0xf8, 0x0f, 0xff, 0xff, 0x80, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x02, 0x05, 0x03, 0xfc,
+  0x7f, 0xff, 0xff, 0xf0, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x02, 0x00, 0x03, 0xc3, 0xff, 0x00,
+  0xfe, 0x80, 0x08, 0x01, 0x07, 0xf8, 0x80, 0x02, 0x00, 0x01, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x07,
+  0x01, 0x07, 0xf0, 0x80, 0x03, 0xc4, 0xff, 0x00, 0xe0, 0x80, 0x07, 0x01, 0x0f, 0xe0, 0x80, 0x03,
+  0x05, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf8, 0x80, 0x07, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x06, 0x01,
+  0xff, 0xfc, 0x00, 0x01, 0xff, 0xfc, 0x80, 0x07, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x06, 0x03, 0xff,
+  0xe0, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x07, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x07, 0x0f, 0xff, 0x80,
+  0x00, 0x00, 0x07, 0xff, 0x80, 0x80, 0x06, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xfc, 0x80,
+  0x02, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x1f, 0x80, 0x80, 0x02, 0x01, 0x3f, 0xf8, 0x80,
+  0x03, 0x01, 0xff, 0xe0, 0x80, 0x06, 0x01, 0x1f, 0x80, 0x80, 0x02, 0x01, 0x7f, 0xe0, 0x80, 0x03,
+  0x01, 0x3f, 0xf0, 0x80, 0x03, 0x04, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x80, 0x02, 0x01, 0xff, 0xc0,
+  0x80, 0x03, 0x01, 0x1f, 0xf8, 0x80, 0x03, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x01,
+  0xff, 0x80, 0x04, 0x01, 0x07, 0xfc, 0x80, 0x03, 0x08, 0xff, 0xff, 0xfc, 0x3f, 0x80, 0x00, 0x00,
+  0x03, 0xfe, 0x80, 0x04, 0x01, 0x03, 0xfe, 0x80, 0x03, 0x08, 0xff, 0xff, 0xfc, 0x3f, 0x80, 0x00,
+  0x00, 0x03, 0xfc, 0x80, 0x04, 0x01, 0x01, 0xff, 0x80, 0x03, 0x08, 0xff, 0xff, 0xfc, 0x3f, 0x80,
+  0x00, 0x00, 0x07, 0xf8, 0x80, 0x05, 0x00, 0xff, 0x80, 0x03, 0x08, 0xff, 0xff, 0xfc, 0x3f, 0x80,
+  0x00, 0x00, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f,
+  0x80, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x3f, 0xc0, 0x80, 0x05, 0x05, 0x1f, 0x80, 0x00,
+  0x00, 0x1f, 0xe0, 0x80, 0x05, 0x01, 0x3f, 0xc0, 0x80, 0x05, 0x05, 0x1f, 0x80, 0x00, 0x00, 0x1f,
+  0xc0, 0x80, 0x05, 0x01, 0x1f, 0xe0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0x80, 0x80,
+  0x05, 0x01, 0x0f, 0xe0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x01, 0xff, 0xff, 0x80, 0x80, 0x05, 0x01,
+  0x0f, 0xf0, 0x80, 0x05, 0x04, 0x0f, 0xe0, 0x0f, 0xff, 0xff, 0x80, 0x06, 0x01, 0x07, 0xf0, 0x80,
+  0x05, 0x04, 0x0f, 0xe0, 0x3f, 0xff, 0xff, 0x80, 0x06, 0x01, 0x03, 0xf8, 0x80, 0x05, 0x04, 0x0f,
+  0xf0, 0x7f, 0xff, 0xfe, 0x80, 0x06, 0x01, 0x03, 0xf8, 0x80, 0x05, 0x04, 0x07, 0xf1, 0xff, 0xff,
+  0xfe, 0x80, 0x06, 0x01, 0x01, 0xf8, 0x80, 0x05, 0x04, 0x07, 0xfb, 0xff, 0xf8, 0x04, 0x80, 0x06,
+  0x01, 0x01, 0xfc, 0x80, 0x05, 0x03, 0x03, 0xff, 0xff, 0x80, 0x80, 0x07, 0x01, 0x01, 0xfc, 0x80,
+  0x05, 0x02, 0x03, 0xff, 0xfe, 0x80, 0x09, 0x00, 0xfc, 0x80, 0x05, 0x02, 0x01, 0xff, 0xf8, 0x80,
+  0x09, 0x00, 0xfe, 0x80, 0x06, 0x01, 0xff, 0xe0, 0x80, 0x09, 0x00, 0xfe, 0x80, 0x55, 0x00, 0x07,
+  0xce, 0xff, 0x00, 0xe0, 0x80, 0x02, 0x00, 0x07, 0xce, 0xff, 0x00, 0xe0, 0x80, 0x02, 0x00, 0x07,
+  0xce, 0xff, 0x00, 0xe0, 0x80, 0x02, 0x00, 0x07, 0xce, 0xff, 0x00, 0xe0, 0x80, 0x02, 0x00, 0x07,
+  0xce, 0xff, 0x00, 0xe0, 0x80, 0x02, 0x00, 0x07, 0xce, 0xff, 0x00, 0xe0, 0x80, 0x02, 0x00, 0x03,
+  0xce, 0xff, 0x00, 0xe0, 0x80, 0xb6, 0xd0, 0xff, 0x80, 0x02, 0xd0, 0xff, 0x80, 0x02, 0xd0, 0xff,
+  0x80, 0x02, 0xd0, 0xff, 0x80, 0x02, 0xd0, 0xff, 0x80, 0x02, 0xd0, 0xff, 0x80, 0x02, 0xd0, 0xff,
+  0x80, 0xb7, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0xe0, 0x80, 0x03, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0xe0,
+  0x80, 0x03, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0xe0, 0x80, 0x03, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0xe0,
+  0x80, 0x03, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0xe0, 0x80, 0x03, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0xe0,
+  0x80, 0x03, 0x00, 0x1f, 0xcd, 0xff, 0x00, 0xe0, 0x80, 0x91, 0x00, 0x1f, 0xc8, 0xff, 0x00, 0xf8,
+  0x80, 0x08, 0x00, 0x1f, 0xc8, 0xff, 0x00, 0xf8, 0x80, 0x08, 0x00, 0x1f, 0xc8, 0xff, 0x00, 0xf8,
+  0x80, 0x08, 0x00, 0x1f, 0xc8, 0xff, 0x00, 0xf8, 0x80, 0x08, 0x00, 0x1f, 0xc8, 0xff, 0x00, 0xf8,
+  0x80, 0x08, 0x00, 0x1f, 0xc8, 0xff, 0x00, 0xf8, 0x81, 0x56,
+};
+static constexpr PackedBitmap fog_sun_160 = {160, 160, fog_sun_160_rle};
+
+// 160x160, 3200 -> 802 bytes
+static const uint8_t fog_moon_160_rle[] PROGMEM = {
+  0x81, 0xe2, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x02, 0x03, 0xff, 0xf0, 0x80, 0x10, 0x02, 0x03, 0xff,
+  0xfe, 0x80, 0x10, 0x03, 0x01, 0xff, 0xff, 0xc0, 0x80, 0x10, 0x02, 0xff, 0xff, 0xf0, 0x80, 0x10,
+  0x02, 0xff, 0xff, 0xfc, 0x80, 0x10, 0x02, 0x7f, 0xff, 0xff, 0x80, 0x10, 0x03, 0x7f, 0xff, 0xff,
+  0x80, 0x80, 0x0f, 0x03, 0x7f, 0xbf, 0xff, 0xe0, 0x80, 0x0f, 0x03, 0x7f, 0x83, 0xff, 0xf0, 0x80,
+  0x0f, 0x03, 0x7f, 0x80, 0xff, 0xf8, 0x80, 0x0f, 0x03, 0x3f, 0x80, 0x3f, 0xfc, 0x80, 0x0f, 0x03,
+  0x3f, 0x80, 0x0f, 0xfe, 0x80, 0x0f, 0x03, 0x7f, 0x80, 0x07, 0xff, 0x80, 0x0f, 0x03, 0x7f, 0x80,
+  0x03, 0xff, 0x80, 0x0f, 0x04, 0x7f, 0x80, 0x01, 0xff, 0x80, 0x80, 0x0e, 0x04, 0x7f, 0x80, 0x00,
+  0xff, 0xc0, 0x80, 0x0e, 0x04, 0xff, 0x80, 0x00, 0x7f, 0xc0, 0x80, 0x0e, 0x04, 0xff, 0x00, 0x00,
+  0x3f, 0xe0, 0x80, 0x0d, 0x05, 0x01, 0xff, 0x00, 0x00, 0x1f, 0xe0, 0x80, 0x0d, 0x05, 0x01, 0xff,
+  0x00, 0x00, 0x1f, 0xf0, 0x80, 0x0d, 0x05, 0x03, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x0d, 0x08,
+  0x07, 0xfe, 0x00, 0x00, 0x0f, 0xf8, 0x03, 0xff, 0xe0, 0x80, 0x0a, 0x05, 0x0f, 0xfc, 0x00, 0x00,
+  0x0f, 0xf9, 0xc2, 0xff, 0x00, 0xc0, 0x80, 0x09, 0x04, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xc3, 0xff,
+  0x00, 0xf8, 0x80, 0x09, 0x04, 0x3f, 0xf8, 0x00, 0x00, 0x07, 0xc4, 0xff, 0x80, 0x09, 0x04, 0xff,
+  0xf0, 0x00, 0x00, 0x07, 0xc4, 0xff, 0x00, 0xc0, 0x80, 0x05, 0x07, 0xe0, 0x00, 0x03, 0xff, 0xe0,
+  0x00, 0x00, 0x0f, 0xc4, 0xff, 0x00, 0xf0, 0x80, 0x05, 0x07, 0xf8, 0x00, 0x1f, 0xff, 0xc0, 0x00,
+  0x00, 0x3f, 0xc4, 0xff, 0x00, 0xfc, 0x80, 0x05, 0x0d, 0xff, 0xc1, 0xff, 0xff, 0x80, 0x00, 0x00,
+  0x7f, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x05, 0xc2, 0xff, 0x05, 0xfe, 0x00, 0x00, 0x01,
+  0xff, 0xff, 0x80, 0x02, 0x02, 0xff, 0xff, 0xc0, 0x80, 0x04, 0xc2, 0xff, 0x05, 0xfc, 0x00, 0x00,
+  0x03, 0xff, 0xfc, 0x80, 0x02, 0x02, 0x1f, 0xff, 0xe0, 0x80, 0x04, 0xc2, 0xff, 0x05, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xe0, 0x80, 0x02, 0x02, 0x03, 0xff, 0xf0, 0x80, 0x04, 0xc2, 0xff, 0x04, 0xc0,
+  0x00, 0x00, 0x1f, 0xff, 0x80, 0x04, 0x01, 0xff, 0xfc, 0x80, 0x04, 0xc2, 0xff, 0x80, 0x02, 0x01,
+  0x3f, 0xfe, 0x80, 0x04, 0x01, 0x3f, 0xfe, 0x80, 0x04, 0x02, 0xff, 0xff, 0xf8, 0x80, 0x02, 0x01,
+  0x7f, 0xf8, 0x80, 0x04, 0x01, 0x0f, 0xff, 0x80, 0x04, 0x02, 0xff, 0x7f, 0x80, 0x80, 0x02, 0x01,
+  0xff, 0xe0, 0x80, 0x04, 0x02, 0x07, 0xff, 0x80, 0x80, 0x03, 0x00, 0xff, 0x80, 0x03, 0x02, 0x01,
+  0xff, 0xc0, 0x80, 0x04, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x01, 0xff, 0x80, 0x80, 0x02, 0x02,
+  0x03, 0xff, 0x80, 0x80, 0x05, 0x01, 0xff, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x01,
+  0x07, 0xff, 0x80, 0x06, 0x01, 0x7f, 0xf0, 0x80, 0x03, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x01, 0x0f,
+  0xfc, 0x80, 0x06, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xf8,
+  0x80, 0x06, 0x01, 0x1f, 0xf8, 0x80, 0x03, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x01, 0x1f, 0xf8, 0x80,
+  0x06, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x01, 0x1f, 0xf0, 0x80, 0x02, 0x01, 0x3f, 0xf0, 0x80, 0x06,
+  0x01, 0x07, 0xfc, 0x80, 0x03, 0x06, 0x1f, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x80, 0x06, 0x01,
+  0x03, 0xfe, 0x80, 0x03, 0x06, 0x0f, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x01,
+  0xff, 0x80, 0x03, 0x06, 0x07, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x01, 0xff,
+  0x80, 0x03, 0x02, 0x07, 0xff, 0x01, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01, 0xff, 0x80, 0x80,
+  0x02, 0x02, 0x03, 0xff, 0x87, 0xc2, 0xff, 0x80, 0x08, 0x01, 0xff, 0x80, 0x80, 0x02, 0x02, 0x01,
+  0xff, 0xef, 0xc2, 0xff, 0x80, 0x08, 0x01, 0x7f, 0x80, 0x80, 0x03, 0xc3, 0xff, 0x00, 0xfe, 0x80,
+  0x08, 0x01, 0x7f, 0xc0, 0x80, 0x03, 0x03, 0x7f, 0xff, 0xff, 0xc0, 0x80, 0x09, 0x01, 0x3f, 0xc0,
+  0x80, 0x03, 0x02, 0x3f, 0xff, 0xfc, 0x80, 0x0a, 0x01, 0x3f, 0xe0, 0x80, 0x03, 0x02, 0x0f, 0xff,
+  0xe0, 0x80, 0x0a, 0x01, 0x1f, 0xe0, 0x80, 0x03, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x0a, 0x01, 0x1f,
+  0xe0, 0x80, 0x53, 0x00, 0x7f, 0xd0, 0xff, 0x01, 0xc0, 0x00, 0xd1, 0xff, 0x01, 0xe0, 0x00, 0xd1,
+  0xff, 0x01, 0xe0, 0x00, 0xd1, 0xff, 0x01, 0xe0, 0x00, 0xd1, 0xff, 0x01, 0xe0, 0x00, 0xd1, 0xff,
+  0x02, 0xe0, 0x00, 0x7f, 0xd0, 0xff, 0x00, 0xc0, 0x80, 0xb3, 0x00, 0x1f, 0xd2, 0xff, 0x00, 0x3f,
+  0xd2, 0xff, 0x00, 0x3f, 0xd2, 0xff, 0x00, 0x3f, 0xd2, 0xff, 0x00, 0x3f, 0xd2, 0xff, 0x00, 0x3f,
+  0xd2, 0xff, 0x00, 0x1f, 0xd2, 0xff, 0x80, 0xb4, 0x00, 0x01, 0xd0, 0xff, 0x02, 0xc0, 0x00, 0x01,
+  0xd0, 0xff, 0x02, 0xe0, 0x00, 0x01, 0xd0, 0xff, 0x02, 0xe0, 0x00, 0x01, 0xd0, 0xff, 0x02, 0xe0,
+  0x00, 0x01, 0xd0, 0xff, 0x02, 0xe0, 0x00, 0x01, 0xd0, 0xff, 0x02, 0xe0, 0x00, 0x01, 0xd0, 0xff,
+  0x00, 0xc0, 0x80, 0x7b, 0x00, 0x3f, 0xca, 0xff, 0x00, 0x80, 0x80, 0x06, 0x00, 0x3f, 0xca, 0xff,
+  0x00, 0x80, 0x80, 0x06, 0x00, 0x3f, 0xca, 0xff, 0x00, 0x80, 0x80, 0x06, 0x00, 0x3f, 0xca, 0xff,
+  0x00, 0x80, 0x80, 0x06, 0x00, 0x3f, 0xca, 0xff, 0x00, 0x80, 0x80, 0x06, 0x00, 0x3f, 0xca, 0xff,
+  0x00, 0x80, 0x80, 0x06, 0x00, 0x3f, 0xca, 0xff, 0x00, 0x80, 0x80, 0x06, 0x00, 0x1f, 0xca, 0xff,
+  0x81, 0xe3,
+};
+static constexpr PackedBitmap fog_moon_160 = {160, 160, fog_moon_160_rle};
+
+// 160x160, 3200 -> 1815 bytes
+static const uint8_t rain_sun_160_rle[] PROGMEM = {
+  0x80, 0x19, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80,
+  0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11,
+  0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01,
+  0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f,
+  0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x0d, 0x00, 0x60, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80,
+  0x02, 0x00, 0x38, 0x80, 0x09, 0x00, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0x7c,
+  0x80, 0x08, 0x01, 0x01, 0xfc, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x08,
+  0x01, 0x03, 0xfe, 0x80, 0x02, 0x05, 0x0f, 0xc0, 0x00, 0x00, 0x01, 0xff, 0x80, 0x08, 0x01, 0x03,
+  0xff, 0x80, 0x02, 0x05, 0x0f, 0xc0, 0x00, 0x00, 0x03, 0xff, 0x80, 0x08, 0x0a, 0x01, 0xff, 0x80,
+  0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x07, 0xfe, 0x80, 0x09, 0x09, 0xff, 0xc0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x0f, 0xfc, 0x80, 0x09, 0x09, 0x7f, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x1f, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0xf0, 0x80, 0x05, 0x01, 0x3f, 0xf0, 0x80, 0x09, 0x01, 0x1f,
+  0xf8, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xfc, 0x80, 0x05, 0x01, 0xff, 0xc0,
+  0x80, 0x09, 0x01, 0x07, 0xfe, 0x80, 0x04, 0x02, 0x01, 0xff, 0x80, 0x80, 0x09, 0x08, 0x03, 0xff,
+  0x00, 0x00, 0x1f, 0xe0, 0x00, 0x03, 0xfe, 0x80, 0x0a, 0x08, 0x01, 0xff, 0x80, 0x03, 0xff, 0xfe,
+  0x00, 0x07, 0xfc, 0x80, 0x0b, 0x07, 0x7f, 0xc0, 0x0f, 0xff, 0xff, 0xc0, 0x0f, 0xf8, 0x80, 0x0b,
+  0x07, 0x3f, 0xc0, 0x7f, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x80, 0x0b, 0x01, 0x1f, 0x80, 0xc2, 0xff,
+  0x02, 0xfc, 0x07, 0xe0, 0x80, 0x0b, 0x01, 0x0f, 0x03, 0xc3, 0xff, 0x01, 0x03, 0xc0, 0x80, 0x0b,
+  0x01, 0x06, 0x07, 0xc3, 0xff, 0x01, 0x81, 0x80, 0x80, 0x0c, 0x05, 0x0f, 0xff, 0x80, 0x07, 0xff,
+  0xc0, 0x80, 0x0d, 0x05, 0x1f, 0xfc, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x0d, 0x05, 0x3f, 0xf0, 0x00,
+  0x00, 0x3f, 0xf0, 0x80, 0x0d, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x1f, 0xf8, 0x80, 0x0d, 0x08, 0xff,
+  0x80, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x1f, 0xfc, 0x80, 0x09, 0x01, 0x01, 0xff, 0x80, 0x02, 0x05,
+  0x03, 0xfc, 0x03, 0xff, 0xff, 0xe0, 0x80, 0x08, 0x01, 0x01, 0xfe, 0x80, 0x02, 0x05, 0x01, 0xfe,
+  0x3f, 0xff, 0xff, 0xfc, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x03, 0xc4, 0xff, 0x00, 0x80, 0x80,
+  0x07, 0x01, 0x03, 0xf8, 0x80, 0x03, 0xc4, 0xff, 0x00, 0xe0, 0x80, 0x07, 0x01, 0x07, 0xf8, 0x80,
+  0x03, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xf8, 0x80, 0x07, 0x01, 0x07, 0xf0, 0x80, 0x03, 0x05, 0x3f,
+  0xff, 0xfc, 0x3f, 0xff, 0xfe, 0x80, 0x07, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x05, 0xff, 0xff, 0x00,
+  0x00, 0x7f, 0xff, 0x80, 0x07, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x07, 0x01, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xc0, 0x80, 0x06, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x07, 0x03, 0xff, 0xc0, 0x00, 0x00,
+  0x01, 0xff, 0xe0, 0x80, 0x06, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xff, 0x80, 0x03, 0x01,
+  0x7f, 0xf0, 0x80, 0x06, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xfc, 0x80, 0x03, 0x01, 0x3f,
+  0xf8, 0x80, 0x06, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x0f, 0xfc,
+  0x80, 0x03, 0x04, 0xff, 0xff, 0xfc, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01,
+  0x03, 0xfe, 0x80, 0x03, 0x04, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x80, 0x02, 0x01, 0xff, 0xc0, 0x80,
+  0x03, 0x01, 0x01, 0xff, 0x80, 0x03, 0x04, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x80, 0x02, 0x00, 0xff,
+  0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x01,
+  0xfe, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00,
+  0x03, 0xfc, 0x80, 0x05, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00,
+  0x00, 0x07, 0xfc, 0x80, 0x05, 0x01, 0x1f, 0xe0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0xc0,
+  0x00, 0x00, 0x07, 0xf8, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00,
+  0x0f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xf8, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x1f, 0xe0,
+  0x80, 0x05, 0x01, 0x07, 0xf8, 0x80, 0x05, 0x05, 0x0f, 0xc0, 0x00, 0x1f, 0xff, 0xe0, 0x80, 0x05,
+  0x01, 0x03, 0xfc, 0x80, 0x05, 0x05, 0x0f, 0xe0, 0x00, 0xff, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x01,
+  0xfc, 0x80, 0x05, 0x05, 0x0f, 0xe0, 0x07, 0xff, 0xff, 0x80, 0x80, 0x05, 0x01, 0x01, 0xfe, 0x80,
+  0x05, 0x05, 0x0f, 0xf0, 0x1f, 0xff, 0xff, 0x80, 0x80, 0x06, 0x00, 0xfe, 0x80, 0x05, 0x04, 0x07,
+  0xf0, 0x7f, 0xff, 0xff, 0x80, 0x07, 0x00, 0xfe, 0x80, 0x05, 0x01, 0x07, 0xf8, 0xc2, 0xff, 0x80,
+  0x07, 0x00, 0x7f, 0x80, 0x05, 0x03, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x08, 0x00, 0x7f, 0x80, 0x05,
+  0x03, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x08, 0x00, 0x3f, 0x80, 0x05, 0x02, 0x01, 0xff, 0xfe, 0x80,
+  0x09, 0x01, 0x3f, 0x80, 0x80, 0x05, 0x01, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0x80, 0x80, 0x05,
+  0x01, 0xff, 0xf0, 0x80, 0x09, 0x01, 0x3f, 0xfc, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x09, 0x02,
+  0x1f, 0xff, 0x80, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x09, 0x02, 0x1f, 0xff, 0xe0, 0x80, 0x04,
+  0x00, 0xff, 0x80, 0x0a, 0x02, 0x1f, 0xff, 0xf8, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x0a, 0x02,
+  0x1f, 0xff, 0xfc, 0x80, 0x03, 0x01, 0x01, 0xfc, 0x80, 0x0a, 0x02, 0x0f, 0xff, 0xff, 0x80, 0x03,
+  0x01, 0x03, 0xfc, 0x80, 0x0b, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x0b,
+  0x02, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x0c, 0x01, 0x7f, 0xe0, 0x80, 0x02,
+  0x01, 0x07, 0xf0, 0x80, 0x0c, 0x01, 0x3f, 0xf0, 0x80, 0x02, 0x01, 0x07, 0xe0, 0x80, 0x0c, 0x01,
+  0x1f, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c, 0x01, 0x07, 0xf8, 0x80, 0x02, 0x01, 0x0f,
+  0xe0, 0x80, 0x0c, 0x01, 0x07, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x0c, 0x01, 0x03, 0xfc,
+  0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x0c, 0x01, 0x01, 0xfc, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80,
+  0x0d, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x1f,
+  0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02,
+  0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f,
+  0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d,
+  0x00, 0x3f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xc0,
+  0x80, 0x02, 0x01, 0x07, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x03, 0x00, 0x3f, 0x80, 0x02, 0x01,
+  0x0f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x03, 0x00, 0x3f, 0x80,
+  0x02, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x03, 0x00,
+  0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80,
+  0x03, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00,
+  0x7e, 0x80, 0x03, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80,
+  0x03, 0x00, 0x7e, 0x80, 0x03, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x07, 0xf8, 0x80, 0x02, 0x01, 0x0f,
+  0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x03, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x02,
+  0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x03, 0xfc,
+  0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x02, 0x01,
+  0x01, 0xfe, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x02, 0x01, 0x01, 0xfe,
+  0x80, 0x02, 0x01, 0x01, 0xff, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x00, 0x7e, 0x80, 0x02,
+  0x01, 0x01, 0xfc, 0x80, 0x03, 0x00, 0xff, 0x80, 0x02, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00,
+  0x7e, 0x80, 0x02, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x0a, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xe0, 0x00,
+  0x1f, 0x80, 0x00, 0x7e, 0x80, 0x02, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x0a, 0x7f, 0xe0, 0x00, 0x00,
+  0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x02, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x0a, 0x3f,
+  0xf0, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x02, 0x01, 0x1f, 0xf0, 0x80,
+  0x03, 0x0a, 0x1f, 0xfc, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x02, 0x01,
+  0x7f, 0xe0, 0x80, 0x03, 0x0a, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e,
+  0x80, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x0f, 0x07, 0xff, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x1f,
+  0x80, 0x00, 0x7e, 0x00, 0x00, 0x07, 0xff, 0x80, 0x80, 0x03, 0x0e, 0x01, 0xff, 0xff, 0x00, 0x0f,
+  0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x00, 0x00, 0xff, 0xff, 0x80, 0x05, 0x0d, 0xff, 0xff, 0xf8,
+  0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x03, 0xff, 0xff, 0xfe, 0x80, 0x05, 0x0d, 0x3f, 0xff,
+  0xf8, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x03, 0xff, 0xff, 0xfc, 0x80, 0x05, 0x0d, 0x1f,
+  0xff, 0xf8, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x05, 0x0d,
+  0x07, 0xff, 0xf8, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x06,
+  0x0b, 0xff, 0xf8, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x03, 0xff, 0xfe, 0x80, 0x07, 0x0b,
+  0x07, 0xf8, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x03, 0xff, 0xe0, 0x80, 0x09, 0x06, 0x0f,
+  0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e,
+  0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00,
+  0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c,
+  0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80,
+  0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f,
+  0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e,
+  0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00,
+  0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c,
+  0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80,
+  0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f,
+  0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e,
+  0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00,
+  0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c,
+  0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80,
+  0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f,
+  0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e,
+  0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00,
+  0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0c, 0x06, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x7e, 0x80, 0x0f,
+  0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01,
+  0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f,
+  0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x11, 0x01, 0x1f, 0x80,
+  0x80, 0x11, 0x01, 0x1f, 0x80, 0x80, 0x1a,
+};
+static constexpr PackedBitmap rain_sun_160 = {160, 160, rain_sun_160_rle};
+
+// 160x160, 3200 -> 1692 bytes
+static const uint8_t rain_moon_160_rle[] PROGMEM = {
+  0x80, 0xa2, 0x01, 0x01, 0xff, 0x80, 0x11, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x10, 0x02, 0x01, 0xff,
+  0xff, 0x80, 0x11, 0x02, 0xff, 0xff, 0xe0, 0x80, 0x10, 0x02, 0xff, 0xff, 0xfc, 0x80, 0x10, 0x02,
+  0x7f, 0xff, 0xfe, 0x80, 0x10, 0x03, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x0f, 0x03, 0x3f, 0xff, 0xff,
+  0xc0, 0x80, 0x0f, 0x03, 0x3f, 0xdf, 0xff, 0xf0, 0x80, 0x0f, 0x03, 0x3f, 0xc1, 0xff, 0xf8, 0x80,
+  0x0f, 0x03, 0x3f, 0xc0, 0x7f, 0xfc, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0x1f, 0xfe, 0x80, 0x0f, 0x03,
+  0x3f, 0xc0, 0x07, 0xff, 0x80, 0x0f, 0x04, 0x3f, 0xc0, 0x03, 0xff, 0x80, 0x80, 0x0e, 0x04, 0x3f,
+  0xc0, 0x01, 0xff, 0xc0, 0x80, 0x0e, 0x04, 0x3f, 0xc0, 0x00, 0xff, 0xc0, 0x80, 0x0e, 0x04, 0x7f,
+  0xc0, 0x00, 0x7f, 0xe0, 0x80, 0x0e, 0x04, 0x7f, 0x80, 0x00, 0x3f, 0xf0, 0x80, 0x0e, 0x04, 0x7f,
+  0x80, 0x00, 0x1f, 0xf0, 0x80, 0x0e, 0x04, 0xff, 0x80, 0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x05, 0x01,
+  0xff, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x05, 0x01, 0xff, 0x00, 0x00, 0x07, 0xf8, 0x80, 0x0d,
+  0x08, 0x03, 0xfe, 0x00, 0x00, 0x07, 0xfc, 0x01, 0xff, 0xf8, 0x80, 0x0a, 0x05, 0x07, 0xfe, 0x00,
+  0x00, 0x03, 0xfc, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x09, 0x04, 0x0f, 0xfc, 0x00, 0x00, 0x03, 0xc3,
+  0xff, 0x00, 0xfe, 0x80, 0x09, 0x04, 0x3f, 0xf8, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xc0, 0x80,
+  0x08, 0x04, 0x7f, 0xf0, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xf0, 0x80, 0x05, 0x07, 0xe0, 0x00,
+  0x01, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xc4, 0xff, 0x00, 0xfe, 0x80, 0x05, 0x07, 0xfc, 0x00, 0x0f,
+  0xff, 0xc0, 0x00, 0x00, 0x0f, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x04, 0x0e, 0xff, 0xe1, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x80, 0x04, 0xc3, 0xff, 0x80,
+  0x02, 0x07, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0x80, 0x04, 0xc2, 0xff, 0x05, 0xfe,
+  0x00, 0x00, 0x01, 0xff, 0xfe, 0x80, 0x02, 0x02, 0x07, 0xff, 0xf8, 0x80, 0x04, 0xc2, 0xff, 0x05,
+  0xf8, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x80, 0x03, 0x01, 0xff, 0xfe, 0x80, 0x04, 0xc2, 0xff, 0x05,
+  0xe0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x80, 0x03, 0x01, 0x1f, 0xff, 0x80, 0x04, 0xc2, 0xff, 0x80,
+  0x02, 0x01, 0x1f, 0xff, 0x80, 0x04, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x03, 0x02, 0xff, 0xff, 0xfc,
+  0x80, 0x02, 0x01, 0x3f, 0xfc, 0x80, 0x04, 0x02, 0x03, 0xff, 0xc0, 0x80, 0x03, 0x02, 0xff, 0x7f,
+  0x80, 0x80, 0x02, 0x01, 0x7f, 0xf0, 0x80, 0x05, 0x01, 0xff, 0xe0, 0x80, 0x03, 0x01, 0xff, 0x80,
+  0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x7f, 0xf0, 0x80, 0x03, 0x01, 0xff, 0x80, 0x80,
+  0x02, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x3f, 0xf8, 0x80, 0x03, 0x01, 0x7f, 0x80, 0x80,
+  0x02, 0x02, 0x03, 0xff, 0x80, 0x80, 0x05, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x01, 0x7f, 0xc0, 0x80,
+  0x02, 0x01, 0x07, 0xff, 0x80, 0x06, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xe0, 0x80, 0x02,
+  0x01, 0x07, 0xfe, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x01,
+  0x0f, 0xfc, 0x80, 0x06, 0x01, 0x01, 0xff, 0x80, 0x03, 0x01, 0x1f, 0xf0, 0x80, 0x02, 0x01, 0x1f,
+  0xf8, 0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x02, 0x06, 0x1f, 0xf8, 0x00, 0x00, 0xff, 0xff,
+  0xf0, 0x80, 0x07, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x06, 0x0f, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xe0,
+  0x80, 0x07, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x06, 0x07, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xe0, 0x80,
+  0x07, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x02, 0x07, 0xff, 0x00, 0xc2, 0xff, 0x00, 0xc0, 0x80, 0x07,
+  0x01, 0x3f, 0xe0, 0x80, 0x02, 0x02, 0x03, 0xff, 0xc3, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01,
+  0x1f, 0xf0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xef, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01, 0x1f,
+  0xf0, 0x80, 0x03, 0xc4, 0xff, 0x80, 0x08, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x03, 0x7f, 0xff, 0xff,
+  0xc0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x02, 0x1f, 0xff, 0xfe, 0x80, 0x0a, 0x01, 0x07,
+  0xf8, 0x80, 0x03, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x0a, 0x01, 0x07, 0xfc, 0x80, 0x03, 0x02, 0x07,
+  0xff, 0xc0, 0x80, 0x0a, 0x02, 0x07, 0xff, 0xf0, 0x80, 0x02, 0x01, 0x07, 0xff, 0x80, 0x0b, 0x02,
+  0x03, 0xff, 0xfe, 0x80, 0x02, 0x01, 0x0f, 0xfe, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xc0, 0x00,
+  0x00, 0x1f, 0xfc, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x0b,
+  0x07, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x0b, 0x07, 0x01, 0xff, 0xff, 0xfe,
+  0x00, 0x00, 0x7f, 0xe0, 0x80, 0x0c, 0x06, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xc0, 0x80, 0x0d,
+  0x05, 0x1f, 0xff, 0x80, 0x00, 0xff, 0x80, 0x80, 0x0d, 0x04, 0x07, 0xff, 0xc0, 0x00, 0xff, 0x80,
+  0x0e, 0x04, 0x01, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x0f, 0x03, 0x7f, 0xf0, 0x01, 0xfe, 0x80, 0x0f,
+  0x03, 0x3f, 0xf8, 0x01, 0xfe, 0x80, 0x0f, 0x03, 0x1f, 0xf8, 0x03, 0xfe, 0x80, 0x0f, 0x03, 0x0f,
+  0xfc, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x07, 0xfc, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x03, 0xfe, 0x03,
+  0xfc, 0x80, 0x0f, 0x03, 0x01, 0xfe, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x01, 0xff, 0x03, 0xfc, 0x80,
+  0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03,
+  0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0x7f, 0x03, 0xfc, 0x80, 0x10, 0x02,
+  0x7f, 0x03, 0xfc, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x02,
+  0x7f, 0x03, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x02,
+  0x7f, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x02,
+  0xff, 0x01, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x02,
+  0xff, 0x01, 0xff, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x02,
+  0xff, 0x00, 0xff, 0x80, 0x03, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x03, 0x03,
+  0xff, 0x00, 0xff, 0x80, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x02,
+  0x04, 0x01, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01, 0x7f, 0x80,
+  0x80, 0x02, 0x04, 0x01, 0xff, 0x00, 0x7f, 0xe0, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x04, 0x01,
+  0x7f, 0x80, 0x80, 0x02, 0x04, 0x03, 0xfe, 0x00, 0x3f, 0xe0, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80,
+  0x04, 0x01, 0x7f, 0x80, 0x80, 0x02, 0x04, 0x03, 0xfe, 0x00, 0x3f, 0xf0, 0x80, 0x02, 0x08, 0x03,
+  0xf8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x02, 0x04, 0x07, 0xfc, 0x00, 0x1f, 0xfc,
+  0x80, 0x02, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x02, 0x04, 0x0f,
+  0xfc, 0x00, 0x0f, 0xfe, 0x80, 0x02, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80,
+  0x80, 0x02, 0x04, 0x1f, 0xf8, 0x00, 0x07, 0xff, 0x80, 0x02, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe,
+  0x00, 0x00, 0x7f, 0x80, 0x80, 0x02, 0x10, 0x3f, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x03,
+  0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x02, 0x50, 0xff, 0xf0, 0x00, 0x01, 0xff,
+  0xf0, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xff,
+  0xe0, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80,
+  0x00, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfe,
+  0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x03,
+  0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0xff, 0xff, 0xfe, 0x80, 0x02, 0x10, 0x0f,
+  0xff, 0xff, 0xf8, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0xff, 0xff, 0xfc,
+  0x80, 0x02, 0x10, 0x03, 0xff, 0xff, 0xf8, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80,
+  0x7f, 0xff, 0xff, 0xf8, 0x80, 0x03, 0x0f, 0xff, 0xff, 0xf8, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00,
+  0x00, 0x7f, 0x80, 0x7f, 0xff, 0xff, 0xe0, 0x80, 0x03, 0x0f, 0x3f, 0xff, 0xf8, 0x03, 0xf8, 0x00,
+  0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x03, 0x0e, 0x07, 0xff, 0xf8,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0xff, 0xfc, 0x80, 0x05, 0x0d, 0x7f,
+  0xf8, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0xff, 0xc0, 0x80, 0x07, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f,
+  0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f,
+  0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f,
+  0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f,
+  0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f,
+  0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f,
+  0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f,
+  0x80, 0x80, 0x0a, 0x08, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x08,
+  0x03, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0x80, 0x0a, 0x07, 0x03, 0xf8, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x7f, 0x80, 0x0e, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x11,
+  0x01, 0x01, 0xfe, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x01,
+  0x01, 0xfe, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x01, 0x01,
+  0xfe, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x12, 0x00, 0xfc, 0x80, 0xa8,
+};
+static constexpr PackedBitmap rain_moon_160 = {160, 160, rain_moon_160_rle};
+
+// 160x160, 3200 -> 1517 bytes
+static const uint8_t snow_sun_160_rle[] PROGMEM = {
+  0x80, 0xe1, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80,
+  0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11,
+  0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01,
+  0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f,
+  0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x0d, 0x00, 0x60, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80,
+  0x02, 0x00, 0x18, 0x80, 0x09, 0x00, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0x3c,
+  0x80, 0x08, 0x01, 0x01, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0x7e, 0x80, 0x08,
+  0x01, 0x03, 0xfc, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0xff, 0x80, 0x08, 0x01, 0x03,
+  0xfe, 0x80, 0x02, 0x05, 0x0f, 0xc0, 0x00, 0x00, 0x01, 0xff, 0x80, 0x08, 0x01, 0x01, 0xff, 0x80,
+  0x02, 0x05, 0x0f, 0xc0, 0x00, 0x00, 0x03, 0xfe, 0x80, 0x09, 0x09, 0xff, 0x80, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x07, 0xfc, 0x80, 0x09, 0x09, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x0f, 0xf8, 0x80, 0x09, 0x09, 0x3f, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x1f, 0xf0, 0x80,
+  0x09, 0x01, 0x1f, 0xf0, 0x80, 0x05, 0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x05,
+  0x01, 0x7f, 0xc0, 0x80, 0x09, 0x01, 0x07, 0xfc, 0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x09, 0x01,
+  0x03, 0xfe, 0x80, 0x04, 0x01, 0x01, 0xff, 0x80, 0x0a, 0x08, 0x01, 0xff, 0x00, 0x00, 0x7f, 0xf0,
+  0x00, 0x03, 0xfe, 0x80, 0x0b, 0x07, 0xff, 0x80, 0x07, 0xff, 0xff, 0x00, 0x07, 0xfc, 0x80, 0x0b,
+  0x07, 0x7f, 0xc0, 0x1f, 0xff, 0xff, 0xe0, 0x0f, 0xf8, 0x80, 0x0b, 0x07, 0x3f, 0xc0, 0x7f, 0xff,
+  0xff, 0xf8, 0x0f, 0xf0, 0x80, 0x0b, 0x01, 0x1f, 0x81, 0xc2, 0xff, 0x02, 0xfe, 0x07, 0xe0, 0x80,
+  0x0b, 0x01, 0x0f, 0x03, 0xc3, 0xff, 0x01, 0x03, 0xc0, 0x80, 0x0b, 0x07, 0x04, 0x07, 0xff, 0xf0,
+  0x3f, 0xff, 0x81, 0x80, 0x80, 0x0c, 0x05, 0x1f, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x80, 0x0d, 0x05,
+  0x3f, 0xf8, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x0d, 0x05, 0x7f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x80,
+  0x0d, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x08, 0xff, 0x80, 0x00, 0x00, 0x07,
+  0xfc, 0x00, 0x7f, 0xff, 0x80, 0x09, 0x01, 0x01, 0xff, 0x80, 0x02, 0x05, 0x03, 0xfe, 0x0f, 0xff,
+  0xff, 0xf0, 0x80, 0x08, 0x01, 0x01, 0xfe, 0x80, 0x02, 0x05, 0x01, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
+  0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x03, 0xc4, 0xff, 0x00, 0xc0, 0x80, 0x07, 0x01, 0x03, 0xf8,
+  0x80, 0x03, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xf0, 0x80, 0x07, 0x01, 0x07, 0xf0, 0x80, 0x03, 0x00,
+  0x7f, 0xc3, 0xff, 0x00, 0xfc, 0x80, 0x07, 0x01, 0x07, 0xf0, 0x80, 0x03, 0x05, 0x7f, 0xff, 0xe0,
+  0x07, 0xff, 0xfe, 0x80, 0x07, 0x01, 0x0f, 0xe0, 0x80, 0x03, 0x06, 0xff, 0xfc, 0x00, 0x00, 0x3f,
+  0xff, 0x80, 0x80, 0x06, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x07, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x07,
+  0xff, 0xc0, 0x80, 0x06, 0x01, 0x0f, 0xe0, 0x80, 0x02, 0x07, 0x07, 0xff, 0x80, 0x00, 0x00, 0x01,
+  0xff, 0xe0, 0x80, 0x06, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xfe, 0x80, 0x03, 0x01, 0x7f,
+  0xf8, 0x80, 0x06, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x1f, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xfc,
+  0x80, 0x06, 0x01, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80,
+  0x03, 0x04, 0xff, 0xff, 0xfc, 0x1f, 0xc0, 0x80, 0x02, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01, 0x03,
+  0xff, 0x80, 0x03, 0x04, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x80, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03,
+  0x02, 0x01, 0xff, 0x80, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x01, 0xff,
+  0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x03,
+  0xfe, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00,
+  0x03, 0xfc, 0x80, 0x05, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0xc0, 0x00,
+  0x00, 0x07, 0xf8, 0x80, 0x05, 0x01, 0x1f, 0xf0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x0f,
+  0xf0, 0x80, 0x05, 0x01, 0x0f, 0xf0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x0f, 0xf0, 0x80,
+  0x05, 0x01, 0x07, 0xf8, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x1f, 0xe0, 0x80, 0x05, 0x01,
+  0x03, 0xf8, 0x80, 0x05, 0x05, 0x0f, 0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x03, 0xfc,
+  0x80, 0x05, 0x05, 0x0f, 0xe0, 0x01, 0xff, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x01, 0xfc, 0x80, 0x05,
+  0x05, 0x0f, 0xe0, 0x0f, 0xff, 0xff, 0x80, 0x80, 0x05, 0x01, 0x01, 0xfe, 0x80, 0x05, 0x05, 0x07,
+  0xf0, 0x3f, 0xff, 0xff, 0x80, 0x80, 0x06, 0x00, 0xfe, 0x80, 0x05, 0x04, 0x07, 0xf0, 0x7f, 0xff,
+  0xff, 0x80, 0x07, 0x00, 0xff, 0x80, 0x05, 0x01, 0x07, 0xf9, 0xc2, 0xff, 0x80, 0x07, 0x00, 0x7f,
+  0x80, 0x05, 0x03, 0x03, 0xff, 0xff, 0xf0, 0x80, 0x08, 0x00, 0x7f, 0x80, 0x05, 0x03, 0x03, 0xff,
+  0xff, 0x80, 0x80, 0x08, 0x00, 0x3f, 0x80, 0x05, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x09, 0x01, 0x3f,
+  0x80, 0x80, 0x05, 0x01, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x05, 0x01, 0x7f, 0xe0,
+  0x80, 0x09, 0x01, 0x1f, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x09, 0x02, 0x1f, 0xff, 0xc0,
+  0x80, 0x04, 0x01, 0xff, 0x80, 0x80, 0x09, 0x02, 0x1f, 0xff, 0xf0, 0x80, 0x04, 0x00, 0xff, 0x80,
+  0x0a, 0x02, 0x1f, 0xff, 0xf8, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x0a, 0x02, 0x1f, 0xff, 0xfe,
+  0x80, 0x03, 0x01, 0x03, 0xfc, 0x80, 0x0a, 0x02, 0x01, 0xff, 0xff, 0x80, 0x03, 0x01, 0x03, 0xfc,
+  0x80, 0x0b, 0x02, 0x07, 0xff, 0x80, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x0b, 0x02, 0x01, 0xff,
+  0xc0, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x0c, 0x01, 0x7f, 0xe0, 0x80, 0x02, 0x01, 0x07, 0xf0,
+  0x80, 0x0c, 0x01, 0x1f, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c, 0x01, 0x0f, 0xf0, 0x80,
+  0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c, 0x01, 0x07, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c,
+  0x01, 0x03, 0xfc, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x0c, 0x01, 0x01, 0xfc, 0x80, 0x02, 0x01,
+  0x1f, 0xc0, 0x80, 0x0c, 0x01, 0x01, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0xfe,
+  0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d,
+  0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0,
+  0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01,
+  0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80,
+  0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x0d, 0x00,
+  0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80,
+  0x02, 0x06, 0x07, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x70, 0x80, 0x03, 0x00, 0x3f, 0x80, 0x02, 0x01,
+  0x0f, 0xe0, 0x80, 0x02, 0x06, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x01, 0xfc, 0x80, 0x03, 0x00, 0x3f,
+  0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x02, 0x06, 0x3f, 0xc0, 0x00, 0xff, 0x00, 0x03, 0xfe, 0x80,
+  0x03, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x02, 0x06, 0x3f, 0xe0, 0x00, 0xff, 0x80,
+  0x03, 0xfe, 0x80, 0x03, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x07, 0xf8, 0x80, 0x02, 0x06, 0x3f, 0xe0,
+  0x00, 0xff, 0x80, 0x03, 0xfe, 0x80, 0x03, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x02,
+  0x06, 0x3f, 0xe0, 0x00, 0xff, 0x80, 0x03, 0xfe, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x03,
+  0xfc, 0x80, 0x02, 0x06, 0x3f, 0xe0, 0x00, 0xff, 0x80, 0x03, 0xfe, 0x80, 0x03, 0x00, 0xfe, 0x80,
+  0x02, 0x01, 0x01, 0xfe, 0x80, 0x02, 0x06, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x01, 0xfc, 0x80, 0x02,
+  0x01, 0x01, 0xfe, 0x80, 0x03, 0x00, 0xff, 0x80, 0x02, 0x06, 0x0f, 0x80, 0x00, 0x3e, 0x00, 0x00,
+  0xf8, 0x80, 0x02, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x01, 0xff, 0x80, 0x80, 0x0b, 0x01, 0x03, 0xfc,
+  0x80, 0x03, 0x01, 0x7f, 0xc0, 0x80, 0x0b, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x01, 0x3f, 0xe0, 0x80,
+  0x0b, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x01, 0x1f, 0xf8, 0x80, 0x0b, 0x01, 0x3f, 0xf0, 0x80, 0x03,
+  0x01, 0x0f, 0xfc, 0x80, 0x0b, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x02, 0x07, 0xff, 0x80, 0x80, 0x09,
+  0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x02, 0x03, 0xff, 0xf0, 0x80, 0x09, 0x02, 0x0f, 0xff, 0x80,
+  0x80, 0x03, 0x0b, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x0f, 0xc2,
+  0xff, 0x80, 0x05, 0x0d, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xff,
+  0xff, 0xfe, 0x80, 0x05, 0x0d, 0x3f, 0xff, 0xf8, 0x00, 0x07, 0xf8, 0x00, 0x1f, 0xe0, 0x00, 0x0f,
+  0xff, 0xff, 0xf8, 0x80, 0x05, 0x0d, 0x0f, 0xff, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x1f, 0xf0, 0x00,
+  0x0f, 0xff, 0xff, 0xe0, 0x80, 0x05, 0x0d, 0x03, 0xff, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x1f, 0xf0,
+  0x00, 0x0f, 0xff, 0xff, 0x80, 0x80, 0x06, 0x0b, 0x3f, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x1f, 0xf0,
+  0x00, 0x0f, 0xff, 0xfc, 0x80, 0x08, 0x09, 0x78, 0x00, 0x07, 0xfc, 0x00, 0x1f, 0xf0, 0x00, 0x0f,
+  0xff, 0x80, 0x0b, 0x04, 0x03, 0xf8, 0x00, 0x0f, 0xe0, 0x80, 0x0e, 0x04, 0x01, 0xf0, 0x00, 0x07,
+  0xc0, 0x80, 0x99, 0x06, 0x07, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x70, 0x80, 0x0c, 0x06, 0x1f, 0xc0,
+  0x00, 0x7f, 0x00, 0x01, 0xfc, 0x80, 0x0c, 0x06, 0x3f, 0xc0, 0x00, 0xff, 0x00, 0x03, 0xfc, 0x80,
+  0x0c, 0x06, 0x3f, 0xe0, 0x00, 0xff, 0x80, 0x03, 0xfe, 0x80, 0x0c, 0x06, 0x3f, 0xe0, 0x00, 0xff,
+  0x80, 0x03, 0xfe, 0x80, 0x0c, 0x06, 0x3f, 0xe0, 0x00, 0xff, 0x80, 0x03, 0xfe, 0x80, 0x0c, 0x06,
+  0x3f, 0xe0, 0x00, 0xff, 0x80, 0x03, 0xfe, 0x80, 0x0c, 0x06, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x01,
+  0xfc, 0x80, 0x0c, 0x06, 0x0f, 0x80, 0x00, 0x3e, 0x00, 0x00, 0xf8, 0x80, 0xf4,
+};
+static constexpr PackedBitmap snow_sun_160 = {160, 160, snow_sun_160_rle};
+
+// 160x160, 3200 -> 1341 bytes
+static const uint8_t snow_moon_160_rle[] PROGMEM = {
+  0x81, 0x7e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x10, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x10, 0x03, 0x01,
+  0xff, 0xff, 0x80, 0x80, 0x10, 0x02, 0xff, 0xff, 0xf0, 0x80, 0x10, 0x02, 0xff, 0xff, 0xfc, 0x80,
+  0x10, 0x02, 0x7f, 0xff, 0xff, 0x80, 0x10, 0x03, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x0f, 0x03, 0x3f,
+  0xff, 0xff, 0xe0, 0x80, 0x0f, 0x03, 0x3f, 0xc7, 0xff, 0xf0, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0xff,
+  0xf8, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0x3f, 0xfc, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0x0f, 0xfe, 0x80,
+  0x0f, 0x03, 0x3f, 0xc0, 0x07, 0xff, 0x80, 0x0f, 0x04, 0x3f, 0xc0, 0x01, 0xff, 0x80, 0x80, 0x0e,
+  0x04, 0x3f, 0xc0, 0x00, 0xff, 0xc0, 0x80, 0x0e, 0x04, 0x3f, 0xc0, 0x00, 0x7f, 0xe0, 0x80, 0x0e,
+  0x04, 0x7f, 0xc0, 0x00, 0x3f, 0xe0, 0x80, 0x0e, 0x04, 0x7f, 0x80, 0x00, 0x1f, 0xf0, 0x80, 0x0e,
+  0x04, 0xff, 0x80, 0x00, 0x1f, 0xf0, 0x80, 0x0e, 0x04, 0xff, 0x80, 0x00, 0x0f, 0xf8, 0x80, 0x0d,
+  0x05, 0x01, 0xff, 0x00, 0x00, 0x07, 0xf8, 0x80, 0x0d, 0x07, 0x03, 0xff, 0x00, 0x00, 0x07, 0xfc,
+  0x00, 0x06, 0x80, 0x0b, 0x08, 0x03, 0xfe, 0x00, 0x00, 0x03, 0xfc, 0x0f, 0xff, 0xff, 0x80, 0x0a,
+  0x05, 0x0f, 0xfe, 0x00, 0x00, 0x03, 0xfc, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x09, 0x04, 0x1f, 0xfc,
+  0x00, 0x00, 0x03, 0xc4, 0xff, 0x80, 0x09, 0x04, 0x3f, 0xf8, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00,
+  0xe0, 0x80, 0x05, 0x07, 0x80, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xf8,
+  0x80, 0x05, 0x07, 0xe0, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xc4, 0xff, 0x00, 0xfe, 0x80,
+  0x05, 0x07, 0xfe, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x04,
+  0xc3, 0xff, 0x0a, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xe0, 0x80, 0x04,
+  0xc3, 0xff, 0x80, 0x02, 0x01, 0xff, 0xff, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x04, 0xc2,
+  0xff, 0x05, 0xfc, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x80, 0x02, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x04,
+  0xc2, 0xff, 0x05, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0xfe, 0x80, 0x04,
+  0xc2, 0xff, 0x05, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x80, 0x03, 0x01, 0x1f, 0xff, 0x80, 0x04,
+  0x02, 0xff, 0xff, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xfe, 0x80, 0x04, 0x02, 0x07, 0xff, 0xc0, 0x80,
+  0x03, 0x02, 0xff, 0xff, 0xf0, 0x80, 0x02, 0x01, 0x3f, 0xf8, 0x80, 0x04, 0x02, 0x01, 0xff, 0xe0,
+  0x80, 0x03, 0x00, 0xff, 0x80, 0x04, 0x01, 0x7f, 0xf0, 0x80, 0x05, 0x01, 0xff, 0xf0, 0x80, 0x03,
+  0x01, 0xff, 0x80, 0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x3f, 0xf8, 0x80, 0x03, 0x01,
+  0xff, 0x80, 0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x05, 0x01, 0x1f, 0xfc, 0x80, 0x03, 0x01,
+  0x7f, 0xc0, 0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x06, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x01, 0x7f,
+  0xc0, 0x80, 0x02, 0x01, 0x07, 0xfe, 0x80, 0x06, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xe0,
+  0x80, 0x02, 0x01, 0x0f, 0xfc, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xf0, 0x80,
+  0x02, 0x01, 0x0f, 0xf8, 0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x02, 0x01, 0x1f, 0xf0, 0x80,
+  0x02, 0x01, 0xdf, 0xf0, 0x80, 0x07, 0x01, 0xff, 0x80, 0x80, 0x02, 0x06, 0x1f, 0xf8, 0x00, 0x01,
+  0xff, 0xff, 0xf0, 0x80, 0x07, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x06, 0x0f, 0xfc, 0x00, 0x0f, 0xff,
+  0xff, 0xe0, 0x80, 0x07, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x06, 0x07, 0xfe, 0x00, 0x7f, 0xff, 0xff,
+  0xc0, 0x80, 0x07, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x02, 0x03, 0xff, 0x81, 0xc2, 0xff, 0x00, 0xc0,
+  0x80, 0x07, 0x01, 0x1f, 0xe0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xc7, 0xc2, 0xff, 0x00, 0x80, 0x80,
+  0x07, 0x01, 0x1f, 0xf0, 0x80, 0x03, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01, 0x0f, 0xf0, 0x80,
+  0x03, 0x03, 0x7f, 0xff, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x02, 0x3f, 0xff,
+  0xff, 0x80, 0x0a, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x02, 0x1f, 0xff, 0xfc, 0x80, 0x0a, 0x01, 0x07,
+  0xf8, 0x80, 0x03, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x07, 0xff, 0x80, 0x80, 0x02, 0x02,
+  0x07, 0xff, 0x80, 0x80, 0x0a, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xff, 0x80, 0x0b,
+  0x02, 0x03, 0xff, 0xff, 0x80, 0x02, 0x01, 0x0f, 0xfc, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xc0,
+  0x00, 0x00, 0x1f, 0xf8, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x80,
+  0x0b, 0x07, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x0b, 0x07, 0x01, 0xff, 0xff,
+  0xfe, 0x00, 0x00, 0x7f, 0xc0, 0x80, 0x0c, 0x06, 0x01, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 0x80,
+  0x0d, 0x05, 0x1f, 0xff, 0x80, 0x00, 0xff, 0x80, 0x80, 0x0d, 0x04, 0x03, 0xff, 0xc0, 0x01, 0xff,
+  0x80, 0x0f, 0x03, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x0f, 0x03, 0x7f, 0xf0, 0x01, 0xfe, 0x80, 0x0f,
+  0x03, 0x1f, 0xf8, 0x01, 0xfe, 0x80, 0x0f, 0x03, 0x0f, 0xf8, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x07,
+  0xfc, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x07, 0xfe, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x03, 0xfe, 0x03,
+  0xfc, 0x80, 0x0f, 0x03, 0x01, 0xff, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x01, 0xff, 0x03, 0xfc, 0x80,
+  0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03,
+  0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0x7f, 0x03, 0xfc, 0x80, 0x10, 0x02,
+  0x7f, 0x03, 0xfc, 0x80, 0x10, 0x02, 0x7f, 0x03, 0xfe, 0x80, 0x10, 0x02, 0x7f, 0x01, 0xfe, 0x80,
+  0x03, 0x07, 0x07, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x7c, 0x80, 0x04, 0x02, 0xff, 0x01, 0xff,
+  0x80, 0x03, 0x07, 0x0f, 0xf0, 0x00, 0x07, 0xfc, 0x00, 0x01, 0xfe, 0x80, 0x04, 0x02, 0xff, 0x01,
+  0xff, 0x80, 0x03, 0x07, 0x1f, 0xf8, 0x00, 0x07, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x04, 0x03, 0xff,
+  0x00, 0xff, 0x80, 0x80, 0x02, 0x08, 0x1f, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x80,
+  0x03, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x02, 0x08, 0x1f, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x03,
+  0xff, 0x80, 0x80, 0x02, 0x04, 0x01, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x02, 0x08, 0x1f, 0xf8, 0x00,
+  0x0f, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x80, 0x02, 0x04, 0x01, 0xff, 0x00, 0x7f, 0xe0, 0x80, 0x02,
+  0x08, 0x1f, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x80, 0x02, 0x04, 0x03, 0xfe, 0x00,
+  0x3f, 0xf0, 0x80, 0x02, 0x07, 0x1f, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x03, 0xff, 0x80, 0x03, 0x04,
+  0x07, 0xfe, 0x00, 0x1f, 0xf8, 0x80, 0x02, 0x07, 0x0f, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfe,
+  0x80, 0x03, 0x04, 0x07, 0xfc, 0x00, 0x1f, 0xfc, 0x80, 0x02, 0x07, 0x03, 0xc0, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x78, 0x80, 0x03, 0x04, 0x0f, 0xf8, 0x00, 0x0f, 0xfe, 0x80, 0x0e, 0x05, 0x1f, 0xf8,
+  0x00, 0x07, 0xff, 0x80, 0x80, 0x0d, 0x05, 0x7f, 0xf0, 0x00, 0x03, 0xff, 0xe0, 0x80, 0x0d, 0x05,
+  0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x80, 0x0c, 0x06, 0x03, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xfe,
+  0x80, 0x0c, 0x07, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x80, 0x0b, 0x01, 0x7f, 0xff,
+  0x80, 0x02, 0x0c, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x03,
+  0xc2, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x0c, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0x80, 0x00,
+  0x3f, 0xc0, 0x00, 0x03, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x02, 0x0c, 0x01, 0xff, 0xff, 0xf8, 0x00,
+  0x00, 0xff, 0xc0, 0x00, 0x7f, 0xe0, 0x00, 0x03, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x03, 0x0b, 0x7f,
+  0xff, 0xf8, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xf0, 0x00, 0x03, 0xc2, 0xff, 0x00, 0xc0, 0x80,
+  0x03, 0x0b, 0x1f, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xf0, 0x00, 0x03, 0xc2, 0xff,
+  0x80, 0x04, 0x0e, 0x03, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xf0, 0x00, 0x03, 0xff,
+  0xff, 0xf8, 0x80, 0x05, 0x0c, 0x0f, 0xf8, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x7f, 0xf0, 0x00, 0x03,
+  0xff, 0xff, 0x80, 0x0a, 0x04, 0xff, 0xc0, 0x00, 0x3f, 0xe0, 0x80, 0x0e, 0x04, 0x7f, 0x80, 0x00,
+  0x1f, 0xc0, 0x80, 0x0e, 0x03, 0x1e, 0x00, 0x00, 0x0f, 0x80, 0x85, 0x07, 0x03, 0xc0, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0x7c, 0x80, 0x0b, 0x07, 0x0f, 0xf0, 0x00, 0x03, 0xfc, 0x00, 0x01, 0xfe, 0x80,
+  0x0b, 0x07, 0x1f, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x03, 0xff, 0x80, 0x0b, 0x08, 0x1f, 0xf8, 0x00,
+  0x0f, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x80, 0x0a, 0x08, 0x1f, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x03,
+  0xff, 0x80, 0x80, 0x0a, 0x08, 0x1f, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x80, 0x0a,
+  0x08, 0x1f, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x80, 0x0a, 0x07, 0x1f, 0xf8, 0x00,
+  0x07, 0xfc, 0x00, 0x03, 0xff, 0x80, 0x0b, 0x07, 0x0f, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfe,
+  0x80, 0x0b, 0x07, 0x03, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x78, 0x81, 0x81,
+};
+static constexpr PackedBitmap snow_moon_160 = {160, 160, snow_moon_160_rle};
+
+// 160x160, 3200 -> 1532 bytes
+static const uint8_t lightning_sun_160_rle[] PROGMEM = {
+  0x80, 0xa5, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80,
+  0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11,
+  0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01,
+  0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f, 0xc0, 0x80, 0x11, 0x01, 0x0f,
+  0xc0, 0x80, 0x0d, 0x00, 0x60, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0x10, 0x80, 0x09,
+  0x00, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0x3c, 0x80, 0x08, 0x01, 0x01, 0xf8,
+  0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0x7e, 0x80, 0x08, 0x01, 0x03, 0xfc, 0x80, 0x02,
+  0x01, 0x0f, 0xc0, 0x80, 0x02, 0x00, 0xff, 0x80, 0x08, 0x01, 0x03, 0xfe, 0x80, 0x02, 0x05, 0x0f,
+  0xc0, 0x00, 0x00, 0x01, 0xff, 0x80, 0x08, 0x01, 0x03, 0xff, 0x80, 0x02, 0x05, 0x0f, 0xc0, 0x00,
+  0x00, 0x03, 0xfe, 0x80, 0x09, 0x09, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x07, 0xfc,
+  0x80, 0x09, 0x09, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x09, 0x09,
+  0x3f, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x1f, 0xf0, 0x80, 0x09, 0x01, 0x1f, 0xf0, 0x80,
+  0x05, 0x01, 0x3f, 0xe0, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x09,
+  0x01, 0x07, 0xfc, 0x80, 0x05, 0x01, 0xff, 0x80, 0x80, 0x09, 0x01, 0x03, 0xfe, 0x80, 0x04, 0x01,
+  0x01, 0xff, 0x80, 0x0a, 0x08, 0x01, 0xff, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x03, 0xfe, 0x80, 0x0b,
+  0x07, 0xff, 0x80, 0x03, 0xff, 0xff, 0x00, 0x07, 0xfc, 0x80, 0x0b, 0x07, 0x7f, 0xc0, 0x1f, 0xff,
+  0xff, 0xe0, 0x0f, 0xf8, 0x80, 0x0b, 0x07, 0x3f, 0xc0, 0x7f, 0xff, 0xff, 0xf8, 0x0f, 0xf0, 0x80,
+  0x0b, 0x01, 0x1f, 0x81, 0xc2, 0xff, 0x02, 0xfe, 0x07, 0xe0, 0x80, 0x0b, 0x01, 0x0f, 0x03, 0xc3,
+  0xff, 0x01, 0x03, 0xc0, 0x80, 0x0b, 0x07, 0x06, 0x07, 0xff, 0xf0, 0x3f, 0xff, 0x81, 0x80, 0x80,
+  0x0c, 0x05, 0x1f, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x80, 0x0d, 0x05, 0x3f, 0xf8, 0x00, 0x00, 0xff,
+  0xe0, 0x80, 0x0d, 0x05, 0x7f, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x0d, 0x05, 0x7f, 0xc0, 0x00,
+  0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x08, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x7f, 0xff, 0x80,
+  0x09, 0x01, 0x01, 0xff, 0x80, 0x02, 0x05, 0x03, 0xfe, 0x07, 0xff, 0xff, 0xf0, 0x80, 0x08, 0x01,
+  0x01, 0xfe, 0x80, 0x02, 0x05, 0x01, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x80, 0x08, 0x01, 0x03, 0xfc,
+  0x80, 0x03, 0xc4, 0xff, 0x00, 0xc0, 0x80, 0x07, 0x01, 0x03, 0xf8, 0x80, 0x03, 0x00, 0x7f, 0xc3,
+  0xff, 0x00, 0xf0, 0x80, 0x07, 0x01, 0x07, 0xf0, 0x80, 0x03, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xfc,
+  0x80, 0x07, 0x01, 0x07, 0xf0, 0x80, 0x03, 0x05, 0x7f, 0xff, 0xe0, 0x07, 0xff, 0xfe, 0x80, 0x07,
+  0x01, 0x0f, 0xe0, 0x80, 0x03, 0x06, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x80, 0x06, 0x01,
+  0x0f, 0xe0, 0x80, 0x02, 0x07, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x80, 0x06, 0x01,
+  0x0f, 0xe0, 0x80, 0x02, 0x07, 0x07, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x80, 0x06, 0x01,
+  0x1f, 0xc0, 0x80, 0x02, 0x01, 0x0f, 0xfe, 0x80, 0x03, 0x01, 0x7f, 0xf8, 0x80, 0x06, 0x01, 0x1f,
+  0xc0, 0x80, 0x02, 0x01, 0x1f, 0xf8, 0x80, 0x03, 0x01, 0x1f, 0xfc, 0x80, 0x06, 0x01, 0x1f, 0xc0,
+  0x80, 0x02, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x04, 0xff, 0xff, 0xfc,
+  0x1f, 0xc0, 0x80, 0x02, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x01, 0x03, 0xff, 0x80, 0x03, 0x04, 0xff,
+  0xff, 0xfc, 0x1f, 0x80, 0x80, 0x02, 0x01, 0xff, 0x80, 0x80, 0x03, 0x02, 0x01, 0xff, 0x80, 0x80,
+  0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x01, 0xff, 0x80, 0x05, 0x01, 0xff, 0x80,
+  0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x80, 0x05, 0x01, 0x7f,
+  0xc0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x03, 0xfc, 0x80, 0x05, 0x01,
+  0x3f, 0xe0, 0x80, 0x02, 0x08, 0xff, 0xff, 0xfc, 0x1f, 0xc0, 0x00, 0x00, 0x07, 0xf8, 0x80, 0x05,
+  0x01, 0x1f, 0xe0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x0f,
+  0xf0, 0x80, 0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x0f, 0xf0, 0x80, 0x05, 0x01, 0x07, 0xf8, 0x80,
+  0x05, 0x05, 0x1f, 0xc0, 0x00, 0x00, 0x1f, 0xe0, 0x80, 0x05, 0x01, 0x03, 0xf8, 0x80, 0x05, 0x05,
+  0x0f, 0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x03, 0xfc, 0x80, 0x05, 0x05, 0x0f, 0xe0,
+  0x01, 0xff, 0xff, 0xc0, 0x80, 0x05, 0x01, 0x01, 0xfc, 0x80, 0x05, 0x05, 0x0f, 0xe0, 0x0f, 0xff,
+  0xff, 0x80, 0x80, 0x05, 0x01, 0x01, 0xfe, 0x80, 0x05, 0x05, 0x07, 0xf0, 0x3f, 0xff, 0xff, 0x80,
+  0x80, 0x06, 0x00, 0xfe, 0x80, 0x05, 0x04, 0x07, 0xf0, 0x7f, 0xff, 0xff, 0x80, 0x07, 0x00, 0xff,
+  0x80, 0x05, 0x01, 0x07, 0xf9, 0xc2, 0xff, 0x80, 0x07, 0x00, 0x7f, 0x80, 0x05, 0x03, 0x03, 0xff,
+  0xff, 0xf0, 0x80, 0x08, 0x00, 0x7f, 0x80, 0x05, 0x03, 0x03, 0xff, 0xff, 0x80, 0x80, 0x08, 0x00,
+  0x3f, 0x80, 0x05, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x09, 0x01, 0x3f, 0x80, 0x80, 0x05, 0x01, 0xff,
+  0xf8, 0x80, 0x09, 0x01, 0x3f, 0xc0, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x09, 0x01, 0x1f, 0xfe,
+  0x80, 0x05, 0x01, 0x7f, 0xc0, 0x80, 0x09, 0x02, 0x1f, 0xff, 0xc0, 0x80, 0x04, 0x01, 0xff, 0x80,
+  0x80, 0x09, 0x02, 0x1f, 0xff, 0xf0, 0x80, 0x04, 0x00, 0xff, 0x80, 0x0a, 0x02, 0x1f, 0xff, 0xf8,
+  0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x0a, 0x02, 0x1f, 0xff, 0xfe, 0x80, 0x03, 0x01, 0x03, 0xfc,
+  0x80, 0x0a, 0x02, 0x03, 0xff, 0xff, 0x80, 0x03, 0x01, 0x03, 0xfc, 0x80, 0x0b, 0x02, 0x07, 0xff,
+  0x80, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x0b, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x02, 0x01, 0x07,
+  0xf0, 0x80, 0x0c, 0x01, 0x7f, 0xe0, 0x80, 0x02, 0x01, 0x07, 0xf0, 0x80, 0x0c, 0x01, 0x1f, 0xf0,
+  0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c, 0x01, 0x0f, 0xf0, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80,
+  0x0c, 0x01, 0x07, 0xf8, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x0c, 0x01, 0x03, 0xfc, 0x80, 0x02,
+  0x01, 0x0f, 0xc0, 0x80, 0x0c, 0x01, 0x01, 0xfc, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0c, 0x01,
+  0x01, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xc0,
+  0x80, 0x0d, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01,
+  0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x7f, 0x80,
+  0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00,
+  0x3f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80, 0x0d, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x1f, 0xc0, 0x80,
+  0x04, 0x00, 0x01, 0x80, 0x07, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xc0, 0x80, 0x04, 0x01, 0x07,
+  0x80, 0x80, 0x06, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x04, 0x01, 0x0f, 0x80, 0x80,
+  0x06, 0x00, 0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x04, 0x01, 0x3f, 0xc0, 0x80, 0x06, 0x00,
+  0x3f, 0x80, 0x02, 0x01, 0x0f, 0xe0, 0x80, 0x04, 0x01, 0x1f, 0xe0, 0x80, 0x06, 0x00, 0x3f, 0x80,
+  0x02, 0x01, 0x07, 0xf0, 0x80, 0x04, 0x01, 0x1f, 0xe0, 0x80, 0x06, 0x00, 0x7f, 0x80, 0x02, 0x01,
+  0x07, 0xf0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x06, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x07, 0xf8,
+  0x80, 0x04, 0x01, 0x07, 0xf8, 0x80, 0x06, 0x00, 0x7f, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x04,
+  0x01, 0x03, 0xfc, 0x80, 0x06, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x03, 0xfc, 0x80, 0x04, 0x01, 0x03,
+  0xfc, 0x80, 0x06, 0x00, 0xfe, 0x80, 0x02, 0x01, 0x01, 0xfe, 0x80, 0x04, 0x01, 0x01, 0xfe, 0x80,
+  0x05, 0x01, 0x01, 0xfe, 0x80, 0x03, 0x00, 0xff, 0x80, 0x05, 0x00, 0xff, 0x80, 0x05, 0x01, 0x03,
+  0xfc, 0x80, 0x03, 0x01, 0xff, 0x80, 0x80, 0x04, 0x01, 0xff, 0x80, 0x80, 0x04, 0x01, 0x03, 0xfc,
+  0x80, 0x03, 0x01, 0x7f, 0xc0, 0x80, 0x04, 0x01, 0x7f, 0x80, 0x80, 0x04, 0x01, 0x07, 0xf8, 0x80,
+  0x03, 0x01, 0x3f, 0xe0, 0x80, 0x04, 0x01, 0x3f, 0xc0, 0x80, 0x04, 0x01, 0x0f, 0xf0, 0x80, 0x03,
+  0x01, 0x1f, 0xf8, 0x80, 0x04, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x03, 0x01,
+  0x0f, 0xfc, 0x80, 0x04, 0x01, 0x1f, 0xe0, 0x80, 0x04, 0x01, 0x7f, 0xe0, 0x80, 0x03, 0x02, 0x07,
+  0xff, 0x80, 0x80, 0x03, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x03, 0x02,
+  0x03, 0xff, 0xf0, 0x80, 0x03, 0x01, 0x07, 0xf8, 0x80, 0x03, 0x02, 0x0f, 0xff, 0x80, 0x80, 0x03,
+  0x00, 0x01, 0xc2, 0xff, 0x06, 0xf8, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x03, 0xc3, 0xff, 0x80, 0x05,
+  0xc2, 0xff, 0x06, 0xf8, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x03, 0xc2, 0xff, 0x00, 0xfe, 0x80, 0x05,
+  0x09, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x03, 0xc2, 0xff, 0x00, 0xf8, 0x80,
+  0x05, 0x09, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x03, 0xc2, 0xff, 0x00, 0xe0,
+  0x80, 0x05, 0x09, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0x00, 0x03, 0xc2, 0xff, 0x00,
+  0x80, 0x80, 0x06, 0x0b, 0x7f, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xfe,
+  0x80, 0x08, 0x0a, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0x80, 0x80, 0x0b,
+  0x01, 0x01, 0xfe, 0x80, 0x12, 0x00, 0xff, 0x80, 0x12, 0x00, 0xff, 0x80, 0x12, 0x01, 0x7f, 0x80,
+  0x80, 0x11, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x01, 0x1f, 0xe0, 0x80, 0x11, 0x01, 0x1f, 0xe0, 0x80,
+  0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x07, 0xf8, 0x80, 0x11, 0x01, 0x07, 0xfc, 0x80, 0x11,
+  0x01, 0x03, 0xfc, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x12, 0x00, 0xff, 0x80, 0x12, 0x00, 0xff,
+  0x80, 0x12, 0x01, 0x7f, 0x80, 0x80, 0x11, 0x01, 0x3f, 0xc0, 0x80, 0x11, 0x01, 0x3f, 0xe0, 0x80,
+  0x11, 0x01, 0x1f, 0xe0, 0x80, 0x11, 0x01, 0x0f, 0xf0, 0x80, 0x11, 0x01, 0x07, 0xf8, 0x80, 0x11,
+  0x01, 0x07, 0xf8, 0x80, 0x11, 0x01, 0x03, 0xfc, 0x80, 0x11, 0x01, 0x01, 0xfe, 0x80, 0x11, 0x01,
+  0x01, 0xfc, 0x80, 0x12, 0x00, 0xf8, 0x80, 0x12, 0x00, 0x60, 0x80, 0xa5,
+};
+static constexpr PackedBitmap lightning_sun_160 = {160, 160, lightning_sun_160_rle};
+
+// 160x160, 3200 -> 1313 bytes
+static const uint8_t lightning_moon_160_rle[] PROGMEM = {
+  0x81, 0x2e, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x10, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x10, 0x03, 0x01,
+  0xff, 0xff, 0x80, 0x80, 0x10, 0x02, 0xff, 0xff, 0xf0, 0x80, 0x10, 0x02, 0xff, 0xff, 0xfc, 0x80,
+  0x10, 0x02, 0x7f, 0xff, 0xff, 0x80, 0x10, 0x03, 0x7f, 0xff, 0xff, 0x80, 0x80, 0x0f, 0x03, 0x3f,
+  0xff, 0xff, 0xe0, 0x80, 0x0f, 0x03, 0x3f, 0xc7, 0xff, 0xf0, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0xff,
+  0xf8, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0x3f, 0xfc, 0x80, 0x0f, 0x03, 0x3f, 0xc0, 0x0f, 0xfe, 0x80,
+  0x0f, 0x03, 0x3f, 0xc0, 0x07, 0xff, 0x80, 0x0f, 0x04, 0x3f, 0xc0, 0x03, 0xff, 0x80, 0x80, 0x0e,
+  0x04, 0x3f, 0xc0, 0x00, 0xff, 0xc0, 0x80, 0x0e, 0x04, 0x3f, 0xc0, 0x00, 0x7f, 0xe0, 0x80, 0x0e,
+  0x04, 0x7f, 0xc0, 0x00, 0x3f, 0xe0, 0x80, 0x0e, 0x04, 0x7f, 0x80, 0x00, 0x1f, 0xf0, 0x80, 0x0e,
+  0x04, 0xff, 0x80, 0x00, 0x1f, 0xf0, 0x80, 0x0e, 0x04, 0xff, 0x80, 0x00, 0x0f, 0xf8, 0x80, 0x0d,
+  0x05, 0x01, 0xff, 0x00, 0x00, 0x0f, 0xf8, 0x80, 0x0d, 0x05, 0x03, 0xff, 0x00, 0x00, 0x07, 0xfc,
+  0x80, 0x0d, 0x08, 0x03, 0xfe, 0x00, 0x00, 0x03, 0xfc, 0x0f, 0xff, 0xff, 0x80, 0x0a, 0x05, 0x0f,
+  0xfe, 0x00, 0x00, 0x03, 0xfc, 0xc2, 0xff, 0x00, 0xf0, 0x80, 0x09, 0x04, 0x1f, 0xfc, 0x00, 0x00,
+  0x03, 0xc4, 0xff, 0x80, 0x09, 0x04, 0x3f, 0xf8, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xe0, 0x80,
+  0x05, 0x07, 0x80, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x05,
+  0x07, 0xe0, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xc4, 0xff, 0x00, 0xfe, 0x80, 0x05, 0x07,
+  0xfe, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xc5, 0xff, 0x00, 0x80, 0x80, 0x04, 0xc3, 0xff,
+  0x0a, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x80, 0x04, 0xc3, 0xff,
+  0x80, 0x02, 0x01, 0xff, 0xff, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xf0, 0x80, 0x04, 0xc2, 0xff, 0x05,
+  0xfc, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x80, 0x02, 0x02, 0x03, 0xff, 0xfc, 0x80, 0x04, 0xc2, 0xff,
+  0x05, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x80, 0x03, 0x01, 0x7f, 0xfe, 0x80, 0x04, 0xc2, 0xff,
+  0x05, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x80, 0x03, 0x01, 0x1f, 0xff, 0x80, 0x04, 0x02, 0xff,
+  0xff, 0xfe, 0x80, 0x02, 0x01, 0x1f, 0xfe, 0x80, 0x04, 0x02, 0x07, 0xff, 0xc0, 0x80, 0x03, 0x02,
+  0xff, 0xff, 0xf0, 0x80, 0x02, 0x01, 0x3f, 0xfc, 0x80, 0x04, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x03,
+  0x00, 0xff, 0x80, 0x04, 0x01, 0x7f, 0xf0, 0x80, 0x05, 0x01, 0xff, 0xf0, 0x80, 0x03, 0x01, 0xff,
+  0x80, 0x80, 0x03, 0x01, 0xff, 0xe0, 0x80, 0x05, 0x01, 0x7f, 0xf8, 0x80, 0x03, 0x01, 0xff, 0x80,
+  0x80, 0x02, 0x02, 0x01, 0xff, 0x80, 0x80, 0x05, 0x01, 0x1f, 0xfc, 0x80, 0x03, 0x01, 0x7f, 0xc0,
+  0x80, 0x02, 0x01, 0x03, 0xff, 0x80, 0x06, 0x01, 0x0f, 0xfc, 0x80, 0x03, 0x01, 0x7f, 0xc0, 0x80,
+  0x02, 0x01, 0x07, 0xfe, 0x80, 0x06, 0x01, 0x07, 0xfe, 0x80, 0x03, 0x01, 0x3f, 0xe0, 0x80, 0x02,
+  0x01, 0x0f, 0xfc, 0x80, 0x06, 0x01, 0x03, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xf0, 0x80, 0x02, 0x01,
+  0x0f, 0xf8, 0x80, 0x06, 0x02, 0x01, 0xff, 0x80, 0x80, 0x02, 0x01, 0x1f, 0xf0, 0x80, 0x02, 0x01,
+  0x1f, 0xf0, 0x80, 0x07, 0x01, 0xff, 0x80, 0x80, 0x02, 0x06, 0x1f, 0xf8, 0x00, 0x01, 0xff, 0xff,
+  0xf0, 0x80, 0x07, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x06, 0x0f, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xe0,
+  0x80, 0x07, 0x01, 0x7f, 0xc0, 0x80, 0x02, 0x06, 0x07, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x80,
+  0x07, 0x01, 0x3f, 0xe0, 0x80, 0x02, 0x02, 0x03, 0xff, 0x81, 0xc2, 0xff, 0x00, 0xc0, 0x80, 0x07,
+  0x01, 0x1f, 0xe0, 0x80, 0x02, 0x02, 0x01, 0xff, 0xc7, 0xc2, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01,
+  0x1f, 0xf0, 0x80, 0x03, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x07, 0x01, 0x0f, 0xf0, 0x80, 0x03, 0x03,
+  0x7f, 0xff, 0xff, 0xf8, 0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x03, 0x3f, 0xff, 0xff, 0x80,
+  0x80, 0x09, 0x01, 0x0f, 0xf8, 0x80, 0x03, 0x02, 0x1f, 0xff, 0xfc, 0x80, 0x0a, 0x01, 0x07, 0xf8,
+  0x80, 0x03, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x0a, 0x02, 0x07, 0xff, 0x80, 0x80, 0x02, 0x02, 0x07,
+  0xff, 0x80, 0x80, 0x0a, 0x02, 0x03, 0xff, 0xf8, 0x80, 0x02, 0x01, 0x07, 0xff, 0x80, 0x0b, 0x02,
+  0x03, 0xff, 0xff, 0x80, 0x02, 0x01, 0x0f, 0xfc, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xc0, 0x00,
+  0x00, 0x1f, 0xf8, 0x80, 0x0b, 0x07, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x80, 0x0b,
+  0x07, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x0b, 0x07, 0x01, 0xff, 0xff, 0xfe,
+  0x00, 0x00, 0x7f, 0xc0, 0x80, 0x0c, 0x06, 0x01, 0xff, 0xff, 0x00, 0x00, 0xff, 0xc0, 0x80, 0x0d,
+  0x05, 0x1f, 0xff, 0x80, 0x00, 0xff, 0x80, 0x80, 0x0d, 0x04, 0x03, 0xff, 0xc0, 0x01, 0xff, 0x80,
+  0x0f, 0x03, 0xff, 0xe0, 0x01, 0xff, 0x80, 0x0f, 0x03, 0x7f, 0xf0, 0x01, 0xfe, 0x80, 0x0f, 0x03,
+  0x1f, 0xf8, 0x01, 0xfe, 0x80, 0x0f, 0x03, 0x0f, 0xf8, 0x03, 0xfe, 0x80, 0x0f, 0x03, 0x07, 0xfc,
+  0x03, 0xfc, 0x80, 0x0f, 0x03, 0x07, 0xfe, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x03, 0xfe, 0x03, 0xfc,
+  0x80, 0x0f, 0x03, 0x01, 0xff, 0x03, 0xfc, 0x80, 0x0f, 0x03, 0x01, 0xff, 0x03, 0xfc, 0x80, 0x10,
+  0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0xff, 0x03, 0xfc,
+  0x80, 0x10, 0x02, 0xff, 0x03, 0xfc, 0x80, 0x10, 0x02, 0x7f, 0x03, 0xfc, 0x80, 0x06, 0x00, 0x30,
+  0x80, 0x08, 0x02, 0x7f, 0x03, 0xfc, 0x80, 0x06, 0x00, 0x78, 0x80, 0x08, 0x02, 0x7f, 0x03, 0xfe,
+  0x80, 0x05, 0x01, 0x01, 0xfc, 0x80, 0x08, 0x02, 0x7f, 0x01, 0xfe, 0x80, 0x05, 0x01, 0x03, 0xfe,
+  0x80, 0x08, 0x02, 0xff, 0x01, 0xff, 0x80, 0x05, 0x01, 0x03, 0xff, 0x80, 0x08, 0x02, 0xff, 0x01,
+  0xff, 0x80, 0x05, 0x02, 0x01, 0xff, 0x80, 0x80, 0x07, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x05,
+  0x01, 0xff, 0xc0, 0x80, 0x07, 0x03, 0xff, 0x00, 0xff, 0x80, 0x80, 0x05, 0x01, 0xff, 0xc0, 0x80,
+  0x06, 0x04, 0x01, 0xff, 0x00, 0x7f, 0xc0, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x06, 0x04, 0x01,
+  0xff, 0x00, 0x7f, 0xe0, 0x80, 0x05, 0x01, 0x3f, 0xf0, 0x80, 0x06, 0x04, 0x03, 0xfe, 0x00, 0x3f,
+  0xf0, 0x80, 0x05, 0x01, 0x1f, 0xf8, 0x80, 0x06, 0x04, 0x07, 0xfe, 0x00, 0x1f, 0xf8, 0x80, 0x05,
+  0x01, 0x0f, 0xfc, 0x80, 0x06, 0x04, 0x07, 0xfc, 0x00, 0x1f, 0xfc, 0x80, 0x05, 0x01, 0x07, 0xfe,
+  0x80, 0x06, 0x04, 0x0f, 0xf8, 0x00, 0x0f, 0xfe, 0x80, 0x05, 0x01, 0x07, 0xfe, 0x80, 0x06, 0x05,
+  0x1f, 0xf8, 0x00, 0x07, 0xff, 0x80, 0x80, 0x04, 0x01, 0x03, 0xff, 0x80, 0x06, 0x05, 0x7f, 0xf0,
+  0x00, 0x03, 0xff, 0xe0, 0x80, 0x04, 0x02, 0x01, 0xff, 0x80, 0x80, 0x05, 0x05, 0xff, 0xe0, 0x00,
+  0x01, 0xff, 0xf8, 0x80, 0x05, 0x01, 0xff, 0xc0, 0x80, 0x04, 0x06, 0x03, 0xff, 0xc0, 0x00, 0x00,
+  0xff, 0xfe, 0x80, 0x05, 0x01, 0x7f, 0xe0, 0x80, 0x04, 0x07, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x3f,
+  0xff, 0xe0, 0x80, 0x04, 0x01, 0x3f, 0xf0, 0x80, 0x04, 0x01, 0x7f, 0xff, 0x80, 0x02, 0x00, 0x1f,
+  0xc2, 0xff, 0x07, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xc3, 0xff, 0x00, 0xfe, 0x80,
+  0x02, 0x00, 0x07, 0xc2, 0xff, 0x07, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xc3, 0xff,
+  0x00, 0xfc, 0x80, 0x02, 0x00, 0x03, 0xc2, 0xff, 0x07, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00,
+  0x01, 0xc3, 0xff, 0x00, 0xf0, 0x80, 0x03, 0xc2, 0xff, 0x07, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xfe,
+  0x00, 0x01, 0xc3, 0xff, 0x00, 0xc0, 0x80, 0x03, 0x05, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xc2,
+  0xff, 0x01, 0x00, 0x01, 0xc3, 0xff, 0x80, 0x04, 0x0a, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f,
+  0xff, 0xff, 0x80, 0x01, 0xc2, 0xff, 0x00, 0xfc, 0x80, 0x05, 0x09, 0x0f, 0xff, 0xfe, 0x00, 0x00,
+  0x3f, 0xff, 0xff, 0x80, 0x01, 0xc2, 0xff, 0x80, 0x0b, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x01, 0x0f,
+  0xfc, 0x80, 0x11, 0x01, 0x07, 0xfe, 0x80, 0x11, 0x01, 0x07, 0xfe, 0x80, 0x11, 0x01, 0x03, 0xff,
+  0x80, 0x11, 0x02, 0x01, 0xff, 0x80, 0x80, 0x11, 0x01, 0xff, 0xc0, 0x80, 0x11, 0x01, 0x7f, 0xe0,
+  0x80, 0x11, 0x01, 0x3f, 0xf0, 0x80, 0x11, 0x01, 0x3f, 0xf0, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80,
+  0x11, 0x01, 0x0f, 0xfc, 0x80, 0x11, 0x01, 0x07, 0xfe, 0x80, 0x11, 0x01, 0x03, 0xff, 0x80, 0x11,
+  0x02, 0x01, 0xff, 0x80, 0x80, 0x10, 0x02, 0x01, 0xff, 0x80, 0x80, 0x11, 0x01, 0xff, 0xc0, 0x80,
+  0x11, 0x01, 0x7f, 0xe0, 0x80, 0x11, 0x01, 0x3f, 0xf0, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11,
+  0x01, 0x0f, 0xf8, 0x80, 0x11, 0x01, 0x0f, 0xfc, 0x80, 0x11, 0x01, 0x07, 0xfe, 0x80, 0x11, 0x01,
+  0x03, 0xfe, 0x80, 0x11, 0x01, 0x01, 0xf8, 0x80, 0x12, 0x00, 0xf0, 0x80, 0x12, 0x00, 0x40, 0x81,
+  0x32,
+};
+static constexpr PackedBitmap lightning_moon_160 = {160, 160, lightning_moon_160_rle};
+
+// 48x48, 288 -> 173 bytes
+static const uint8_t unknown_48_rle[] PROGMEM = {
+  0x80, 0x37, 0x01, 0x03, 0xf0, 0x80, 0x03, 0x01, 0x1f, 0xfe, 0x80, 0x03, 0x2e, 0x7f, 0xff, 0x80,
+  0x00, 0x00, 0x01, 0xf0, 0x03, 0xe0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0xf0, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0c, 0x00, 0x03,
+  0xfc, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x06, 0x00, 0x1e, 0x80, 0x02, 0x02, 0x07,
+  0x00, 0x38, 0x80, 0x02, 0x02, 0x07, 0xe0, 0x70, 0x80, 0x02, 0x02, 0x03, 0xf8, 0x60, 0x80, 0x03,
+  0x01, 0x3c, 0xe0, 0x80, 0x03, 0x01, 0x0e, 0xc0, 0x80, 0x03, 0x46, 0x06, 0xc0, 0x00, 0x00, 0x80,
+  0x00, 0x07, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x07, 0xf0, 0x00, 0x03, 0xe0, 0x00,
+  0x0f, 0xf8, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0xfc, 0x00, 0x03, 0x70, 0x00, 0x3d, 0xde, 0x00, 0x07,
+  0x70, 0x00, 0x11, 0xc4, 0x00, 0x06, 0x3c, 0x00, 0x01, 0xc0, 0x00, 0x0e, 0x1f, 0x00, 0x01, 0xc0,
+  0x00, 0x3c, 0x0f, 0xff, 0xf1, 0xc7, 0xff, 0xf8, 0x03, 0xff, 0xf1, 0xc7, 0xff, 0xe0, 0x00, 0x00,
+  0x01, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x04, 0x00, 0x80, 0x80, 0x37,
+};
+static constexpr PackedBitmap unknown_48 = {48, 48, unknown_48_rle};
+
+// 48x48, 288 -> 244 bytes
+static const uint8_t sun_48_rle[] PROGMEM = {
+  0x80, 0x13, 0x01, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80, 0x03, 0x7f, 0x01, 0x80, 0x00, 0x00,
+  0x03, 0x80, 0x01, 0x80, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0x80, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x3c, 0x07, 0xe0, 0x3c, 0x00, 0x00, 0x1c,
+  0x3f, 0xfc, 0x38, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x30, 0x00, 0x00, 0x01, 0xe0, 0x07, 0x80, 0x00,
+  0x00, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0c,
+  0x00, 0x00, 0x30, 0x00, 0xff, 0x8c, 0x00, 0x00, 0x33, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x31, 0xff,
+  0x00, 0x0c, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x07, 0x80, 0x01, 0x3b, 0xe0, 0x00, 0x00,
+  0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x01, 0xf0, 0x0f, 0x80, 0x00, 0x00, 0x0c, 0x7f, 0xfe, 0x30,
+  0x00, 0x00, 0x1c, 0x3f, 0xfc, 0x38, 0x00, 0x00, 0x3c, 0x03, 0xc0, 0x3c, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x1e, 0x00, 0x00, 0xe0, 0x01, 0x80, 0x07, 0x00, 0x01, 0xc0, 0x01, 0x80, 0x03, 0x80, 0x03,
+  0x80, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80, 0x03,
+  0x01, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x80, 0x13,
+};
+static constexpr PackedBitmap sun_48 = {48, 48, sun_48_rle};
+
+// 48x48, 288 -> 263 bytes
+static const uint8_t moon_48_rle[] PROGMEM = {
+  0x80, 0x07, 0x01, 0x01, 0xe0, 0x80, 0x03, 0x01, 0x01, 0xfe, 0x80, 0x04, 0x01, 0xff, 0xc0, 0x80,
+  0x03, 0x01, 0x7f, 0xf0, 0x80, 0x03, 0x01, 0x71, 0xf8, 0x80, 0x03, 0x01, 0x38, 0x3c, 0x80, 0x03,
+  0x01, 0x38, 0x1f, 0x80, 0x03, 0x02, 0x38, 0x07, 0x80, 0x80, 0x02, 0x02, 0x38, 0x03, 0xc0, 0x80,
+  0x02, 0x02, 0x18, 0x01, 0xc0, 0x80, 0x02, 0x02, 0x18, 0x00, 0xe0, 0x80, 0x02, 0x02, 0x18, 0x00,
+  0xf0, 0x80, 0x02, 0x02, 0x18, 0x00, 0x70, 0x80, 0x02, 0x02, 0x38, 0x00, 0x38, 0x80, 0x02, 0x02,
+  0x38, 0x00, 0x38, 0x80, 0x02, 0x02, 0x38, 0x00, 0x1c, 0x80, 0x02, 0x02, 0x38, 0x00, 0x1c, 0x80,
+  0x02, 0x02, 0x70, 0x00, 0x1c, 0x80, 0x02, 0x02, 0x70, 0x00, 0x0c, 0x80, 0x02, 0x02, 0xe0, 0x00,
+  0x0e, 0x80, 0x02, 0x34, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x0e, 0x00, 0x00, 0x03,
+  0xc0, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x60,
+  0x00, 0x3e, 0x00, 0x00, 0x0e, 0x78, 0x00, 0xf8, 0x00, 0x00, 0x0e, 0x7f, 0xff, 0xf0, 0x00, 0x00,
+  0x0e, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x0c, 0x3b, 0xfe, 0x80, 0x02, 0x01, 0x1c, 0x38, 0x80, 0x03,
+  0x01, 0x1c, 0x38, 0x80, 0x03, 0x01, 0x38, 0x1c, 0x80, 0x03, 0x01, 0x38, 0x1c, 0x80, 0x03, 0x01,
+  0x78, 0x0e, 0x80, 0x03, 0x01, 0x70, 0x0f, 0x80, 0x03, 0x35, 0xe0, 0x07, 0x80, 0x00, 0x00, 0x01,
+  0xe0, 0x03, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x80, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x1f, 0x80, 0x01, 0xf8, 0x00, 0x00, 0x07, 0xfc, 0x3f, 0xe0, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80,
+  0x80, 0x02, 0x01, 0x3f, 0xfc, 0x80, 0x07,
+};
+static constexpr PackedBitmap moon_48 = {48, 48, moon_48_rle};
+
+// 48x48, 288 -> 216 bytes
+static const uint8_t cloud_sun_48_rle[] PROGMEM = {
+  0x80, 0x24, 0x01, 0x01, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80,
+  0x03, 0x01, 0x01, 0xc0, 0x80, 0x02, 0x1b, 0x04, 0x01, 0xc0, 0x10, 0x00, 0x00, 0x0e, 0x01, 0xc0,
+  0x38, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x01,
+  0xc3, 0xe1, 0xc0, 0x80, 0x02, 0x02, 0xcf, 0xf9, 0x80, 0x80, 0x02, 0x01, 0x3e, 0x3e, 0x80, 0x03,
+  0x02, 0x38, 0x0e, 0x1e, 0x80, 0x02, 0x42, 0x70, 0x07, 0xff, 0xc0, 0x00, 0x00, 0xe0, 0x03, 0xff,
+  0xf0, 0x00, 0x00, 0xe0, 0x0f, 0x80, 0x78, 0x00, 0xfe, 0xc0, 0x1e, 0x00, 0x1c, 0x00, 0xfe, 0xc0,
+  0x1c, 0x00, 0x0e, 0x00, 0xfc, 0xc0, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe3, 0xf0, 0x00, 0x03, 0x00,
+  0x00, 0x6f, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x7e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x38, 0x00, 0x00,
+  0x01, 0xf0, 0x00, 0x70, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x60, 0x80, 0x02, 0x02, 0x1e, 0x00, 0xe0,
+  0x80, 0x02, 0x02, 0x0e, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x07, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x03,
+  0x00, 0xc0, 0x80, 0x02, 0x02, 0x03, 0x00, 0xe0, 0x80, 0x02, 0x02, 0x03, 0x00, 0xe0, 0x80, 0x02,
+  0x02, 0x03, 0x00, 0x60, 0x80, 0x02, 0x02, 0x03, 0x00, 0x70, 0x80, 0x02, 0x02, 0x07, 0x00, 0x38,
+  0x80, 0x02, 0x02, 0x0e, 0x00, 0x1f, 0x80, 0x02, 0x02, 0x3c, 0x00, 0x0f, 0xc2, 0xff, 0x02, 0xf8,
+  0x00, 0x03, 0xc2, 0xff, 0x00, 0xe0, 0x80, 0x23,
+};
+static constexpr PackedBitmap cloud_sun_48 = {48, 48, cloud_sun_48_rle};
+
+// 48x48, 288 -> 174 bytes
+static const uint8_t cloud_moon_48_rle[] PROGMEM = {
+  0x80, 0x30, 0x00, 0x30, 0x80, 0x04, 0x00, 0x7f, 0x80, 0x04, 0x01, 0x3f, 0x80, 0x80, 0x03, 0x01,
+  0x3b, 0xe0, 0x80, 0x03, 0x01, 0x38, 0xf0, 0x80, 0x03, 0x01, 0x38, 0x70, 0x80, 0x03, 0x01, 0x70,
+  0x38, 0x80, 0x03, 0x3b, 0xf0, 0x3f, 0xfc, 0x00, 0x00, 0x01, 0xe0, 0x3f, 0xff, 0x80, 0x00, 0xff,
+  0xc0, 0x7e, 0x07, 0xe0, 0x00, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xe0, 0x03, 0xc0, 0x00, 0x38,
+  0x00, 0xe0, 0x03, 0x80, 0x00, 0x1c, 0x00, 0x70, 0x1f, 0x00, 0x00, 0x0e, 0x00, 0x79, 0xfe, 0x00,
+  0x00, 0x0e, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x07, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x07, 0x80, 0x1e,
+  0x80, 0x02, 0x02, 0x03, 0xf0, 0x1c, 0x80, 0x02, 0x02, 0x01, 0xfc, 0x38, 0x80, 0x03, 0x01, 0x1e,
+  0x38, 0x80, 0x03, 0x01, 0x0e, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30,
+  0x80, 0x03, 0x01, 0x03, 0x38, 0x80, 0x03, 0x01, 0x03, 0x38, 0x80, 0x03, 0x01, 0x07, 0x1c, 0x80,
+  0x03, 0x01, 0x07, 0x1e, 0x80, 0x03, 0x02, 0x0e, 0x0f, 0x80, 0x80, 0x02, 0x01, 0x1c, 0x03, 0xc3,
+  0xff, 0x01, 0xf8, 0x01, 0xc3, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xc2, 0xff, 0x80, 0x30,
+};
+static constexpr PackedBitmap cloud_moon_48 = {48, 48, cloud_moon_48_rle};
+
+// 48x48, 288 -> 175 bytes
+static const uint8_t fog_sun_48_rle[] PROGMEM = {
+  0x80, 0x1e, 0x01, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80, 0x03, 0x01, 0x01, 0x80, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x80, 0x02, 0x1b, 0x04, 0x01, 0x80, 0x30, 0x00, 0x00, 0x0e, 0x01, 0x80,
+  0x70, 0x00, 0x00, 0x07, 0x01, 0x80, 0xf0, 0x00, 0x00, 0x03, 0x80, 0x01, 0xe0, 0x00, 0x00, 0x01,
+  0xc7, 0xf1, 0xc0, 0x80, 0x02, 0x02, 0xdf, 0xf9, 0x80, 0x80, 0x02, 0x01, 0x3c, 0x3c, 0x80, 0x03,
+  0x02, 0x70, 0x0e, 0x7f, 0x80, 0x02, 0x33, 0x60, 0x07, 0xff, 0xc0, 0x00, 0x00, 0xe0, 0x07, 0xe3,
+  0xf0, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x78, 0x00, 0xfe, 0xc0, 0x1c, 0x00, 0x1c, 0x00, 0xfe, 0xc0,
+  0x38, 0x00, 0x0e, 0x00, 0x00, 0xc0, 0x70, 0x00, 0x06, 0x00, 0x00, 0xe7, 0xe0, 0x00, 0x07, 0x00,
+  0x00, 0xff, 0xe0, 0x00, 0x03, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x03, 0x80, 0x07, 0x00, 0x7f, 0xc2,
+  0xff, 0x02, 0xfc, 0x00, 0x7f, 0xc2, 0xff, 0x00, 0xfe, 0x80, 0x11, 0x00, 0x01, 0xc4, 0xff, 0x00,
+  0x01, 0xc4, 0xff, 0x80, 0x12, 0x00, 0x3f, 0xc2, 0xff, 0x02, 0xfe, 0x00, 0x3f, 0xc2, 0xff, 0x00,
+  0xfe, 0x80, 0x0c, 0x00, 0x01, 0xc2, 0xff, 0x80, 0x01, 0x00, 0x01, 0xc2, 0xff, 0x80, 0x1e,
+};
+static constexpr PackedBitmap fog_sun_48 = {48, 48, fog_sun_48_rle};
+
+// 48x48, 288 -> 156 bytes
+static const uint8_t fog_moon_48_rle[] PROGMEM = {
+  0x80, 0x2a, 0x00, 0x78, 0x80, 0x04, 0x00, 0x7f, 0x80, 0x04, 0x01, 0x3f, 0x80, 0x80, 0x03, 0x01,
+  0x39, 0xc0, 0x80, 0x03, 0x01, 0x30, 0xe0, 0x80, 0x03, 0x01, 0x30, 0x70, 0x80, 0x03, 0x01, 0x70,
+  0x30, 0x80, 0x03, 0x35, 0xe0, 0x3f, 0xfc, 0x00, 0x00, 0x83, 0xe0, 0x3f, 0xff, 0x80, 0x00, 0xff,
+  0x80, 0xfc, 0x07, 0xc0, 0x00, 0xff, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0xe0, 0x03, 0x80, 0x00, 0x78,
+  0x00, 0xe0, 0x07, 0x00, 0x00, 0x3c, 0x00, 0x70, 0x3e, 0x00, 0x00, 0x1c, 0x00, 0x39, 0xfe, 0x00,
+  0x00, 0x0e, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x80, 0x02, 0x00, 0x06, 0x80, 0x06,
+  0x00, 0x1f, 0xc3, 0xff, 0x01, 0xfc, 0x1f, 0xc3, 0xff, 0x00, 0xfc, 0x80, 0x11, 0x00, 0x7f, 0xc4,
+  0xff, 0x00, 0x7f, 0xc4, 0xff, 0x80, 0x0b, 0x00, 0x07, 0xc3, 0xff, 0x01, 0xfc, 0x0f, 0xc3, 0xff,
+  0x01, 0xfc, 0x07, 0xc3, 0xff, 0x00, 0xfc, 0x80, 0x06, 0x0f, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00,
+  0x3f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x2a,
+};
+static constexpr PackedBitmap fog_moon_48 = {48, 48, fog_moon_48_rle};
+
+// 48x48, 288 -> 280 bytes
+static const uint8_t rain_sun_48_rle[] PROGMEM = {
+  0x80, 0x01, 0x00, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x03,
+  0x01, 0x01, 0xc0, 0x80, 0x02, 0x1b, 0x04, 0x01, 0xc0, 0x10, 0x00, 0x00, 0x0e, 0x01, 0xc0, 0x38,
+  0x00, 0x00, 0x07, 0x00, 0xc0, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x01, 0xc3,
+  0xe1, 0xc0, 0x80, 0x02, 0x02, 0xcf, 0xf9, 0x80, 0x80, 0x02, 0x01, 0x3e, 0x3e, 0x80, 0x03, 0x02,
+  0x38, 0x0e, 0x3e, 0x80, 0x02, 0x42, 0x70, 0x07, 0xff, 0xc0, 0x00, 0x00, 0xe0, 0x03, 0xff, 0xf0,
+  0x00, 0x00, 0xc0, 0x0f, 0x00, 0x78, 0x00, 0xfe, 0xc0, 0x1e, 0x00, 0x1c, 0x00, 0xfe, 0xc0, 0x18,
+  0x00, 0x0e, 0x00, 0x00, 0xc0, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe3, 0xf0, 0x00, 0x03, 0x00, 0x00,
+  0x6f, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x7e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x38, 0x00, 0x00, 0x01,
+  0xf0, 0x00, 0x70, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x60, 0x80, 0x02, 0x02, 0x1e, 0x00, 0xe0, 0x80,
+  0x02, 0x02, 0x0e, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x07, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x03, 0x00,
+  0xc0, 0x80, 0x02, 0x35, 0x03, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x03, 0x00, 0xe0, 0x0e, 0x00, 0x30,
+  0x03, 0x00, 0x60, 0x0e, 0x00, 0x30, 0x03, 0x00, 0x70, 0x0e, 0x18, 0x30, 0x07, 0x00, 0x38, 0x0e,
+  0x18, 0x30, 0x0e, 0x00, 0x1f, 0x0e, 0x18, 0x30, 0x7c, 0x00, 0x0f, 0xee, 0x18, 0x33, 0xf8, 0x00,
+  0x01, 0xce, 0x18, 0x33, 0xe0, 0x00, 0x00, 0x0e, 0x18, 0x30, 0x80, 0x02, 0x02, 0x0e, 0x18, 0x30,
+  0x80, 0x02, 0x02, 0x0e, 0x18, 0x30, 0x80, 0x02, 0x02, 0x0e, 0x18, 0x30, 0x80, 0x02, 0x02, 0x0e,
+  0x18, 0x30, 0x80, 0x02, 0x02, 0x0e, 0x18, 0x30, 0x80, 0x02, 0x02, 0x0e, 0x18, 0x30, 0x80, 0x02,
+  0x02, 0x0e, 0x18, 0x30, 0x80, 0x02, 0x02, 0x04, 0x18, 0x20, 0x80, 0x03, 0x00, 0x18, 0x80, 0x04,
+  0x00, 0x18, 0x80, 0x04, 0x02, 0x18, 0x00, 0x00,
+};
+static constexpr PackedBitmap rain_sun_48 = {48, 48, rain_sun_48_rle};
+
+// 48x48, 288 -> 241 bytes
+static const uint8_t rain_moon_48_rle[] PROGMEM = {
+  0x80, 0x0c, 0x00, 0x30, 0x80, 0x04, 0x00, 0x7f, 0x80, 0x04, 0x01, 0x3f, 0x80, 0x80, 0x03, 0x01,
+  0x3b, 0xe0, 0x80, 0x03, 0x01, 0x38, 0xf0, 0x80, 0x03, 0x01, 0x38, 0x70, 0x80, 0x03, 0x01, 0x70,
+  0x38, 0x80, 0x03, 0x35, 0xf0, 0x3f, 0xfc, 0x00, 0x00, 0x81, 0xe0, 0x3f, 0xff, 0x80, 0x00, 0xff,
+  0xc0, 0x7e, 0x07, 0xe0, 0x00, 0xff, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xe0, 0x03, 0xc0, 0x00, 0x38,
+  0x00, 0xe0, 0x03, 0x80, 0x00, 0x1c, 0x00, 0x70, 0x1f, 0x00, 0x00, 0x0e, 0x00, 0x79, 0xfe, 0x00,
+  0x00, 0x06, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x80, 0x02, 0x02, 0x07, 0x80, 0x1e,
+  0x80, 0x02, 0x02, 0x03, 0xf0, 0x1c, 0x80, 0x02, 0x02, 0x01, 0xfc, 0x38, 0x80, 0x03, 0x01, 0x1e,
+  0x38, 0x80, 0x03, 0x01, 0x0e, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30,
+  0x80, 0x03, 0x2f, 0x03, 0x38, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x38, 0x00, 0xe0, 0x01, 0xc0, 0x07,
+  0x1c, 0x00, 0xe0, 0x01, 0xc0, 0x07, 0x1e, 0x00, 0xe0, 0xc1, 0xc0, 0x0e, 0x0f, 0x80, 0xe0, 0xc1,
+  0xc0, 0x3c, 0x03, 0xf8, 0xe0, 0xc1, 0xcf, 0xf8, 0x00, 0xfc, 0xe0, 0xc1, 0xcf, 0xf0, 0x00, 0x00,
+  0xe0, 0xc1, 0xc4, 0x80, 0x02, 0x02, 0xe0, 0xc1, 0xc0, 0x80, 0x02, 0x02, 0xe0, 0xc1, 0xc0, 0x80,
+  0x02, 0x02, 0xe0, 0xc1, 0xc0, 0x80, 0x02, 0x02, 0xe0, 0xc1, 0xc0, 0x80, 0x02, 0x02, 0xe0, 0xc1,
+  0xc0, 0x80, 0x02, 0x02, 0xe0, 0xc1, 0xc0, 0x80, 0x02, 0x02, 0xe0, 0xc1, 0xc0, 0x80, 0x02, 0x02,
+  0xe0, 0xc1, 0xc0, 0x80, 0x03, 0x00, 0xc0, 0x80, 0x04, 0x00, 0xc0, 0x80, 0x04, 0x00, 0xc0, 0x80,
+  0x13,
+};
+static constexpr PackedBitmap rain_moon_48 = {48, 48, rain_moon_48_rle};
+
+// 48x48, 288 -> 236 bytes
+static const uint8_t snow_sun_48_rle[] PROGMEM = {
+  0x80, 0x13, 0x00, 0x80, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x03,
+  0x01, 0x01, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x02, 0x15, 0x0e, 0x01, 0xc0, 0x38, 0x00,
+  0x00, 0x07, 0x01, 0xc0, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x01, 0xc3, 0xe1,
+  0xc0, 0x80, 0x02, 0x02, 0xcf, 0xf9, 0x80, 0x80, 0x02, 0x01, 0x1f, 0x7c, 0x80, 0x03, 0x02, 0x38,
+  0x0e, 0x0c, 0x80, 0x02, 0x42, 0x70, 0x07, 0xff, 0xc0, 0x00, 0x00, 0xe0, 0x03, 0xff, 0xf0, 0x00,
+  0x00, 0xe0, 0x07, 0x80, 0x78, 0x00, 0xfc, 0xc0, 0x0e, 0x00, 0x1c, 0x00, 0xfe, 0xc0, 0x1c, 0x00,
+  0x0e, 0x00, 0xfc, 0xc0, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe3, 0xf0, 0x00, 0x03, 0x00, 0x00, 0xef,
+  0xe0, 0x00, 0x03, 0x80, 0x00, 0x7e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x38, 0x00, 0x00, 0x01, 0xe0,
+  0x00, 0x70, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x60, 0x80, 0x02, 0x02, 0x3c, 0x00, 0xe0, 0x80, 0x02,
+  0x02, 0x0e, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x07, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x03, 0x00, 0xc0,
+  0x80, 0x02, 0x02, 0x03, 0x00, 0xc0, 0x80, 0x02, 0x14, 0x03, 0x00, 0xe0, 0x0c, 0x18, 0x60, 0x03,
+  0x00, 0x60, 0x0e, 0x38, 0x70, 0x03, 0x00, 0x70, 0x0c, 0x18, 0x60, 0x07, 0x00, 0x38, 0x80, 0x02,
+  0x02, 0x0e, 0x00, 0x1e, 0x80, 0x02, 0x0c, 0x3c, 0x00, 0x0f, 0xc1, 0xc3, 0x07, 0xf8, 0x00, 0x03,
+  0xc1, 0xc3, 0x87, 0xe0, 0x80, 0x02, 0x00, 0x83, 0x80, 0x0f, 0x02, 0x0c, 0x38, 0x70, 0x80, 0x02,
+  0x02, 0x0e, 0x38, 0x70, 0x80, 0x02, 0x02, 0x04, 0x10, 0x20, 0x80, 0x12,
+};
+static constexpr PackedBitmap snow_sun_48 = {48, 48, snow_sun_48_rle};
+
+// 48x48, 288 -> 194 bytes
+static const uint8_t snow_moon_48_rle[] PROGMEM = {
+  0x80, 0x24, 0x00, 0x7e, 0x80, 0x04, 0x01, 0x3f, 0x80, 0x80, 0x03, 0x01, 0x3b, 0xc0, 0x80, 0x03,
+  0x01, 0x38, 0xe0, 0x80, 0x03, 0x01, 0x38, 0x70, 0x80, 0x03, 0x01, 0x70, 0x38, 0x80, 0x03, 0x3b,
+  0x70, 0x3b, 0xfc, 0x00, 0x00, 0x01, 0xe0, 0x1f, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x7f, 0x0f, 0xe0,
+  0x00, 0xff, 0x80, 0xf0, 0x01, 0xf0, 0x00, 0xfc, 0x01, 0xc0, 0x00, 0x78, 0x00, 0xe0, 0x03, 0x80,
+  0x00, 0x1c, 0x00, 0x70, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x78, 0xfe, 0x00, 0x00, 0x0e, 0x00, 0x3f,
+  0xfe, 0x00, 0x00, 0x07, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x80, 0x02, 0x02, 0x03,
+  0xf0, 0x1c, 0x80, 0x02, 0x02, 0x03, 0xf8, 0x38, 0x80, 0x03, 0x01, 0x3c, 0x38, 0x80, 0x03, 0x01,
+  0x0e, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30, 0x80, 0x03, 0x01, 0x03,
+  0x38, 0x80, 0x03, 0x13, 0x03, 0x38, 0x01, 0xc1, 0xc1, 0xc0, 0x07, 0x1c, 0x01, 0xc1, 0xc1, 0xc0,
+  0x07, 0x1e, 0x00, 0xc0, 0x81, 0x80, 0x0e, 0x0f, 0x80, 0x03, 0x12, 0x1e, 0x07, 0xf8, 0x08, 0x08,
+  0x0f, 0xfc, 0x01, 0xfc, 0x1c, 0x1c, 0x1f, 0xf0, 0x00, 0x38, 0x1c, 0x1c, 0x0f, 0x80, 0x80, 0x0d,
+  0x0e, 0xc0, 0x81, 0x80, 0x00, 0x00, 0x01, 0xc1, 0xc3, 0xc0, 0x00, 0x00, 0x01, 0xc1, 0xc1, 0xc0,
+  0x80, 0x24,
+};
+static constexpr PackedBitmap snow_moon_48 = {48, 48, snow_moon_48_rle};
+
+// 48x48, 288 -> 249 bytes
+static const uint8_t lightning_sun_48_rle[] PROGMEM = {
+  0x80, 0x0d, 0x00, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x03, 0x01, 0x01, 0xc0, 0x80, 0x03,
+  0x01, 0x01, 0xc0, 0x80, 0x02, 0x1b, 0x04, 0x01, 0xc0, 0x10, 0x00, 0x00, 0x0e, 0x01, 0xc0, 0x38,
+  0x00, 0x00, 0x07, 0x01, 0xc0, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x01, 0xc3,
+  0xe1, 0xc0, 0x80, 0x02, 0x02, 0xcf, 0xf9, 0x80, 0x80, 0x02, 0x01, 0x3e, 0x3e, 0x80, 0x03, 0x02,
+  0x78, 0x0e, 0x3e, 0x80, 0x02, 0x42, 0x70, 0x07, 0xff, 0xc0, 0x00, 0x00, 0xe0, 0x03, 0xff, 0xf0,
+  0x00, 0x00, 0xe0, 0x0f, 0x00, 0x78, 0x00, 0xfe, 0xc0, 0x1e, 0x00, 0x1c, 0x00, 0xfe, 0xc0, 0x1c,
+  0x00, 0x0e, 0x00, 0xfc, 0xc0, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe3, 0xf0, 0x00, 0x03, 0x00, 0x00,
+  0x6f, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x7e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x38, 0x00, 0x00, 0x01,
+  0xf0, 0x00, 0x70, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x60, 0x80, 0x02, 0x02, 0x1e, 0x00, 0xe0, 0x80,
+  0x02, 0x02, 0x0e, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x07, 0x00, 0xc0, 0x80, 0x02, 0x02, 0x03, 0x00,
+  0xc0, 0x80, 0x02, 0x30, 0x03, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x03, 0x00, 0xe0, 0x00, 0x70, 0x00,
+  0x03, 0x00, 0x60, 0x00, 0x70, 0x00, 0x07, 0x00, 0x70, 0x00, 0x38, 0x00, 0x07, 0x00, 0x3c, 0x00,
+  0x1c, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x1c, 0x00, 0x7c, 0x00, 0x0f, 0xf8, 0x7e, 0x1f, 0xf8, 0x00,
+  0x01, 0xf8, 0x3e, 0x1f, 0xe0, 0x80, 0x02, 0x00, 0x38, 0x80, 0x04, 0x00, 0x1c, 0x80, 0x04, 0x00,
+  0x0e, 0x80, 0x04, 0x00, 0x0e, 0x80, 0x04, 0x00, 0x07, 0x80, 0x04, 0x01, 0x03, 0x80, 0x80, 0x03,
+  0x01, 0x01, 0x80, 0x80, 0x03, 0x00, 0x01, 0x80, 0x0d,
+};
+static constexpr PackedBitmap lightning_sun_48 = {48, 48, lightning_sun_48_rle};
+
+// 48x48, 288 -> 210 bytes
+static const uint8_t lightning_moon_48_rle[] PROGMEM = {
+  0x80, 0x18, 0x00, 0x30, 0x80, 0x04, 0x00, 0x7f, 0x80, 0x04, 0x01, 0x3f, 0x80, 0x80, 0x03, 0x01,
+  0x3b, 0xe0, 0x80, 0x03, 0x01, 0x38, 0xf0, 0x80, 0x03, 0x01, 0x38, 0x70, 0x80, 0x03, 0x01, 0x70,
+  0x38, 0x80, 0x03, 0x3b, 0xf0, 0x3f, 0xfc, 0x00, 0x00, 0x81, 0xe0, 0x3f, 0xff, 0x80, 0x00, 0xff,
+  0xc0, 0x7e, 0x07, 0xe0, 0x00, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xe0, 0x03, 0xc0, 0x00, 0x38,
+  0x00, 0xe0, 0x03, 0x80, 0x00, 0x1c, 0x00, 0x70, 0x1f, 0x00, 0x00, 0x0e, 0x00, 0x79, 0xfe, 0x00,
+  0x00, 0x0e, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x07, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x07, 0x80, 0x1e,
+  0x80, 0x02, 0x02, 0x03, 0xf0, 0x1c, 0x80, 0x02, 0x02, 0x01, 0xfc, 0x38, 0x80, 0x03, 0x01, 0x1e,
+  0x38, 0x80, 0x03, 0x01, 0x0e, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30, 0x80, 0x03, 0x01, 0x07, 0x30,
+  0x80, 0x03, 0x2f, 0x03, 0x38, 0x00, 0x07, 0x00, 0x00, 0x03, 0x38, 0x00, 0x07, 0x80, 0x00, 0x07,
+  0x1c, 0x00, 0x03, 0x80, 0x00, 0x07, 0x1e, 0x00, 0x01, 0xc0, 0x00, 0x0e, 0x0f, 0x80, 0x00, 0xe0,
+  0x00, 0x1c, 0x03, 0xff, 0x07, 0xf0, 0x3f, 0xf8, 0x01, 0xff, 0x87, 0xf8, 0x7f, 0xf0, 0x00, 0x0f,
+  0x03, 0xf0, 0x3f, 0x80, 0x02, 0x01, 0x01, 0xc0, 0x80, 0x04, 0x00, 0xe0, 0x80, 0x04, 0x00, 0x70,
+  0x80, 0x04, 0x00, 0x38, 0x80, 0x04, 0x00, 0x1c, 0x80, 0x04, 0x00, 0x1e, 0x80, 0x04, 0x00, 0x0e,
+  0x80, 0x1f,
+};
+static constexpr PackedBitmap lightning_moon_48 = {48, 48, lightning_moon_48_rle};
+
+// 160x160, 3200 -> 853 bytes
+static const uint8_t train_north_rle[] PROGMEM = {
+  0x83, 0x23, 0xc4, 0xff, 0x00, 0xf0, 0x80, 0x0c, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x0c,
+  0x00, 0x01, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x0c, 0x00, 0x01, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x0c,
+  0x00, 0x01, 0xc4, 0xff, 0x00, 0xf8, 0x80, 0x0c, 0x01, 0x01, 0xf0, 0x80, 0x03, 0x00, 0xf8, 0x80,
+  0x0c, 0x01, 0x01, 0xf0, 0x80, 0x03, 0x00, 0xf8, 0x80, 0x0c, 0x01, 0x01, 0xf0, 0x80, 0x03, 0x00,
+  0xfc, 0x80, 0x09, 0x02, 0x0f, 0xff, 0xc0, 0xca, 0xff, 0x00, 0xfc, 0x80, 0x04, 0x02, 0x3f, 0xff,
+  0xc1, 0xcb, 0xff, 0x00, 0x80, 0x80, 0x03, 0x02, 0x7f, 0xff, 0xc1, 0xcb, 0xff, 0x00, 0xe0, 0x80,
+  0x03, 0x02, 0x7f, 0xff, 0xc1, 0xcb, 0xff, 0x00, 0xf0, 0x80, 0x03, 0x02, 0xff, 0xff, 0x80, 0xcb,
+  0xff, 0x00, 0xf8, 0x80, 0x03, 0x00, 0xf8, 0x80, 0x0c, 0x01, 0x03, 0xfc, 0x80, 0x03, 0x00, 0xf8,
+  0x80, 0x0d, 0x00, 0xfe, 0x80, 0x03, 0x00, 0xf8, 0x80, 0x0d, 0x00, 0x7f, 0x80, 0x03, 0x00, 0xf8,
+  0x80, 0x0d, 0x01, 0x3f, 0x80, 0x80, 0x02, 0x00, 0xf8, 0x80, 0x0d, 0x01, 0x1f, 0xc0, 0x80, 0x02,
+  0x00, 0xf8, 0x80, 0x0c, 0x02, 0x01, 0xff, 0xe0, 0x80, 0x02, 0x00, 0xf8, 0x80, 0x0c, 0x02, 0x07,
+  0xff, 0xf0, 0x80, 0x02, 0x00, 0xf8, 0x80, 0x0c, 0x02, 0x0f, 0xff, 0xf8, 0x80, 0x02, 0x01, 0xf8,
+  0x1f, 0xc2, 0xff, 0x00, 0x07, 0xc2, 0xff, 0x00, 0xc3, 0xc2, 0xff, 0x03, 0xf0, 0x1f, 0xff, 0xfc,
+  0x80, 0x02, 0x01, 0xf8, 0x3f, 0xc2, 0xff, 0x00, 0x8f, 0xc2, 0xff, 0x00, 0xc3, 0xc2, 0xff, 0x03,
+  0xf0, 0x1f, 0xff, 0xfe, 0x80, 0x02, 0x01, 0xf8, 0x3f, 0xc2, 0xff, 0x00, 0x8f, 0xc2, 0xff, 0x00,
+  0xe3, 0xc2, 0xff, 0x03, 0xf0, 0x3f, 0x00, 0x7f, 0x80, 0x02, 0x01, 0xf8, 0x1f, 0xc2, 0xff, 0x00,
+  0x8f, 0xc2, 0xff, 0x00, 0xc3, 0xc2, 0xff, 0x0c, 0xf0, 0x3e, 0x00, 0x3f, 0x80, 0x00, 0x00, 0xf8,
+  0x0f, 0xff, 0xff, 0xfe, 0x03, 0xc2, 0xff, 0x00, 0x81, 0xc2, 0xff, 0x7f, 0xe0, 0x3e, 0x00, 0x1f,
+  0xc0, 0x00, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07,
+  0xc0, 0x3e, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00, 0x1f,
+  0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3e, 0x00, 0x07, 0xf0, 0x00, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x3c,
+  0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3f, 0x00, 0x03, 0xf8, 0x00, 0x00, 0xf8,
+  0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x1f, 0xc0, 0x01,
+  0xfc, 0x00, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07,
+  0xc0, 0x0f, 0xe0, 0x00, 0xfe, 0x00, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00, 0x1f,
+  0x00, 0xf8, 0x00, 0x07, 0xc0, 0x07, 0xf0, 0x00, 0x7f, 0x00, 0x00, 0xf8, 0x54, 0x07, 0xc0, 0x00,
+  0x3c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x03, 0xf8, 0x00, 0x3f, 0x80, 0x00,
+  0xf8, 0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x01, 0xfc,
+  0x00, 0x1f, 0xc0, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00,
+  0x07, 0xc0, 0x00, 0xfe, 0x00, 0x0f, 0xe0, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x3c, 0x03, 0xe0, 0x00,
+  0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0x00, 0x07, 0xf0, 0x00, 0xf8, 0x07, 0xff, 0xff,
+  0xfc, 0x03, 0xc2, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x0c, 0xc0, 0x00, 0x3f, 0x80, 0x03, 0xf8, 0x00,
+  0xf8, 0x07, 0xff, 0xff, 0xfc, 0x03, 0xc2, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x0c, 0xc0, 0x00, 0x1f,
+  0xe0, 0x01, 0xfc, 0x00, 0xf8, 0x07, 0xff, 0xff, 0xfc, 0x03, 0xc2, 0xff, 0x00, 0x00, 0xc2, 0xff,
+  0x0c, 0xc0, 0x00, 0x0f, 0xf0, 0x00, 0xfe, 0x00, 0xf8, 0x07, 0xff, 0xff, 0xfc, 0x01, 0xc2, 0xff,
+  0x00, 0x00, 0xc2, 0xff, 0x02, 0xc0, 0x00, 0x03, 0xc2, 0xff, 0x10, 0x00, 0xf8, 0x03, 0xff, 0xff,
+  0xfc, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x01, 0xc2, 0xff, 0x01, 0x80,
+  0xf8, 0x80, 0x0e, 0xc2, 0xff, 0x01, 0xc0, 0xf8, 0x80, 0x0e, 0x04, 0x7f, 0xff, 0xff, 0xe0, 0xf8,
+  0x80, 0x0e, 0x04, 0x0f, 0xff, 0xff, 0xf0, 0xf8, 0x80, 0x10, 0x02, 0x03, 0xf8, 0xf8, 0x80, 0x10,
+  0x02, 0x01, 0xfc, 0xf8, 0x80, 0x11, 0x00, 0xfc, 0xd2, 0xff, 0x00, 0xfe, 0xd2, 0xff, 0x00, 0xfe,
+  0xd2, 0xff, 0x00, 0xfe, 0xd3, 0xff, 0x00, 0xf8, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x01,
+  0x1f, 0xf8, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x01, 0x1f,
+  0xf8, 0x80, 0x11, 0x00, 0x1f, 0xe6, 0xff, 0x00, 0xfe, 0xd2, 0xff, 0x00, 0xfe, 0xd2, 0xff, 0x00,
+  0xfe, 0xd2, 0xff, 0x01, 0xfc, 0xf8, 0x80, 0x10, 0x02, 0x01, 0xfc, 0xf8, 0x80, 0x10, 0x02, 0x03,
+  0xf8, 0xfc, 0x80, 0x10, 0x02, 0x3f, 0xf0, 0x7f, 0xd1, 0xff, 0x01, 0xe0, 0x7f, 0xd1, 0xff, 0x01,
+  0xc0, 0x3f, 0xd1, 0xff, 0x01, 0x00, 0x1f, 0xd0, 0xff, 0x02, 0xfc, 0x00, 0x07, 0xd0, 0xff, 0x66,
+  0xc0, 0x00, 0x07, 0xc0, 0x01, 0xf1, 0xf0, 0x7c, 0x7c, 0x00, 0x1f, 0x03, 0xe0, 0x01, 0xf0, 0xf0,
+  0x3e, 0x3e, 0x00, 0x1f, 0x00, 0x00, 0x03, 0xe0, 0x03, 0xf1, 0xf0, 0x7c, 0x7e, 0x00, 0x3f, 0x03,
+  0xe0, 0x01, 0xf0, 0xf0, 0x3e, 0x3e, 0x00, 0x1f, 0x00, 0x00, 0x03, 0xe0, 0x03, 0xe1, 0xf0, 0x7c,
+  0x3e, 0x00, 0x3e, 0x03, 0xf0, 0x03, 0xf0, 0xf0, 0x3e, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x03, 0xf0,
+  0x07, 0xe1, 0xf0, 0x7c, 0x3f, 0x00, 0x7e, 0x01, 0xf8, 0x07, 0xe0, 0xf0, 0x3e, 0x1f, 0x80, 0x7e,
+  0x00, 0x00, 0x01, 0xfc, 0x1f, 0xc1, 0xf0, 0x7c, 0x1f, 0xc1, 0xfc, 0x01, 0xfc, 0x0f, 0xe0, 0xf0,
+  0x3e, 0x1f, 0xe0, 0xfe, 0x00, 0x00, 0x7f, 0xd1, 0xff, 0x00, 0xfe, 0xfb, 0xff, 0x00, 0x7f, 0xd1,
+  0xff, 0x00, 0xfe, 0x83, 0x1f,
+};
+extern constexpr PackedBitmap train_north = {160, 160, train_north_rle};
+
+// 160x160, 3200 -> 850 bytes
+static const uint8_t train_south_rle[] PROGMEM = {
+  0x83, 0x29, 0x00, 0x0f, 0xc4, 0xff, 0x80, 0x0d, 0x00, 0x1f, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x0c,
+  0x00, 0x1f, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x0c, 0x00, 0x1f, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x0c,
+  0x00, 0x1f, 0xc4, 0xff, 0x00, 0x80, 0x80, 0x0c, 0x00, 0x1f, 0x80, 0x03, 0x01, 0x0f, 0x80, 0x80,
+  0x0c, 0x00, 0x1f, 0x80, 0x03, 0x01, 0x0f, 0x80, 0x80, 0x0c, 0x00, 0x3f, 0x80, 0x03, 0x01, 0x0f,
+  0x80, 0x80, 0x07, 0x00, 0x3f, 0xca, 0xff, 0x02, 0x03, 0xff, 0xf0, 0x80, 0x03, 0x00, 0x01, 0xcb,
+  0xff, 0x02, 0x83, 0xff, 0xfc, 0x80, 0x03, 0x00, 0x07, 0xcb, 0xff, 0x02, 0x83, 0xff, 0xfe, 0x80,
+  0x03, 0x00, 0x0f, 0xcb, 0xff, 0x02, 0x83, 0xff, 0xfe, 0x80, 0x03, 0x00, 0x1f, 0xcb, 0xff, 0x02,
+  0x01, 0xff, 0xff, 0x80, 0x03, 0x01, 0x3f, 0xc0, 0x80, 0x0c, 0x00, 0x1f, 0x80, 0x03, 0x00, 0x7f,
+  0x80, 0x0d, 0x00, 0x1f, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x0d, 0x00, 0x1f, 0x80, 0x02, 0x01, 0x01,
+  0xfc, 0x80, 0x0d, 0x00, 0x1f, 0x80, 0x02, 0x01, 0x03, 0xf8, 0x80, 0x0d, 0x00, 0x1f, 0x80, 0x02,
+  0x02, 0x07, 0xff, 0x80, 0x80, 0x0c, 0x00, 0x1f, 0x80, 0x02, 0x02, 0x0f, 0xff, 0xe0, 0x80, 0x0c,
+  0x00, 0x1f, 0x80, 0x02, 0x02, 0x1f, 0xff, 0xf0, 0x80, 0x0c, 0x00, 0x1f, 0x80, 0x02, 0x03, 0x3f,
+  0xff, 0xf8, 0x0f, 0xc2, 0xff, 0x00, 0xc3, 0xc2, 0xff, 0x00, 0xe0, 0xc2, 0xff, 0x01, 0xf8, 0x1f,
+  0x80, 0x02, 0x03, 0x7f, 0xff, 0xf8, 0x0f, 0xc2, 0xff, 0x00, 0xc3, 0xc2, 0xff, 0x00, 0xf1, 0xc2,
+  0xff, 0x01, 0xfc, 0x1f, 0x80, 0x02, 0x03, 0xfe, 0x00, 0xfc, 0x0f, 0xc2, 0xff, 0x00, 0xc7, 0xc2,
+  0xff, 0x00, 0xf1, 0xc2, 0xff, 0x08, 0xfc, 0x1f, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x7c, 0x0f, 0xc2,
+  0xff, 0x00, 0xc3, 0xc2, 0xff, 0x00, 0xf1, 0xc2, 0xff, 0x08, 0xf8, 0x1f, 0x00, 0x00, 0x03, 0xf8,
+  0x00, 0x7c, 0x07, 0xc2, 0xff, 0x00, 0x81, 0xc2, 0xff, 0x7f, 0xc0, 0x7f, 0xff, 0xff, 0xf0, 0x1f,
+  0x00, 0x00, 0x07, 0xf0, 0x00, 0x7c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3c,
+  0x00, 0x03, 0xe0, 0x1f, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x7c, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8,
+  0x00, 0x07, 0xc0, 0x3c, 0x00, 0x03, 0xe0, 0x1f, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0x03, 0xe0,
+  0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3c, 0x00, 0x03, 0xe0, 0x1f, 0x00, 0x00, 0x3f, 0x80,
+  0x03, 0xf8, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3c, 0x00, 0x03, 0xe0, 0x1f,
+  0x00, 0x00, 0x7f, 0x00, 0x07, 0xf0, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3c,
+  0x00, 0x03, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x00, 0x0f, 0xe0, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8,
+  0x00, 0x07, 0xc0, 0x3c, 0x00, 0x03, 0xe0, 0x1f, 0x00, 0x01, 0x54, 0xfc, 0x00, 0x1f, 0xc0, 0x03,
+  0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3c, 0x00, 0x03, 0xe0, 0x1f, 0x00, 0x03, 0xf8,
+  0x00, 0x3f, 0x80, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0, 0x3c, 0x00, 0x03, 0xe0,
+  0x1f, 0x00, 0x07, 0xf0, 0x00, 0x7f, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x07, 0xc0,
+  0x3c, 0x00, 0x03, 0xe0, 0x1f, 0x00, 0x0f, 0xe0, 0x00, 0xfe, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0x00,
+  0xf8, 0x00, 0x07, 0xc0, 0x3c, 0x00, 0x03, 0xe0, 0x1f, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x03,
+  0xc2, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x0c, 0xc0, 0x3f, 0xff, 0xff, 0xe0, 0x1f, 0x00, 0x3f, 0x80,
+  0x07, 0xf8, 0x00, 0x03, 0xc2, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x0c, 0xc0, 0x3f, 0xff, 0xff, 0xe0,
+  0x1f, 0x00, 0x7f, 0x00, 0x0f, 0xf0, 0x00, 0x03, 0xc2, 0xff, 0x00, 0x00, 0xc2, 0xff, 0x06, 0xc0,
+  0x3f, 0xff, 0xff, 0xe0, 0x1f, 0x00, 0xc2, 0xff, 0x02, 0xc0, 0x00, 0x03, 0xc2, 0xff, 0x00, 0x00,
+  0xc2, 0xff, 0x06, 0x80, 0x3f, 0xff, 0xff, 0xe0, 0x1f, 0x01, 0xc2, 0xff, 0x10, 0x80, 0x00, 0x01,
+  0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xc0, 0x1f, 0x03, 0xc2, 0xff,
+  0x80, 0x0e, 0x04, 0x1f, 0x07, 0xff, 0xff, 0xfe, 0x80, 0x0e, 0x04, 0x1f, 0x0f, 0xff, 0xff, 0xf0,
+  0x80, 0x0e, 0x02, 0x1f, 0x1f, 0xc0, 0x80, 0x10, 0x02, 0x1f, 0x3f, 0x80, 0x80, 0x10, 0x01, 0x1f,
+  0x3f, 0x80, 0x11, 0x01, 0x1f, 0x7f, 0xd2, 0xff, 0x00, 0x7f, 0xd2, 0xff, 0x00, 0x7f, 0xe6, 0xff,
+  0x00, 0xf8, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x01, 0x1f,
+  0xf8, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x01, 0x1f, 0xf8, 0x80, 0x11, 0x00, 0x1f, 0xd3,
+  0xff, 0x00, 0x7f, 0xd2, 0xff, 0x00, 0x7f, 0xd2, 0xff, 0x00, 0x7f, 0xd2, 0xff, 0x00, 0x3f, 0xd2,
+  0xff, 0x01, 0x3f, 0x80, 0x80, 0x10, 0x02, 0x1f, 0x1f, 0xc0, 0x80, 0x10, 0x02, 0x1f, 0x0f, 0xfc,
+  0x80, 0x10, 0x01, 0x3f, 0x07, 0xd1, 0xff, 0x01, 0xfe, 0x03, 0xd1, 0xff, 0x01, 0xfe, 0x00, 0xd1,
+  0xff, 0x02, 0xfc, 0x00, 0x3f, 0xd0, 0xff, 0x02, 0xf8, 0x00, 0x03, 0xd0, 0xff, 0x65, 0xe0, 0x00,
+  0x00, 0xf8, 0x00, 0x7c, 0x7c, 0x0f, 0x0f, 0x80, 0x07, 0xc0, 0xf8, 0x00, 0x3e, 0x3e, 0x0f, 0x8f,
+  0x80, 0x03, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x7c, 0x7c, 0x0f, 0x0f, 0x80, 0x07, 0xc0, 0xfc, 0x00,
+  0x7e, 0x3e, 0x0f, 0x8f, 0xc0, 0x07, 0xc0, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x7c, 0x0f, 0x0f, 0xc0,
+  0x0f, 0xc0, 0x7c, 0x00, 0x7c, 0x3e, 0x0f, 0x87, 0xc0, 0x07, 0xc0, 0x00, 0x00, 0x7e, 0x01, 0xf8,
+  0x7c, 0x0f, 0x07, 0xe0, 0x1f, 0x80, 0x7e, 0x00, 0xfc, 0x3e, 0x0f, 0x87, 0xe0, 0x0f, 0xc0, 0x00,
+  0x00, 0x7f, 0x07, 0xf8, 0x7c, 0x0f, 0x07, 0xf0, 0x3f, 0x80, 0x3f, 0x83, 0xf8, 0x3e, 0x0f, 0x83,
+  0xf8, 0x3f, 0x80, 0x7f, 0xd1, 0xff, 0x00, 0xfe, 0xfb, 0xff, 0x00, 0x7f, 0xd1, 0xff, 0x00, 0xfe,
+  0x83, 0x1f,
+};
+extern constexpr PackedBitmap train_south = {160, 160, train_south_rle};
+
+extern constexpr const PackedBitmap* WEATHER_ICONS[ICON_SIZES][WX_CATEGORIES][2] = {
+  {  // 200
+    {&unknown_200, &unknown_200},   // unknown: night, day
+    {&moon_200, &sun_200},   // clear: night, day
+    {&cloud_moon_200, &cloud_sun_200},   // cloudy: night, day
+    {&fog_moon_200, &fog_sun_200},   // fog: night, day
+    {&rain_moon_200, &rain_sun_200},   // rain: night, day
+    {&snow_moon_200, &snow_sun_200},   // snow: night, day
+    {&lightning_moon_200, &lightning_sun_200},   // thunder: night, day
+  },
+  {  // 160
+    {&unknown_160, &unknown_160},   // unknown: night, day
+    {&moon_160, &sun_160},   // clear: night, day
+    {&cloud_moon_160, &cloud_sun_160},   // cloudy: night, day
+    {&fog_moon_160, &fog_sun_160},   // fog: night, day
+    {&rain_moon_160, &rain_sun_160},   // rain: night, day
+    {&snow_moon_160, &snow_sun_160},   // snow: night, day
+    {&lightning_moon_160, &lightning_sun_160},   // thunder: night, day
+  },
+  {  // 48
+    {&unknown_48, &unknown_48},   // unknown: night, day
+    {&moon_48, &sun_48},   // clear: night, day
+    {&cloud_moon_48, &cloud_sun_48},   // cloudy: night, day
+    {&fog_moon_48, &fog_sun_48},   // fog: night, day
+    {&rain_moon_48, &rain_sun_48},   // rain: night, day
+    {&snow_moon_48, &snow_sun_48},   // snow: night, day
+    {&lightning_moon_48, &lightning_sun_48},   // thunder: night, day
+  },
+};
+
+extern constexpr uint8_t WMO_CATEGORY[100] = {
+  1, 2, 2, 2, 0, 0, 0, 0, 0, 0,   // 0-9
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 10-19
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 20-29
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 30-39
+  0, 0, 0, 0, 0, 3, 0, 0, 3, 0,   // 40-49
+  0, 4, 4, 4, 4, 4, 4, 4, 4, 4,   // 50-59
+  4, 4, 4, 4, 4, 4, 4, 4, 0, 0,   // 60-69
+  0, 5, 5, 5, 5, 5, 5, 5, 0, 0,   // 70-79
+  4, 4, 4, 0, 0, 5, 5, 0, 0, 0,   // 80-89
+  0, 0, 0, 0, 0, 6, 6, 0, 0, 6,   // 90-99
+};
+
+// 41 icons: 44288 bytes packed from 116744 (37.9%)
@@ -0,0 +1,173 @@
+#include "json_cursor.h"
+
+// Refill from whatever the socket already has, or block (with the stream
+// timeout) for a single byte when it has nothing yet
+bool JsonCursor::fill() {
+  int n = src.available();
+  if (n <= 0) n = 1;
+  if (n > (int)sizeof(buf)) n = sizeof(buf);
+  end = (uint8_t)src.readBytes((char*)buf, n);
+  pos = 0;
+  return end > 0;
+}
+
+int JsonCursor::peekByte() {
+  if (pos == end && !fill()) return -1;
+  return buf[pos];
+}
+
+int JsonCursor::getByte() {
+  if (pos == end && !fill()) return -1;
+  return buf[pos++];
+}
+
+void JsonCursor::skipSpace() {
+  int c;
+  while ((c = peekByte()) == ' ' || c == '\n' || c == '\r' || c == '\t') pos++;
+}
+
+bool JsonCursor::beginObject() {
+  skipSpace();
+  if (peekByte() != '{') {
+    skipValue();
+    return false;
+  }
+  pos++;
+  return true;
+}
+
+bool JsonCursor::beginArray() {
+  skipSpace();
+  if (peekByte() != '[') {
+    skipValue();
+    return false;
+  }
+  pos++;
+  return true;
+}
+
+bool JsonCursor::nextKey(char* key, size_t cap, size_t& len) {
+  if (error) return false;
+  skipSpace();
+  int c = getByte();
+  if (c == ',') {
+    skipSpace();
+    c = getByte();
+  }
+  if (c == '}') return false;
+  if (c != '"') {
+    error = true;
+    return false;
+  }
+
+  len = readString(key, cap);
+  skipSpace();
+  if (getByte() != ':') {
+    error = true;
+    return false;
+  }
+  return true;
+}
+
+bool JsonCursor::nextElement() {
+  if (error) return false;
+  skipSpace();
+  int c = peekByte();
+  if (c == ',') {
+    pos++;
+    skipSpace();
+    c = peekByte();
+  }
+  if (c == ']') {
+    pos++;
+    return false;
+  }
+  if (c < 0) error = true;
+  return !error;
+}
+
+size_t JsonCursor::readString(char* out, size_t cap) {
+  size_t len = 0;
+  int c;
+  while ((c = getByte()) >= 0 && c != '"') {
+    if (c == '\\') c = getByte();  // keep the escaped byte as is; names and codes are ASCII
+    if (c < 0) break;
+    if (out && len + 1 < cap) out[len] = (char)c;
+    len++;
+  }
+  if (c < 0) error = true;
+  if (out && cap) out[len < cap ? len : cap - 1] = '\0';
+  return len;
+}
+
+bool JsonCursor::readNumber(char* out, size_t cap) {
+  skipSpace();
+  int c = peekByte();
+  if (c != '-' && (c < '0' || c > '9')) {
+    skipValue();
+    return false;
+  }
+
+  size_t len = 0;
+  while ((c = peekByte()) >= 0 &&
+         ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+    if (len + 1 < cap) out[len++] = (char)c;
+    pos++;
+  }
+  out[len] = '\0';
+  return true;
+}
+
+void JsonCursor::readInt(int& out) {
+  char num[24];
+  if (!readNumber(num, sizeof(num))) return;
+  // Fractions truncate, like ArduinoJson's as<int>()
+  out = strpbrk(num, ".eE") ? (int)strtof(num, nullptr) : (int)strtol(num, nullptr, 10);
+}
+
+void JsonCursor::readUint32(uint32_t& out) {
+  char num[24];
+  if (readNumber(num, sizeof(num)) && num[0] != '-') out = strtoul(num, nullptr, 10);
+}
+
+void JsonCursor::readFloat(float& out) {
+  char num[24];
+  if (readNumber(num, sizeof(num))) out = strtof(num, nullptr);
+}
+
+void JsonCursor::readChar(char& out) {
+  skipSpace();
+  if (peekByte() != '"') {
+    skipValue();
+    return;
+  }
+  pos++;
+  char first[2];
+  if (readString(first, sizeof(first)) > 0) out = first[0];
+}
+
+// Strings are skipped whole (brackets inside them do not count), containers
+// by depth, bare literals up to the next delimiter
+void JsonCursor::skipValue() {
+  skipSpace();
+  int depth = 0;
+  do {
+    int c = getByte();
+    if (c < 0) {
+      error = true;
+      return;
+    }
+    if (c == '"') {
+      readString(nullptr, 0);
+    } else if (c == '{' || c == '[') {
+      depth++;
+    } else if (c == '}' || c == ']') {
+      depth--;
+    } else if (depth == 0) {
+      while ((c = peekByte()) >= 0 && c != ',' && c != '}' && c != ']' &&
+             c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+        pos++;
+      }
+    }
+  } while (depth > 0 && !error);
+}
@@ -1,5 +1,5 @@
 #include <Arduino.h>
-#include <GxEPD2_BW.h>
+#include <gdey/GxEPD2_750_GDEY075T7.h>
 #include <WiFi.h>
 #include <WebServer.h>
 #include <Preferences.h>
@@ -9,7 +9,9 @@
 #include <Fonts/FreeMonoBold24pt7b.h>
 #include <Fonts/FreeMonoBold12pt7b.h>
 #include "api.h"
+#include "epd_frame.h"
 #include "icon.h"
+#include "widgets.h"
 
 
 // ------------------------------- PINS ----------------------------- //
@@ -37,28 +39,25 @@ bool apModeActive = false;
 
 // ------------------------------- LINKS ----------------------------- //
 static const char* TIMEZONE = "EST5EDT,M3.2.0/2,M11.1.0/2";
-const char* MTA_URL = "https://inkchat-ruby.vercel.app/api/mta";
-const char* WEATHER_URL = "https://inkchat-ruby.vercel.app/api/weather";
+const char* MTA_URL = "https://inkchat-ruby.vercel.app/api/mta?fmt=bin&v=2";      // compact binary body, arrival epochs
+const char* WEATHER_URL = "https://inkchat-ruby.vercel.app/api/weather?fmt=bin";  // (JSON if the proxy is older)
+const char* BUNDLE_URL = "https://inkchat-ruby.vercel.app/api/bundle?fmt=bin&v=2";  // both at once
+// Push updates need a long-lived connection, which the Vercel function cannot
+// hold; point this at local_server, e.g. "http://192.168.1.20:8787/mta/stream"
+const char* MTA_STREAM_URL = "";
 
 // ------------------------------- FONT ----------------------------- //
 static const GFXfont* FONT = &FreeMonoBold9pt7b;
 static const GFXfont* FONT_BIG = &FreeMonoBold24pt7b;
 static const GFXfont* FONT_MED = &FreeMonoBold12pt7b;
 
-// ------------------------------- MTA (storage) ----------------------------- //
-static const int MAX_ARR = 5;
-char northTrain[MAX_ARR] = {'?','?','?','?','?'};
-int  northMin[MAX_ARR]   = {0,0,0,0,0};
-char southTrain[MAX_ARR] = {'?','?','?','?','?'};
-int  southMin[MAX_ARR]   = {0,0,0,0,0};
-
-// ------------------------------- WEATHER (storage) -------------------------- //
-int   weatherStartIndex = 0;
-int   weatherCount = 0;
-int   wTemp[WEATHER_MAX] = {0};
-float wPrec[WEATHER_MAX] = {0};
-int   wCode[WEATHER_MAX];  // Initialized to -1 in setup()
-int   wDay[WEATHER_MAX]  = {0};
+// ------------------------------- DATA ------------------------------------ //
+// Render-side copies of the latest snapshots published by the fetch task
+// (see api.h). Only loop() and the draw functions below touch these.
+static MtaSnapshot mta = {0, 0, false,
+                          {'?','?','?','?','?'}, {0,0,0,0,0},
+                          {'?','?','?','?','?'}, {0,0,0,0,0}};
+static WeatherSnapshot wx;  // cleared to "no data" in setup()
 
 // ------------------------------- SCREENS ----------------------------- //
 enum Screen : uint8_t { SCREEN_TIME, SCREEN_MTA, SCREEN_WEATHER };
@@ -91,9 +90,6 @@ static const int ICON_X   = 20;
 // Route area start (right side of icon)
 static const int ROUTE_X  = 220;
 
-// Dot geometry
-static const int DOT_R = 6;
-
 // Hard-coded dot positions (5 dots)
 static const int DOT_X[MAX_ARR] = {330, 430, 510, 620, 730};
 
@@ -109,10 +105,6 @@ static const int ROUTE_Y_BOT = 380;
 static const int ICON_Y_TOP = 60;
 static const int ICON_Y_BOT = 300;
 
-// Text offsets around dot
-static const int TRAIN_TEXT_DY = -18;
-static const int MIN_TEXT_DY   =  26;
-
 // WEATHER layout icon sizes
 static const int ICON_SIDE_W = 160;  // Left and right blocks
 static const int ICON_SIDE_H = 160;
@@ -138,9 +130,20 @@ static const int ROWS_Y = 280;
 // Button press navigation: 1 press = next screen, 2 presses = previous screen
 static const unsigned long DOUBLE_PRESS_WINDOW_MS = 1200;  // 1200ms window for double press
 // ---------------- 7.5" 800x480 Good Display (UC8179) -------------- //
-GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> display(
-  GxEPD2_750_GDEY075T7(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)
-);
+GxEPD2_750_GDEY075T7 epd(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY);
+// Every screen draws its whole picture here; update() sends only what
+// changed since the last refresh (see epd_frame.h)
+EpdFrame display(epd);
+
+// Frame and shadow are static, so a build without room for them fails to
+// link instead of booting to a blank screen. Only the optional render-ahead
+// buffer comes from the heap.
+static const int16_t FRAME_ROWS =
+    EPD_PAGE_ROWS > 0 && EPD_PAGE_ROWS < GxEPD2_750_GDEY075T7::HEIGHT ? EPD_PAGE_ROWS
+                                                                      : GxEPD2_750_GDEY075T7::HEIGHT;
+static uint8_t frameStore[EpdFrame::bandBytes(GxEPD2_750_GDEY075T7::WIDTH, FRAME_ROWS)];
+static uint8_t shadowStore[EpdFrame::bandBytes(GxEPD2_750_GDEY075T7::WIDTH,
+                                               GxEPD2_750_GDEY075T7::HEIGHT)];
 
 // --------------------------- SETUP FUNCTION ----------------------- //
 void displayInit();
@@ -163,18 +166,18 @@ void updateTimePartialEveryMinute();
 
 void drawMTAScreen();
 void updateMtaDotsPartial();
+void updateMtaCountdown();
 
 void drawWeatherScreen();
 void updateWeatherPartial();
 
-static void drawMtaHalf(int y0, bool isNorth);
+static void mtaArrivalsNow(bool isNorth, char* train, int* minutes);
+static void showScreen(WidgetScreen& screen, int nav);
+static void cleanupWhenIdle();
 
 static int safeIdx(int idx);
 static bool hasIdx(int idx);
 static int dayBaseIndexFromPage(uint8_t page);
-static void draw1bppWhiteOnBlack(int x, int y, int w, int h, const unsigned char* bmp);
-static void drawTopIconBlock(int x, int y, int w, int h, int dayBaseIdx, bool emptySlot, bool forceMoon);
-static void drawSixHourRows(int startIdx);
 static void handleSerialEncoder();
 static int8_t read_rotary();
 static void goToScreen(Screen s);
@@ -190,13 +193,25 @@ void setup() {
   pinMode(ENC_CLK, INPUT_PULLUP);
   pinMode(ENC_DT, INPUT_PULLUP);
   
-  // Initialize all weather codes to -1 (no data)
-  for (int i = 0; i < WEATHER_MAX; i++) {
-    wCode[i] = -1;
-  }
+  // Every hour reads as "no data" until the first weather snapshot arrives
+  wx.hours.clear();
   
   displayInit();
-  drawBootLogo();
+
+  // Last saved data first: it needs no network, only the timezone for its stamp
+  setenv("TZ", TIMEZONE, 1);
+  tzset();
+  snapshotsRestore();
+  mtaLatest(mta);
+  weatherLatest(wx);
+
+  if (mta.seq) {
+    currentScreen = SCREEN_MTA;
+    navState = 1;
+    drawMTAScreen();
+  } else {
+    drawBootLogo();
+  }
   
   if (wifiConnect()) {
     timeSync();
@@ -204,7 +219,9 @@ void setup() {
 
   // Only draw time screen if not in AP mode (WiFi setup)
   if (!apModeActive) {
-    drawTimeScreen();
+    fetchTaskStart();
+    fetchRequest(FEED_MTA | FEED_WEATHER);  // warm both snapshots before the first rotation
+    if (currentScreen == SCREEN_TIME) drawTimeScreen();
   }
 }
 
@@ -257,8 +274,16 @@ void loop() {
       }
       Serial.println("Pin debug complete.");
     }
+    else if (ch == 'F' || ch == 'f') {
+      Serial.println("[SERIAL] FLIGHT_RECORDER command recognized");
+      fetchRecorderDump(Serial);
+    }
+    else if (ch == 'E' || ch == 'e') {
+      Serial.println("[SERIAL] EPD_STATS command recognized");
+      display.printStats(Serial);
+    }
     else {
-      Serial.println("[SERIAL] Unknown command. Use 'W' to clear WiFi or 'D' for pin debug.");
+      Serial.println("[SERIAL] Unknown command. Use 'W' to clear WiFi, 'D' for pin debug, 'F' for fetch timings or 'E' for refresh stats and ghosting counts.");
     }
   }
 
@@ -276,20 +301,16 @@ void loop() {
     if (currentScreen == SCREEN_TIME) {
       currentScreen = SCREEN_MTA;
 
+      fetchRequest(FEED_MTA);
       drawMTAScreen();
-      if (mtaFetch()) {
-        updateMtaDotsPartial();
-      }
     }
     else if (currentScreen == SCREEN_MTA) {
       currentScreen = SCREEN_WEATHER;
 
-      weatherFetch();
-      drawWeatherScreen();
-
+      fetchRequest(FEED_WEATHER);
       weatherPage = 0;
       lastWeatherFlipMs = now;
-      updateWeatherPartial();
+      drawWeatherScreen();
     }
     else if (currentScreen == SCREEN_WEATHER) {
       currentScreen = SCREEN_TIME;
@@ -297,10 +318,27 @@ void loop() {
     }
   }
 
+  // New data from the fetch task: redraw only the region that shows it,
+  // or the whole screen once if the "as of" stamp has to go
+  bool mtaWasSaved = mta.restored;
+  if (mtaLatest(mta) && currentScreen == SCREEN_MTA) {
+    if (mtaWasSaved) drawMTAScreen();
+    else updateMtaDotsPartial();
+  }
+  bool weatherWasSaved = wx.restored;
+  if (weatherLatest(wx) && currentScreen == SCREEN_WEATHER) {
+    if (weatherWasSaved) drawWeatherScreen();
+    else updateWeatherPartial();
+  }
+
   if (currentScreen == SCREEN_TIME) {
     updateTimePartialEveryMinute();
   }
 
+  if (currentScreen == SCREEN_MTA) {
+    updateMtaCountdown();
+  }
+
   if (!manualMode && currentScreen == SCREEN_WEATHER) {
     if (now - lastWeatherFlipMs >= WEATHER_FLIP_EVERY_MS) {
       lastWeatherFlipMs = now;
@@ -309,30 +347,32 @@ void loop() {
     }
   }
 
+  cleanupWhenIdle();
+
   delay(50);
 }
 
 
 // --------------------------- DISPLAY INIT -------------------------- //
 void displayInit() {
-  display.init(115200);
+  display.setBuffers(frameStore, shadowStore);
+  display.begin(115200);  // cannot fail with the static buffers
   display.setRotation(0);
-  display.setFullWindow();
   Serial.println("Display Good");
 }
 
 // --------------------------- BOOT LOGO ANIMATION ------------------- //
+static void bootLogo(EpdFrame& f, int) {
+  f.setFont(FONT_BIG);
+  f.setTextColor(GxEPD_BLACK);
+
+  f.fillScreen(GxEPD_WHITE);
+  f.setCursor(280, 240);
+  f.print("INK-HAT");
+}
+
 void drawBootLogo() {
-  display.setFullWindow();
-  display.setFont(FONT_BIG);
-  display.setTextColor(GxEPD_BLACK);
-  
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setCursor(280, 240);
-    display.print("INK-HAT");
-  } while (display.nextPage());
+  display.drawPaged(bootLogo, 0, true);
   
   delay(1000);  // Hold the splash for 1 second
 }
@@ -366,6 +406,36 @@ bool wifiConnect() {
   */
 }
 
+// Connection test screen; the status band under the header changes
+enum : int { WIFI_CONNECTING, WIFI_CONNECTED, WIFI_RETRYING, WIFI_FAILED };
+
+static void wifiStatus(EpdFrame& f, int state) {
+  f.fillScreen(GxEPD_WHITE);
+  f.setTextColor(GxEPD_BLACK);
+  f.setFont(FONT);
+
+  f.setCursor(330, 20);
+  f.print("SETUP START");
+  f.drawLine(0, 30, 799, 30, GxEPD_BLACK);
+
+  f.setCursor(300, 220);
+  f.print("Testing Connection");
+
+  if (state == WIFI_CONNECTING) {
+    f.setCursor(320, 245);
+    f.print("Connecting...");
+  } else if (state == WIFI_CONNECTED) {
+    f.setCursor(345, 245);
+    f.print("Success");
+  } else if (state == WIFI_RETRYING) {
+    f.setCursor(290, 245);
+    f.print("Failed. Trying Again");
+  } else {
+    f.setCursor(275, 245);
+    f.print("Failed. Bro Wifi is Cooked.");
+  }
+}
+
 // Connect to WiFi in STA mode with timeout and display feedback
 bool connectWiFiSTA(const char* ssid, const char* pass, uint32_t timeoutMs) {
   WiFi.mode(WIFI_STA);
@@ -373,24 +443,7 @@ bool connectWiFiSTA(const char* ssid, const char* pass, uint32_t timeoutMs) {
   WiFi.disconnect(true, true);
   delay(200);
 
-  display.setFullWindow();
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-    display.setFont(FONT);
-
-    display.setCursor(330, 20);
-    display.print("SETUP START");
-    display.drawLine(0, 30, 799, 30, GxEPD_BLACK);
-
-    display.setCursor(300, 220);
-    display.print("Testing Connection");
-    display.setCursor(320, 245);
-    display.print("Connecting...");
-  } while (display.nextPage());
-
-  display.setPartialWindow(0, 200, 800, 120);
+  display.drawPaged(wifiStatus, WIFI_CONNECTING, true);
 
   for (int attempt = 1; attempt <= 2; attempt++) {
     WiFi.begin(ssid, pass);
@@ -404,28 +457,9 @@ bool connectWiFiSTA(const char* ssid, const char* pass, uint32_t timeoutMs) {
 
     bool ok = WiFi.isConnected();
 
-    display.firstPage();
-    do {
-      display.fillScreen(GxEPD_WHITE);
-      display.setTextColor(GxEPD_BLACK);
-      display.setFont(FONT);
-
-      display.setCursor(300, 220);
-      display.print("Testing Connection");
-
-      if (ok) {
-        display.setCursor(345, 245);
-        display.print("Success");
-      } else {
-        if (attempt < 2) {
-          display.setCursor(290, 245);
-          display.print("Failed. Trying Again");
-        } else {
-          display.setCursor(275, 245);
-          display.print("Failed. Bro Wifi is Cooked.");
-        }
-      }
-    } while (display.nextPage());
+    // Only the status band differs, so only it is sent
+    int state = ok ? WIFI_CONNECTED : attempt < 2 ? WIFI_RETRYING : WIFI_FAILED;
+    display.drawPaged(wifiStatus, state);
 
     if (ok) {
       Serial.println(WiFi.localIP());
@@ -471,31 +505,23 @@ String getTime() {
   return String(buf);
 }
 
-void drawTimeScreen() {
-  display.setFullWindow();
-
-  String timeStr = getTime();
+// ------------------------------- TIME SCREEN ----------------------------- //
+// Screens are fixed widget lists (see widgets.h); on a data change only the
+// widgets that show it are drawn again
+static Label timeTitle({355, 4, 60, 22}, 360, 20, FONT, "TIME");
+static Rule headerRule(0, 30, 799, 30);   // shared, it never changes
+static Label timeGreeting({285, 108, 250, 32}, 290, 130, FONT_MED, "Hello, PitchFest!");
 
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
+static void clockText(LabelText& out, int) {
+  strlcpy(out.text, getTime().c_str(), sizeof(out.text));
+}
+static Label timeClock({240, 180, 300, 90}, 250, 250, FONT_BIG, clockText, 0, 2);
 
-    display.setFont(FONT);
-    display.setCursor(360, 20);
-    display.print("TIME");
-    display.drawLine(0, 30, 799, 30, GxEPD_BLACK);
+static Widget* const TIME_WIDGETS[] = {&timeTitle, &headerRule, &timeGreeting, &timeClock};
+static WidgetScreen timeScreen(TIME_WIDGETS, sizeof(TIME_WIDGETS) / sizeof(TIME_WIDGETS[0]));
 
-    display.setFont(FONT_MED);
-    display.setCursor(290, 130);
-    display.print("Hello, PitchFest!");
-    
-    display.setFont(FONT_BIG);
-    display.setTextSize(2);  // make time larger
-    display.setCursor(250, 250);
-    display.print(timeStr);
-    display.setTextSize(1);  // reset size for other text
-  } while (display.nextPage());
+void drawTimeScreen() {
+  showScreen(timeScreen, 0);
 }
 
 void updateTimePartialEveryMinute() {
@@ -508,173 +534,110 @@ void updateTimePartialEveryMinute() {
   if (currentMinute == lastMinute) return;
   lastMinute = currentMinute;
 
-  // Partial window = the big box region (plus a little padding)
-  display.setPartialWindow(195, 135, 410, 210);
-
-  String t = getTime();
-
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-    
-    // Redraw the time (big)
-    display.setFont(FONT_BIG);
-    display.setTextSize(2);  // larger time readout
-    display.setCursor(250, 250);
-    display.print(t);
-    display.setTextSize(1);
-
-  } while (display.nextPage());
+  // Only the clock is redrawn, and only the digits that changed are sent
+  timeScreen.update(display);
 }
 
-static void drawMtaHalf(int y0, bool isNorth)
-{
-  // Title
-  display.setFont(FONT);
-  display.setTextColor(GxEPD_BLACK);
+// Header note while a screen shows data restored from flash at boot,
+// empty otherwise. arg = FEED_MTA or FEED_WEATHER.
+static void savedStamp(LabelText& out, int feed) {
+  bool restored = feed == FEED_MTA ? mta.restored : wx.restored;
+  uint32_t fetchedAt = feed == FEED_MTA ? mta.fetchedAt : wx.fetchedAt;
+  if (!restored) return;
 
-  if (isNorth) {
-    display.setCursor(20, y0 + 55);
-    display.print("Northbound");
-  } else {
-    display.setCursor(20, y0 + 55);
-    display.print("Southbound");
-  }
-
-  // Icon placeholder box (160x160) with train icon
-  int iconY;
-  if (isNorth) {
-    iconY = ICON_Y_TOP;
-  } else {
-    iconY = ICON_Y_BOT;
-  }
-  display.drawRect(ICON_X, iconY, ICON_W, ICON_H, GxEPD_BLACK);
-  
-  // Draw train icon inside the box
-  const unsigned char* trainIcon = isNorth ? train_north : train_south;
-  if (trainIcon != nullptr) {
-    // Center the 160x160 icon in the 160x160 box
-    draw1bppWhiteOnBlack(ICON_X, iconY, ICON_W, ICON_H, trainIcon);
-  }
-
-  // ------------------- Route "station" marker like: *\  \_  -------------------
-  int routeY;
-  if (isNorth) {
-    routeY = ROUTE_Y_TOP;
-  } else {
-    routeY = ROUTE_Y_BOT;
+  if (fetchedAt == 0) {
+    strlcpy(out.text, "saved data", sizeof(out.text));
+    return;
   }
 
-  // Star (station) as text
-  display.setFont(FONT);
-  display.setCursor(ROUTE_X, routeY - 10);
-  display.print("*");
-
-  // Slanted "\" from star down-right
-  display.drawLine(ROUTE_X + 8, routeY - 8, ROUTE_X + 28, routeY + 12, GxEPD_BLACK);
+  time_t t = fetchedAt;
+  struct tm tm_info;
+  localtime_r(&t, &tm_info);
+  snprintf(out.text, sizeof(out.text), "as of %02d:%02d", tm_info.tm_hour, tm_info.tm_min);
+}
 
-  // Small "_" (horizontal) after the slash
-  display.drawLine(ROUTE_X + 28, routeY + 12, ROUTE_X + 55, routeY + 12, GxEPD_BLACK);
+// ------------------------------- MTA SCREEN ------------------------------ //
+// Arrivals as of right now. With arrival times and a set clock the minutes
+// are recounted here, and trains that already left drop off the front.
+// Without them, the minutes from the last fetch are shown as they came.
+static void mtaArrivalsNow(bool isNorth, char* train, int* minutes) {
+  const char* t = isNorth ? mta.northTrain : mta.southTrain;
+  const int* m = isNorth ? mta.northMin : mta.southMin;
+  const uint32_t* at = isNorth ? mta.northAt : mta.southAt;
 
-  // Main track line to the first dot
-  display.drawLine(ROUTE_X + 55, routeY + 12, DOT_X[0] - DOT_R - 8, routeY + 12, GxEPD_BLACK);
+  time_t now = time(nullptr);
+  bool clockSet = now > 1700000000;
 
-  // Dots + connecting segments (like ". ____ . ____ .")
+  int n = 0;
   for (int i = 0; i < MAX_ARR; i++) {
-    int x = DOT_X[i];
-    int y = routeY + 12;
-
-    // Dot (.)
-    display.drawCircle(x, y, DOT_R, GxEPD_BLACK);
-
-    // Connect to next dot
-    if (i < MAX_ARR - 1) {
-      display.drawLine(x + DOT_R, y, DOT_X[i + 1] - DOT_R, y, GxEPD_BLACK);
-    }
-
-    // Train letter above dot + minutes below dot
-    display.setFont(FONT);
-
-    if (isNorth) {
-      // Train above
-      display.setCursor(x - 3, y + TRAIN_TEXT_DY);
-      display.print(northTrain[i]);
-
-      // Minutes below
-      display.setCursor(x - 10, y + MIN_TEXT_DY);
-      display.print(northMin[i]);
-    } else {
-      display.setCursor(x - 3, y + TRAIN_TEXT_DY);
-      display.print(southTrain[i]);
-
-      display.setCursor(x - 10, y + MIN_TEXT_DY);
-      display.print(southMin[i]);
+    int mins = m[i];
+    if (at[i] && clockSet) {
+      long secs = (long)at[i] - (long)now;
+      if (secs < -30) continue;          // same rounding as the proxy: gone below -0.5 min
+      mins = (int)((secs + 30) / 60);
     }
+    train[n] = t[i];
+    minutes[n] = mins;
+    n++;
+  }
+  for (; n < MAX_ARR; n++) {
+    train[n] = '?';
+    minutes[n] = -1;
   }
 }
 
-void drawMTAScreen()
-{
-  display.setFullWindow();
-
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-    display.setFont(FONT);
+// Header top centered-ish (hard-coded)
+static Label mtaTitle({365, 4, 130, 22}, 370, 20, FONT, "THE N TRAIN");
+static Label mtaStamp({655, 4, 145, 22}, 660, 20, FONT, savedStamp, FEED_MTA);
+static Rule mtaSplit(0, 239, 799, 239);   // across the middle
 
-    // Header top centered-ish (hard-coded)
-    display.setCursor(370, 20);
-    display.print("THE N TRAIN");
-    display.drawLine(0, 30, 799, 30, GxEPD_BLACK);
+// Top half (Northbound)
+static Label northTitle({15, TOP_Y0 + 38, 120, 22}, 20, TOP_Y0 + 55, FONT, "Northbound");
+static Icon northIcon({ICON_X, ICON_Y_TOP, ICON_W, ICON_H}, &train_north, true);
+static DotTrack northTrack(ROUTE_X, ROUTE_Y_TOP, DOT_X, true, mtaArrivalsNow, FONT);
 
-    // Split line across middle (horizontal)
-    display.drawLine(0, 239, 799, 239, GxEPD_BLACK);
+// Bottom half (Southbound)
+static Label southTitle({15, BOT_Y0 + 38, 120, 22}, 20, BOT_Y0 + 55, FONT, "Southbound");
+static Icon southIcon({ICON_X, ICON_Y_BOT, ICON_W, ICON_H}, &train_south, true);
+static DotTrack southTrack(ROUTE_X, ROUTE_Y_BOT, DOT_X, false, mtaArrivalsNow, FONT);
 
-    // Top half (Northbound)
-    drawMtaHalf(TOP_Y0, true);
+static Widget* const MTA_WIDGETS[] = {
+  &mtaTitle, &headerRule, &mtaStamp, &mtaSplit,
+  &northTitle, &northIcon, &northTrack,
+  &southTitle, &southIcon, &southTrack
+};
+static WidgetScreen mtaScreen(MTA_WIDGETS, sizeof(MTA_WIDGETS) / sizeof(MTA_WIDGETS[0]));
 
-    // Bottom half (Southbound)
-    drawMtaHalf(BOT_Y0, false);
-
-  } while (display.nextPage());
+void drawMTAScreen()
+{
+  showScreen(mtaScreen, 1);
 }
 
-// ------------------- PARTIAL UPDATE: ONLY THE ROUTE/DOTS AREA (both halves) -------------------
+// ------------------- PARTIAL UPDATE: WHATEVER MOVED ON THE ROUTES -------------------
 void updateMtaDotsPartial() {
-  // Route area bounds (covers both halves route area, not headers, not icon boxes)
-  // X: start at ROUTE_X-10, width to end
-  // Y: from top route band down to bottom route band region
-  const int PX = ROUTE_X - 10;
-  const int PY = 70;  // moved up to include the middle line at Y=239
-  const int PW = SCREEN_W - PX;
-  const int PH = SCREEN_H - PY - 20;
-
-  display.setPartialWindow(PX, PY, PW, PH);
-
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-
-    // Redraw the route + dots + text for both halves (inside the partial region)
-    drawMtaHalf(TOP_Y0, true);
-    drawMtaHalf(BOT_Y0, false);
-
-  } while (display.nextPage());
+  mtaScreen.update(display);
+}
+
+// Between fetches the minutes tick down on the device. Polling the tracks is
+// cheap; nothing is drawn or sent until a label actually changes.
+void updateMtaCountdown() {
+  static unsigned long lastCheckMs = 0;
+  if (millis() - lastCheckMs < 1000) return;
+  lastCheckMs = millis();
+
+  updateMtaDotsPartial();
 }
 
 // --------------------------- WEATHER SCREEN ------------------------ //
 static int safeIdx(int idx) {
-  if (weatherCount <= 0) return 0;
+  if (wx.count <= 0) return 0;
   if (idx < 0) return 0;
-  if (idx >= weatherCount) return weatherCount - 1;
+  if (idx >= wx.count) return wx.count - 1;
   return idx;
 }
 
 static bool hasIdx(int idx) {
-  return (idx >= 0 && idx < weatherCount);
+  return (idx >= 0 && idx < wx.count);
 }
 
 static int dayBaseIndexFromPage(uint8_t page) {
@@ -683,237 +646,153 @@ static int dayBaseIndexFromPage(uint8_t page) {
   else if (page == 1) dayOffset = 1;
   else dayOffset = 2;
 
-  return safeIdx(weatherStartIndex + (dayOffset * 24));
+  return safeIdx(wx.startIndex + (dayOffset * 24));
 }
 
-// Helper: Draw 1bpp bitmap as BLACK on WHITE
-static void draw1bppWhiteOnBlack(int x, int y, int w, int h, const unsigned char* bmp) {
-  if (bmp == nullptr) return;
-  display.drawBitmap(x, y, bmp, w, h, GxEPD_BLACK, GxEPD_WHITE);
+// Day in each icon column (left, middle, right) per weatherPage, -1 = empty
+// page 0: EMPTY | TODAY | TOMORROW
+// page 1: TODAY | TOMORROW | FOLLOW
+// page 2: TOMORROW | FOLLOW | EMPTY
+static const int8_t PAGE_DAYS[3][3] = {{-1, 0, 1}, {0, 1, 2}, {1, 2, -1}};
+
+// Day labels underneath icons, offsets from the column's icon x and labelY
+struct DayLabel {
+  const char* text;
+  int8_t dx, dy;
+};
+static const DayLabel DAY_LABELS[3][3] = {
+  {{"Yesterday", 30, -20}, {"Today", 80, 20},         {"Tomorrow", 50, -10}},
+  {{"Today", 50, -10},     {"Tomorrow", 45, 30},      {"Following Day", 10, -20}},
+  {{"Tomorrow", 40, -10},  {"Following Day", 15, 0},  {"The Third Morrow", 0, -15}}
+};
+static const int COLUMN_X[3] = {ICON_L_X, ICON_M_X, ICON_R_X};
+static const int LABEL_Y = 225;
+
+// Midday-ish hour stands for the whole day; empty columns and days without
+// data show the unknown icon
+static const PackedBitmap* dayIcon(int col) {
+  IconSize size = col == 1 ? ICON_SIZE_200 : ICON_SIZE_160;
+  int day = PAGE_DAYS[weatherPage][col];
+  int midIdx = day * 24 + 12;
+  if (day < 0 || !hasIdx(midIdx)) return weatherIcon(size, -1, 0);
+  return weatherIcon(size, wx.hours.weatherCode(midIdx), wx.hours.isDay(midIdx));
 }
 
-static void drawTopIconBlock(int x, int y, int w, int h, int dayBaseIdx, bool emptySlot, bool forceMoon) {
-  // If forceMoon is true, show unknown icon (no data)
-  if (forceMoon) {
-    // Clear the area first
-    display.fillRect(x, y, w, h, GxEPD_WHITE);
-    
-    const unsigned char* bmp;
-    if (w == 200 && h == 200) {
-      bmp = unknown_200;
-    } else if (w == 160 && h == 160) {
-      bmp = unknown_160;
-    } else {
-      bmp = unknown_200;
-    }
-    
-    if (bmp != nullptr) {
-      draw1bppWhiteOnBlack(x, y, w, h, bmp);
-    }
-    return;
-  }
-
-  // Pick representative hour for day block (midday-ish: +12 hours)
-  int midIdx = dayBaseIdx + 12;
-
-  // Empty slot or out-of-range: show unknown icon instead of blank
-  if (emptySlot || !hasIdx(midIdx)) {
-    display.fillRect(x, y, w, h, GxEPD_WHITE);
-    
-    const unsigned char* bmp;
-    if (w == 200 && h == 200) {
-      bmp = unknown_200;
-    } else if (w == 160 && h == 160) {
-      bmp = unknown_160;
-    } else {
-      bmp = unknown_200;
-    }
-    
-    if (bmp != nullptr) {
-      draw1bppWhiteOnBlack(x, y, w, h, bmp);
-    }
-    return;
-  }
-
-  // Get correct-sized bitmap based on block dimensions
-  const unsigned char* bmp;
-  if (w == 200 && h == 200) {
-    bmp = mapWeatherIcon200(wCode[midIdx], wDay[midIdx]);
-    draw1bppWhiteOnBlack(x, y, w, h, bmp);
-  } else if (w == 160 && h == 160) {
-    bmp = mapWeatherIcon160(wCode[midIdx], wDay[midIdx]);
-    draw1bppWhiteOnBlack(x, y, w, h, bmp);
-  } else {
-    // Fallback to 200 if size doesn't match expected
-    bmp = mapWeatherIcon200(wCode[midIdx], wDay[midIdx]);
-    draw1bppWhiteOnBlack(x, y, w, h, bmp);
-  }
+static void dayLabel(LabelText& out, int col) {
+  const DayLabel& l = DAY_LABELS[weatherPage][col];
+  strlcpy(out.text, l.text, sizeof(out.text));
+  out.x = COLUMN_X[col] + l.dx;
+  out.y = LABEL_Y + l.dy;
 }
 
-static void drawSixHourRows(int startIdx) {
-  display.setFont(FONT);
-  display.setTextColor(GxEPD_BLACK);
-
-  // Horizontal tile layout settings
-  const int startX = 20;          // left margin for tiles area
-  const int startY = ROWS_Y;      // top margin (constant Y for all tiles)
-  const int tileW = 120;          // width of each tile
-  const int tileH = 120;          // height of each tile
-  const int gap = 10;             // horizontal gap between tiles
-  const int iconSize = 48;        // icon size (48x48)
-
-  // Offsets within the tile
-  const int timeOffsetX = 8;
-  const int timeOffsetY = 18;
-  const int iconOffsetY = 38;     // vertical position of icon top inside the tile
-  const int textOffsetX = 8;
-  const int textOffsetY = iconOffsetY + iconSize + 12; // below icon
-
-  const bool DEBUG_WEATHER_CARDS = false; // disable outlines
-
-  // Draw 6 tiles with 4-hour stepping
-  for (int i = 0; i < 6; i++) {
-    // Compute dataIndex: 4-hour steps (0, 4, 8, 12, 16, 20)
-    int dataIdx = startIdx + (i * 4);
-    
-    // Bounds check: skip if out of range
-    if (dataIdx < 0 || dataIdx >= WEATHER_MAX) continue;
-
-    // Horizontal placement: same Y, increment X per tile
-    int tileX = startX + i * (tileW + gap);
-    int tileY = startY;
-
-    // Draw box around the tile
-    display.drawRect(tileX, tileY, tileW, tileH, GxEPD_BLACK);
-
-    // LABEL: (i+1)*4 → 04:00, 08:00, 12:00, 16:00, 20:00, 24:00
-    int hoursAhead = (i + 1) * 4;
-    display.setCursor(tileX + timeOffsetX + 15, tileY + timeOffsetY);
-    char buf[6];
-    snprintf(buf, sizeof(buf), "%02d:00", hoursAhead);
-    display.print(buf);
-
-    // ICON (48x48, centered in tile)
-    const unsigned char* bmp = mapWeatherIcon48(wCode[dataIdx], wDay[dataIdx]);
-    int iconX = tileX + (tileW - iconSize) / 2;
-    int iconY = tileY + iconOffsetY;
-    draw1bppWhiteOnBlack(iconX, iconY - 10, iconSize, iconSize, bmp);
-
-    // TEMP + PRECIP
-    display.setCursor(tileX + textOffsetX - 10, tileY + textOffsetY);
-    display.print(wTemp[dataIdx]);
-    display.print("F ");
-    display.print(wPrec[dataIdx], 2);
-    display.print("in");
-  }
+// Six 4-hour tiles through the middle column's day
+static int tileFirstHour() {
+  return PAGE_DAYS[weatherPage][1] * 24;
 }
 
-void drawWeatherScreen() {
-  display.setFullWindow();
-
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-    display.setFont(FONT);
+static Label weatherTitle({340, 4, 85, 22}, 345, 20, FONT, "WEATHER");
+static Label weatherStamp({655, 4, 145, 22}, 660, 20, FONT, savedStamp, FEED_WEATHER);
+
+static Icon leftIcon({ICON_L_X, ICON_SIDE_Y, ICON_SIDE_W, ICON_SIDE_H}, dayIcon, 0);
+static Icon midIcon({ICON_M_X, ICON_MID_Y, ICON_MID_W, ICON_MID_H}, dayIcon, 1);
+static Icon rightIcon({ICON_R_X, ICON_SIDE_Y, ICON_SIDE_W, ICON_SIDE_H}, dayIcon, 2);
+
+static Label leftDay({ICON_L_X + 20, 190, 200, 72}, ICON_L_X, LABEL_Y, FONT, dayLabel, 0);
+static Label midDay({ICON_M_X + 5, 190, 200, 72}, ICON_M_X, LABEL_Y, FONT, dayLabel, 1);
+static Label rightDay({ICON_R_X - 10, 190, 200, 72}, ICON_R_X, LABEL_Y, FONT, dayLabel, 2);
+
+// Horizontal tiles: 20px margin, 120px tiles, 10px gaps
+static WeatherTile tile0(20,  ROWS_Y, 0, wx, tileFirstHour, FONT);
+static WeatherTile tile1(150, ROWS_Y, 1, wx, tileFirstHour, FONT);
+static WeatherTile tile2(280, ROWS_Y, 2, wx, tileFirstHour, FONT);
+static WeatherTile tile3(410, ROWS_Y, 3, wx, tileFirstHour, FONT);
+static WeatherTile tile4(540, ROWS_Y, 4, wx, tileFirstHour, FONT);
+static WeatherTile tile5(670, ROWS_Y, 5, wx, tileFirstHour, FONT);
+
+static Widget* const WEATHER_WIDGETS[] = {
+  &weatherTitle, &headerRule, &weatherStamp,
+  &leftIcon, &midIcon, &rightIcon,
+  &leftDay, &midDay, &rightDay,
+  &tile0, &tile1, &tile2, &tile3, &tile4, &tile5
+};
+static WidgetScreen weatherScreen(WEATHER_WIDGETS, sizeof(WEATHER_WIDGETS) / sizeof(WEATHER_WIDGETS[0]));
 
-    display.setCursor(345, 20);
-    display.print("WEATHER");
-    display.drawLine(0, 30, 799, 30, GxEPD_BLACK);
-  } while (display.nextPage());
-
-  updateWeatherPartial();
+void drawWeatherScreen() {
+  showScreen(weatherScreen, 2 + weatherPage);
 }
 
 void updateWeatherPartial() {
-  display.setPartialWindow(0, 35, 800, 445);
-
-  int baseToday    = 0;
-  int baseTomorrow = 24;
-  int baseFollow   = 48;
-
-  // default assignment (will be overridden)
-  int leftBase  = baseToday;
-  int midBase   = baseToday;
-  int rightBase = baseTomorrow;
-
-  bool leftEmpty  = false;
-  bool midEmpty   = false;
-  bool rightEmpty = false;
-
-  // page 0: EMPTY | TODAY | TOMORROW
-  // page 1: TODAY | TOMORROW | FOLLOW
-  // page 2: TOMORROW | FOLLOW | EMPTY
-  if (weatherPage == 0) {
-    leftEmpty = true;
-
-    midBase = baseToday;
-    rightBase = baseTomorrow;
-    if (!hasIdx(midBase + 12)) midEmpty = true;
-    if (!hasIdx(rightBase + 12)) rightEmpty = true;
+  weatherScreen.update(display);
+}
 
-  } else if (weatherPage == 1) {
-    leftBase  = baseToday;
-    midBase   = baseTomorrow;
-    rightBase = baseFollow;
+// --------------------------- RENDER-AHEAD -------------------------- //
+// While the panel refreshes (~1.2 s full, ~0.45 s partial), the screen most
+// likely to come next is drawn into the frame's back buffer (see epd_frame.h).
+// Screens are named by navState: 0=TIME, 1=MTA, 2..4=WEATHER page 0..2.
+static WidgetScreen& navScreen(int nav) {
+  if (nav == 0) return timeScreen;
+  if (nav == 1) return mtaScreen;
+  return weatherScreen;
+}
 
-    if (!hasIdx(leftBase + 12)) leftEmpty = true;
-    if (!hasIdx(midBase + 12))  midEmpty = true;
-    if (!hasIdx(rightBase + 12)) rightEmpty = true;
+static void renderNav(EpdFrame& f, int nav) {
+  uint8_t page = weatherPage;
+  if (nav >= 2) weatherPage = nav - 2;
+  navScreen(nav).render(f, true);
+  weatherPage = page;
+}
 
-  } else {
-    rightEmpty = true;
+// The current screen, polled beforehand: a paged frame runs this once per
+// band, and every band has to show the same data
+static void drawNav(EpdFrame& f, int nav) {
+  navScreen(nav).drawAll(f);
+}
 
-    leftBase = baseTomorrow;
-    midBase  = baseFollow;
+// Auto-rotation: TIME -> MTA -> WEATHER page 0 -> TIME. Manual: navState + 1.
+// -1 when the next screen uses the same widgets as this one (weather pages):
+// drawing it ahead would leave the widgets describing the back buffer while
+// this screen still gets partial updates.
+static int nextNavState(int nav) {
+  int next;
+  if (manualMode) next = (nav + 1) % 5;
+  else next = nav == 0 ? 1 : nav == 1 ? 2 : 0;
+  if (&navScreen(next) == &navScreen(nav)) return -1;
+  return next;
+}
 
-    if (!hasIdx(leftBase + 12)) leftEmpty = true;
-    if (!hasIdx(midBase + 12))  midEmpty = true;
+// Switch to a screen: a partial refresh, or a full one once the ghosting
+// budget is spent. If it was drawn ahead, only the widgets that changed since
+// then are drawn again. The next one is queued to be drawn during this
+// refresh.
+static void showScreen(WidgetScreen& screen, int nav) {
+  bool full = display.cleanupDue();
+  bool ahead = display.takeAhead(renderNav, nav);
+  if (ahead) screen.render(display, false);
+
+  int next = nextNavState(nav);
+  if (next >= 0) display.renderAhead(renderNav, next);
+  if (ahead) {
+    if (full) display.updateFull();
+    else display.update();
+    return;
   }
+  screen.pollAll();
+  display.drawPaged(drawNav, nav, full);
+}
 
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-
-    // page 0: left = moon (yesterday), page 2: right = moon (day after)
-    bool leftMoon = (weatherPage == 0);
-    bool rightMoon = (weatherPage == 2);
-
-    drawTopIconBlock(ICON_L_X, ICON_SIDE_Y, ICON_SIDE_W, ICON_SIDE_H, leftBase, leftEmpty, leftMoon);
-    drawTopIconBlock(ICON_M_X, ICON_MID_Y,  ICON_MID_W,  ICON_MID_H,  midBase,  midEmpty, false);
-    drawTopIconBlock(ICON_R_X, ICON_SIDE_Y, ICON_SIDE_W, ICON_SIDE_H, rightBase, rightEmpty, rightMoon);
-
-    // Day labels underneath icons
-    display.setFont(FONT);
-    display.setTextColor(GxEPD_BLACK);
-    const int labelY = 225;
-    
-    if (weatherPage == 0) {
-      display.setCursor(ICON_L_X + 30, labelY - 20);
-      display.print("Yesterday");
-      display.setCursor(ICON_M_X + 80, labelY + 20);
-      display.print("Today");
-      display.setCursor(ICON_R_X + 50, labelY - 10);
-      display.print("Tomorrow");
-    } else if (weatherPage == 1) {
-      display.setCursor(ICON_L_X + 50, labelY - 10);
-      display.print("Today");
-      display.setCursor(ICON_M_X + 45, labelY + 30);
-      display.print("Tomorrow");
-      display.setCursor(ICON_R_X + 10, labelY - 20);
-      display.print("Following Day");
-    } else {
-      display.setCursor(ICON_L_X + 40, labelY - 10);
-      display.print("Tomorrow");
-      display.setCursor(ICON_M_X + 15, labelY);
-      display.print("Following Day");
-      display.setCursor(ICON_R_X, labelY - 15);
-      display.print("The Third Morrow");
-    }
-
-    drawSixHourRows(midBase);
-  } while (display.nextPage());
+// ------------------------------ GHOSTING ----------------------------- //
+// Partial refreshes leave ghosting behind, so the frame keeps a budget for
+// them (EpdFrame::cleanupDue()). Once it's spent, the next screen switch is
+// a full refresh; if none comes first, the current screen is redrawn with
+// one after CLEANUP_IDLE_MS without any refresh, i.e. between minute ticks
+// and weather page flips rather than right after one.
+static const unsigned long CLEANUP_IDLE_MS = 5000;
+
+static void cleanupWhenIdle() {
+  if (!display.cleanupDue() || display.idleMs() < CLEANUP_IDLE_MS) return;
+  if (currentScreen == SCREEN_TIME) drawTimeScreen();
+  else if (currentScreen == SCREEN_MTA) drawMTAScreen();
+  else drawWeatherScreen();
 }
 
 static void applyNavState() {
@@ -923,15 +802,14 @@ static void applyNavState() {
     drawTimeScreen();
   } else if (navState == 1) {
     currentScreen = SCREEN_MTA;
+    fetchRequest(FEED_MTA);
     drawMTAScreen();
-    if (mtaFetch()) updateMtaDotsPartial();
   } else {
     currentScreen = SCREEN_WEATHER;
     weatherPage = navState - 2; // 0,1,2
-    weatherFetch();
-    drawWeatherScreen();
+    fetchRequest(FEED_WEATHER);
     lastWeatherFlipMs = millis();
-    updateWeatherPartial();
+    drawWeatherScreen();
   }
 }
 
@@ -943,15 +821,14 @@ static void goToScreen(Screen s) {
     drawTimeScreen();
   } else if (currentScreen == SCREEN_MTA) {
     navState = 1;
+    fetchRequest(FEED_MTA);
     drawMTAScreen();
-    if (mtaFetch()) updateMtaDotsPartial();
   } else { // SCREEN_WEATHER
     navState = 2; // reset to first weather page
-    weatherFetch();
-    drawWeatherScreen();
+    fetchRequest(FEED_WEATHER);
     weatherPage = 0;
     lastWeatherFlipMs = millis();
-    updateWeatherPartial();
+    drawWeatherScreen();
   }
 }
 
@@ -1361,6 +1238,42 @@ void handleClear() {
   ESP.restart();
 }
 
+// AP credentials and setup address
+static void apInfo(EpdFrame& f, int) {
+  f.fillScreen(GxEPD_WHITE);
+  f.setTextColor(GxEPD_BLACK);
+  f.setFont(FONT_BIG);
+
+  f.setCursor(250, 35);
+  f.print("WiFi Setup");
+  f.drawLine(10, 50, 790, 50, GxEPD_BLACK);      // Top
+  f.drawLine(10, 450, 790, 450, GxEPD_BLACK);    // Bottom
+  f.drawLine(10, 50, 10, 450, GxEPD_BLACK);      // Left
+  f.drawLine(790, 50, 790, 450, GxEPD_BLACK);    // Right
+
+
+  f.setFont(FONT_BIG);
+  f.setCursor(250, 100);
+  f.print("Connect to:");
+  f.setCursor(310, 140);
+  f.setFont(FONT_MED);
+  f.print(AP_SSID);
+
+  f.setFont(FONT_BIG);
+  f.setCursor(270, 220);
+  f.print("Password:");
+  f.setCursor(330, 260);
+  f.setFont(FONT_MED);
+  f.print(AP_PASS);
+
+  f.setFont(FONT_BIG);
+  f.setCursor(190, 340);
+  f.print("Visit in browser:");
+  f.setCursor(330, 380);
+  f.setFont(FONT_MED);
+  f.print("192.168.4.1");
+}
+
 // Start Access Point mode with web server
 void startAPMode() {
   apModeActive = true;
@@ -1379,43 +1292,7 @@ void startAPMode() {
   Serial.println(WiFi.softAPIP());
 
   // Display AP info on e-ink
-  display.setFullWindow();
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-    display.setFont(FONT_BIG);
-
-    display.setCursor(250, 35);
-    display.print("WiFi Setup");
-    display.drawLine(10, 50, 790, 50, GxEPD_BLACK);      // Top
-    display.drawLine(10, 450, 790, 450, GxEPD_BLACK);    // Bottom
-    display.drawLine(10, 50, 10, 450, GxEPD_BLACK);      // Left
-    display.drawLine(790, 50, 790, 450, GxEPD_BLACK);    // Right
-
-
-    display.setFont(FONT_BIG);
-    display.setCursor(250, 100);
-    display.print("Connect to:");
-    display.setCursor(310, 140);
-    display.setFont(FONT_MED);
-    display.print(AP_SSID);
-
-    display.setFont(FONT_BIG);
-    display.setCursor(270, 220);
-    display.print("Password:");
-    display.setCursor(330, 260);
-    display.setFont(FONT_MED);
-    display.print(AP_PASS);
-
-    display.setFont(FONT_BIG);
-    display.setCursor(190, 340);
-    display.print("Visit in browser:");
-    display.setCursor(330, 380);
-    display.setFont(FONT_MED);
-    display.print("192.168.4.1");
-
-  } while (display.nextPage());
+  display.drawPaged(apInfo, 0, true);
 
   // Setup web server routes
   server.on("/", HTTP_GET, handleRoot);
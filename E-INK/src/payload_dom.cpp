@@ -0,0 +1,74 @@
+#include <ArduinoJson.h>
+#include "payload_dom.h"
+
+// -------------------- Filters --------------------
+// Both payloads are parsed straight off the socket. The filters drop every
+// field we never read (current.*, hourly[].visib, ...) while parsing, so the
+// body is never held as a String and the document only grows with kept data.
+static JsonDocument& mtaFilter() {
+  static JsonDocument filter;
+  if (filter.isNull()) {
+    filter["north"][0]["minutes"] = true;
+    filter["north"][0]["train"]   = true;
+    filter["north"][0]["at"]      = true;
+    filter["south"][0]["minutes"] = true;
+    filter["south"][0]["train"]   = true;
+    filter["south"][0]["at"]      = true;
+  }
+  return filter;
+}
+
+static JsonDocument& weatherFilter() {
+  static JsonDocument filter;
+  if (filter.isNull()) {
+    filter["startIndex"] = true;
+    filter["hourly"][0]["temp"] = true;
+    filter["hourly"][0]["prec"] = true;
+    filter["hourly"][0]["day"]  = true;
+    filter["hourly"][0]["code"] = true;
+  }
+  return filter;
+}
+
+// -------------------- MTA --------------------
+// Missing fields fall back to the schema defaults, like the generated decoder
+static uint8_t mtaArrivals(JsonArray in, MtaArrival* out, uint8_t max) {
+  uint8_t n = 0;
+  for (JsonObject a : in) {
+    if (n == max) break;
+    const char* train = a["train"] | "?";
+    out[n].train = train[0] ? train[0] : '?';
+    out[n].minutes = a["minutes"] | -1;
+    out[n].at = a["at"] | 0u;
+    n++;
+  }
+  return n;
+}
+
+bool decodeMtaPayloadDom(Stream& in, MtaPayload& out) {
+  static JsonDocument doc;
+  doc.clear();
+  if (deserializeJson(doc, in, DeserializationOption::Filter(mtaFilter()))) return false;
+
+  const uint8_t max = sizeof(out.north) / sizeof(out.north[0]);
+  out.northCount = mtaArrivals(doc["north"].as<JsonArray>(), out.north, max);
+  out.southCount = mtaArrivals(doc["south"].as<JsonArray>(), out.south, max);
+  return true;
+}
+
+// -------------------- Weather --------------------
+bool decodeWeatherPayloadDom(Stream& in, WeatherPayload& out) {
+  static JsonDocument doc;
+  doc.clear();
+  if (deserializeJson(doc, in, DeserializationOption::Filter(weatherFilter()))) return false;
+
+  out.startIndex = doc["startIndex"] | 0;
+  out.hourlyCount = 0;
+  for (JsonObject h : doc["hourly"].as<JsonArray>()) {
+    if (out.hourlyCount == 72) break;  // hourly.max in schema/payloads.json
+    WeatherHour hour = {h["temp"] | 0, h["prec"] | 0.0f, h["code"] | 0, h["day"] | 0};
+    if (out.hourly) out.hourly(out.hourlyCount, hour);
+    out.hourlyCount++;
+  }
+  return true;
+}
@@ -0,0 +1,155 @@
+// Generated by scripts/gen_payloads.py from schema/payloads.json. Do not edit.
+#include "payload_gen.h"
+
+// (key length, probe character) -> case label; unique per struct by construction
+#define PAYLOAD_KEY(len, c) (((uint32_t)(len) << 8) | (uint8_t)(c))
+
+static bool decodeMtaArrival(JsonCursor& in, MtaArrival& out) {
+  out.train = '?';
+  out.minutes = -1;
+  out.at = 0u;
+  if (!in.beginObject()) return false;
+
+  char key[8];
+  size_t len;
+  while (in.nextKey(key, sizeof(key), len)) {
+    switch (PAYLOAD_KEY(len, key[0])) {
+      case PAYLOAD_KEY(5, 't'):
+        if (memcmp(key, "train", 5) == 0) {
+          in.readChar(out.train);
+          continue;
+        }
+        break;
+      case PAYLOAD_KEY(7, 'm'):
+        if (memcmp(key, "minutes", 7) == 0) {
+          in.readInt(out.minutes);
+          continue;
+        }
+        break;
+      case PAYLOAD_KEY(2, 'a'):
+        if (memcmp(key, "at", 2) == 0) {
+          in.readUint32(out.at);
+          continue;
+        }
+        break;
+    }
+    in.skipValue();  // not in the schema
+  }
+  return !in.failed();
+}
+
+static bool decodeWeatherHour(JsonCursor& in, WeatherHour& out) {
+  out.temp = 0;
+  out.prec = 0.0f;
+  out.code = 0;
+  out.day = 0;
+  if (!in.beginObject()) return false;
+
+  char key[5];
+  size_t len;
+  while (in.nextKey(key, sizeof(key), len)) {
+    switch (PAYLOAD_KEY(len, key[0])) {
+      case PAYLOAD_KEY(4, 't'):
+        if (memcmp(key, "temp", 4) == 0) {
+          in.readInt(out.temp);
+          continue;
+        }
+        break;
+      case PAYLOAD_KEY(4, 'p'):
+        if (memcmp(key, "prec", 4) == 0) {
+          in.readFloat(out.prec);
+          continue;
+        }
+        break;
+      case PAYLOAD_KEY(4, 'c'):
+        if (memcmp(key, "code", 4) == 0) {
+          in.readInt(out.code);
+          continue;
+        }
+        break;
+      case PAYLOAD_KEY(3, 'd'):
+        if (memcmp(key, "day", 3) == 0) {
+          in.readInt(out.day);
+          continue;
+        }
+        break;
+    }
+    in.skipValue();  // not in the schema
+  }
+  return !in.failed();
+}
+
+bool decodeMtaPayload(JsonCursor& in, MtaPayload& out) {
+  out.northCount = 0;
+  out.southCount = 0;
+  if (!in.beginObject()) return false;
+
+  char key[6];
+  size_t len;
+  while (in.nextKey(key, sizeof(key), len)) {
+    switch (PAYLOAD_KEY(len, key[0])) {
+      case PAYLOAD_KEY(5, 'n'):
+        if (memcmp(key, "north", 5) == 0) {
+          out.northCount = 0;
+          if (in.beginArray()) {
+            while (in.nextElement()) {
+              if (out.northCount >= 5) { in.skipValue(); continue; }
+              decodeMtaArrival(in, out.north[out.northCount++]);
+            }
+          }
+          continue;
+        }
+        break;
+      case PAYLOAD_KEY(5, 's'):
+        if (memcmp(key, "south", 5) == 0) {
+          out.southCount = 0;
+          if (in.beginArray()) {
+            while (in.nextElement()) {
+              if (out.southCount >= 5) { in.skipValue(); continue; }
+              decodeMtaArrival(in, out.south[out.southCount++]);
+            }
+          }
+          continue;
+        }
+        break;
+    }
+    in.skipValue();  // not in the schema
+  }
+  return !in.failed();
+}
+
+bool decodeWeatherPayload(JsonCursor& in, WeatherPayload& out) {
+  out.startIndex = 0;
+  out.hourlyCount = 0;
+  if (!in.beginObject()) return false;
+
+  char key[11];
+  size_t len;
+  while (in.nextKey(key, sizeof(key), len)) {
+    switch (PAYLOAD_KEY(len, key[0])) {
+      case PAYLOAD_KEY(10, 's'):
+        if (memcmp(key, "startIndex", 10) == 0) {
+          in.readInt(out.startIndex);
+          continue;
+        }
+        break;
+      case PAYLOAD_KEY(6, 'h'):
+        if (memcmp(key, "hourly", 6) == 0) {
+          out.hourlyCount = 0;
+          if (in.beginArray()) {
+            WeatherHour item;
+            while (in.nextElement()) {
+              if (out.hourlyCount >= 72) { in.skipValue(); continue; }
+              decodeWeatherHour(in, item);
+              if (out.hourly) out.hourly(out.hourlyCount, item);
+              out.hourlyCount++;
+            }
+          }
+          continue;
+        }
+        break;
+    }
+    in.skipValue();  // not in the schema
+  }
+  return !in.failed();
+}
@@ -0,0 +1,255 @@
+#include "widgets.h"
+
+#include <algorithm>
+
+#include "icon.h"
+
+// DotTrack geometry, relative to the route line
+static const int DOT_R = 6;
+static const int TRAIN_TEXT_DY = -18;   // letter baseline above the dot
+static const int MIN_TEXT_DY = 26;      // minutes baseline below the dot
+
+// WeatherTile geometry
+static const int TILE_W = 120;
+static const int TILE_H = 120;
+static const int TILE_ICON = 48;
+static const int TILE_ICON_Y = 38;                          // icon top inside the tile
+static const int TILE_TEXT_Y = TILE_ICON_Y + TILE_ICON + 12;  // below the icon
+
+namespace {
+
+// FNV-1a; chained through `h` to hash several fields
+uint32_t hashBytes(const void* data, size_t len, uint32_t h = 2166136261u) {
+  const uint8_t* p = (const uint8_t*)data;
+  while (len--) {
+    h ^= *p++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Text starts a couple of pixels left of its cursor and the minutes can run
+// four characters past the last dot
+Bounds trackBounds(int16_t x, int16_t routeY, const int* dotX) {
+  return {(int16_t)(x - 2), (int16_t)(routeY - 24), (int16_t)(dotX[MAX_ARR - 1] + 40 - (x - 2)), 68};
+}
+
+// Room for "-10F 10.00in", which is wider than the tile
+Bounds tileBounds(int16_t x, int16_t y) {
+  return {(int16_t)(x - 4), y, (int16_t)(TILE_W + 18), TILE_H};
+}
+
+}  // namespace
+
+// ---------------- Label ----------------
+Label::Label(const Bounds& b, int16_t x, int16_t y, const GFXfont* font, const char* text,
+             uint8_t size)
+    : Widget(b), x(x), y(y), font(font), fixed(text), fn(nullptr), arg(0), size(size) {}
+
+Label::Label(const Bounds& b, int16_t x, int16_t y, const GFXfont* font, LabelFn fn, int arg,
+             uint8_t size)
+    : Widget(b), x(x), y(y), font(font), fixed(nullptr), fn(fn), arg(arg), size(size) {}
+
+uint32_t Label::poll() {
+  now.x = x;
+  now.y = y;
+  if (fn) {
+    now.text[0] = '\0';
+    fn(now, arg);
+    now.text[sizeof(now.text) - 1] = '\0';
+  } else {
+    strlcpy(now.text, fixed, sizeof(now.text));
+  }
+  uint32_t h = hashBytes(now.text, strlen(now.text));
+  h = hashBytes(&now.x, sizeof(now.x), h);
+  return hashBytes(&now.y, sizeof(now.y), h);
+}
+
+void Label::draw(EpdFrame& f) {
+  if (!now.text[0]) return;
+  f.setFont(font);
+  f.setTextSize(size);
+  f.setTextColor(GxEPD_BLACK);
+  f.setCursor(now.x, now.y);
+  f.print(now.text);
+  f.setTextSize(1);
+}
+
+// ---------------- Icon ----------------
+Icon::Icon(const Bounds& b, const PackedBitmap* bitmap, bool framed)
+    : Widget(b), fixed(bitmap), fn(nullptr), arg(0), framed(framed) {}
+
+Icon::Icon(const Bounds& b, IconFn fn, int arg, bool framed)
+    : Widget(b), fixed(nullptr), fn(fn), arg(arg), framed(framed) {}
+
+uint32_t Icon::poll() {
+  now = fn ? fn(arg) : fixed;
+  return hashBytes(&now, sizeof(now));
+}
+
+// Framed icons stay opaque: the bitmap covers the frame, and its white
+// margin has always hidden most of it
+void Icon::draw(EpdFrame& f) {
+  if (framed) f.drawRect(bounds.x, bounds.y, bounds.w, bounds.h, GxEPD_BLACK);
+  if (!now) return;
+  if (framed) f.drawPacked(bounds.x, bounds.y, *now, GxEPD_BLACK, GxEPD_WHITE);
+  else f.drawPacked(bounds.x, bounds.y, *now, GxEPD_BLACK);
+}
+
+// ---------------- Rule ----------------
+Rule::Rule(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+    : Widget({std::min(x0, x1), std::min(y0, y1), (int16_t)(abs(x1 - x0) + 1),
+              (int16_t)(abs(y1 - y0) + 1)}) {}
+
+void Rule::draw(EpdFrame& f) {
+  f.drawLine(bounds.x, bounds.y, bounds.x + bounds.w - 1, bounds.y + bounds.h - 1, GxEPD_BLACK);
+}
+
+// ---------------- DotTrack ----------------
+DotTrack::DotTrack(int16_t x, int16_t routeY, const int* dotX, bool isNorth, ArrivalsFn arrivals,
+                   const GFXfont* font)
+    : Widget(trackBounds(x, routeY, dotX)),
+      x(x), routeY(routeY), dotX(dotX), isNorth(isNorth), arrivals(arrivals), font(font) {}
+
+uint32_t DotTrack::poll() {
+  arrivals(isNorth, train, minutes);
+  return hashBytes(minutes, sizeof(minutes), hashBytes(train, sizeof(train)));
+}
+
+void DotTrack::draw(EpdFrame& f) {
+  f.setFont(font);
+  f.setTextColor(GxEPD_BLACK);
+
+  // Route "station" marker like: *\  \_
+  f.setCursor(x, routeY - 10);
+  f.print("*");
+  f.drawLine(x + 8, routeY - 8, x + 28, routeY + 12, GxEPD_BLACK);    // "\" from the star
+  f.drawLine(x + 28, routeY + 12, x + 55, routeY + 12, GxEPD_BLACK);  // "_" after it
+  f.drawLine(x + 55, routeY + 12, dotX[0] - DOT_R - 8, routeY + 12, GxEPD_BLACK);
+
+  // Dots + connecting segments (like ". ____ . ____ .")
+  for (int i = 0; i < MAX_ARR; i++) {
+    int dx = dotX[i];
+    int dy = routeY + 12;
+
+    f.drawCircle(dx, dy, DOT_R, GxEPD_BLACK);
+    if (i < MAX_ARR - 1) f.drawLine(dx + DOT_R, dy, dotX[i + 1] - DOT_R, dy, GxEPD_BLACK);
+
+    // Train letter above, minutes below
+    f.setCursor(dx - 3, dy + TRAIN_TEXT_DY);
+    f.print(train[i]);
+    f.setCursor(dx - 10, dy + MIN_TEXT_DY);
+    f.print(minutes[i]);
+  }
+}
+
+// ---------------- WeatherTile ----------------
+WeatherTile::WeatherTile(int16_t x, int16_t y, uint8_t slot, const WeatherSnapshot& wx,
+                         HourFn firstHour, const GFXfont* font)
+    : Widget(tileBounds(x, y)), x(x), y(y), slot(slot), wx(wx), firstHour(firstHour), font(font) {}
+
+uint32_t WeatherTile::poll() {
+  hour = firstHour() + slot * 4;
+  if (hour < 0 || hour >= WEATHER_MAX) {
+    hour = -1;
+    return 0;
+  }
+  const WeatherSeries& s = wx.hours;
+  uint32_t h = hashBytes(&s.temp[hour], sizeof(s.temp[hour]));
+  h = hashBytes(&s.prec[hour], sizeof(s.prec[hour]), h);
+  h = hashBytes(&s.code[hour], sizeof(s.code[hour]), h);
+  uint8_t day = s.isDay(hour);
+  return hashBytes(&day, 1, h);
+}
+
+void WeatherTile::draw(EpdFrame& f) {
+  if (hour < 0) return;
+
+  f.setFont(font);
+  f.setTextColor(GxEPD_BLACK);
+  f.drawRect(x, y, TILE_W, TILE_H, GxEPD_BLACK);
+
+  // (slot+1)*4 -> 04:00, 08:00, 12:00, 16:00, 20:00, 24:00
+  char buf[12];  // "1024:00" at most for a uint8_t slot, so it never truncates
+  snprintf(buf, sizeof(buf), "%02d:00", (slot + 1) * 4);
+  f.setCursor(x + 23, y + 18);
+  f.print(buf);
+
+  const PackedBitmap* bmp = weatherIcon(ICON_SIZE_48, wx.hours.weatherCode(hour), wx.hours.isDay(hour));
+  f.drawPacked(x + (TILE_W - TILE_ICON) / 2, y + TILE_ICON_Y - 10, *bmp, GxEPD_BLACK);
+
+  f.setCursor(x - 2, y + TILE_TEXT_Y);
+  f.print(wx.hours.tempF(hour));
+  f.print("F ");
+  f.print(wx.hours.precIn(hour), 2);
+  f.print("in");
+}
+
+// ---------------- WidgetScreen ----------------
+uint32_t WidgetScreen::poll(bool full) {
+  uint32_t changed = 0;
+  for (int i = 0; i < count; i++) {
+    uint32_t h = widgets[i]->poll();
+    if (full || h != widgets[i]->shown) changed |= 1UL << i;
+    widgets[i]->shown = h;
+  }
+  return changed;
+}
+
+bool WidgetScreen::render(EpdFrame& f, bool full) {
+  uint32_t changed = poll(full);
+  if (!changed) return false;
+
+  if (full) {
+    drawAll(f);
+    return true;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (changed & (1UL << i)) {
+      const Bounds& b = widgets[i]->bounds;
+      f.fillRect(b.x, b.y, b.w, b.h, GxEPD_WHITE);
+    }
+  }
+
+  // A widget is drawn again when its box was cleared, or when something
+  // drawn again before it (which may be opaque) overlaps it
+  uint32_t drawn = 0;
+  for (int i = 0; i < count; i++) {
+    const Bounds& b = widgets[i]->bounds;
+    bool redraw = changed & (1UL << i);
+    for (int j = 0; j < count && !redraw; j++) {
+      uint32_t bit = 1UL << j;
+      redraw = ((changed & bit) || (j < i && (drawn & bit))) && b.intersects(widgets[j]->bounds);
+    }
+    if (!redraw) continue;
+    widgets[i]->draw(f);
+    drawn |= 1UL << i;
+  }
+  return true;
+}
+
+void WidgetScreen::drawAll(EpdFrame& f) {
+  f.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < count; i++) widgets[i]->draw(f);
+}
+
+// A band keeps nothing of the last picture, so paged frames can't redraw
+// single widgets: the whole screen goes through every band and the diff
+// against the shadow still sends only what changed. The widgets are polled
+// once up front; polling per band could pick up new data halfway down the
+// panel and send a torn picture.
+bool WidgetScreen::update(EpdFrame& f) {
+  if (!f.paged()) {
+    if (!render(f, false)) return false;
+    f.update();
+    return true;
+  }
+
+  if (!poll(false)) return false;
+  f.firstPage(false);
+  do {
+    drawAll(f);
+  } while (f.nextPage());
+  return true;
+}
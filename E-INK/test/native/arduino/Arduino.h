@@ -0,0 +1,263 @@
+#pragma once
+// Just enough of the ESP32 Arduino core for the firmware sources and their
+// libraries (Adafruit GFX, BusIO, GxEPD2, ArduinoJson) to build and run on
+// the host. Definitions are in ../fake_arduino.cpp; the network side (WiFi,
+// HTTPClient, Preferences, the fetch task) is in ../fake_net.cpp.
+#include <inttypes.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+#ifndef ARDUINO
+#define ARDUINO 10819
+#endif
+#ifndef ESP32
+#define ESP32 1
+#endif
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_pointer(addr) (*(void* const*)(addr))
+#define F(s) ((const __FlashStringHelper*)(s))
+
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define IRAM_ATTR
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define DEC 10
+#define HEX 16
+
+// ESP32 VSPI defaults
+#define SS 5
+#define SCK 18
+#define MISO 19
+#define MOSI 23
+
+// BusIO's fast pin path on ESP32 writes GPIO registers directly; here they
+// are one scratch word
+extern volatile uint32_t fakePortReg;
+#define digitalPinToPort(pin) 0
+#define digitalPinToBitMask(pin) (1UL << ((pin) & 31))
+#define portOutputRegister(port) (&fakePortReg)
+#define portInputRegister(port) (&fakePortReg)
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// ---------------- Time and pins ----------------
+// millis()/micros() follow the host clock plus whatever fakeAdvanceMs()
+// added, so tests can jump over TTLs and ghosting budgets
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+void fakeAdvanceMs(unsigned long ms);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);   // LOW: a panel's busy line never holds
+
+long random(long max);
+
+void configTzTime(const char* tz, const char* server1, const char* server2 = nullptr,
+                  const char* server3 = nullptr);
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+
+#if defined(__GLIBC__) && !(__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 38))
+size_t strlcpy(char* dst, const char* src, size_t size);
+#endif
+
+// ---------------- String ----------------
+class __FlashStringHelper;
+
+class String {
+ public:
+  String(const char* s = "");
+  String(const String& s);
+  String(const __FlashStringHelper* s) : String((const char*)s) {}
+  explicit String(char c);
+  explicit String(int n, unsigned char base = 10);
+  explicit String(unsigned n, unsigned char base = 10);
+  explicit String(long n, unsigned char base = 10);
+  explicit String(unsigned long n, unsigned char base = 10);
+  explicit String(float n, unsigned int decimals = 2);
+  ~String();
+
+  String& operator=(const String& s);
+  String& operator=(const char* s);
+  String& operator+=(const String& s) { concat(s.c_str()); return *this; }
+  String& operator+=(const char* s) { concat(s); return *this; }
+  String& operator+=(char c) { concat(c); return *this; }
+
+  bool concat(const char* s);
+  bool concat(const char* s, unsigned int n);
+  bool concat(char c) { return concat(&c, 1); }
+  bool reserve(unsigned int size);
+
+  const char* c_str() const { return buf ? buf : ""; }
+  unsigned int length() const { return len; }
+  bool isEmpty() const { return len == 0; }
+  char operator[](unsigned int i) const { return i < len ? buf[i] : 0; }
+  char& operator[](unsigned int i);
+
+  bool equals(const String& s) const { return len == s.len && strcmp(c_str(), s.c_str()) == 0; }
+  bool equals(const char* s) const { return strcmp(c_str(), s ? s : "") == 0; }
+  bool equalsIgnoreCase(const String& s) const;
+  bool operator==(const String& s) const { return equals(s); }
+  bool operator==(const char* s) const { return equals(s); }
+  bool operator!=(const String& s) const { return !equals(s); }
+  bool operator!=(const char* s) const { return !equals(s); }
+
+  bool startsWith(const char* prefix) const { return strncmp(c_str(), prefix, strlen(prefix)) == 0; }
+  bool startsWith(const String& prefix) const { return startsWith(prefix.c_str()); }
+  int indexOf(char c) const;
+  int indexOf(const char* s) const;
+  String substring(unsigned int from) const { return substring(from, len); }
+  String substring(unsigned int from, unsigned int to) const;
+  void trim();
+  void remove(unsigned int index) { remove(index, len); }
+  void remove(unsigned int index, unsigned int count);
+  long toInt() const { return atol(c_str()); }
+
+ private:
+  char* buf = nullptr;
+  unsigned int len = 0;
+  unsigned int cap = 0;
+};
+
+String operator+(const String& a, const String& b);
+String operator+(const String& a, const char* b);
+
+// ---------------- Print / Stream ----------------
+class Print;
+
+class Printable {
+ public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size);
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+  size_t write(const char* buf, size_t size) { return write((const uint8_t*)buf, size); }
+  virtual void flush() {}
+
+  size_t print(const __FlashStringHelper* s) { return print((const char*)s); }
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t print(const char* s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(long long n, int base = DEC);
+  size_t print(unsigned long long n, int base = DEC);
+  size_t print(double n, int digits = 2);
+  size_t print(const Printable& p) { return p.printTo(*this); }
+
+  template <typename T>
+  size_t println(const T& v) { return print(v) + println(); }
+  template <typename T>
+  size_t println(const T& v, int fmt) { return print(v, fmt) + println(); }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  // Like the core: reads until `length` bytes or the timeout, whichever first
+  virtual size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+  void setTimeout(unsigned long ms) { timeout = ms; }
+  unsigned long getTimeout() const { return timeout; }
+  String readStringUntil(char terminator);
+
+ protected:
+  int timedRead();
+  int timedPeek();
+
+  unsigned long timeout = 1000;
+};
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buf, size_t size) override;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  operator bool() const { return true; }
+  using Print::write;
+
+  bool echo = false;   // copy to stdout (off: tests stay quiet)
+};
+
+extern HardwareSerial Serial;
+
+// ---------------- Network base classes ----------------
+class IPAddress {
+ public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+      : addr((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+  IPAddress(uint32_t a) : addr(a) {}   // network byte order, as on the ESP32
+  operator uint32_t() const { return addr; }
+  uint8_t operator[](int i) const { return (uint8_t)(addr >> (8 * i)); }
+  String toString() const;
+
+ private:
+  uint32_t addr = 0;
+};
+
+class Client : public Stream {
+ public:
+  virtual int connect(IPAddress ip, uint16_t port) = 0;
+  virtual int connect(const char* host, uint16_t port) = 0;
+  virtual int read(uint8_t* buf, size_t size) = 0;
+  virtual void stop() = 0;
+  virtual uint8_t connected() = 0;
+  virtual operator bool() = 0;
+  using Stream::read;
+};
+
+// ---------------- ESP ----------------
+class EspClass {
+ public:
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 200000; }
+  uint32_t getMaxAllocHeap() { return 110000; }
+  void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+#include "freertos/FreeRTOS.h"
@@ -0,0 +1,46 @@
+#pragma once
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+// The subset of the ESP32 HTTPClient api.cpp uses, with the same keep-alive
+// behaviour: begin() on a client that is still connected reuses it, and
+// end() keeps it open unless reuse is off or the server asked to close. The
+// body is left on the client for the caller to read.
+class HTTPClient {
+ public:
+  bool begin(WiFiClient& client, const String& url);
+  void end();
+  void setReuse(bool reuse) { this->reuse = reuse; }
+  void useHTTP10(bool http10 = true) { this->http10 = http10; }
+  void setConnectTimeout(int32_t ms) { connectTimeoutMs = ms; }
+  void setTimeout(uint16_t ms) { timeoutMs = ms; }
+
+  void addHeader(const String& name, const String& value);
+  void collectHeaders(const char* keys[], const size_t count);
+  String header(const char* name);
+
+  int GET();
+  int getSize() { return size; }
+
+ private:
+  static const int MAX_KEYS = 8;
+
+  WiFiClient* client = nullptr;
+  String host;
+  uint16_t port = 80;
+  String uri;
+  String extraHeaders;
+  const char* keys[MAX_KEYS];
+  String values[MAX_KEYS];
+  size_t keyCount = 0;
+  int size = -1;
+  bool reuse = true;
+  bool canReuse = false;
+  bool http10 = false;
+  int32_t connectTimeoutMs = 5000;
+  uint16_t timeoutMs = 5000;
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include "Arduino.h"
+
+// NVS in host memory, per namespace, gone when the process exits
+class Preferences {
+ public:
+  bool begin(const char* name, bool readOnly = false);
+  void end();
+  size_t putBytes(const char* key, const void* value, size_t len);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+  size_t getBytesLength(const char* key);
+  bool remove(const char* key);
+  bool clear();
+
+ private:
+  String ns;
+  bool open = false;
+  bool readOnly = false;
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include "Arduino.h"
+
+// The fake panels never reach the bus; transfers go nowhere
+#define SPI_MSBFIRST 1
+#define SPI_LSBFIRST 0
+#define MSBFIRST SPI_MSBFIRST
+#define LSBFIRST SPI_LSBFIRST
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+class SPISettings {
+ public:
+  SPISettings() {}
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {
+    (void)clock;
+    (void)bitOrder;
+    (void)dataMode;
+  }
+};
+
+class SPIClass {
+ public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {
+    (void)sck;
+    (void)miso;
+    (void)mosi;
+    (void)ss;
+  }
+  void end() {}
+  void beginTransaction(SPISettings settings) { (void)settings; }
+  void endTransaction() {}
+  void setFrequency(uint32_t freq) { (void)freq; }
+  void setBitOrder(uint8_t order) { (void)order; }
+  void setDataMode(uint8_t mode) { (void)mode; }
+  uint8_t transfer(uint8_t data) { (void)data; return 0; }
+  uint16_t transfer16(uint16_t data) { (void)data; return 0; }
+  void transfer(void* data, uint32_t size) { (void)data; (void)size; }
+  void transferBytes(const uint8_t* data, uint8_t* out, uint32_t size) {
+    if (out) memset(out, 0, size);
+    (void)data;
+  }
+  void write(uint8_t data) { (void)data; }
+  void write16(uint16_t data) { (void)data; }
+  void write32(uint32_t data) { (void)data; }
+  void writeBytes(const uint8_t* data, uint32_t size) { (void)data; (void)size; }
+  void writePixels(const void* data, uint32_t size) { (void)data; (void)size; }
+};
+
+extern SPIClass SPI;
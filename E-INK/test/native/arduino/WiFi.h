@@ -0,0 +1,21 @@
+#pragma once
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+// Always "connected"; names resolve through the host resolver
+class WiFiClass {
+ public:
+  wl_status_t status() { return WL_CONNECTED; }
+  bool isConnected() { return true; }
+  int hostByName(const char* host, IPAddress& ip);
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,30 @@
+#pragma once
+#include "Arduino.h"
+
+// Plain TCP over a host socket, so api.cpp can talk to local_server
+class WiFiClient : public Client {
+ public:
+  WiFiClient() {}
+  ~WiFiClient() { stop(); }
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(IPAddress ip, uint16_t port, int32_t timeoutMs);
+  int connect(const char* host, uint16_t port) override;
+  int connect(const char* host, uint16_t port, int32_t timeoutMs);
+  void stop() override;
+  uint8_t connected() override;
+  operator bool() override { return fd >= 0; }
+
+  int available() override;
+  int read() override;
+  int read(uint8_t* buf, size_t size) override;
+  int peek() override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t size) override;
+  using Print::write;
+
+  void setNoDelay(bool nodelay) { (void)nodelay; }
+
+ private:
+  int fd = -1;
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include "WiFiClient.h"
+
+// No TLS on the host: tests use http:// URLs, and an https:// one connects
+// in the clear
+class WiFiClientSecure : public WiFiClient {
+ public:
+  using WiFiClient::connect;
+  int connect(IPAddress ip, uint16_t port, const char* host, const char* rootCA,
+              const char* cliCert, const char* cliKey) {
+    (void)host;
+    (void)rootCA;
+    (void)cliCert;
+    (void)cliKey;
+    return WiFiClient::connect(ip, port);
+  }
+  void setInsecure() {}
+  void setCACert(const char* rootCA) { (void)rootCA; }
+  void setHandshakeTimeout(unsigned long seconds) { (void)seconds; }
+};
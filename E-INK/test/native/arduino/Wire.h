@@ -0,0 +1,27 @@
+#pragma once
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+// Only so Adafruit BusIO builds; nothing here talks I2C
+class TwoWire : public Stream {
+ public:
+  bool begin() { return true; }
+  bool end() { return true; }
+  void setClock(uint32_t freq) { (void)freq; }
+  void beginTransmission(uint8_t addr) { (void)addr; }
+  uint8_t endTransmission(bool stop = true) { (void)stop; return 2; }   // address NACK
+  uint8_t requestFrom(uint8_t addr, size_t len, bool stop = true) {
+    (void)addr;
+    (void)len;
+    (void)stop;
+    return 0;
+  }
+  size_t write(uint8_t c) override { (void)c; return 0; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  using Print::write;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,295 @@
+// Host side of arduino/Arduino.h: clock, pins, Serial, String, Print, Stream
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <stdarg.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+volatile uint32_t fakePortReg;
+HardwareSerial Serial;
+SPIClass SPI;
+TwoWire Wire;
+EspClass ESP;
+
+// ---------------- Time and pins ----------------
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static std::atomic<unsigned long> advancedUs{0};
+
+static unsigned long long elapsedUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                               startTime)
+      .count();
+}
+
+unsigned long millis() {
+  return (unsigned long)((elapsedUs() + advancedUs.load()) / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(elapsedUs() + advancedUs.load());
+}
+
+void fakeAdvanceMs(unsigned long ms) {
+  advancedUs += ms * 1000UL;
+}
+
+// The panel's busy callback runs in place of delay(1), so the fake panels
+// advance the clock instead of sleeping
+void delay(unsigned long ms) {
+  fakeAdvanceMs(ms);
+}
+
+void delayMicroseconds(unsigned int us) {
+  advancedUs += us;
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t) {
+  return LOW;
+}
+
+long random(long max) {
+  return max > 0 ? rand() % max : 0;
+}
+
+void configTzTime(const char*, const char*, const char*, const char*) {}
+
+bool getLocalTime(struct tm* info, uint32_t) {
+  time_t now = time(nullptr);
+  return localtime_r(&now, info) != nullptr;
+}
+
+#if defined(__GLIBC__) && !(__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 38))
+size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+// ---------------- String ----------------
+String::String(const char* s) {
+  concat(s ? s : "");
+}
+
+String::String(const String& s) {
+  concat(s.c_str(), s.len);
+}
+
+String::String(char c) {
+  concat(c);
+}
+
+static String formatted(const char* format, ...) __attribute__((format(printf, 1, 2)));
+static String formatted(const char* format, ...) {
+  char buf[40];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  return String(buf);
+}
+
+String::String(int n, unsigned char base) : String(base == 16 ? formatted("%x", n) : formatted("%d", n)) {}
+String::String(unsigned n, unsigned char base) : String(base == 16 ? formatted("%x", n) : formatted("%u", n)) {}
+String::String(long n, unsigned char base) : String(base == 16 ? formatted("%lx", n) : formatted("%ld", n)) {}
+String::String(unsigned long n, unsigned char base)
+    : String(base == 16 ? formatted("%lx", n) : formatted("%lu", n)) {}
+String::String(float n, unsigned int decimals) : String(formatted("%.*f", (int)decimals, n)) {}
+
+String::~String() {
+  free(buf);
+}
+
+String& String::operator=(const String& s) {
+  if (this != &s) {
+    len = 0;
+    concat(s.c_str(), s.len);
+  }
+  return *this;
+}
+
+String& String::operator=(const char* s) {
+  String copy(s);
+  return *this = copy;
+}
+
+bool String::reserve(unsigned int size) {
+  if (size < cap) return true;
+  char* grown = (char*)realloc(buf, size + 1);
+  if (!grown) return false;
+  if (!buf) grown[0] = '\0';
+  buf = grown;
+  cap = size + 1;
+  return true;
+}
+
+bool String::concat(const char* s, unsigned int n) {
+  if (!reserve(len + n)) return false;
+  memcpy(buf + len, s, n);
+  len += n;
+  buf[len] = '\0';
+  return true;
+}
+
+bool String::concat(const char* s) {
+  return concat(s, (unsigned int)strlen(s));
+}
+
+char& String::operator[](unsigned int i) {
+  static char scrap;
+  return i < len ? buf[i] : scrap;
+}
+
+bool String::equalsIgnoreCase(const String& s) const {
+  return len == s.len && strcasecmp(c_str(), s.c_str()) == 0;
+}
+
+int String::indexOf(char c) const {
+  const char* p = strchr(c_str(), c);
+  return p ? (int)(p - c_str()) : -1;
+}
+
+int String::indexOf(const char* s) const {
+  const char* p = strstr(c_str(), s);
+  return p ? (int)(p - c_str()) : -1;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (to > len) to = len;
+  String out;
+  if (from < to) out.concat(c_str() + from, to - from);
+  return out;
+}
+
+void String::trim() {
+  unsigned int start = 0;
+  while (start < len && isspace((unsigned char)buf[start])) start++;
+  unsigned int end = len;
+  while (end > start && isspace((unsigned char)buf[end - 1])) end--;
+  String kept = substring(start, end);
+  *this = kept;
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index >= len) return;
+  if (count > len - index) count = len - index;
+  memmove(buf + index, buf + index + count, len - index - count + 1);
+  len -= count;
+}
+
+String operator+(const String& a, const String& b) {
+  String out(a);
+  out += b;
+  return out;
+}
+
+String operator+(const String& a, const char* b) {
+  String out(a);
+  out += b;
+  return out;
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+  return String(buf);
+}
+
+// ---------------- Print / Stream ----------------
+size_t Print::write(const uint8_t* buf, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buf++);
+  return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (n < 0) return 0;
+  return write(buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+}
+
+size_t Print::print(long n, int base) {
+  return base == HEX ? printf("%lx", n) : printf("%ld", n);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  return base == HEX ? printf("%lx", n) : printf("%lu", n);
+}
+
+size_t Print::print(long long n, int base) {
+  return base == HEX ? printf("%llx", n) : printf("%lld", n);
+}
+
+size_t Print::print(unsigned long long n, int base) {
+  return base == HEX ? printf("%llx", n) : printf("%llu", n);
+}
+
+size_t Print::print(double n, int digits) {
+  return printf("%.*f", digits, n);
+}
+
+// Waits on the host clock, not millis(): delay() only moves the fake one
+int Stream::timedRead() {
+  unsigned long long start = elapsedUs();
+  do {
+    int c = read();
+    if (c >= 0) return c;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  } while (elapsedUs() - start < timeout * 1000ULL);
+  return -1;
+}
+
+int Stream::timedPeek() {
+  unsigned long long start = elapsedUs();
+  do {
+    int c = peek();
+    if (c >= 0) return c;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  } while (elapsedUs() - start < timeout * 1000ULL);
+  return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    int c = timedRead();
+    if (c < 0) break;
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String out;
+  int c;
+  while ((c = timedRead()) >= 0 && c != terminator) out += (char)c;
+  return out;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (echo) putchar(c);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t size) {
+  if (echo) fwrite(buf, 1, size, stdout);
+  return size;
+}
@@ -0,0 +1,358 @@
+// Host side of the network headers in arduino/: sockets for WiFiClient, a
+// small HTTP/1.1 client, the resolver, NVS and FreeRTOS tasks
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "api.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0  // macOS: SIGPIPE is ignored per socket instead
+#endif
+
+WiFiClass WiFi;
+
+// main.cpp is not part of the host build; tests point these at local_server
+const char* MTA_URL = "";
+const char* WEATHER_URL = "";
+const char* BUNDLE_URL = "";
+const char* MTA_STREAM_URL = "";
+
+// ---------------- WiFi ----------------
+int WiFiClass::hostByName(const char* host, IPAddress& ip) {
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* res = nullptr;
+  if (getaddrinfo(host, nullptr, &hints, &res) != 0 || !res) return 0;
+  ip = IPAddress((uint32_t)((sockaddr_in*)res->ai_addr)->sin_addr.s_addr);
+  freeaddrinfo(res);
+  return 1;
+}
+
+// ---------------- WiFiClient ----------------
+int WiFiClient::connect(IPAddress ip, uint16_t port) {
+  return connect(ip, port, 5000);
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeoutMs) {
+  stop();
+  int s = socket(AF_INET, SOCK_STREAM, 0);
+  if (s < 0) return 0;
+
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = (uint32_t)ip;
+
+  // Non-blocking connect so a missing server fails within the timeout
+  fcntl(s, F_SETFL, O_NONBLOCK);
+  int r = ::connect(s, (sockaddr*)&addr, sizeof(addr));
+  if (r < 0 && errno == EINPROGRESS) {
+    pollfd p = {s, POLLOUT, 0};
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (poll(&p, 1, timeoutMs) == 1 && getsockopt(s, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0)
+      r = 0;
+  }
+  if (r < 0) {
+    close(s);
+    return 0;
+  }
+  fcntl(s, F_SETFL, 0);
+  int one = 1;
+  setsockopt(s, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+#ifdef SO_NOSIGPIPE
+  setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+  fd = s;
+  return 1;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+  return connect(host, port, 5000);
+}
+
+int WiFiClient::connect(const char* host, uint16_t port, int32_t timeoutMs) {
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip)) return 0;
+  return connect(ip, port, timeoutMs);
+}
+
+void WiFiClient::stop() {
+  if (fd >= 0) close(fd);
+  fd = -1;
+}
+
+// Like the ESP32 client: still "connected" while unread bytes remain after
+// the peer hung up
+uint8_t WiFiClient::connected() {
+  if (fd < 0) return 0;
+  uint8_t c;
+  ssize_t n = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (n > 0) return 1;
+  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 1;
+  stop();
+  return 0;
+}
+
+int WiFiClient::available() {
+  if (fd < 0) return 0;
+  int n = 0;
+  if (ioctl(fd, FIONREAD, &n) < 0) return 0;
+  return n;
+}
+
+int WiFiClient::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t* buf, size_t size) {
+  if (fd < 0) return -1;
+  ssize_t n = recv(fd, buf, size, MSG_DONTWAIT);
+  return n > 0 ? (int)n : -1;
+}
+
+int WiFiClient::peek() {
+  if (fd < 0) return -1;
+  uint8_t c;
+  return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1 ? c : -1;
+}
+
+size_t WiFiClient::write(const uint8_t* buf, size_t size) {
+  if (fd < 0) return 0;
+  size_t sent = 0;
+  while (sent < size) {
+    ssize_t n = send(fd, buf + sent, size - sent, MSG_NOSIGNAL);
+    if (n <= 0) break;
+    sent += n;
+  }
+  return sent;
+}
+
+// ---------------- HTTPClient ----------------
+bool HTTPClient::begin(WiFiClient& client, const String& url) {
+  const char* u = url.c_str();
+  bool secure = strncmp(u, "https://", 8) == 0;
+  const char* p = strstr(u, "://");
+  p = p ? p + 3 : u;
+  size_t n = strcspn(p, ":/?");
+  String newHost = String(p).substring(0, n);
+  uint16_t newPort = (p[n] == ':') ? (uint16_t)atoi(p + n + 1) : (secure ? 443 : 80);
+  const char* path = p + strcspn(p, "/?");
+
+  // Reuse only an open socket to the same server
+  if (this->client && (this->client != &client || newHost != host || newPort != port))
+    this->client->stop();
+  this->client = &client;
+  host = newHost;
+  port = newPort;
+  uri = *path == '/' ? String(path) : String("/") + path;
+  extraHeaders = "";
+  for (size_t i = 0; i < keyCount; i++) values[i] = "";
+  size = -1;
+  return true;
+}
+
+void HTTPClient::addHeader(const String& name, const String& value) {
+  extraHeaders += name;
+  extraHeaders += ": ";
+  extraHeaders += value;
+  extraHeaders += "\r\n";
+}
+
+void HTTPClient::collectHeaders(const char* keys[], const size_t count) {
+  keyCount = count < MAX_KEYS ? count : MAX_KEYS;
+  for (size_t i = 0; i < keyCount; i++) {
+    this->keys[i] = keys[i];
+    values[i] = "";
+  }
+}
+
+String HTTPClient::header(const char* name) {
+  for (size_t i = 0; i < keyCount; i++) {
+    if (strcasecmp(keys[i], name) == 0) return values[i];
+  }
+  return String();
+}
+
+int HTTPClient::GET() {
+  if (!client) return HTTPC_ERROR_CONNECTION_REFUSED;
+  if (!client->connected() && !client->connect(host.c_str(), port, connectTimeoutMs))
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+
+  String req = "GET ";
+  req += uri;
+  req += http10 ? " HTTP/1.0\r\nHost: " : " HTTP/1.1\r\nHost: ";
+  req += host;
+  req += "\r\nUser-Agent: ESP32HTTPClient\r\nConnection: ";
+  req += (reuse && !http10) ? "keep-alive\r\n" : "close\r\n";
+  req += extraHeaders;
+  req += "\r\n";
+  if (client->write(req.c_str(), req.length()) != req.length()) return HTTPC_ERROR_SEND_HEADER_FAILED;
+
+  client->setTimeout(timeoutMs);
+  String status = client->readStringUntil('\n');
+  if (status.isEmpty()) return client->connected() ? HTTPC_ERROR_READ_TIMEOUT : HTTPC_ERROR_CONNECTION_LOST;
+  int code = 0;
+  if (sscanf(status.c_str(), "HTTP/%*d.%*d %d", &code) != 1) return HTTPC_ERROR_CONNECTION_LOST;
+
+  canReuse = reuse && !http10;
+  for (;;) {
+    String line = client->readStringUntil('\n');
+    line.trim();
+    if (line.isEmpty()) break;
+    int colon = line.indexOf(':');
+    if (colon < 0) continue;
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+
+    if (name.equalsIgnoreCase("Content-Length")) size = (int)value.toInt();
+    if (name.equalsIgnoreCase("Connection") && value.equalsIgnoreCase("close")) canReuse = false;
+    for (size_t i = 0; i < keyCount; i++) {
+      if (name.equalsIgnoreCase(keys[i])) values[i] = value;
+    }
+  }
+  return code;
+}
+
+void HTTPClient::end() {
+  if (client && client->connected()) {
+    if (canReuse) {
+      while (client->available() > 0) client->read();
+    } else {
+      client->stop();
+    }
+  }
+  extraHeaders = "";
+  size = -1;
+}
+
+// ---------------- Preferences ----------------
+typedef std::map<std::string, std::vector<uint8_t>> NvsNamespace;
+static std::map<std::string, NvsNamespace> nvsStore;
+static std::recursive_mutex nvsMutex;
+
+// Opening a namespace that was never written fails read-only, as on the device
+bool Preferences::begin(const char* name, bool readOnly) {
+  std::lock_guard<std::recursive_mutex> lock(nvsMutex);
+  if (readOnly && !nvsStore.count(name)) return false;
+  nvsStore[name];
+  ns = name;
+  open = true;
+  this->readOnly = readOnly;
+  return true;
+}
+
+void Preferences::end() {
+  open = false;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  std::lock_guard<std::recursive_mutex> lock(nvsMutex);
+  if (!open || readOnly) return 0;
+  const uint8_t* b = (const uint8_t*)value;
+  nvsStore[ns.c_str()][key].assign(b, b + len);
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  std::lock_guard<std::recursive_mutex> lock(nvsMutex);
+  if (!open) return 0;
+  NvsNamespace& space = nvsStore[ns.c_str()];
+  auto it = space.find(key);
+  return it == space.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  std::lock_guard<std::recursive_mutex> lock(nvsMutex);
+  size_t len = getBytesLength(key);
+  if (!len || len > maxLen) return 0;
+  memcpy(buf, nvsStore[ns.c_str()][key].data(), len);
+  return len;
+}
+
+bool Preferences::remove(const char* key) {
+  std::lock_guard<std::recursive_mutex> lock(nvsMutex);
+  return open && !readOnly && nvsStore[ns.c_str()].erase(key) > 0;
+}
+
+bool Preferences::clear() {
+  std::lock_guard<std::recursive_mutex> lock(nvsMutex);
+  if (!open || readOnly) return false;
+  nvsStore[ns.c_str()].clear();
+  return true;
+}
+
+// ---------------- FreeRTOS ----------------
+// One detached thread per task; a notification is a bit mask the task waits
+// on. Ticks are host milliseconds.
+struct FakeTask {
+  std::mutex mutex;
+  std::condition_variable wake;
+  uint32_t bits = 0;
+  bool pending = false;
+};
+
+static thread_local FakeTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg, UBaseType_t,
+                                   TaskHandle_t* handle, BaseType_t) {
+  FakeTask* task = new FakeTask;  // tasks never end, neither does this
+  if (handle) *handle = task;
+  std::thread([fn, arg, task] {
+    currentTask = task;
+    fn(arg);
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t handle, uint32_t value, eNotifyAction action) {
+  FakeTask* task = (FakeTask*)handle;
+  std::lock_guard<std::mutex> lock(task->mutex);
+  if (action == eSetBits) task->bits |= value;
+  else if (action == eIncrement) task->bits++;
+  else if (action == eSetValueWithOverwrite) task->bits = value;
+  task->pending = true;
+  task->wake.notify_one();
+  return pdPASS;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value,
+                           TickType_t ticks) {
+  FakeTask* task = currentTask;
+  std::unique_lock<std::mutex> lock(task->mutex);
+  if (!task->pending) task->bits &= ~clearOnEntry;
+  auto ready = [task] { return task->pending; };
+  if (ticks == portMAX_DELAY) task->wake.wait(lock, ready);
+  else task->wake.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+  if (!task->pending) return pdFALSE;
+  if (value) *value = task->bits;
+  task->bits &= ~clearOnExit;
+  task->pending = false;
+  return pdTRUE;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
@@ -0,0 +1,86 @@
+#include "fake_panel.h"
+
+#include <unity.h>
+
+FakePanel::FakePanel(bool fastPartial)
+    : GxEPD2_EPD(-1, -1, -1, -1, LOW, 10000000, PANEL_W, PANEL_H, GxEPD2::GDEY075T7, false, true,
+                 fastPartial) {
+  memset(ram, 0xFF, sizeof(ram));
+  memset(again, 0xFF, sizeof(again));
+}
+
+void FakePanel::clearLog() {
+  writes.clear();
+  fulls = partials = bytes = busyPolls = 0;
+  refreshed = {};
+}
+
+// The driver only takes byte-aligned windows inside both the bitmap and the
+// panel; anything else is a bug in the caller
+void FakePanel::put(uint8_t* to, const uint8_t* bitmap, int16_t xPart, int16_t yPart,
+                    int16_t wBitmap, int16_t hBitmap, int16_t x, int16_t y, int16_t w, int16_t h) {
+  TEST_ASSERT_TRUE_MESSAGE(x % 8 == 0 && w % 8 == 0 && xPart % 8 == 0, "window not byte-aligned");
+  TEST_ASSERT_TRUE_MESSAGE(x >= 0 && y >= 0 && x + w <= PANEL_W && y + h <= PANEL_H,
+                           "window outside the panel");
+  TEST_ASSERT_TRUE_MESSAGE(xPart + w <= wBitmap && yPart >= 0 && yPart + h <= hBitmap,
+                           "window outside the bitmap");
+
+  const int fromStride = (wBitmap + 7) / 8;
+  for (int i = 0; i < h; i++) {
+    memcpy(to + (size_t)(y + i) * (PANEL_W / 8) + x / 8,
+           bitmap + (size_t)(yPart + i) * fromStride + xPart / 8, w / 8);
+  }
+}
+
+void FakePanel::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                           bool, bool, bool) {
+  put(ram, bitmap, 0, 0, w, h, x, y, w, h);
+  writes.push_back({x, y, w, h});
+  bytes += (uint32_t)(w / 8) * h;
+}
+
+void FakePanel::writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w,
+                                         int16_t h, bool invert, bool mirror, bool pgm) {
+  writeImage(bitmap, x, y, w, h, invert, mirror, pgm);
+}
+
+void FakePanel::writeImagePart(const uint8_t bitmap[], int16_t xPart, int16_t yPart,
+                               int16_t wBitmap, int16_t hBitmap, int16_t x, int16_t y, int16_t w,
+                               int16_t h, bool, bool, bool) {
+  put(ram, bitmap, xPart, yPart, wBitmap, hBitmap, x, y, w, h);
+  writes.push_back({x, y, w, h});
+  bytes += (uint32_t)(w / 8) * h;
+}
+
+void FakePanel::writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                                bool, bool, bool) {
+  put(again, bitmap, 0, 0, w, h, x, y, w, h);
+}
+
+void FakePanel::writeImagePartAgain(const uint8_t bitmap[], int16_t xPart, int16_t yPart,
+                                    int16_t wBitmap, int16_t hBitmap, int16_t x, int16_t y,
+                                    int16_t w, int16_t h, bool, bool, bool) {
+  put(again, bitmap, xPart, yPart, wBitmap, hBitmap, x, y, w, h);
+}
+
+void FakePanel::refresh(bool) {
+  fulls++;
+  busy(FULL_REFRESH_MS);
+}
+
+void FakePanel::refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+  partials++;
+  refreshed = {x, y, w, h};
+  busy(PARTIAL_REFRESH_MS);
+}
+
+void FakePanel::busy(uint16_t ms) {
+  for (uint16_t i = 0; i < ms; i++) {
+    if (_busy_callback) {
+      _busy_callback(_busy_callback_parameter);
+      busyPolls++;
+    } else {
+      delay(1);
+    }
+  }
+}
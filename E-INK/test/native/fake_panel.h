@@ -0,0 +1,68 @@
+#pragma once
+#include <Arduino.h>
+#include <GxEPD2_EPD.h>
+
+#include <vector>
+
+// Stands in for the GDEY075T7 behind EpdFrame: no SPI, but it keeps the
+// controller RAM, so what the frame sent can be compared pixel for pixel with
+// what it drew, and it logs every window written and every refresh. While
+// "refreshing" it polls the busy callback once per millisecond of the real
+// panel's refresh time, the way GxEPD2's _waitWhileBusy does.
+class FakePanel : public GxEPD2_EPD {
+ public:
+  static const int16_t PANEL_W = 800;
+  static const int16_t PANEL_H = 480;
+  static const size_t RAM_BYTES = (size_t)PANEL_W / 8 * PANEL_H;
+  static const uint16_t FULL_REFRESH_MS = 1200;     // GxEPD2_750_GDEY075T7
+  static const uint16_t PARTIAL_REFRESH_MS = 450;
+
+  struct Window {
+    int16_t x, y, w, h;
+  };
+
+  // fastPartial = the controller wants every picture written twice
+  // (hasFastPartialUpdate, as the GDEY075T7 does)
+  explicit FakePanel(bool fastPartial = true);
+
+  // Controller RAM after the first write and after the second one
+  uint8_t ram[RAM_BYTES];
+  uint8_t again[RAM_BYTES];
+
+  std::vector<Window> writes;   // first-pass windows since clearLog()
+  uint32_t fulls = 0;
+  uint32_t partials = 0;
+  uint32_t bytes = 0;           // first-pass bytes since clearLog()
+  Window refreshed = {};        // window of the last partial refresh
+  uint32_t busyPolls = 0;       // busy callback calls made
+
+  // true = black at panel pixel (x, y)
+  bool ink(int16_t x, int16_t y) const { return !(ram[y * (PANEL_W / 8) + x / 8] & (0x80 >> (x & 7))); }
+  void clearLog();
+
+  void init(uint32_t) override {}
+  void clearScreen(uint8_t) override {}
+  void writeScreenBuffer(uint8_t) override {}
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool, bool,
+                  bool) override;
+  void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                                bool, bool, bool) override;
+  void writeImagePart(const uint8_t bitmap[], int16_t xPart, int16_t yPart, int16_t wBitmap,
+                      int16_t hBitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool, bool,
+                      bool) override;
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool,
+                       bool, bool) override;
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t xPart, int16_t yPart, int16_t wBitmap,
+                           int16_t hBitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool, bool,
+                           bool) override;
+  void refresh(bool partialUpdateMode) override;
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) override;
+  void powerOff() override {}
+  void hibernate() override {}
+
+ private:
+  // Copies a byte-aligned window out of a wBitmap x hBitmap bitmap into `to`
+  void put(uint8_t* to, const uint8_t* bitmap, int16_t xPart, int16_t yPart, int16_t wBitmap,
+           int16_t hBitmap, int16_t x, int16_t y, int16_t w, int16_t h);
+  void busy(uint16_t ms);
+};
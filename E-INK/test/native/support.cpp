@@ -0,0 +1,116 @@
+#include "support.h"
+
+#include <WiFi.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <unity.h>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Relative to this file, so suites find the data whatever the working dir
+std::string readFixture(const char* name) {
+  std::string path = __FILE__;
+  size_t slash = path.find_last_of("/\\");
+  path = (slash == std::string::npos ? std::string(".") : path.substr(0, slash)) + "/data/" + name;
+
+  std::ifstream in(path, std::ios::binary);
+  std::stringstream out;
+  out << in.rdbuf();
+  return out.str();
+}
+
+size_t MemStream::readBytes(char* buf, size_t len) {
+  size_t n = body.size() - pos < len ? body.size() - pos : len;
+  memcpy(buf, body.data() + pos, n);
+  pos += n;
+  return n;
+}
+
+std::vector<uint8_t> unpackBitmap(const PackedBitmap& bmp) {
+  const size_t size = (size_t)(bmp.w + 7) / 8 * bmp.h;
+  std::vector<uint8_t> out;
+  const uint8_t* p = bmp.data;
+  while (out.size() < size) {
+    uint8_t t = *p++;
+    if (t < PACK_ZERO) {
+      out.insert(out.end(), p, p + t + 1);
+      p += t + 1;
+    } else if (t < PACK_REPEAT) {
+      int n = (((t & 0x3F) << 8) | *p++) + 1;
+      out.insert(out.end(), n, 0x00);
+    } else {
+      int n = (t & 0x3F) + 1;
+      out.insert(out.end(), n, *p++);
+    }
+  }
+  out.resize(size);
+  return out;
+}
+
+static pid_t server = -1;
+
+static std::string serverDir() {
+  const char* dir = getenv("LOCAL_SERVER_DIR");
+  if (dir) return dir;
+  std::string path = __FILE__;
+  size_t slash = path.find_last_of("/\\");
+  path = slash == std::string::npos ? std::string(".") : path.substr(0, slash);
+  return path + "/../../../local_server";
+}
+
+static bool serverUp(uint16_t port) {
+  WiFiClient probe;
+  return probe.connect(IPAddress(127, 0, 0, 1), port, 200);
+}
+
+bool localServerStart(uint16_t port) {
+  std::string dir = serverDir();
+  std::string portText = std::to_string(port);
+  server = fork();
+  if (server < 0) return false;
+  if (server == 0) {
+    if (chdir(dir.c_str()) != 0) _exit(127);
+    setenv("FAKE_MTA", "1", 1);
+    setenv("PORT", portText.c_str(), 1);
+    if (!freopen("/dev/null", "w", stdout)) _exit(127);
+    if (!freopen("/dev/null", "w", stderr)) _exit(127);
+    execlp("node", "node", "server.js", (char*)nullptr);
+    _exit(127);
+  }
+
+  for (int i = 0; i < 100; i++) {
+    if (waitpid(server, nullptr, WNOHANG) == server) {
+      server = -1;  // node missing, or server.js failed to load
+      return false;
+    }
+    if (serverUp(port)) return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  return false;
+}
+
+void localServerStop() {
+  if (server <= 0) return;
+  kill(server, SIGTERM);
+  waitpid(server, nullptr, 0);
+  server = -1;
+}
+
+FetchRecord fetchThroughTask(uint8_t feed, unsigned long ttlMs) {
+  static FetchRecord records[32];
+  fakeAdvanceMs(ttlMs + 1);
+  uint32_t asked = millis();  // the ring may be full, so look for a newer record, not a longer ring
+  fetchRequest(feed);
+  size_t n = 0;
+  for (int i = 0; i < 200; i++) {
+    n = fetchRecords(records, 32);
+    if (n && records[n - 1].atMs >= asked) return records[n - 1];
+    std::this_thread::sleep_for(std::chrono::milliseconds(25));
+  }
+  TEST_FAIL_MESSAGE("fetch did not finish");
+  return {};
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+
+#include <string>
+#include <vector>
+
+#include "api.h"
+#include "packed_bitmap.h"
+
+// Shared by the native test suites (built into each of them with the fake
+// core in this folder)
+
+// A whole file under test/native/data/, empty if it is missing
+std::string readFixture(const char* name);
+
+// A packed bitmap expanded to plain rows of (w + 7) / 8 bytes, the way
+// drawBitmap() takes them; decoded here from the format description, not
+// with EpdFrame's reader
+std::vector<uint8_t> unpackBitmap(const PackedBitmap& bmp);
+
+// Runs `node server.js` from local_server with FAKE_MTA=1 on `port`
+// (LOCAL_SERVER_DIR overrides the folder) and waits until it answers; false
+// when it cannot be started, e.g. without node or `npm install` there
+bool localServerStart(uint16_t port);
+void localServerStop();
+
+// One fetch of `feed` (FEED_*) through the fetch task, as loop() would ask
+// for it; the fake clock is moved past `ttlMs` so it reaches the network
+FetchRecord fetchThroughTask(uint8_t feed, unsigned long ttlMs);
+
+// Serves a recorded body the way the socket would, for the decoders
+class MemStream : public Stream {
+ public:
+  explicit MemStream(const std::string& body) : body(body) {}
+
+  int available() override { return (int)(body.size() - pos); }
+  int read() override { return pos < body.size() ? (uint8_t)body[pos++] : -1; }
+  int peek() override { return pos < body.size() ? (uint8_t)body[pos] : -1; }
+  size_t readBytes(char* buf, size_t len) override;
+  size_t write(uint8_t) override { return 0; }
+
+ private:
+  const std::string& body;
+  size_t pos = 0;
+};
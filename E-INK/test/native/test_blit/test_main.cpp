@@ -0,0 +1,191 @@
+// EpdFrame::drawBitmap's byte-wise blit against Adafruit_GFX's pixel loop:
+// same pixels for every bit offset and clipped edge, and on the weather
+// screen's icon row, which is also timed both ways. The timing is only
+// printed, never checked; host times, the ratio is what carries over.
+#include <Arduino.h>
+#include <unity.h>
+
+#include <chrono>
+#include <vector>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+#include "icon.h"
+#include "support.h"
+
+static const int W = FakePanel::PANEL_W;
+static const int H = FakePanel::PANEL_H;
+static const int ROUNDS = 40;
+
+static FakePanel panel;
+static EpdFrame frame(panel, 0);
+static GFXcanvas1 reference(W, H);   // Adafruit_GFX's own drawBitmap
+
+static std::vector<uint8_t> noise(size_t n, unsigned seed) {
+  srand(seed);
+  std::vector<uint8_t> out(n);
+  for (uint8_t& b : out) b = (uint8_t)rand();
+  return out;
+}
+
+// Both canvases from the same background, one bitmap drawn on each
+static void drawBoth(const std::vector<uint8_t>& background, int16_t x, int16_t y,
+                     const uint8_t* bmp, int16_t w, int16_t h, uint16_t color, bool opaque) {
+  memcpy(frame.getBuffer(), background.data(), background.size());
+  memcpy(reference.getBuffer(), background.data(), background.size());
+  uint16_t bg = color == GxEPD_BLACK ? GxEPD_WHITE : GxEPD_BLACK;
+  if (opaque) {
+    frame.drawBitmap(x, y, bmp, w, h, color, bg);
+    reference.drawBitmap(x, y, bmp, w, h, color, bg);
+  } else {
+    frame.drawBitmap(x, y, bmp, w, h, color);
+    reference.drawBitmap(x, y, bmp, w, h, color);
+  }
+}
+
+static void assertSameAt(int16_t x, int16_t y, int16_t w, bool opaque) {
+  if (memcmp(frame.getBuffer(), reference.getBuffer(), FakePanel::RAM_BYTES) == 0) return;
+  char msg[80];
+  snprintf(msg, sizeof(msg), "differs at x %d y %d w %d %s", x, y, w, opaque ? "opaque" : "transparent");
+  TEST_FAIL_MESSAGE(msg);
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(frame.begin());
+}
+
+void tearDown() {}
+
+// Every x % 8, in the middle and clipped at the left and right edges; the
+// padding bits past w are random and must not show
+void test_shifted_and_clipped_columns_match_gfx() {
+  const std::vector<uint8_t> background = noise(FakePanel::RAM_BYTES, 1);
+  const int16_t widths[] = {1, 7, 21, 48, 160};
+  for (int16_t w : widths) {
+    const int16_t h = 12;
+    const std::vector<uint8_t> bmp = noise((size_t)(w + 7) / 8 * h, w);
+    std::vector<int16_t> xs;
+    for (int16_t d = -20; d <= 20; d++) {
+      xs.push_back(d - w / 2);       // left edge
+      xs.push_back(400 + d);         // inside
+      xs.push_back(W - w / 2 + d);   // right edge
+    }
+    xs.push_back(-w);                // just off either side
+    xs.push_back(W);
+    for (int16_t x : xs) {
+      for (int opaque = 0; opaque < 2; opaque++) {
+        for (uint16_t color : {GxEPD_BLACK, GxEPD_WHITE}) {
+          drawBoth(background, x, 100, bmp.data(), w, h, color, opaque);
+          assertSameAt(x, 100, w, opaque);
+        }
+      }
+    }
+  }
+}
+
+void test_clipped_rows_match_gfx() {
+  const std::vector<uint8_t> background = noise(FakePanel::RAM_BYTES, 2);
+  const int16_t w = 37, h = 30;
+  const std::vector<uint8_t> bmp = noise((size_t)(w + 7) / 8 * h, 3);
+  const int16_t ys[] = {-h, -h + 1, -17, -1, 0, H - h, H - 13, H - 1, H};
+  for (int16_t y : ys) {
+    for (int16_t x : {(int16_t)-5, (int16_t)203, (int16_t)(W - 30)}) {
+      for (int opaque = 0; opaque < 2; opaque++) {
+        drawBoth(background, x, y, bmp.data(), w, h, GxEPD_BLACK, opaque);
+        assertSameAt(x, y, w, opaque);
+      }
+    }
+  }
+}
+
+// Paged, the band clips rows as well: what reaches the panel is still
+// Adafruit_GFX's picture
+static std::vector<uint8_t> bandBitmap;
+
+static void bandScene(EpdFrame& f, int) {
+  f.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 24; i++) {
+    f.drawBitmap(i * 33 - 9, i * 19 - 25, bandBitmap.data(), 45, 70, GxEPD_BLACK, i % 3 ? GxEPD_WHITE : GxEPD_BLACK);
+  }
+}
+
+void test_paged_bands_match_gfx() {
+  bandBitmap = noise((size_t)(45 + 7) / 8 * 70, 4);
+  FakePanel banded;
+  EpdFrame paged(banded, 60);
+  TEST_ASSERT_TRUE(paged.begin());
+  paged.drawPaged(bandScene, 0, true);
+
+  reference.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 24; i++) {
+    reference.drawBitmap(i * 33 - 9, i * 19 - 25, bandBitmap.data(), 45, 70, GxEPD_BLACK,
+                         i % 3 ? GxEPD_WHITE : GxEPD_BLACK);
+  }
+  TEST_ASSERT_EQUAL_MEMORY(reference.getBuffer(), banded.ram, FakePanel::RAM_BYTES);
+}
+
+// ---------------- Weather screen benchmark ----------------
+// The icon row of the weather screen (160 / 200 / 160 px, opaque, at the
+// columns main.cpp uses) redrawn and sent with a partial refresh, once
+// through the blit and once through Adafruit_GFX's pixel loop. `shift`
+// moves the icons off the byte grid.
+struct IconRow {
+  std::vector<uint8_t> left, mid, right;
+};
+
+static void weatherPartial(EpdFrame& f, const IconRow& icons, int shift, bool perPixel) {
+  const int16_t xs[3] = {(int16_t)(40 + shift), (int16_t)(300 + shift), (int16_t)(560 + shift)};
+  const int16_t sizes[3] = {160, 200, 160};
+  const uint8_t* bitmaps[3] = {icons.left.data(), icons.mid.data(), icons.right.data()};
+  f.fillRect(0, 35, W, 445, GxEPD_WHITE);
+  for (int i = 0; i < 3; i++) {
+    if (perPixel) f.Adafruit_GFX::drawBitmap(xs[i], 45, bitmaps[i], sizes[i], sizes[i], GxEPD_BLACK, GxEPD_WHITE);
+    else f.drawBitmap(xs[i], 45, bitmaps[i], sizes[i], sizes[i], GxEPD_BLACK, GxEPD_WHITE);
+  }
+  f.update();
+}
+
+static IconRow iconRow(uint8_t category, int isDay) {
+  return {unpackBitmap(*WEATHER_ICONS[ICON_SIZE_160][category][isDay]),
+          unpackBitmap(*WEATHER_ICONS[ICON_SIZE_200][category][isDay]),
+          unpackBitmap(*WEATHER_ICONS[ICON_SIZE_160][category][!isDay])};
+}
+
+// Microseconds per update, alternating two icon rows so every one sends
+static double timeWeatherPartial(EpdFrame& f, const IconRow* rows, int shift, bool perPixel) {
+  weatherPartial(f, rows[1], shift, perPixel);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ROUNDS; i++) weatherPartial(f, rows[i & 1], shift, perPixel);
+  std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - start;
+  return took.count() / ROUNDS;
+}
+
+void test_weather_partial_is_the_same_and_timed() {
+  const IconRow rows[2] = {iconRow(WX_RAIN, 1), iconRow(WX_CLOUDY, 0)};
+  for (int shift : {0, 3}) {
+    FakePanel fastPanel, slowPanel;
+    EpdFrame fast(fastPanel, 0), slow(slowPanel, 0);
+    TEST_ASSERT_TRUE(fast.begin());
+    TEST_ASSERT_TRUE(slow.begin());
+    fast.update();
+    slow.update();
+
+    double blit = timeWeatherPartial(fast, rows, shift, false);
+    double pixels = timeWeatherPartial(slow, rows, shift, true);
+    TEST_ASSERT_EQUAL_MEMORY(slowPanel.ram, fastPanel.ram, FakePanel::RAM_BYTES);
+
+    char line[120];
+    snprintf(line, sizeof(line), "weather partial, x %% 8 = %d: Adafruit_GFX %8.1f us  blit %7.1f us  (%.1fx)",
+             shift, pixels, blit, pixels / blit);
+    TEST_MESSAGE(line);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_shifted_and_clipped_columns_match_gfx);
+  RUN_TEST(test_clipped_rows_match_gfx);
+  RUN_TEST(test_paged_bands_match_gfx);
+  RUN_TEST(test_weather_partial_is_the_same_and_timed);
+  return UNITY_END();
+}
@@ -0,0 +1,115 @@
+// Conditional GET against the real local_server: the second request for an
+// unchanged feed must come back 304 with no body, and the snapshot the
+// screen draws from must stay as it was.
+//
+// Starts `node server.js` in ../local_server with FAKE_MTA=1 on port 18787
+// (LOCAL_SERVER_DIR overrides the folder). The tests are ignored when the
+// server cannot be started, e.g. without node or `npm install` there.
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include <unity.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "api.h"
+#include "support.h"
+
+static const uint16_t PORT = 18787;
+static const char* URL = "http://127.0.0.1:18787/mta?fmt=bin&v=2";  // what the firmware asks for
+static const unsigned long MTA_TTL = 60000;                         // MTA_TTL_MS in api.cpp
+
+static bool serverRunning = false;
+
+static FetchRecord fetchMta() {
+  return fetchThroughTask(FEED_MTA, MTA_TTL);
+}
+
+void setUp() {
+  if (!serverRunning) TEST_IGNORE_MESSAGE("local_server not running (node, npm install in local_server)");
+}
+
+void tearDown() {}
+
+// What the proxy puts on the wire, seen from a plain HTTPClient
+void test_304_has_no_body() {
+  const char* keys[] = {"ETag"};
+  for (int attempt = 0; attempt < 3; attempt++) {
+    WiFiClient client;
+    HTTPClient http;
+    http.begin(client, URL);
+    http.collectHeaders(keys, 1);
+    TEST_ASSERT_EQUAL_INT(200, http.GET());
+    String etag = http.header("ETag");
+    TEST_ASSERT_FALSE(etag.isEmpty());
+    std::string body(http.getSize(), '\0');
+    TEST_ASSERT_EQUAL_size_t(body.size(), client.readBytes(&body[0], body.size()));
+    http.end();
+
+    http.begin(client, URL);
+    http.collectHeaders(keys, 1);
+    http.addHeader("If-None-Match", etag);
+    int code = http.GET();
+    if (code == 200) continue;  // the fake feed slipped a train in between
+
+    TEST_ASSERT_EQUAL_INT(304, code);
+    TEST_ASSERT_TRUE(http.getSize() <= 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));  // anything trailing would be here by now
+    TEST_ASSERT_EQUAL_INT(0, client.available());
+    TEST_ASSERT_TRUE(client.connected());  // and the socket stays open for the next one
+    http.end();
+    return;
+  }
+  TEST_FAIL_MESSAGE("feed changed between every pair of requests");
+}
+
+// The firmware's own path: fetch task, If-None-Match from the stored ETag,
+// flight recorder, published snapshot
+void test_second_fetch_is_304_and_keeps_the_snapshot() {
+  MTA_URL = URL;
+  fetchTaskStart();
+
+  FetchRecord first = fetchMta();
+  TEST_ASSERT_EQUAL_INT16(200, first.status);
+  TEST_ASSERT_EQUAL_UINT8(FETCH_UPDATED, first.result);
+  TEST_ASSERT_TRUE(first.bytes > 0);
+
+  for (int attempt = 0; attempt < 3; attempt++) {
+    MtaSnapshot shown = {};
+    TEST_ASSERT_TRUE(mtaLatest(shown));
+    uint32_t savedBefore = fetchBytesSaved();
+
+    FetchRecord second = fetchMta();
+    if (second.status == 200) {  // the fake feed slipped a train in between
+      first = second;
+      continue;
+    }
+
+    TEST_ASSERT_EQUAL_INT16(304, second.status);
+    TEST_ASSERT_EQUAL_UINT8(FETCH_NOT_MODIFIED, second.result);
+    TEST_ASSERT_EQUAL_UINT32(0, second.bytes);
+    TEST_ASSERT_TRUE(second.reused);
+    TEST_ASSERT_EQUAL_UINT32(first.bytes, fetchBytesSaved() - savedBefore);
+
+    // Nothing newer was published, and what is there is what was shown
+    MtaSnapshot after = shown;
+    TEST_ASSERT_FALSE(mtaLatest(after));
+    MtaSnapshot latest = {};
+    TEST_ASSERT_TRUE(mtaLatest(latest));
+    TEST_ASSERT_EQUAL_MEMORY(&shown, &latest, sizeof(shown));
+    return;
+  }
+  TEST_FAIL_MESSAGE("feed changed between every pair of fetches");
+}
+
+int main() {
+  serverRunning = localServerStart(PORT);
+  UNITY_BEGIN();
+  RUN_TEST(test_304_has_no_body);
+  RUN_TEST(test_second_fetch_is_304_and_keeps_the_snapshot);
+  int failures = UNITY_END();
+  localServerStop();
+  return failures;
+}
@@ -0,0 +1,217 @@
+// The JSON half of a fetch cycle must not touch the heap: decoding the
+// recorded /mta and /weather bodies, the way api.cpp does, is run many times
+// with every malloc and operator new counted. The whole cycle does allocate
+// (HTTPClient builds its request and header Strings on every GET), so for
+// that the check is that nothing stays behind: fetches through the fetch
+// task against local_server, started as in test_conditional_get, must free
+// every block they take. That part is ignored without node or
+// `npm install` in local_server.
+#include <Arduino.h>
+#include <unity.h>
+
+#include <atomic>
+#include <new>
+#include <string>
+
+#include "api.h"
+#include "payload_gen.h"
+#include "support.h"
+
+static std::atomic<bool> counting{false};
+static std::atomic<unsigned> allocations{0};
+static std::atomic<unsigned> frees{0};
+
+// glibc lets the program replace malloc and friends outright; elsewhere only
+// operator new is counted
+#ifdef __GLIBC__
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t n, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+extern "C" void __libc_free(void* ptr);
+
+extern "C" void* malloc(size_t size) {
+  if (counting) allocations++;
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t n, size_t size) {
+  if (counting) allocations++;
+  return __libc_calloc(n, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+  if (counting) {
+    if (size) allocations++;
+    if (ptr) frees++;
+  }
+  return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void* ptr) {
+  if (counting && ptr) frees++;
+  __libc_free(ptr);
+}
+
+static void* heapAlloc(size_t size) {
+  return malloc(size);
+}
+
+static void heapFree(void* p) {
+  free(p);
+}
+#else
+static void* heapAlloc(size_t size) {
+  if (counting) allocations++;
+  return malloc(size);
+}
+
+static void heapFree(void* p) {
+  if (counting && p) frees++;
+  free(p);
+}
+#endif
+
+void* operator new(size_t size) {
+  void* p = heapAlloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+  heapFree(p);
+}
+
+void operator delete[](void* p) noexcept {
+  heapFree(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  heapFree(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  heapFree(p);
+}
+
+// Same sink as weatherDecodeJson in api.cpp
+static WeatherSeries series;
+
+static void weatherHour(int i, const WeatherHour& h) {
+  if (i < WEATHER_MAX) series.set(i, h.temp, h.prec, h.code, h.day);
+}
+
+static bool decodeCycle(const std::string& mtaBody, const std::string& weatherBody, MtaPayload& mta,
+                        WeatherPayload& weather) {
+  MemStream ms(mtaBody);
+  JsonCursor mtaIn(ms);
+  bool ok = decodeMtaPayload(mtaIn, mta);
+
+  MemStream ws(weatherBody);
+  JsonCursor weatherIn(ws);
+  weather.hourly = weatherHour;
+  return decodeWeatherPayload(weatherIn, weather) && ok;
+}
+
+static const uint16_t PORT = 18787;
+static const char* MTA_BIN_URL = "http://127.0.0.1:18787/mta?fmt=bin&v=2";  // what the firmware asks for
+static const char* MTA_JSON_URL = "http://127.0.0.1:18787/mta";
+static const unsigned long MTA_TTL = 60000;                                  // MTA_TTL_MS in api.cpp
+static bool serverRunning = false;
+
+// JSON then binary, each asked for twice: the first of a pair is a 200 with
+// a body to decode (the ETag is for the other format), the second usually
+// a 304
+static void fetchCycle() {
+  static const char* const urls[] = {MTA_JSON_URL, MTA_JSON_URL, MTA_BIN_URL, MTA_BIN_URL};
+  for (const char* url : urls) {
+    MTA_URL = url;
+    FetchRecord rec = fetchThroughTask(FEED_MTA, MTA_TTL);
+    TEST_ASSERT_NOT_EQUAL_UINT8(FETCH_FAILED, rec.result);
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+// Make sure the hooks are live, or a zero below would prove nothing
+void test_counter_sees_the_heap() {
+  allocations = 0;
+  counting = true;
+  {
+    std::string s(100, 'x');
+    s += s;
+  }
+  counting = false;
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT(2, allocations.load());
+}
+
+void test_fixtures_decode() {
+  std::string mtaBody = readFixture("mta.json");
+  std::string weatherBody = readFixture("weather.json");
+  TEST_ASSERT_FALSE(mtaBody.empty());
+  TEST_ASSERT_FALSE(weatherBody.empty());
+
+  MtaPayload mta;
+  WeatherPayload weather;
+  TEST_ASSERT_TRUE(decodeCycle(mtaBody, weatherBody, mta, weather));
+  TEST_ASSERT_EQUAL_UINT8(5, mta.northCount);
+  TEST_ASSERT_EQUAL_UINT8(5, mta.southCount);
+  TEST_ASSERT_EQUAL_CHAR('Q', mta.north[0].train);
+  TEST_ASSERT_EQUAL_UINT32(1792167930u, mta.north[0].at);
+  TEST_ASSERT_EQUAL_INT(-1, mta.north[0].minutes);  // JSON bodies no longer carry it
+  TEST_ASSERT_EQUAL_INT(15, weather.startIndex);
+  TEST_ASSERT_EQUAL_UINT8(57, weather.hourlyCount);
+  TEST_ASSERT_EQUAL_INT(60, series.tempF(0));
+  TEST_ASSERT_EQUAL_INT(61, series.weatherCode(0));
+}
+
+void test_decode_cycles_do_not_allocate() {
+  std::string mtaBody = readFixture("mta.json");
+  std::string weatherBody = readFixture("weather.json");
+  MtaPayload mta;
+  WeatherPayload weather;
+
+  bool ok = true;
+  allocations = 0;
+  counting = true;
+  for (int cycle = 0; cycle < 100; cycle++) ok = decodeCycle(mtaBody, weatherBody, mta, weather) && ok;
+  counting = false;
+
+  TEST_ASSERT_TRUE(ok);
+  TEST_ASSERT_EQUAL_UINT(0, allocations.load());
+}
+
+void test_fetch_cycles_keep_no_blocks() {
+  if (!serverRunning) TEST_IGNORE_MESSAGE("local_server not running (node, npm install in local_server)");
+  fetchTaskStart();
+  fetchCycle();  // opens the connection and sizes whatever is kept with it
+
+  allocations = 0;
+  frees = 0;
+  counting = true;
+  const int cycles = 20;
+  for (int cycle = 0; cycle < cycles; cycle++) fetchCycle();
+  counting = false;
+
+  char line[96];
+  snprintf(line, sizeof(line), "%.1f allocations per fetch (fake core), %d blocks kept after %d fetches",
+           allocations.load() / (cycles * 4.0), (int)(allocations.load() - frees.load()), cycles * 4);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL_INT(0, (int)(allocations.load() - frees.load()));
+}
+
+int main() {
+  serverRunning = localServerStart(PORT);
+  UNITY_BEGIN();
+  RUN_TEST(test_counter_sees_the_heap);
+  RUN_TEST(test_fixtures_decode);
+  RUN_TEST(test_decode_cycles_do_not_allocate);
+  RUN_TEST(test_fetch_cycles_keep_no_blocks);
+  int failures = UNITY_END();
+  localServerStop();
+  return failures;
+}
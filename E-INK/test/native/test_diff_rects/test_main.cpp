@@ -0,0 +1,153 @@
+// EpdFrame's diff layer: after every update the panel RAM must hold exactly
+// the frame, written as a few byte-aligned rectangles around what changed,
+// and an unchanged picture must not be sent or refreshed at all.
+#include <Arduino.h>
+#include <unity.h>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+
+static FakePanel panel;
+static EpdFrame frame(panel, 0);
+
+static void assertPanelHoldsFrame() {
+  TEST_ASSERT_EQUAL_MEMORY(frame.getBuffer(), panel.ram, FakePanel::RAM_BYTES);
+  TEST_ASSERT_EQUAL_MEMORY(panel.ram, panel.again, FakePanel::RAM_BYTES);
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(frame.begin());
+  frame.fillScreen(GxEPD_WHITE);
+  frame.fillRect(0, 0, 800, 40, GxEPD_BLACK);
+  frame.update();  // the first one is a full refresh
+  panel.clearLog();
+}
+
+void tearDown() {}
+
+void test_first_update_is_full() {
+  EpdFrame fresh(panel, 0);
+  TEST_ASSERT_TRUE(fresh.begin());
+  panel.clearLog();
+  TEST_ASSERT_EQUAL_INT(1, fresh.update());
+  TEST_ASSERT_EQUAL_UINT32(1, panel.fulls);
+  TEST_ASSERT_EQUAL_UINT32(0, panel.partials);
+  TEST_ASSERT_EQUAL_UINT32(FakePanel::RAM_BYTES, panel.bytes);
+}
+
+void test_unchanged_picture_is_skipped() {
+  uint32_t skipped = frame.stats().skipped;
+  frame.fillRect(0, 0, 800, 40, GxEPD_BLACK);  // drawn again, same pixels
+  TEST_ASSERT_EQUAL_INT(0, frame.update());
+  TEST_ASSERT_EQUAL_UINT32(skipped + 1, frame.stats().skipped);
+  TEST_ASSERT_EQUAL_UINT32(0, panel.partials);
+  TEST_ASSERT_EQUAL_UINT(0, panel.writes.size());
+}
+
+// One glyph-sized change off the byte grid: one rectangle, widened to whole
+// bytes and no further
+void test_small_change_sends_one_aligned_rect() {
+  frame.fillRect(213, 117, 5, 9, GxEPD_BLACK);
+  TEST_ASSERT_EQUAL_INT(1, frame.update());
+  TEST_ASSERT_EQUAL_UINT(1, panel.writes.size());
+
+  const FakePanel::Window& r = panel.writes[0];
+  TEST_ASSERT_EQUAL_INT16(208, r.x);
+  TEST_ASSERT_EQUAL_INT16(117, r.y);
+  TEST_ASSERT_EQUAL_INT16(16, r.w);
+  TEST_ASSERT_EQUAL_INT16(9, r.h);
+  TEST_ASSERT_EQUAL_UINT32(2 * 9, panel.bytes);
+  TEST_ASSERT_EQUAL_UINT32(1, panel.partials);
+  TEST_ASSERT_EQUAL_INT16(208, panel.refreshed.x);
+  TEST_ASSERT_EQUAL_INT16(16, panel.refreshed.w);
+  assertPanelHoldsFrame();
+}
+
+// Far apart changes go as separate rectangles under one refresh covering both
+void test_distant_changes_send_separate_rects() {
+  frame.fillRect(16, 100, 16, 10, GxEPD_BLACK);
+  frame.fillRect(704, 400, 24, 20, GxEPD_BLACK);
+  TEST_ASSERT_EQUAL_INT(2, frame.update());
+  TEST_ASSERT_EQUAL_UINT32(2 * 10 + 3 * 20, panel.bytes);
+  TEST_ASSERT_EQUAL_UINT32(1, panel.partials);
+  TEST_ASSERT_EQUAL_INT16(16, panel.refreshed.x);
+  TEST_ASSERT_EQUAL_INT16(100, panel.refreshed.y);
+  TEST_ASSERT_EQUAL_INT16(728 - 16, panel.refreshed.w);
+  TEST_ASSERT_EQUAL_INT16(420 - 100, panel.refreshed.h);
+  assertPanelHoldsFrame();
+}
+
+// Neighbours are cheaper as one rectangle than as two window setups
+void test_close_changes_are_merged() {
+  frame.fillRect(100, 200, 8, 8, GxEPD_BLACK);
+  frame.fillRect(124, 204, 8, 8, GxEPD_BLACK);
+  TEST_ASSERT_EQUAL_INT(1, frame.update());
+  assertPanelHoldsFrame();
+}
+
+// Scattered changes never take more than MAX_RECTS, and nothing is missed
+void test_scattered_changes_are_capped() {
+  srand(7);
+  for (int round = 0; round < 20; round++) {
+    for (int i = 0; i < 40; i++) {
+      frame.fillRect(rand() % 800, rand() % 480, 1 + rand() % 30, 1 + rand() % 30,
+                     rand() % 2 ? GxEPD_BLACK : GxEPD_WHITE);
+    }
+    panel.clearLog();
+    int n = frame.update();
+    TEST_ASSERT_TRUE(n >= 0 && n <= EpdFrame::MAX_RECTS);
+    TEST_ASSERT_EQUAL_UINT((unsigned)n, panel.writes.size());
+    assertPanelHoldsFrame();
+  }
+}
+
+// diff() reports the same rectangles update() then sends
+void test_diff_matches_update() {
+  frame.fillRect(300, 50, 40, 3, GxEPD_BLACK);
+  frame.fillRect(10, 300, 3, 40, GxEPD_BLACK);
+  EpdFrame::Rect rects[EpdFrame::MAX_RECTS];
+  int n = frame.diff(rects);
+  TEST_ASSERT_EQUAL_INT(n, frame.update());
+  for (int i = 0; i < n; i++) {
+    TEST_ASSERT_EQUAL_INT16(rects[i].x, panel.writes[i].x);
+    TEST_ASSERT_EQUAL_INT16(rects[i].y, panel.writes[i].y);
+    TEST_ASSERT_EQUAL_INT16(rects[i].w, panel.writes[i].w);
+    TEST_ASSERT_EQUAL_INT16(rects[i].h, panel.writes[i].h);
+  }
+}
+
+static void scene(EpdFrame& f, int seed) {
+  srand(seed);
+  f.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 30; i++) {
+    f.fillRect(rand() % 800, rand() % 480, 1 + rand() % 60, 1 + rand() % 60, GxEPD_BLACK);
+  }
+}
+
+// A frame drawn in 60-row bands leaves the panel as the whole frame does
+void test_paged_frame_sends_the_same_picture() {
+  FakePanel whole, banded;
+  EpdFrame a(whole, 0), b(banded, 60);
+  TEST_ASSERT_TRUE(a.begin());
+  TEST_ASSERT_TRUE(b.begin());
+  for (int step = 0; step < 10; step++) {
+    a.drawPaged(scene, step, step == 0);
+    b.drawPaged(scene, step, step == 0);
+    TEST_ASSERT_EQUAL_MEMORY(whole.ram, banded.ram, FakePanel::RAM_BYTES);
+    TEST_ASSERT_EQUAL_MEMORY(banded.ram, banded.again, FakePanel::RAM_BYTES);
+  }
+  TEST_ASSERT_EQUAL_UINT32(a.stats().partial, b.stats().partial);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_update_is_full);
+  RUN_TEST(test_unchanged_picture_is_skipped);
+  RUN_TEST(test_small_change_sends_one_aligned_rect);
+  RUN_TEST(test_distant_changes_send_separate_rects);
+  RUN_TEST(test_close_changes_are_merged);
+  RUN_TEST(test_scattered_changes_are_capped);
+  RUN_TEST(test_diff_matches_update);
+  RUN_TEST(test_paged_frame_sends_the_same_picture);
+  return UNITY_END();
+}
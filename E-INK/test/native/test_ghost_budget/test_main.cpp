@@ -0,0 +1,151 @@
+// The ghosting budget: partial refreshes are counted per 100x120 region
+// they touch, cleanupDue() turns true at EPD_GHOST_PARTIALS in one region
+// or EPD_GHOST_MINUTES after the last full refresh (once partials followed
+// it), and a full refresh starts over.
+#include <Arduino.h>
+#include <unity.h>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+
+static const unsigned long BUDGET_MS = EPD_GHOST_MINUTES * 60000UL;
+
+static FakePanel panel;
+static EpdFrame* frame;
+
+// One partial refresh that changes the given box
+static void partialAt(int16_t x, int16_t y, int16_t w, int16_t h) {
+  frame->fillRect(x, y, w, h, frame->getPixel(x, y) ? GxEPD_BLACK : GxEPD_WHITE);
+  TEST_ASSERT_TRUE(frame->update() > 0);
+}
+
+static uint32_t totalCount() {
+  uint32_t n = 0;
+  for (int row = 0; row < EpdFrame::GHOST_ROWS; row++)
+    for (int col = 0; col < EpdFrame::GHOST_COLS; col++) n += frame->ghostCount(col, row);
+  return n;
+}
+
+void setUp() {
+  frame = new EpdFrame(panel, 0);
+  TEST_ASSERT_TRUE(frame->begin());
+  frame->updateFull();
+}
+
+void tearDown() {
+  delete frame;
+}
+
+void test_partials_count_in_the_regions_they_touch() {
+  partialAt(10, 10, 20, 20);   // region 0,0
+  TEST_ASSERT_EQUAL_UINT16(1, frame->ghostCount(0, 0));
+  TEST_ASSERT_EQUAL_UINT32(1, totalCount());
+
+  partialAt(190, 230, 20, 20);   // straddles columns 1-2 and rows 1-2
+  TEST_ASSERT_EQUAL_UINT16(1, frame->ghostCount(1, 1));
+  TEST_ASSERT_EQUAL_UINT16(1, frame->ghostCount(2, 1));
+  TEST_ASSERT_EQUAL_UINT16(1, frame->ghostCount(1, 2));
+  TEST_ASSERT_EQUAL_UINT16(1, frame->ghostCount(2, 2));
+  TEST_ASSERT_EQUAL_UINT32(5, totalCount());
+}
+
+// Several rectangles in one refresh count a region once
+void test_one_refresh_counts_a_region_once() {
+  frame->fillRect(8, 8, 8, 8, GxEPD_BLACK);
+  frame->fillRect(80, 100, 8, 8, GxEPD_BLACK);
+  frame->fillRect(704, 400, 8, 8, GxEPD_BLACK);
+  TEST_ASSERT_EQUAL_INT(3, frame->update());
+  TEST_ASSERT_EQUAL_UINT16(1, frame->ghostCount(0, 0));
+  TEST_ASSERT_EQUAL_UINT16(1, frame->ghostCount(7, 3));
+  TEST_ASSERT_EQUAL_UINT32(2, totalCount());
+}
+
+void test_skipped_updates_do_not_count() {
+  TEST_ASSERT_EQUAL_INT(0, frame->update());
+  TEST_ASSERT_EQUAL_UINT32(0, totalCount());
+  TEST_ASSERT_FALSE(frame->cleanupDue());
+}
+
+void test_due_at_the_partial_budget() {
+  for (int i = 0; i < EPD_GHOST_PARTIALS - 1; i++) partialAt(420, 250, 30, 30);
+  partialAt(20, 20, 10, 10);   // elsewhere: doesn't add up with the others
+  TEST_ASSERT_EQUAL_UINT16(EPD_GHOST_PARTIALS - 1, frame->ghostCount(4, 2));
+  TEST_ASSERT_FALSE(frame->cleanupDue());
+
+  partialAt(420, 250, 30, 30);
+  TEST_ASSERT_EQUAL_UINT16(EPD_GHOST_PARTIALS, frame->ghostCount(4, 2));
+  TEST_ASSERT_TRUE(frame->cleanupDue());
+}
+
+void test_due_after_the_time_budget() {
+  fakeAdvanceMs(BUDGET_MS * 2);   // only a full refresh so far: nothing to clean
+  TEST_ASSERT_FALSE(frame->cleanupDue());
+
+  frame->updateFull();
+  partialAt(20, 20, 10, 10);
+  fakeAdvanceMs(BUDGET_MS - 5000);
+  TEST_ASSERT_FALSE(frame->cleanupDue());
+  fakeAdvanceMs(10000);
+  TEST_ASSERT_TRUE(frame->cleanupDue());
+}
+
+// A full refresh clears the counts; one made while due counts as a cleanup
+void test_full_refresh_starts_over() {
+  for (int i = 0; i < EPD_GHOST_PARTIALS; i++) partialAt(620, 10, 30, 30);
+  TEST_ASSERT_TRUE(frame->cleanupDue());
+  uint32_t cleanups = frame->stats().cleanups;
+
+  frame->updateFull();
+  TEST_ASSERT_FALSE(frame->cleanupDue());
+  TEST_ASSERT_EQUAL_UINT32(0, totalCount());
+  TEST_ASSERT_EQUAL_UINT32(cleanups + 1, frame->stats().cleanups);
+
+  frame->updateFull();   // not due: not a cleanup
+  TEST_ASSERT_EQUAL_UINT32(cleanups + 1, frame->stats().cleanups);
+}
+
+void test_idle_time_follows_refreshes() {
+  partialAt(20, 20, 10, 10);
+  TEST_ASSERT_TRUE(frame->idleMs() < 1000);
+  fakeAdvanceMs(6000);
+  TEST_ASSERT_TRUE(frame->idleMs() >= 6000);
+  frame->update();   // skipped: still idle
+  TEST_ASSERT_TRUE(frame->idleMs() >= 6000);
+}
+
+// Bands count the regions of everything they sent, once per picture
+static int16_t boxX = 0;
+
+static void box(EpdFrame& f, int) {
+  f.fillScreen(GxEPD_WHITE);
+  f.fillRect(boxX, 100, 40, 200, GxEPD_BLACK);   // rows 0-2 of the regions
+}
+
+void test_paged_frames_count_the_same() {
+  FakePanel banded;
+  EpdFrame paged(banded, 60);
+  TEST_ASSERT_TRUE(paged.begin());
+  paged.drawPaged(box, 0, true);
+  boxX = 304;
+  paged.drawPaged(box, 0);
+
+  TEST_ASSERT_EQUAL_UINT16(1, paged.ghostCount(0, 0));
+  TEST_ASSERT_EQUAL_UINT16(1, paged.ghostCount(0, 2));
+  TEST_ASSERT_EQUAL_UINT16(1, paged.ghostCount(3, 1));
+  TEST_ASSERT_EQUAL_UINT16(0, paged.ghostCount(0, 3));
+  TEST_ASSERT_EQUAL_UINT16(0, paged.ghostCount(1, 1));
+  TEST_ASSERT_EQUAL_UINT32(1, paged.stats().partial);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_partials_count_in_the_regions_they_touch);
+  RUN_TEST(test_one_refresh_counts_a_region_once);
+  RUN_TEST(test_skipped_updates_do_not_count);
+  RUN_TEST(test_due_at_the_partial_budget);
+  RUN_TEST(test_due_after_the_time_budget);
+  RUN_TEST(test_full_refresh_starts_over);
+  RUN_TEST(test_idle_time_follows_refreshes);
+  RUN_TEST(test_paged_frames_count_the_same);
+  return UNITY_END();
+}
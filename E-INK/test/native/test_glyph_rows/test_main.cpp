@@ -0,0 +1,114 @@
+// EpdFrame's GFXfont text, a glyph row at a time, against Adafruit_GFX's
+// pixel-by-pixel drawChar: same pixels and same cursor for the fonts the
+// screens use, at 1x to 3x, clipped at every edge and across paged bands.
+#include <Arduino.h>
+#include <Fonts/FreeMonoBold12pt7b.h>
+#include <Fonts/FreeMonoBold24pt7b.h>
+#include <Fonts/FreeMonoBold9pt7b.h>
+#include <unity.h>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+
+static const int W = FakePanel::PANEL_W;
+static const int H = FakePanel::PANEL_H;
+static const GFXfont* const FONTS[] = {&FreeMonoBold9pt7b, &FreeMonoBold12pt7b, &FreeMonoBold24pt7b};
+static const char TEXT[] = "12:34 Qg|~ -10F 0.25in";
+
+static FakePanel panel;
+static EpdFrame frame(panel, 0);
+static GFXcanvas1 reference(W, H);
+
+static void printAt(Adafruit_GFX& g, const GFXfont* font, uint8_t size, uint16_t color, int16_t x,
+                    int16_t y, const char* text) {
+  g.setFont(font);
+  g.setTextSize(size);
+  g.setTextColor(color);
+  g.setCursor(x, y);
+  g.print(text);
+}
+
+// Prints on both from the same background and compares pixels and cursor
+static void assertSameText(const GFXfont* font, uint8_t size, uint16_t color, int16_t x, int16_t y,
+                           const char* text) {
+  frame.fillScreen(GxEPD_WHITE);
+  reference.fillScreen(GxEPD_WHITE);
+  frame.fillRect(0, H / 2, W, H / 2, GxEPD_BLACK);   // white text shows on the lower half
+  reference.fillRect(0, H / 2, W, H / 2, GxEPD_BLACK);
+  printAt(frame, font, size, color, x, y, text);
+  printAt(reference, font, size, color, x, y, text);
+
+  char msg[80];
+  snprintf(msg, sizeof(msg), "font %d px, size %d, at %d,%d", font->yAdvance, size, x, y);
+  TEST_ASSERT_EQUAL_MEMORY_MESSAGE(reference.getBuffer(), frame.getBuffer(), FakePanel::RAM_BYTES, msg);
+  TEST_ASSERT_EQUAL_INT16_MESSAGE(reference.getCursorX(), frame.getCursorX(), msg);
+  TEST_ASSERT_EQUAL_INT16_MESSAGE(reference.getCursorY(), frame.getCursorY(), msg);
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(frame.begin());
+  frame.setTextWrap(true);
+  reference.setTextWrap(true);
+}
+
+void tearDown() {}
+
+void test_text_matches_gfx_at_every_offset() {
+  for (const GFXfont* font : FONTS) {
+    for (uint8_t size = 1; size <= 3; size++) {
+      for (int16_t dx = 0; dx < 8; dx++) {
+        assertSameText(font, size, GxEPD_BLACK, 10 + dx, 80, TEXT);
+        assertSameText(font, size, GxEPD_WHITE, 3 + dx, 400, TEXT);
+      }
+    }
+  }
+}
+
+// Glyphs hanging off the top, bottom, left and right of the frame
+void test_clipped_text_matches_gfx() {
+  const int16_t ys[] = {-30, 0, 5, 12, H - 5, H, H + 20};
+  for (const GFXfont* font : FONTS) {
+    for (uint8_t size = 1; size <= 2; size++) {
+      for (int16_t y : ys) {
+        assertSameText(font, size, GxEPD_BLACK, -13, y, TEXT);
+        assertSameText(font, size, GxEPD_BLACK, W - 37, y, "Qg");
+      }
+    }
+  }
+}
+
+// Wrapping moves the cursor the same way, newlines included
+void test_wrapped_text_matches_gfx() {
+  assertSameText(&FreeMonoBold24pt7b, 2, GxEPD_BLACK, 500, 60, "Wrapping text\nacross lines");
+  assertSameText(&FreeMonoBold9pt7b, 3, GxEPD_BLACK, 0, 30, "x\n\ny z");
+}
+
+// Rows split across 60-row bands, doubled rows on a band edge included
+static void bandText(EpdFrame& f, int) {
+  f.fillScreen(GxEPD_WHITE);
+  printAt(f, &FreeMonoBold24pt7b, 2, GxEPD_BLACK, 20, 119, "12:34");
+  printAt(f, &FreeMonoBold12pt7b, 3, GxEPD_BLACK, 7, 241, "Qg5");
+  printAt(f, &FreeMonoBold9pt7b, 1, GxEPD_BLACK, 403, 300, TEXT);
+}
+
+void test_paged_text_matches_gfx() {
+  FakePanel banded;
+  EpdFrame paged(banded, 60);
+  TEST_ASSERT_TRUE(paged.begin());
+  paged.drawPaged(bandText, 0, true);
+
+  reference.fillScreen(GxEPD_WHITE);
+  printAt(reference, &FreeMonoBold24pt7b, 2, GxEPD_BLACK, 20, 119, "12:34");
+  printAt(reference, &FreeMonoBold12pt7b, 3, GxEPD_BLACK, 7, 241, "Qg5");
+  printAt(reference, &FreeMonoBold9pt7b, 1, GxEPD_BLACK, 403, 300, TEXT);
+  TEST_ASSERT_EQUAL_MEMORY(reference.getBuffer(), banded.ram, FakePanel::RAM_BYTES);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_text_matches_gfx_at_every_offset);
+  RUN_TEST(test_clipped_text_matches_gfx);
+  RUN_TEST(test_wrapped_text_matches_gfx);
+  RUN_TEST(test_paged_text_matches_gfx);
+  return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// Packed icons (scripts/pack_icons.py, EpdFrame::drawPacked) against the
+// PBMs they were made from: every icon the tables point at unpacks to its
+// source image, and drawPacked() puts the same pixels in the frame as
+// drawBitmap() of the raw rows does, at any offset, clipped or paged.
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <unity.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+#include "icon.h"
+#include "support.h"
+
+static const int W = FakePanel::PANEL_W;
+static const int H = FakePanel::PANEL_H;
+
+static FakePanel panel;
+static EpdFrame frame(panel, 0);
+static GFXcanvas1 reference(W, H);
+
+// A file of the project (E-INK/), relative to this one
+static std::string projectFile(const std::string& name) {
+  std::string path = __FILE__;
+  size_t slash = path.find_last_of("/\\");
+  path = slash == std::string::npos ? std::string(".") : path.substr(0, slash);
+  std::ifstream in(path + "/../../../" + name, std::ios::binary);
+  std::stringstream out;
+  out << in.rdbuf();
+  return out.str();
+}
+
+// Raster of a binary (P4) PBM: rows of (w + 7) / 8 bytes, 1 = ink
+static std::vector<uint8_t> readPbm(const std::string& name, int& w, int& h) {
+  std::string data = projectFile("assets/icons/" + name + ".pbm");
+  std::istringstream in(data);
+  std::string magic;
+  in >> magic >> w >> h;
+  in.get();
+  TEST_ASSERT_EQUAL_STRING_MESSAGE("P4", magic.c_str(), name.c_str());
+  size_t size = (size_t)(w + 7) / 8 * h;
+  size_t at = (size_t)in.tellg();
+  TEST_ASSERT_TRUE_MESSAGE(data.size() >= at + size, name.c_str());
+  return std::vector<uint8_t>(data.begin() + at, data.begin() + at + size);
+}
+
+static void assertPackedIsPbm(const PackedBitmap& bmp, const std::string& name) {
+  int w = 0, h = 0;
+  std::vector<uint8_t> raw = readPbm(name, w, h);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(w, bmp.w, name.c_str());
+  TEST_ASSERT_EQUAL_INT_MESSAGE(h, bmp.h, name.c_str());
+  std::vector<uint8_t> unpacked = unpackBitmap(bmp);
+  TEST_ASSERT_EQUAL_MEMORY_MESSAGE(raw.data(), unpacked.data(), raw.size(), name.c_str());
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(frame.begin());
+}
+
+void tearDown() {}
+
+// WEATHER_ICONS[size][category][is_day] is what assets/icons.json says
+void test_tables_hold_the_source_images() {
+  JsonDocument manifest;
+  TEST_ASSERT_FALSE(deserializeJson(manifest, projectFile("assets/icons.json")));
+  JsonArray sizes = manifest["sizes"];
+  JsonArray categories = manifest["categories"];
+  TEST_ASSERT_EQUAL_UINT(ICON_SIZES, sizes.size());
+  TEST_ASSERT_EQUAL_UINT(WX_CATEGORIES, categories.size());
+
+  for (size_t s = 0; s < sizes.size(); s++) {
+    for (size_t k = 0; k < categories.size(); k++) {
+      int size = sizes[s];
+      std::string night = categories[k]["night"].as<std::string>() + "_" + std::to_string(size);
+      std::string day = categories[k]["day"].as<std::string>() + "_" + std::to_string(size);
+      assertPackedIsPbm(*WEATHER_ICONS[s][k][0], night);
+      assertPackedIsPbm(*WEATHER_ICONS[s][k][1], day);
+    }
+  }
+  assertPackedIsPbm(train_north, "train_north");
+  assertPackedIsPbm(train_south, "train_south");
+}
+
+// Both ways of drawing, from the same background
+static void assertSameDraw(const PackedBitmap& bmp, const std::vector<uint8_t>& rows,
+                           const std::vector<uint8_t>& background, int16_t x, int16_t y, bool opaque) {
+  memcpy(frame.getBuffer(), background.data(), background.size());
+  memcpy(reference.getBuffer(), background.data(), background.size());
+  if (opaque) {
+    frame.drawPacked(x, y, bmp, GxEPD_BLACK, GxEPD_WHITE);
+    reference.drawBitmap(x, y, rows.data(), bmp.w, bmp.h, GxEPD_BLACK, GxEPD_WHITE);
+  } else {
+    frame.drawPacked(x, y, bmp, GxEPD_BLACK);
+    reference.drawBitmap(x, y, rows.data(), bmp.w, bmp.h, GxEPD_BLACK);
+  }
+  char msg[80];
+  snprintf(msg, sizeof(msg), "%dx%d at %d,%d %s", bmp.w, bmp.h, x, y, opaque ? "opaque" : "transparent");
+  TEST_ASSERT_EQUAL_MEMORY_MESSAGE(reference.getBuffer(), frame.getBuffer(), FakePanel::RAM_BYTES, msg);
+}
+
+void test_draw_packed_matches_draw_bitmap() {
+  srand(5);
+  std::vector<uint8_t> background(FakePanel::RAM_BYTES);
+  for (uint8_t& b : background) b = (uint8_t)rand();
+
+  const PackedBitmap* icons[] = {WEATHER_ICONS[ICON_SIZE_200][WX_RAIN][1],
+                                 WEATHER_ICONS[ICON_SIZE_160][WX_THUNDER][0],
+                                 WEATHER_ICONS[ICON_SIZE_48][WX_SNOW][1], &train_north};
+  for (const PackedBitmap* bmp : icons) {
+    std::vector<uint8_t> rows = unpackBitmap(*bmp);
+    for (int opaque = 0; opaque < 2; opaque++) {
+      for (int16_t dx = 0; dx < 8; dx++) {
+        assertSameDraw(*bmp, rows, background, 40 + dx, 45, opaque);
+        assertSameDraw(*bmp, rows, background, -bmp->w / 2 + dx, -bmp->h / 3, opaque);
+        assertSameDraw(*bmp, rows, background, W - bmp->w / 2 + dx, H - bmp->h / 2, opaque);
+      }
+    }
+  }
+}
+
+// Rows above and below the band are read past, never drawn
+static const PackedBitmap* const ROW_ICONS[] = {WEATHER_ICONS[ICON_SIZE_160][WX_CLOUDY][1],
+                                                WEATHER_ICONS[ICON_SIZE_200][WX_FOG][0],
+                                                WEATHER_ICONS[ICON_SIZE_160][WX_CLEAR][1]};
+static const int16_t ROW_X[] = {40, 303, 560};
+
+static void pagedIcons(EpdFrame& f, int) {
+  f.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 3; i++) f.drawPacked(ROW_X[i], 45 + i * 31, *ROW_ICONS[i], GxEPD_BLACK);
+}
+
+void test_paged_icons_match_draw_bitmap() {
+  FakePanel banded;
+  EpdFrame paged(banded, 60);
+  TEST_ASSERT_TRUE(paged.begin());
+  paged.drawPaged(pagedIcons, 0, true);
+  reference.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 3; i++) {
+    std::vector<uint8_t> rows = unpackBitmap(*ROW_ICONS[i]);
+    reference.drawBitmap(ROW_X[i], 45 + i * 31, rows.data(), ROW_ICONS[i]->w, ROW_ICONS[i]->h, GxEPD_BLACK);
+  }
+  TEST_ASSERT_EQUAL_MEMORY(reference.getBuffer(), banded.ram, FakePanel::RAM_BYTES);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_tables_hold_the_source_images);
+  RUN_TEST(test_draw_packed_matches_draw_bitmap);
+  RUN_TEST(test_paged_icons_match_draw_bitmap);
+  return UNITY_END();
+}
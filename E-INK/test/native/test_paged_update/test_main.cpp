@@ -0,0 +1,127 @@
+// WidgetScreen::update() on a paged frame: the widgets are polled once and
+// every band draws that same data, so data that changes while the bands
+// are drawn can't tear the picture, and the panel ends up as the whole
+// frame would leave it.
+#include <Arduino.h>
+#include <unity.h>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+#include "widgets.h"
+
+static const int ROWS = 60;
+static uint32_t source = 1;   // the data behind the widgets, e.g. a snapshot
+
+// Stripes of the polled value across its bounds; counts polls and draws
+class Stripes : public Widget {
+ public:
+  Stripes(const Bounds& b, uint32_t salt) : Widget(b), salt(salt) {}
+
+  uint32_t poll() override {
+    polls++;
+    value = source + salt;
+    return value;
+  }
+
+  void draw(EpdFrame& f) override {
+    draws++;
+    for (int y = bounds.y; y < bounds.y + bounds.h; y += 10) {
+      f.drawFastHLine(bounds.x + value % 37, y, bounds.w - value % 37, GxEPD_BLACK);
+    }
+    if (onDraw) onDraw();
+  }
+
+  const uint32_t salt;
+  uint32_t value = 0;
+  int polls = 0, draws = 0;
+  void (*onDraw)() = nullptr;
+};
+
+static Stripes tall({100, 0, 200, 480}, 0);   // crosses every band
+static Stripes small({500, 130, 150, 40}, 7);
+static Widget* const WIDGETS[] = {&tall, &small};
+static WidgetScreen screen(WIDGETS, 2);
+
+static FakePanel panel;
+static EpdFrame paged(panel, ROWS);
+
+static void drawScreen(EpdFrame& f, int) {
+  screen.drawAll(f);
+}
+
+void setUp() {
+  source = 1;
+  tall.onDraw = nullptr;
+  TEST_ASSERT_TRUE(paged.begin());
+  screen.pollAll();
+  paged.drawPaged(drawScreen, 0, true);
+  tall.polls = tall.draws = small.polls = small.draws = 0;
+  panel.clearLog();
+}
+
+void tearDown() {}
+
+void test_polls_once_and_draws_every_band() {
+  source = 2;
+  TEST_ASSERT_TRUE(screen.update(paged));
+  TEST_ASSERT_EQUAL_INT(1, tall.polls);
+  TEST_ASSERT_EQUAL_INT(1, small.polls);
+  const int bands = FakePanel::PANEL_H / ROWS * 2;   // second pass: hasFastPartialUpdate
+  TEST_ASSERT_EQUAL_INT(bands, tall.draws);
+  TEST_ASSERT_EQUAL_UINT32(1, panel.partials);
+}
+
+void test_unchanged_data_draws_nothing() {
+  TEST_ASSERT_FALSE(screen.update(paged));
+  TEST_ASSERT_EQUAL_INT(1, tall.polls);
+  TEST_ASSERT_EQUAL_INT(0, tall.draws);
+  TEST_ASSERT_EQUAL_UINT32(0, panel.partials);
+}
+
+// New data arriving while the bands are drawn waits for the next update
+static void publish() {
+  source++;
+}
+
+void test_data_changing_mid_update_does_not_tear() {
+  source = 5;
+  tall.onDraw = publish;
+  TEST_ASSERT_TRUE(screen.update(paged));
+  tall.onDraw = nullptr;
+
+  FakePanel other;
+  EpdFrame whole(other, 0);
+  TEST_ASSERT_TRUE(whole.begin());
+  tall.value = 5;
+  small.value = 5 + small.salt;
+  screen.drawAll(whole);
+  TEST_ASSERT_EQUAL_MEMORY(whole.getBuffer(), panel.ram, FakePanel::RAM_BYTES);
+  TEST_ASSERT_EQUAL_MEMORY(panel.ram, panel.again, FakePanel::RAM_BYTES);
+}
+
+// Band by band or all at once, the panel shows the same
+void test_paged_updates_match_whole_frame_updates() {
+  FakePanel otherPanel;
+  EpdFrame whole(otherPanel, 0);
+  TEST_ASSERT_TRUE(whole.begin());
+  screen.render(whole, true);
+  whole.updateFull();
+
+  for (int step = 0; step < 20; step++) {
+    source = 3 + step * 5 % 11;
+    screen.update(paged);
+    // The widgets hold what was just polled; the whole frame draws the same
+    screen.drawAll(whole);
+    whole.update();
+    TEST_ASSERT_EQUAL_MEMORY(otherPanel.ram, panel.ram, FakePanel::RAM_BYTES);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_polls_once_and_draws_every_band);
+  RUN_TEST(test_unchanged_data_draws_nothing);
+  RUN_TEST(test_data_changing_mid_update_does_not_tear);
+  RUN_TEST(test_paged_updates_match_whole_frame_updates);
+  return UNITY_END();
+}
@@ -0,0 +1,133 @@
+// Generated decoders (payload_gen.cpp) against the ArduinoJson baseline
+// (payload_dom.cpp) on the recorded /mta and /weather bodies: both must
+// decode the same values. Times per decode are only printed, never checked,
+// so a busy machine cannot fail the run; they are host times, the ratio is
+// what carries over.
+#include <Arduino.h>
+#include <unity.h>
+
+#include <chrono>
+#include <string>
+
+#include "payload_dom.h"
+#include "payload_gen.h"
+#include "support.h"
+
+static const int ITERATIONS = 2000;
+
+static WeatherHour hours[72];
+
+static void keepHour(int i, const WeatherHour& h) {
+  hours[i] = h;
+}
+
+static void ignoreHour(int, const WeatherHour&) {}
+
+static bool decodeMtaGen(Stream& s, MtaPayload& p) {
+  JsonCursor in(s);
+  return decodeMtaPayload(in, p);
+}
+
+static bool decodeWeatherGen(Stream& s, WeatherPayload& p) {
+  JsonCursor in(s);
+  return decodeWeatherPayload(in, p);
+}
+
+// Microseconds per decode of `body`, after a warm-up round
+template <typename Payload>
+static double timeDecode(bool (*decode)(Stream&, Payload&), const std::string& body, Payload& p) {
+  for (int i = 0; i < ITERATIONS / 10; i++) {
+    MemStream s(body);
+    decode(s, p);
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; i++) {
+    MemStream s(body);
+    decode(s, p);
+  }
+  std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - start;
+  return took.count() / ITERATIONS;
+}
+
+static void report(const char* name, size_t bytes, double dom, double gen) {
+  char line[120];
+  snprintf(line, sizeof(line), "%-7s %5u B  DOM %7.2f us  generated %7.2f us  (%.1fx)", name,
+           (unsigned)bytes, dom, gen, dom / gen);
+  TEST_MESSAGE(line);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_mta_decoders_agree() {
+  std::string body = readFixture("mta.json");
+  TEST_ASSERT_FALSE(body.empty());
+
+  MtaPayload gen, dom;
+  MemStream a(body), b(body);
+  TEST_ASSERT_TRUE(decodeMtaGen(a, gen));
+  TEST_ASSERT_TRUE(decodeMtaPayloadDom(b, dom));
+
+  TEST_ASSERT_EQUAL_UINT8(gen.northCount, dom.northCount);
+  TEST_ASSERT_EQUAL_UINT8(gen.southCount, dom.southCount);
+  for (int i = 0; i < gen.northCount; i++) {
+    TEST_ASSERT_EQUAL_CHAR(gen.north[i].train, dom.north[i].train);
+    TEST_ASSERT_EQUAL_INT(gen.north[i].minutes, dom.north[i].minutes);
+    TEST_ASSERT_EQUAL_UINT32(gen.north[i].at, dom.north[i].at);
+  }
+  for (int i = 0; i < gen.southCount; i++) {
+    TEST_ASSERT_EQUAL_CHAR(gen.south[i].train, dom.south[i].train);
+    TEST_ASSERT_EQUAL_INT(gen.south[i].minutes, dom.south[i].minutes);
+    TEST_ASSERT_EQUAL_UINT32(gen.south[i].at, dom.south[i].at);
+  }
+}
+
+void test_weather_decoders_agree() {
+  std::string body = readFixture("weather.json");
+  TEST_ASSERT_FALSE(body.empty());
+
+  WeatherPayload gen, dom;
+  WeatherHour genHours[72];
+  gen.hourly = keepHour;
+  MemStream a(body);
+  TEST_ASSERT_TRUE(decodeWeatherGen(a, gen));
+  memcpy(genHours, hours, sizeof(hours));
+
+  dom.hourly = keepHour;
+  MemStream b(body);
+  TEST_ASSERT_TRUE(decodeWeatherPayloadDom(b, dom));
+
+  TEST_ASSERT_EQUAL_INT(gen.startIndex, dom.startIndex);
+  TEST_ASSERT_EQUAL_UINT8(gen.hourlyCount, dom.hourlyCount);
+  for (int i = 0; i < gen.hourlyCount; i++) {
+    TEST_ASSERT_EQUAL_INT(genHours[i].temp, hours[i].temp);
+    TEST_ASSERT_EQUAL_FLOAT(genHours[i].prec, hours[i].prec);
+    TEST_ASSERT_EQUAL_INT(genHours[i].code, hours[i].code);
+    TEST_ASSERT_EQUAL_INT(genHours[i].day, hours[i].day);
+  }
+}
+
+void test_decoder_timings() {
+  std::string mta = readFixture("mta.json");
+  std::string weather = readFixture("weather.json");
+
+  MtaPayload m;
+  double mtaDom = timeDecode(decodeMtaPayloadDom, mta, m);
+  double mtaGen = timeDecode(decodeMtaGen, mta, m);
+
+  WeatherPayload w;
+  w.hourly = ignoreHour;
+  double weatherDom = timeDecode(decodeWeatherPayloadDom, weather, w);
+  double weatherGen = timeDecode(decodeWeatherGen, weather, w);
+
+  report("mta", mta.size(), mtaDom, mtaGen);
+  report("weather", weather.size(), weatherDom, weatherGen);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_mta_decoders_agree);
+  RUN_TEST(test_weather_decoders_agree);
+  RUN_TEST(test_decoder_timings);
+  return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// Render-ahead: a picture queued with renderAhead() is drawn into the back
+// buffer while the panel is busy refreshing, without disturbing the frame
+// on its way to the controller, and takeAhead() swaps it in only for the
+// same fn and arg. Follows showScreen() in main.cpp.
+#include <Arduino.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+
+static FakePanel panel;
+static EpdFrame* frame;
+static int draws = 0;
+
+// Screen `n`: a few blocks in places that depend on n
+static void screenN(EpdFrame& f, int n) {
+  draws++;
+  f.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 6; i++) f.fillRect(40 + i * 120, 60 + n * 37 % 200, 70, 50 + n * 11 % 90, GxEPD_BLACK);
+  f.drawFastHLine(0, 35 + n, 800, GxEPD_BLACK);
+}
+
+// What screenN(n) draws, from a frame of its own
+static std::vector<uint8_t> picture(int n) {
+  FakePanel other;
+  EpdFrame f(other, 0);
+  TEST_ASSERT_TRUE(f.begin());
+  screenN(f, n);
+  draws--;
+  return std::vector<uint8_t>(f.getBuffer(), f.getBuffer() + FakePanel::RAM_BYTES);
+}
+
+void setUp() {
+  frame = new EpdFrame(panel, 0);
+  TEST_ASSERT_TRUE(frame->begin());
+  frame->drawPaged(screenN, 0, true);
+  panel.clearLog();
+  draws = 0;
+}
+
+void tearDown() {
+  delete frame;
+}
+
+// The queued screen is drawn during the refresh, and the panel still gets
+// the current one, second write (after the refresh) included
+void test_next_screen_is_drawn_during_the_refresh() {
+  frame->renderAhead(screenN, 2);
+  frame->drawPaged(screenN, 1, true);
+  TEST_ASSERT_EQUAL_INT(2, draws);   // screen 1 now, screen 2 from the busy callback
+  TEST_ASSERT_EQUAL_UINT32(1, frame->stats().ahead);
+  TEST_ASSERT_TRUE(panel.busyPolls > 0);
+
+  std::vector<uint8_t> one = picture(1);
+  TEST_ASSERT_EQUAL_MEMORY(one.data(), panel.ram, FakePanel::RAM_BYTES);
+  TEST_ASSERT_EQUAL_MEMORY(one.data(), panel.again, FakePanel::RAM_BYTES);
+  TEST_ASSERT_EQUAL_MEMORY(one.data(), frame->getBuffer(), FakePanel::RAM_BYTES);
+}
+
+// Swapped in, the picture is sent as a diff against what the panel shows
+void test_take_ahead_swaps_the_picture_in() {
+  frame->renderAhead(screenN, 2);
+  frame->drawPaged(screenN, 1, true);
+  draws = 0;
+
+  TEST_ASSERT_TRUE(frame->takeAhead(screenN, 2));
+  TEST_ASSERT_EQUAL_INT(0, draws);
+  TEST_ASSERT_EQUAL_UINT32(1, frame->stats().aheadUsed);
+  std::vector<uint8_t> two = picture(2);
+  TEST_ASSERT_EQUAL_MEMORY(two.data(), frame->getBuffer(), FakePanel::RAM_BYTES);
+
+  panel.clearLog();
+  TEST_ASSERT_TRUE(frame->update() > 0);
+  TEST_ASSERT_EQUAL_UINT32(1, panel.partials);
+  TEST_ASSERT_TRUE(panel.bytes < FakePanel::RAM_BYTES);
+  TEST_ASSERT_EQUAL_MEMORY(two.data(), panel.ram, FakePanel::RAM_BYTES);
+  TEST_ASSERT_EQUAL_MEMORY(two.data(), panel.again, FakePanel::RAM_BYTES);
+}
+
+// Another screen than the predicted one: nothing is swapped, and the back
+// buffer is spent either way
+void test_wrong_prediction_is_not_used() {
+  frame->renderAhead(screenN, 2);
+  frame->drawPaged(screenN, 1, true);
+  std::vector<uint8_t> one = picture(1);
+
+  TEST_ASSERT_FALSE(frame->takeAhead(screenN, 3));
+  TEST_ASSERT_EQUAL_MEMORY(one.data(), frame->getBuffer(), FakePanel::RAM_BYTES);
+  TEST_ASSERT_FALSE(frame->takeAhead(screenN, 2));
+  TEST_ASSERT_EQUAL_UINT32(0, frame->stats().aheadUsed);
+}
+
+// Partial refreshes wait on the panel too
+void test_partial_refresh_draws_ahead() {
+  frame->renderAhead(screenN, 4);
+  screenN(*frame, 3);
+  TEST_ASSERT_TRUE(frame->update() > 0);
+  TEST_ASSERT_TRUE(frame->takeAhead(screenN, 4));
+  std::vector<uint8_t> four = picture(4);
+  TEST_ASSERT_EQUAL_MEMORY(four.data(), frame->getBuffer(), FakePanel::RAM_BYTES);
+}
+
+// Queued but no refresh came: nothing to take
+void test_nothing_drawn_without_a_refresh() {
+  frame->renderAhead(screenN, 2);
+  TEST_ASSERT_FALSE(frame->takeAhead(screenN, 2));
+  TEST_ASSERT_EQUAL_INT(0, draws);
+}
+
+// A band can't hold the next screen
+void test_paged_frame_has_no_back_buffer() {
+  FakePanel banded;
+  EpdFrame paged(banded, 60);
+  TEST_ASSERT_TRUE(paged.begin());
+  paged.renderAhead(screenN, 2);
+  paged.drawPaged(screenN, 1, true);
+  TEST_ASSERT_EQUAL_UINT32(0, paged.stats().ahead);
+  TEST_ASSERT_FALSE(paged.takeAhead(screenN, 2));
+}
+
+// Static frame and shadow, as displayInit() passes them: the swap moves the
+// caller's frame into the back buffer, and the destructor must still free
+// only the back buffer begin() allocated
+void test_caller_buffers_survive_the_swap() {
+  static uint8_t frameStore[EpdFrame::bandBytes(FakePanel::PANEL_W, FakePanel::PANEL_H)];
+  static uint8_t shadowStore[EpdFrame::bandBytes(FakePanel::PANEL_W, FakePanel::PANEL_H)];
+  FakePanel own;
+  {
+    EpdFrame f(own, 0);
+    f.setBuffers(frameStore, shadowStore);
+    TEST_ASSERT_TRUE(f.begin());
+    TEST_ASSERT_EQUAL_PTR(frameStore, f.getBuffer());
+
+    f.renderAhead(screenN, 2);
+    f.drawPaged(screenN, 1, true);
+    TEST_ASSERT_TRUE(f.takeAhead(screenN, 2));
+    TEST_ASSERT_TRUE(f.getBuffer() != frameStore);
+    TEST_ASSERT_EQUAL_MEMORY(picture(1).data(), shadowStore, FakePanel::RAM_BYTES);
+  }
+  TEST_ASSERT_EQUAL_MEMORY(picture(1).data(), frameStore, FakePanel::RAM_BYTES);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_next_screen_is_drawn_during_the_refresh);
+  RUN_TEST(test_take_ahead_swaps_the_picture_in);
+  RUN_TEST(test_wrong_prediction_is_not_used);
+  RUN_TEST(test_partial_refresh_draws_ahead);
+  RUN_TEST(test_nothing_drawn_without_a_refresh);
+  RUN_TEST(test_paged_frame_has_no_back_buffer);
+  RUN_TEST(test_caller_buffers_survive_the_swap);
+  return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// EpdFrame's span fills (masked edge bytes and a memset in between) against
+// GFXcanvas1 and Adafruit_GFX: rectangles, lines and the shapes built from
+// them come out the same at every bit offset, clipped or paged.
+#include <Arduino.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+
+static const int W = FakePanel::PANEL_W;
+static const int H = FakePanel::PANEL_H;
+
+static FakePanel panel;
+static EpdFrame frame(panel, 0);
+static GFXcanvas1 reference(W, H);
+static std::vector<uint8_t> background;
+
+static void startBoth() {
+  memcpy(frame.getBuffer(), background.data(), background.size());
+  memcpy(reference.getBuffer(), background.data(), background.size());
+}
+
+static void assertSame(const char* what, int x, int y, int w, int h) {
+  char msg[80];
+  snprintf(msg, sizeof(msg), "%s %d,%d %dx%d", what, x, y, w, h);
+  TEST_ASSERT_EQUAL_MEMORY_MESSAGE(reference.getBuffer(), frame.getBuffer(), FakePanel::RAM_BYTES, msg);
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(frame.begin());
+  srand(1);
+  background.resize(FakePanel::RAM_BYTES);
+  for (uint8_t& b : background) b = (uint8_t)rand();
+}
+
+void tearDown() {}
+
+// Every start and end bit, one byte wide and many, both colors
+void test_fill_rect_matches_gfx() {
+  const int16_t widths[] = {1, 2, 7, 8, 9, 15, 16, 17, 63, 300};
+  for (int16_t w : widths) {
+    for (int16_t x = 96; x < 104; x++) {
+      for (uint16_t color : {GxEPD_BLACK, GxEPD_WHITE}) {
+        startBoth();
+        frame.fillRect(x, 50, w, 13, color);
+        reference.fillRect(x, 50, w, 13, color);
+        assertSame("fillRect", x, 50, w, 13);
+      }
+    }
+  }
+}
+
+void test_clipped_fill_rect_matches_gfx() {
+  const int16_t xs[] = {-40, -9, -1, 0, 3, W - 41, W - 8, W - 1, W};
+  const int16_t ys[] = {-20, -1, 0, H - 10, H - 1, H};
+  for (int16_t x : xs) {
+    for (int16_t y : ys) {
+      startBoth();
+      frame.fillRect(x, y, 45, 17, GxEPD_BLACK);
+      reference.fillRect(x, y, 45, 17, GxEPD_BLACK);
+      assertSame("fillRect", x, y, 45, 17);
+    }
+  }
+  startBoth();
+  frame.fillRect(-100, -100, W + 200, H + 200, GxEPD_WHITE);
+  reference.fillRect(-100, -100, W + 200, H + 200, GxEPD_WHITE);
+  assertSame("fillRect", -100, -100, W + 200, H + 200);
+}
+
+// Negative sizes grow left/up the way GFXcanvas1's lines do (Adafruit_GFX's
+// fillRect draws nothing for a negative width)
+void test_negative_sizes_grow_left_and_up() {
+  startBoth();
+  frame.fillRect(120, 90, -21, -11, GxEPD_BLACK);
+  reference.fillRect(100, 80, 21, 11, GxEPD_BLACK);
+  assertSame("fillRect", 120, 90, -21, -11);
+
+  startBoth();
+  frame.drawFastHLine(300, 7, -45, GxEPD_BLACK);
+  reference.drawFastHLine(300, 7, -45, GxEPD_BLACK);
+  assertSame("drawFastHLine", 300, 7, -45, 1);
+}
+
+// Lines and the shapes made of them: rules, tile borders, dots
+void test_lines_and_shapes_match_gfx() {
+  for (int16_t x = 0; x < 8; x++) {
+    startBoth();
+    frame.drawFastHLine(x, 35, 795 - x, GxEPD_BLACK);
+    frame.drawFastVLine(400 + x, -3, 500, GxEPD_BLACK);
+    frame.drawRect(20 + x, 280, 120, 120, GxEPD_BLACK);
+    frame.drawRect(-5 + x, 470, 30, 30, GxEPD_BLACK);
+    frame.fillCircle(111 + x, 200, 6, GxEPD_BLACK);
+    frame.fillRoundRect(500 + x, 100, 77, 40, 8, GxEPD_WHITE);
+    frame.fillTriangle(600 + x, 300, 700, 310 + x, 650, 420, GxEPD_BLACK);
+    frame.drawLine(10, 460 + x, 790, 460 + x, GxEPD_WHITE);
+
+    reference.drawFastHLine(x, 35, 795 - x, GxEPD_BLACK);
+    reference.drawFastVLine(400 + x, -3, 500, GxEPD_BLACK);
+    reference.drawRect(20 + x, 280, 120, 120, GxEPD_BLACK);
+    reference.drawRect(-5 + x, 470, 30, 30, GxEPD_BLACK);
+    reference.fillCircle(111 + x, 200, 6, GxEPD_BLACK);
+    reference.fillRoundRect(500 + x, 100, 77, 40, 8, GxEPD_WHITE);
+    reference.fillTriangle(600 + x, 300, 700, 310 + x, 650, 420, GxEPD_BLACK);
+    reference.drawLine(10, 460 + x, 790, 460 + x, GxEPD_WHITE);
+    assertSame("shapes", x, 0, 0, 0);
+  }
+}
+
+void test_fill_screen_fills_everything() {
+  frame.fillScreen(GxEPD_BLACK);
+  reference.fillScreen(GxEPD_BLACK);
+  assertSame("fillScreen", 0, 0, W, H);
+  frame.fillScreen(GxEPD_WHITE);
+  reference.fillScreen(GxEPD_WHITE);
+  assertSame("fillScreen", 0, 0, W, H);
+}
+
+// Paged, fills are clipped to the band; fillScreen clears only the band
+static void shapes(Adafruit_GFX& g) {
+  g.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 40; i++) {
+    g.fillRect(i * 19 - 7, i * 13 - 21, 37 + i, 23 + i % 7, i % 3 ? GxEPD_BLACK : GxEPD_WHITE);
+  }
+  g.drawFastHLine(0, 59, W, GxEPD_BLACK);
+  g.drawFastHLine(0, 60, W, GxEPD_BLACK);
+  g.drawFastVLine(333, 0, H, GxEPD_BLACK);
+  g.drawRect(20, 280, 120, 120, GxEPD_BLACK);
+  g.fillCircle(400, 240, 70, GxEPD_BLACK);
+}
+
+static void pagedShapes(EpdFrame& f, int) {
+  shapes(f);
+}
+
+void test_paged_fills_match_gfx() {
+  FakePanel banded;
+  EpdFrame paged(banded, 60);
+  TEST_ASSERT_TRUE(paged.begin());
+  paged.drawPaged(pagedShapes, 0, true);
+  shapes(reference);
+  TEST_ASSERT_EQUAL_MEMORY(reference.getBuffer(), banded.ram, FakePanel::RAM_BYTES);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_fill_rect_matches_gfx);
+  RUN_TEST(test_clipped_fill_rect_matches_gfx);
+  RUN_TEST(test_negative_sizes_grow_left_and_up);
+  RUN_TEST(test_lines_and_shapes_match_gfx);
+  RUN_TEST(test_fill_screen_fills_everything);
+  RUN_TEST(test_paged_fills_match_gfx);
+  return UNITY_END();
+}
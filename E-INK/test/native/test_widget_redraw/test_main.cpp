@@ -0,0 +1,147 @@
+// WidgetScreen::render()'s redraw set: only changed widgets and the ones
+// overlapping them are cleared and drawn, in list order, and the frame
+// always ends up as a full redraw of the same data would leave it.
+#include <Arduino.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "epd_frame.h"
+#include "fake_panel.h"
+#include "widgets.h"
+
+static std::vector<int> drawn;   // ids, in draw order
+
+// Draws a pattern of `value` inside its bounds; opaque ones clear them first
+class Probe : public Widget {
+ public:
+  Probe(int id, const Bounds& b, bool opaque = false) : Widget(b), id(id), opaque(opaque) {}
+
+  uint32_t poll() override { return value; }
+
+  void draw(EpdFrame& f) override {
+    drawn.push_back(id);
+    if (opaque) f.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, GxEPD_WHITE);
+    for (int k = 0; k < 4; k++) {
+      f.drawFastHLine(bounds.x, bounds.y + (value * 7 + k * 5) % bounds.h, bounds.w, GxEPD_BLACK);
+      f.drawFastVLine(bounds.x + (value * 13 + k * 11) % bounds.w, bounds.y, bounds.h, GxEPD_BLACK);
+    }
+  }
+
+  const int id;
+  const bool opaque;
+  uint32_t value = 1;
+};
+
+//   0: header across the top        3: overlaps 2, opaque
+//   1: alone on the left            4: overlaps 3 only
+//   2: middle                       5: overlaps 0 (drawn before 5)
+static Probe p0(0, {0, 0, 800, 40});
+static Probe p1(1, {10, 100, 100, 100});
+static Probe p2(2, {300, 100, 150, 150});
+static Probe p3(3, {420, 200, 100, 100}, true);
+static Probe p4(4, {500, 280, 100, 100});
+static Probe p5(5, {600, 20, 100, 60});
+static Probe* const PROBES[] = {&p0, &p1, &p2, &p3, &p4, &p5};
+static Widget* const WIDGETS[] = {&p0, &p1, &p2, &p3, &p4, &p5};
+static WidgetScreen screen(WIDGETS, 6);
+
+static FakePanel panel;
+static EpdFrame frame(panel, 0);
+
+static void assertDrawn(const std::vector<int>& expected) {
+  TEST_ASSERT_EQUAL_UINT(expected.size(), drawn.size());
+  for (size_t i = 0; i < expected.size(); i++) TEST_ASSERT_EQUAL_INT(expected[i], drawn[i]);
+}
+
+// What a full redraw of the current values gives
+static void assertFrameIsFullRedraw() {
+  FakePanel other;
+  EpdFrame fresh(other, 0);
+  TEST_ASSERT_TRUE(fresh.begin());
+  fresh.fillScreen(GxEPD_WHITE);
+  for (Probe* p : PROBES) p->draw(fresh);
+  TEST_ASSERT_EQUAL_MEMORY(fresh.getBuffer(), frame.getBuffer(), FakePanel::RAM_BYTES);
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(frame.begin());
+  for (Probe* p : PROBES) p->value = 1;
+  screen.render(frame, true);
+  frame.update();
+  panel.clearLog();
+  drawn.clear();
+}
+
+void tearDown() {}
+
+void test_full_render_draws_everything_in_order() {
+  TEST_ASSERT_TRUE(screen.render(frame, true));
+  assertDrawn({0, 1, 2, 3, 4, 5});
+  assertFrameIsFullRedraw();
+}
+
+void test_nothing_changed_draws_nothing() {
+  TEST_ASSERT_FALSE(screen.render(frame, false));
+  assertDrawn({});
+  TEST_ASSERT_FALSE(screen.update(frame));
+  TEST_ASSERT_EQUAL_UINT32(0, panel.partials);
+}
+
+void test_lone_widget_is_drawn_alone() {
+  p1.value = 2;
+  TEST_ASSERT_TRUE(screen.render(frame, false));
+  assertDrawn({1});
+  assertFrameIsFullRedraw();
+}
+
+// 2 changed: 3 overlaps it, 4 overlaps 3 (which is opaque and drawn again)
+void test_overlaps_are_drawn_in_list_order() {
+  p2.value = 5;
+  TEST_ASSERT_TRUE(screen.render(frame, false));
+  assertDrawn({2, 3, 4});
+  assertFrameIsFullRedraw();
+}
+
+// A later widget changing clears part of an earlier one's box, so the
+// earlier one is drawn again first
+void test_earlier_overlapping_widget_is_drawn_first() {
+  p5.value = 9;
+  TEST_ASSERT_TRUE(screen.render(frame, false));
+  assertDrawn({0, 5});
+  assertFrameIsFullRedraw();
+}
+
+// Only the changed boxes go to the panel
+void test_update_sends_only_the_changed_box() {
+  p1.value = 3;
+  TEST_ASSERT_TRUE(screen.update(frame));
+  TEST_ASSERT_EQUAL_UINT32(1, panel.partials);
+  for (const FakePanel::Window& w : panel.writes) {
+    TEST_ASSERT_TRUE(w.x >= 8 && w.x + w.w <= 112 && w.y >= 100 && w.y + w.h <= 200);
+  }
+  TEST_ASSERT_EQUAL_MEMORY(frame.getBuffer(), panel.ram, FakePanel::RAM_BYTES);
+}
+
+void test_random_changes_match_full_redraws() {
+  srand(3);
+  for (int round = 0; round < 200; round++) {
+    for (Probe* p : PROBES) {
+      if (rand() % 4 == 0) p->value = 1 + rand() % 50;
+    }
+    screen.render(frame, false);
+    assertFrameIsFullRedraw();
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_full_render_draws_everything_in_order);
+  RUN_TEST(test_nothing_changed_draws_nothing);
+  RUN_TEST(test_lone_widget_is_drawn_alone);
+  RUN_TEST(test_overlaps_are_drawn_in_list_order);
+  RUN_TEST(test_earlier_overlapping_widget_is_drawn_first);
+  RUN_TEST(test_update_sends_only_the_changed_box);
+  RUN_TEST(test_random_changes_match_full_redraws);
+  return UNITY_END();
+}
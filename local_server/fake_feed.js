@@ -0,0 +1,58 @@
+// Stand-in for the MTA GTFS Realtime feed, for testing without network.
+// Builds the same protobuf FeedMessage the real endpoint returns, with N/Q/R/W
+// trips through R17N/R17S every few minutes. Now and then a prediction jumps
+// by a couple of minutes so the push stream has something to report.
+//
+//   FAKE_MTA=1 node server.js        serve /mta and /mta/stream from this
+//   node fake_feed.js                print the current top 5 once
+import GtfsRealtimeBindings from "gtfs-realtime-bindings";
+
+const { FeedMessage } = GtfsRealtimeBindings.transit_realtime;
+
+const ROUTES = ["N", "Q", "R", "W"];
+const HEADWAY_S = 210;          // one train every 3.5 min per direction
+const JUMP_EVERY_S = 90;        // how often some prediction slips
+const JUMP_S = 150;
+
+// Same train, same slot -> same arrival time across calls, so an unchanged
+// feed really is unchanged
+function arrivals(stopId, offset, now) {
+    const trips = [];
+    const first = Math.floor((now - offset) / HEADWAY_S);
+    const jumpSlot = Math.floor(now / JUMP_EVERY_S);
+    for (let slot = first; slot < first + 8; slot++) {
+        let t = slot * HEADWAY_S + offset;
+        if ((slot + jumpSlot) % 5 === 0) t += JUMP_S;   // delayed train
+        if (t < now) continue;
+        trips.push({
+            id: `${stopId}_${slot}`,
+            route: ROUTES[((slot % ROUTES.length) + ROUTES.length) % ROUTES.length],
+            stopId,
+            time: t
+        });
+    }
+    return trips;
+}
+
+export function fakeFeed(now = Math.floor(Date.now() / 1000)) {
+    const trips = [...arrivals("R17N", 0, now), ...arrivals("R17S", 95, now)];
+    const message = FeedMessage.fromObject({
+        header: { gtfsRealtimeVersion: "2.0", timestamp: now },
+        entity: trips.map((t) => ({
+            id: t.id,
+            tripUpdate: {
+                trip: { tripId: t.id, routeId: t.route },
+                stopTimeUpdate: [{ stopId: t.stopId, arrival: { time: t.time } }]
+            }
+        }))
+    });
+    return Buffer.from(FeedMessage.encode(message).finish());
+}
+
+if (process.argv[1] && process.argv[1].endsWith("fake_feed.js")) {
+    const feed = FeedMessage.decode(fakeFeed());
+    for (const e of feed.entity) {
+        const u = e.tripUpdate.stopTimeUpdate[0];
+        console.log(e.tripUpdate.trip.routeId, u.stopId, new Date(Number(u.arrival.time) * 1000).toISOString());
+    }
+}
@@ -1,7 +1,9 @@
 //MTA PROXY 
+import { createHash } from "node:crypto";
 import express from "express";
 import cors from "cors";
 import GtfsRealtimeBindings from "gtfs-realtime-bindings";
+import { fakeFeed } from "./fake_feed.js";
 
 const northA = "A28N";
 const southA = "A28S";
@@ -20,141 +22,388 @@ const WEATHER_URL =
     //Current Temp, Prec, Weather Code, Rain/Shower/Snowfall
     //Hourly Temp, Prec, Visib, UV, Is_Day
     //Daily Temp Min, Temp Max, Weather Code      
+// Binary wire format (?fmt=bin), same layout as server/api/index.js
+//   MTA v1   "IM" | 1 | nNorth u8 | nSouth u8 | (train u8, minutes u16) x (nNorth + nSouth)
+//   MTA v2   "IM" | 2 | nNorth u8 | nSouth u8 | (train u8, at u32 unix s) x (nNorth + nSouth)
+//   Weather  "IW" | 1 | count u8 | startIndex u16 |
+//            temp i8[count] | prec u16[count] (0.01 in) | code u8[count] | day bits[(count + 7) / 8]
+const WIRE_VERSION = 1;
+const MTA_WIRE_VERSION_AT = 2;    // ?fmt=bin&v=2
+
+const clamp = (v, lo, hi) => Math.min(hi, Math.max(lo, v));
+
+function encodeMtaBin(north, south, version = WIRE_VERSION) {
+    const withAt = version === MTA_WIRE_VERSION_AT;
+    const entry = withAt ? 5 : 3;
+    const buf = Buffer.alloc(5 + (north.length + south.length) * entry);
+    buf.write("IM", 0, "latin1");
+    buf.writeUInt8(withAt ? MTA_WIRE_VERSION_AT : WIRE_VERSION, 2);
+    buf.writeUInt8(north.length, 3);
+    buf.writeUInt8(south.length, 4);
+
+    let o = 5;
+    for (const a of [...north, ...south]) {
+        buf.writeUInt8(String(a.train || "?").charCodeAt(0) & 0xff, o);
+        if (withAt) buf.writeUInt32LE(clamp(a.at, 0, 0xffffffff), o + 1);
+        else buf.writeUInt16LE(clamp(a.minutes, 0, 0xffff), o + 1);
+        o += entry;
+    }
+    return buf;
+}
+
+function encodeWeatherBin(startIndex, hourly) {
+    const n = Math.min(hourly.length, 255);
+    const buf = Buffer.alloc(6 + n * 4 + Math.ceil(n / 8));
+    buf.write("IW", 0, "latin1");
+    buf.writeUInt8(WIRE_VERSION, 2);
+    buf.writeUInt8(n, 3);
+    buf.writeUInt16LE(clamp(startIndex, 0, 0xffff), 4);
+
+    const tempAt = 6;
+    const precAt = tempAt + n;
+    const codeAt = precAt + n * 2;
+    const dayAt = codeAt + n;
+    for (let i = 0; i < n; i++) {
+        const h = hourly[i];
+        buf.writeInt8(clamp(h.temp, -128, 127), tempAt + i);
+        buf.writeUInt16LE(clamp(Math.round((h.prec || 0) * 100), 0, 0xffff), precAt + i * 2);
+        buf.writeUInt8(clamp(h.code, 0, 255), codeAt + i);
+        if (h.day) buf[dayAt + (i >> 3)] |= 1 << (i & 7);
+    }
+    return buf;
+}
+
+//   Bundle   "IB" | 1 | nSections u8 | (kind u8, fetchedAt u32 unix s, len u16, body[len]) x nSections
+//            kind 'M' = MTA body, 'W' = Weather body
+function encodeBundleBin(sections) {
+    const buf = Buffer.alloc(4 + sections.reduce((n, s) => n + 7 + s.body.length, 0));
+    buf.write("IB", 0, "latin1");
+    buf.writeUInt8(WIRE_VERSION, 2);
+    buf.writeUInt8(sections.length, 3);
+
+    let o = 4;
+    for (const s of sections) {
+        buf.write(s.kind, o, "latin1");
+        buf.writeUInt32LE(s.fetchedAt, o + 1);
+        buf.writeUInt16LE(s.body.length, o + 5);
+        s.body.copy(buf, o + 7);
+        o += 7 + s.body.length;
+    }
+    return buf;
+}
+
+// Express only adds its own ETag when none is set
+function etagOf(body) {
+    return '"' + createHash("sha1").update(body).digest("base64url").slice(0, 20) + '"';
+}
+
 const app = express();
 app.use(cors());
 
-app.listen(8787, "0.0.0.0", () => console.log("Listening on 8787"));
+const PORT = Number(process.env.PORT) || 8787;
+app.listen(PORT, "0.0.0.0", () => console.log(`Listening on ${PORT}`));
 
 app.get("/health", (req, res) => {
   res.json({ ok: true});  
 });
 
-app.get("/mta", async (req, res) => {
-    try {
-        const mtaRes = await fetch(MTA_URL_N);
-        if(!mtaRes.ok) {
-            return res.status(502).json({ Error: "MTA Shi Failed", status: mtaRes.status})
-        }
-        
-        const mtaArrayBuffer = await mtaRes.arrayBuffer();
-        const mtaBuffer = Buffer.from(mtaArrayBuffer);
-        const mtaFeed = GtfsRealtimeBindings.transit_realtime.FeedMessage.decode(mtaBuffer);
-        
-        const northbound = [];      //store mins of north  
-        const southbound = [];      //same but for south
-        const timeNow = Math.floor(Date.now() / 1000);
-        
-        for (const entity of mtaFeed.entity) {
-            if (entity.tripUpdate) {
-                const update = entity.tripUpdate.stopTimeUpdate;    //array of predictions
-                
-                if (!update) continue;
+// FAKE_MTA=1 serves the stand-in feed from fake_feed.js instead of the MTA
+const FAKE_MTA = Boolean(process.env.FAKE_MTA);
+
+async function loadMtaFeed() {
+    if (FAKE_MTA) return fakeFeed();
+
+    const mtaRes = await fetch(MTA_URL_N);
+    if(!mtaRes.ok) {
+        const err = new Error("MTA Shi Failed");
+        err.status = mtaRes.status;
+        throw err;
+    }
+    return Buffer.from(await mtaRes.arrayBuffer());
+}
+
+// Top 5 arrivals per direction at our stop
+async function mtaArrivals() {
+    const mtaBuffer = await loadMtaFeed();
+    const mtaFeed = GtfsRealtimeBindings.transit_realtime.FeedMessage.decode(mtaBuffer);
+    
+    const northbound = [];      //store mins of north  
+    const southbound = [];      //same but for south
+    const timeNow = Math.floor(Date.now() / 1000);
+    
+    for (const entity of mtaFeed.entity) {
+        if (entity.tripUpdate) {
+            const update = entity.tripUpdate.stopTimeUpdate;    //array of predictions
+            
+            if (!update) continue;
+            
+            const tripId = entity.tripUpdate.trip.routeId; 
+            
+            /* const i = tripId.indexOf("_");
+            let train;
+            if (i === -1) {                     //WHOLE FUNCTION WAS FOR
+                train = tripId;                 //TRIP ID NOT ROUTE OOPS
+            } else {
+                train = tripId[i + 1];
+            }
+            */
+           
+            for (const x of update) {
+                const stop = x.stopId;
                 
-                const tripId = entity.tripUpdate.trip.routeId; 
+                let t;
                 
-                /* const i = tripId.indexOf("_");
-                let train;
-                if (i === -1) {                     //WHOLE FUNCTION WAS FOR
-                    train = tripId;                 //TRIP ID NOT ROUTE OOPS
+                if (x.arrival.time != null) {
+                    t = x.arrival.time;
+                } else if (x.departure.time != null) {
+                    t = x.departure.time;
                 } else {
-                    train = tripId[i + 1];
+                    t = null;
                 }
-                */
-               
-                for (const x of update) {
-                    const stop = x.stopId;
-                    
-                    let t;
-                    
-                    if (x.arrival.time != null) {
-                        t = x.arrival.time;
-                    } else if (x.departure.time != null) {
-                        t = x.departure.time;
-                    } else {
-                        t = null;
-                    }
-                    
-                    if(!t) continue;
-                    
-                    const minutes = Math.round((t - timeNow) / 60);
-                    
-                    if(minutes < 0) continue;
-                    
-                    if (stop === northN) {
-                        northbound.push({
-                            minutes: minutes,
-                            train: tripId
-                        });
-                    } else if (stop === southN) {
-                        southbound.push({
-                            minutes: minutes,
-                            train: tripId
-                        });
-                    }
-                    
+                
+                if(!t) continue;
+                
+                const minutes = Math.round((t - timeNow) / 60);
+                
+                if(minutes < 0) continue;
+                
+                if (stop === northN) {
+                    northbound.push({
+                        minutes: minutes,
+                        at: Number(t),          // unix seconds, lets the device count down
+                        train: tripId
+                    });
+                } else if (stop === southN) {
+                    southbound.push({
+                        minutes: minutes,
+                        at: Number(t),
+                        train: tripId
+                    });
                 }
+                
             }
         }
-        
-        northbound.sort((a, b) => a.minutes - b.minutes);
-        southbound.sort((a, b) => a.minutes - b.minutes);
-        const north = northbound.slice(0, 5);
-        const south = southbound.slice(0, 5);
+    }
+    
+    northbound.sort((a, b) => a.minutes - b.minutes);
+    southbound.sort((a, b) => a.minutes - b.minutes);
+    return {
+        north: northbound.slice(0, 5),
+        south: southbound.slice(0, 5)
+    };
+}
+
+// JSON bodies list each arrival as { train, at }, as in server/api/index.js:
+// `minutes` would change the body (and its ETag) every minute while the
+// arrivals stay put. Binary v1 still carries minutes.
+function arrivalsJson({ north, south }) {
+    return {
+        north: north.map(({ train, at }) => ({ train, at })),
+        south: south.map(({ train, at }) => ({ train, at }))
+    };
+}
+
+app.get("/mta", async (req, res) => {
+    try {
+        const { north, south } = await mtaArrivals();
+
+        if (req.query.fmt === "bin") {
+            const version = Number(req.query.v) || WIRE_VERSION;
+            return res.type("application/octet-stream").send(encodeMtaBin(north, south, version));
+        }
             
-        res.json ({
-            north,
-            south
-        });
+        res.json(arrivalsJson({ north, south }));
         
     } catch (ERR) {
+        if (ERR.status) {
+            return res.status(502).json({ Error: ERR.message, status: ERR.status})
+        }
         res.status(500).json({ error: "MTA Proxy error", detail: String(ERR) });
     }
 });
 
-app.get("/weather", async (req, res) => {
+// ---------------- Push stream (/mta/stream) ----------------
+// Server-sent events for a display on the local network. The feed is polled
+// here while at least one client is connected, and an "mta" event (same JSON
+// body as /mta) goes out only when the top 5 changed: a different train, or an
+// arrival that moved by STREAM_MOVE_S or more. Jitter of a few seconds between
+// feed updates is not worth a message, the display counts down from `at`.
+// A comment line every STREAM_PING_MS keeps the socket (and its NAT entry)
+// alive and tells the display the stream is still up.
+const STREAM_POLL_MS = 15000;
+const STREAM_PING_MS = 20000;
+const STREAM_MOVE_S = 30;
+
+const streamClients = new Set();
+let streamLast = null;              // last body sent
+let streamPoll = null;
+let streamPing = null;
+
+function arrivalsChanged(prev, next) {
+    if (!prev) return true;
+    for (const dir of ["north", "south"]) {
+        if (prev[dir].length !== next[dir].length) return true;
+        for (let i = 0; i < next[dir].length; i++) {
+            const a = prev[dir][i];
+            const b = next[dir][i];
+            if (a.train !== b.train || Math.abs(a.at - b.at) >= STREAM_MOVE_S) return true;
+        }
+    }
+    return false;
+}
+
+function streamSend(res, body) {
+    res.write(`event: mta\ndata: ${JSON.stringify(arrivalsJson(body))}\n\n`);
+}
+
+async function streamTick() {
     try {
-        const weatherRes = await fetch(WEATHER_URL); 
-        if (!weatherRes.ok) {
-            return res.status(502).json({ Error: "MTA Shi Failed", status: weatherRes.status})
+        const next = await mtaArrivals();
+        if (!arrivalsChanged(streamLast, next)) return;
+        streamLast = next;
+        for (const res of streamClients) streamSend(res, next);
+        console.log(`mta/stream: sent update to ${streamClients.size} client(s)`);
+    } catch (ERR) {
+        console.log("mta/stream: poll failed", String(ERR));
+    }
+}
+
+app.get("/mta/stream", (req, res) => {
+    res.writeHead(200, {
+        "Content-Type": "text/event-stream",
+        "Cache-Control": "no-cache",
+        "Connection": "keep-alive"
+    });
+    req.socket.setNoDelay(true);
+
+    streamClients.add(res);
+    if (streamLast) streamSend(res, streamLast);
+
+    if (!streamPoll) {
+        streamPoll = setInterval(streamTick, STREAM_POLL_MS);
+        streamPing = setInterval(() => {
+            for (const c of streamClients) c.write(": ping\n\n");
+        }, STREAM_PING_MS);
+        streamTick();
+    }
+
+    req.on("close", () => {
+        streamClients.delete(res);
+        if (streamClients.size === 0) {
+            clearInterval(streamPoll);
+            clearInterval(streamPing);
+            streamPoll = null;
+            streamPing = null;
+            streamLast = null;      // next client starts from a fresh poll
         }
-        
-        const data = await weatherRes.json();
-        
-        const time = data.hourly.time;                                  //array of time
-        const currentHour = data.current.time.slice(0, 13) + ":00";     //fix from 1:34 to 1:00
-        const startIndex = time.indexOf(currentHour);
-        
-        let safeStart = startIndex;
-        if (safeStart < 0) {
-            safeStart = 0;
+    });
+});
+
+async function weatherForecast() {
+    const weatherRes = await fetch(WEATHER_URL); 
+    if (!weatherRes.ok) {
+        const err = new Error("MTA Shi Failed");
+        err.status = weatherRes.status;
+        throw err;
+    }
+    
+    const data = await weatherRes.json();
+    
+    const time = data.hourly.time;                                  //array of time
+    const currentHour = data.current.time.slice(0, 13) + ":00";     //fix from 1:34 to 1:00
+    const startIndex = time.indexOf(currentHour);
+    
+    let safeStart = startIndex;
+    if (safeStart < 0) {
+        safeStart = 0;
+    }
+    
+    const tempArr  = data.hourly.temperature_2m.slice(safeStart);
+    const precArr  = data.hourly.precipitation.slice(safeStart);
+    const visibArr = data.hourly.visibility.slice(safeStart);
+    const dayArr   = data.hourly.is_day.slice(safeStart);
+    const codeArr  = data.hourly.weather_code.slice(safeStart);
+
+    const hourly = tempArr.map((t, i) => ({
+        temp: Math.round(t),
+        prec: precArr[i],
+        visib: Math.round(visibArr[i]),
+        day: dayArr[i],
+        code: codeArr[i]                // ADDED
+    }));
+
+    return {
+        startIndex: safeStart,            // ADDED (helps ESP32 know where "now" starts)
+        current: {
+            temp: Math.round(data.current.temperature_2m),
+            code: data.current.weather_code,
+            prec: data.current.precipitation,
+            rain: data.current.rain,
+            snow: data.current.snowfall
+        },
+        hourly
+    };
+}
+
+app.get("/weather", async (req, res) => {
+    try {
+        const weather = await weatherForecast();
+
+        if (req.query.fmt === "bin") {
+            return res.type("application/octet-stream").send(encodeWeatherBin(weather.startIndex, weather.hourly));
         }
         
-        const tempArr  = data.hourly.temperature_2m.slice(safeStart);
-        const precArr  = data.hourly.precipitation.slice(safeStart);
-        const visibArr = data.hourly.visibility.slice(safeStart);
-        const dayArr   = data.hourly.is_day.slice(safeStart);
-        const codeArr  = data.hourly.weather_code.slice(safeStart);
-        
-        res.json({
-            startIndex: safeStart,            // ADDED (helps ESP32 know where "now" starts)
-            current: {
-                temp: Math.round(data.current.temperature_2m),
-                code: data.current.weather_code,
-                prec: data.current.precipitation,
-                rain: data.current.rain,
-                snow: data.current.snowfall
-            },
-            hourly: tempArr.map((t, i) => ({
-                temp: Math.round(t),
-                prec: precArr[i],
-                visib: Math.round(visibArr[i]),
-                day: dayArr[i],
-                code: codeArr[i]                // ADDED
-            }))
-        });
+        res.json(weather);
           
     } catch (ERR) {
+        if (ERR.status) {
+            return res.status(502).json({ Error: ERR.message, status: ERR.status})
+        }
         res.status(500).json({ error: "Weather Proxy error", detail: String(ERR) });
 
     }
 })
+
+// ---------------- Bundle (/bundle) ----------------
+// MTA and weather in one response, same layout as server/api/index.js. Each
+// section carries the time its upstream answered; a failed section is left
+// out. The ETag skips the timestamps so unchanged data still gets a 304.
+app.get("/bundle", async (req, res) => {
+    const stamped = (p) => p.then((data) => ({ fetchedAt: Math.floor(Date.now() / 1000), data }));
+    const [mta, weather] = await Promise.allSettled([
+        stamped(mtaArrivals()),
+        stamped(weatherForecast())
+    ]);
+    if (mta.status === "rejected" && weather.status === "rejected") {
+        return res.status(502).json({ Error: "Bundle upstreams failed" });
+    }
+
+    if (req.query.fmt === "bin") {
+        const version = Number(req.query.v) || WIRE_VERSION;
+        const sections = [];
+        if (mta.status === "fulfilled") {
+            const { fetchedAt, data } = mta.value;
+            sections.push({ kind: "M", fetchedAt, body: encodeMtaBin(data.north, data.south, version) });
+        }
+        if (weather.status === "fulfilled") {
+            const { fetchedAt, data } = weather.value;
+            sections.push({ kind: "W", fetchedAt, body: encodeWeatherBin(data.startIndex, data.hourly) });
+        }
+        const tagged = Buffer.concat(sections.map((s) => Buffer.concat([Buffer.from(s.kind), s.body])));
+        res.set("ETag", etagOf(tagged));
+        return res.type("application/octet-stream").send(encodeBundleBin(sections));
+    }
+
+    const body = {};
+    const tagged = {};
+    if (mta.status === "fulfilled") {
+        tagged.mta = arrivalsJson(mta.value.data);
+        body.mta = { fetchedAt: mta.value.fetchedAt, ...tagged.mta };
+    }
+    if (weather.status === "fulfilled") {
+        body.weather = { fetchedAt: weather.value.fetchedAt, ...weather.value.data };
+        tagged.weather = weather.value.data;
+    }
+    res.set("ETag", etagOf(JSON.stringify(tagged)));
+    res.json(body);
+})
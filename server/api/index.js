@@ -1,3 +1,4 @@
+import { createHash } from "node:crypto";
 import GtfsRealtimeBindings from "gtfs-realtime-bindings";
 
 const northA = "A28N";
@@ -15,12 +16,227 @@ const LON = -73.9935;
 const WEATHER_URL =
   "https://api.open-meteo.com/v1/forecast?latitude=40.7506&longitude=-73.9935&daily=temperature_2m_max,temperature_2m_min,weather_code&hourly=temperature_2m,precipitation,visibility,is_day,weather_code&current=temperature_2m,precipitation,weather_code,rain,showers,snowfall,is_day&timezone=America%2FNew_York&forecast_days=3&wind_speed_unit=mph&temperature_unit=fahrenheit&precipitation_unit=inch";
 
+// ---------------- Binary wire format (?fmt=bin) ----------------
+// Compact alternative to the JSON bodies for the ESP32. Little-endian.
+//   MTA v1   "IM" | 1 | nNorth u8 | nSouth u8 | (train u8, minutes u16) x (nNorth + nSouth)
+//   MTA v2   "IM" | 2 | nNorth u8 | nSouth u8 | (train u8, at u32 unix s) x (nNorth + nSouth)
+//   Weather  "IW" | 1 | count u8 | startIndex u16 |
+//            temp i8[count] | prec u16[count] (0.01 in) | code u8[count] | day bits[(count + 7) / 8]
+// Bump the version whenever a layout changes; the firmware rejects others.
+// MTA v2 is sent for ?fmt=bin&v=2: absolute arrival times let the device
+// count down on its own, and the body (and its ETag) only changes when the
+// arrivals themselves do.
+const WIRE_VERSION = 1;
+const MTA_WIRE_VERSION_AT = 2;
+
+const clamp = (v, lo, hi) => Math.min(hi, Math.max(lo, v));
+
+function encodeMtaBin(north, south, version = WIRE_VERSION) {
+  const withAt = version === MTA_WIRE_VERSION_AT;
+  const entry = withAt ? 5 : 3;
+  const buf = Buffer.alloc(5 + (north.length + south.length) * entry);
+  buf.write("IM", 0, "latin1");
+  buf.writeUInt8(withAt ? MTA_WIRE_VERSION_AT : WIRE_VERSION, 2);
+  buf.writeUInt8(north.length, 3);
+  buf.writeUInt8(south.length, 4);
+
+  let o = 5;
+  for (const a of [...north, ...south]) {
+    buf.writeUInt8(String(a.train || "?").charCodeAt(0) & 0xff, o);
+    if (withAt) buf.writeUInt32LE(clamp(a.at, 0, 0xffffffff), o + 1);
+    else buf.writeUInt16LE(clamp(a.minutes, 0, 0xffff), o + 1);
+    o += entry;
+  }
+  return buf;
+}
+
+function encodeWeatherBin(startIndex, hourly) {
+  const n = Math.min(hourly.length, 255);
+  const buf = Buffer.alloc(6 + n * 4 + Math.ceil(n / 8));
+  buf.write("IW", 0, "latin1");
+  buf.writeUInt8(WIRE_VERSION, 2);
+  buf.writeUInt8(n, 3);
+  buf.writeUInt16LE(clamp(startIndex, 0, 0xffff), 4);
+
+  const tempAt = 6;
+  const precAt = tempAt + n;
+  const codeAt = precAt + n * 2;
+  const dayAt = codeAt + n;
+  for (let i = 0; i < n; i++) {
+    const h = hourly[i];
+    buf.writeInt8(clamp(h.temp, -128, 127), tempAt + i);
+    buf.writeUInt16LE(clamp(Math.round((h.prec || 0) * 100), 0, 0xffff), precAt + i * 2);
+    buf.writeUInt8(clamp(h.code, 0, 255), codeAt + i);
+    if (h.day) buf[dayAt + (i >> 3)] |= 1 << (i & 7);
+  }
+  return buf;
+}
+
+// Bundle   "IB" | 1 | nSections u8 | (kind u8, fetchedAt u32 unix s, len u16, body[len]) x nSections
+//          kind 'M' = MTA body, 'W' = Weather body, each in the layout above
+function encodeBundleBin(sections) {
+  const buf = Buffer.alloc(4 + sections.reduce((n, s) => n + 7 + s.body.length, 0));
+  buf.write("IB", 0, "latin1");
+  buf.writeUInt8(WIRE_VERSION, 2);
+  buf.writeUInt8(sections.length, 3);
+
+  let o = 4;
+  for (const s of sections) {
+    buf.write(s.kind, o, "latin1");
+    buf.writeUInt32LE(s.fetchedAt, o + 1);
+    buf.writeUInt16LE(s.body.length, o + 5);
+    s.body.copy(buf, o + 7);
+    o += 7 + s.body.length;
+  }
+  return buf;
+}
+
+// ---------------- Conditional GET ----------------
+// Every 200 carries a strong ETag derived from the body. A client that sends
+// it back in If-None-Match gets an empty 304 while the data is unchanged.
+function etagOf(body) {
+  return '"' + createHash("sha1").update(body).digest("base64url").slice(0, 20) + '"';
+}
+
+// `tagged` is what the ETag is computed over when it should not be the whole
+// body (the bundle leaves its per-section timestamps out)
+function sendBody(req, res, contentType, body, tagged = body) {
+  const buf = Buffer.isBuffer(body) ? body : Buffer.from(body);
+  const etag = etagOf(Buffer.isBuffer(tagged) ? tagged : Buffer.from(tagged));
+  res.setHeader("ETag", etag);
+  res.setHeader("Cache-Control", "no-cache");
+
+  const ifNoneMatch = req.headers["if-none-match"];
+  if (ifNoneMatch && ifNoneMatch.split(/\s*,\s*/).includes(etag)) {
+    res.statusCode = 304;
+    return res.end();
+  }
+
+  res.statusCode = 200;
+  res.setHeader("Content-Type", contentType);
+  res.setHeader("Content-Length", buf.length);
+  return res.end(buf);
+}
+
+const sendBin = (req, res, buf, tagged) => sendBody(req, res, "application/octet-stream", buf, tagged);
+const sendJson = (req, res, obj, tagged) =>
+  sendBody(req, res, "application/json", JSON.stringify(obj), tagged && JSON.stringify(tagged));
+
+function sendError(res, status, body) {
+  res.statusCode = status;
+  res.setHeader("Content-Type", "application/json");
+  return res.end(JSON.stringify(body));
+}
+
+// ---------------- Upstreams ----------------
+// Each resolves to one feed's data; an upstream that answers with an error
+// status rejects with err.status set.
+function upstreamError(message, status) {
+  const err = new Error(message);
+  err.status = status;
+  return err;
+}
+
+const nowSeconds = () => Math.floor(Date.now() / 1000);
+
+async function mtaArrivals() {
+  const mtaRes = await fetch(MTA_URL_N);
+  if (!mtaRes.ok) throw upstreamError("MTA Shi Failed", mtaRes.status);
+
+  const mtaArrayBuffer = await mtaRes.arrayBuffer();
+  const mtaBuffer = Buffer.from(mtaArrayBuffer);
+  const mtaFeed =
+    GtfsRealtimeBindings.transit_realtime.FeedMessage.decode(mtaBuffer);
+
+  const northbound = [];
+  const southbound = [];
+  const timeNow = nowSeconds();
+
+  for (const entity of mtaFeed.entity) {
+    if (!entity.tripUpdate) continue;
+
+    const update = entity.tripUpdate.stopTimeUpdate;
+    if (!update) continue;
+
+    const tripId = entity.tripUpdate.trip.routeId;
+
+    for (const x of update) {
+      const stop = x.stopId;
+
+      let t;
+      if (x.arrival?.time != null) t = x.arrival.time;
+      else if (x.departure?.time != null) t = x.departure.time;
+      else continue;
+
+      const minutes = Math.round((t - timeNow) / 60);
+      if (minutes < 0) continue;
+
+      const at = Number(t);
+      if (stop === northN) {
+        northbound.push({ minutes, at, train: tripId });
+      } else if (stop === southN) {
+        southbound.push({ minutes, at, train: tripId });
+      }
+    }
+  }
+
+  northbound.sort((a, b) => a.minutes - b.minutes);
+  southbound.sort((a, b) => a.minutes - b.minutes);
+
+  return { north: northbound.slice(0, 5), south: southbound.slice(0, 5) };
+}
+
+// JSON bodies list each arrival as { train, at }. `minutes` is relative to
+// the request time, so it would change the body (and its ETag) every minute
+// while the arrivals stay put; clients count down from `at` instead. Binary
+// v1 still carries minutes for firmware that predates `at`.
+const arrivalsJson = ({ north, south }) => ({
+  north: north.map(({ train, at }) => ({ train, at })),
+  south: south.map(({ train, at }) => ({ train, at })),
+});
+
+async function weatherForecast() {
+  const weatherRes = await fetch(WEATHER_URL);
+  if (!weatherRes.ok) throw upstreamError("Weather Shi Failed", weatherRes.status);
+
+  const data = await weatherRes.json();
+
+  const time = data.hourly.time;
+  const currentHour = data.current.time.slice(0, 13) + ":00";
+  const startIndex = time.indexOf(currentHour);
+
+  let safeStart = startIndex;
+  if (safeStart < 0) safeStart = 0;
+
+  const hourly = data.hourly.temperature_2m
+    .slice(safeStart)
+    .map((t, i) => ({
+      temp: Math.round(t),
+      prec: data.hourly.precipitation[safeStart + i],
+      visib: Math.round(data.hourly.visibility[safeStart + i]),
+      day: data.hourly.is_day[safeStart + i],
+      code: data.hourly.weather_code[safeStart + i],
+    }));
+
+  return {
+    startIndex: safeStart,
+    current: {
+      temp: Math.round(data.current.temperature_2m),
+      code: data.current.weather_code,
+      prec: data.current.precipitation,
+      rain: data.current.rain,
+      snow: data.current.snowfall,
+    },
+    hourly,
+  };
+}
+
 export default async function handler(req, res) {
   console.log("HIT", req.method, req.url);
 
   res.setHeader("Access-Control-Allow-Origin", "*");
   res.setHeader("Access-Control-Allow-Methods", "GET,OPTIONS");
-  res.setHeader("Access-Control-Allow-Headers", "Content-Type");
+  res.setHeader("Access-Control-Allow-Headers", "Content-Type, If-None-Match");
 
   if (req.method === "OPTIONS") {
     res.statusCode = 204;
@@ -29,8 +245,9 @@ export default async function handler(req, res) {
 
   const url = new URL(req.url, `http://${req.headers.host}`);
 
-  // comes from ?path=health | mta | weather
+  // comes from ?path=health | mta | weather | bundle
   const route = url.searchParams.get("path") || "";
+  const binary = url.searchParams.get("fmt") === "bin";
 
   if (route === "health") {
     res.statusCode = 200;
@@ -40,123 +257,75 @@ export default async function handler(req, res) {
 
   if (route === "mta") {
     try {
-      const mtaRes = await fetch(MTA_URL_N);
-
-      if (!mtaRes.ok) {
-        res.statusCode = 502;
-        res.setHeader("Content-Type", "application/json");
-        return res.end(
-          JSON.stringify({ Error: "MTA Shi Failed", status: mtaRes.status })
-        );
-      }
-
-      const mtaArrayBuffer = await mtaRes.arrayBuffer();
-      const mtaBuffer = Buffer.from(mtaArrayBuffer);
-      const mtaFeed =
-        GtfsRealtimeBindings.transit_realtime.FeedMessage.decode(mtaBuffer);
-
-      const northbound = [];
-      const southbound = [];
-      const timeNow = Math.floor(Date.now() / 1000);
-
-      for (const entity of mtaFeed.entity) {
-        if (!entity.tripUpdate) continue;
+      const { north, south } = await mtaArrivals();
 
-        const update = entity.tripUpdate.stopTimeUpdate;
-        if (!update) continue;
-
-        const tripId = entity.tripUpdate.trip.routeId;
-
-        for (const x of update) {
-          const stop = x.stopId;
-
-          let t;
-          if (x.arrival?.time != null) t = x.arrival.time;
-          else if (x.departure?.time != null) t = x.departure.time;
-          else continue;
-
-          const minutes = Math.round((t - timeNow) / 60);
-          if (minutes < 0) continue;
-
-          if (stop === northN) {
-            northbound.push({ minutes, train: tripId });
-          } else if (stop === southN) {
-            southbound.push({ minutes, train: tripId });
-          }
-        }
+      if (binary) {
+        const version = Number(url.searchParams.get("v")) || WIRE_VERSION;
+        return sendBin(req, res, encodeMtaBin(north, south, version));
       }
-
-      northbound.sort((a, b) => a.minutes - b.minutes);
-      southbound.sort((a, b) => a.minutes - b.minutes);
-
-      res.statusCode = 200;
-      res.setHeader("Content-Type", "application/json");
-      return res.end(
-        JSON.stringify({
-          north: northbound.slice(0, 5),
-          south: southbound.slice(0, 5),
-        })
-      );
+      return sendJson(req, res, arrivalsJson({ north, south }));
     } catch (ERR) {
-      res.statusCode = 500;
-      res.setHeader("Content-Type", "application/json");
-      return res.end(
-        JSON.stringify({ error: "MTA Proxy error", detail: String(ERR) })
-      );
+      if (ERR.status) return sendError(res, 502, { Error: ERR.message, status: ERR.status });
+      return sendError(res, 500, { error: "MTA Proxy error", detail: String(ERR) });
     }
   }
 
   if (route === "weather") {
     try {
-      const weatherRes = await fetch(WEATHER_URL);
-
-      if (!weatherRes.ok) {
-        res.statusCode = 502;
-        res.setHeader("Content-Type", "application/json");
-        return res.end(
-          JSON.stringify({ Error: "Weather Shi Failed", status: weatherRes.status })
-        );
-      }
+      const weather = await weatherForecast();
 
-      const data = await weatherRes.json();
-
-      const time = data.hourly.time;
-      const currentHour = data.current.time.slice(0, 13) + ":00";
-      const startIndex = time.indexOf(currentHour);
-
-      let safeStart = startIndex;
-      if (safeStart < 0) safeStart = 0;
-
-      res.statusCode = 200;
-      res.setHeader("Content-Type", "application/json");
-      return res.end(
-        JSON.stringify({
-          startIndex: safeStart,
-          current: {
-            temp: Math.round(data.current.temperature_2m),
-            code: data.current.weather_code,
-            prec: data.current.precipitation,
-            rain: data.current.rain,
-            snow: data.current.snowfall,
-          },
-          hourly: data.hourly.temperature_2m
-            .slice(safeStart)
-            .map((t, i) => ({
-              temp: Math.round(t),
-              prec: data.hourly.precipitation[safeStart + i],
-              visib: Math.round(data.hourly.visibility[safeStart + i]),
-              day: data.hourly.is_day[safeStart + i],
-              code: data.hourly.weather_code[safeStart + i],
-            })),
-        })
-      );
+      if (binary) return sendBin(req, res, encodeWeatherBin(weather.startIndex, weather.hourly));
+      return sendJson(req, res, weather);
     } catch (ERR) {
-      res.statusCode = 500;
-      res.setHeader("Content-Type", "application/json");
-      return res.end(
-        JSON.stringify({ error: "Weather Proxy error", detail: String(ERR) })
-      );
+      if (ERR.status) return sendError(res, 502, { Error: ERR.message, status: ERR.status });
+      return sendError(res, 500, { error: "Weather Proxy error", detail: String(ERR) });
+    }
+  }
+
+  // Both feeds in one response, so a refresh costs the device one request.
+  // The upstreams are fetched in parallel and each section carries the time
+  // its upstream answered. A section whose upstream failed is left out; the
+  // device then asks for that feed on its own. The ETag covers the data only,
+  // so unchanged arrivals and forecast still get a 304.
+  if (route === "bundle") {
+    const stamped = (p) => p.then((data) => ({ fetchedAt: nowSeconds(), data }));
+    const [mta, weather] = await Promise.allSettled([
+      stamped(mtaArrivals()),
+      stamped(weatherForecast()),
+    ]);
+    for (const [name, r] of [["mta", mta], ["weather", weather]]) {
+      if (r.status === "rejected") console.log("bundle:", name, "failed:", String(r.reason));
+    }
+    if (mta.status === "rejected" && weather.status === "rejected") {
+      return sendError(res, 502, { Error: "Bundle upstreams failed" });
+    }
+
+    if (binary) {
+      const version = Number(url.searchParams.get("v")) || WIRE_VERSION;
+      const sections = [];
+      if (mta.status === "fulfilled") {
+        const { fetchedAt, data } = mta.value;
+        sections.push({ kind: "M", fetchedAt, body: encodeMtaBin(data.north, data.south, version) });
+      }
+      if (weather.status === "fulfilled") {
+        const { fetchedAt, data } = weather.value;
+        sections.push({ kind: "W", fetchedAt, body: encodeWeatherBin(data.startIndex, data.hourly) });
+      }
+      const tagged = Buffer.concat(sections.map((s) => Buffer.concat([Buffer.from(s.kind), s.body])));
+      return sendBin(req, res, encodeBundleBin(sections), tagged);
+    }
+
+    const body = {};
+    const tagged = {};
+    if (mta.status === "fulfilled") {
+      tagged.mta = arrivalsJson(mta.value.data);
+      body.mta = { fetchedAt: mta.value.fetchedAt, ...tagged.mta };
+    }
+    if (weather.status === "fulfilled") {
+      body.weather = { fetchedAt: weather.value.fetchedAt, ...weather.value.data };
+      tagged.weather = weather.value.data;
     }
+    return sendJson(req, res, body, tagged);
   }
 
   res.statusCode = 404;